@@ -6,6 +6,10 @@
  *    - http://opensource.org/licenses/MIT
  */
 
+#include <mutex>
+
+#include "EverCrypt_DRBG.h"
+#include "EverCrypt_Random.h"
 #include "Hacl_HMAC_DRBG.h"
 
 #include "util.h"
@@ -55,4 +59,85 @@ BENCHMARK_CAPTURE(HACL_Drbg_complete, sha2_512, Spec_Hash_Definitions_SHA2_512)
 BENCHMARK_CAPTURE(HACL_Drbg_complete, sha1, Spec_Hash_Definitions_SHA1)
   ->Setup(DoSetup);
 
+// Bulk output: HMAC-DRBG with SHA2-256 against the ChaCha20 generator.
+static void
+EverCrypt_Drbg_generate(benchmark::State& state, bool chacha20)
+{
+  EverCrypt_DRBG_state_s* st =
+    chacha20 ? EverCrypt_DRBG_create_chacha20()
+             : EverCrypt_DRBG_create(Spec_Hash_Definitions_SHA2_256);
+  EverCrypt_DRBG_instantiate(st, NULL, 0);
+
+  bytes out(state.range(0));
+  for (auto _ : state) {
+    EverCrypt_DRBG_generate(out.data(), st, out.size(), NULL, 0);
+  }
+  state.SetBytesProcessed(state.iterations() * out.size());
+
+  EverCrypt_DRBG_uninstantiate(st);
+}
+
+BENCHMARK_CAPTURE(EverCrypt_Drbg_generate, sha2_256, false)
+  ->Setup(DoSetup)
+  ->RangeMultiplier(32)
+  ->Range(32, 65536);
+BENCHMARK_CAPTURE(EverCrypt_Drbg_generate, chacha20, true)
+  ->Setup(DoSetup)
+  ->RangeMultiplier(32)
+  ->Range(32, 1 << 20);
+
+// Nonce-sized requests from many threads: the OS directly, one shared
+// EverCrypt_DRBG state behind a lock, and the per-thread service.
+static const size_t nonce_len = 32;
+
+static void
+OS_random(benchmark::State& state)
+{
+  bytes out(nonce_len);
+  for (auto _ : state) {
+    Lib_RandomBuffer_System_crypto_random(out.data(), out.size());
+  }
+  state.SetBytesProcessed(state.iterations() * nonce_len);
+}
+
+BENCHMARK(OS_random)->Setup(DoSetup)->ThreadRange(1, 8)->UseRealTime();
+
+static std::mutex shared_drbg_lock;
+static EverCrypt_DRBG_state_s* shared_drbg = NULL;
+
+static void
+EverCrypt_DRBG_shared(benchmark::State& state)
+{
+  if (state.thread_index() == 0) {
+    shared_drbg = EverCrypt_DRBG_create(Spec_Hash_Definitions_SHA2_256);
+    EverCrypt_DRBG_instantiate(shared_drbg, NULL, 0);
+  }
+  bytes out(nonce_len);
+  for (auto _ : state) {
+    std::lock_guard<std::mutex> guard(shared_drbg_lock);
+    EverCrypt_DRBG_generate(out.data(), shared_drbg, out.size(), NULL, 0);
+  }
+  state.SetBytesProcessed(state.iterations() * nonce_len);
+  if (state.thread_index() == 0) {
+    EverCrypt_DRBG_uninstantiate(shared_drbg);
+  }
+}
+
+BENCHMARK(EverCrypt_DRBG_shared)
+  ->Setup(DoSetup)
+  ->ThreadRange(1, 8)
+  ->UseRealTime();
+
+static void
+EverCrypt_Random(benchmark::State& state)
+{
+  bytes out(nonce_len);
+  for (auto _ : state) {
+    hacl_random_bytes(out.data(), out.size());
+  }
+  state.SetBytesProcessed(state.iterations() * nonce_len);
+}
+
+BENCHMARK(EverCrypt_Random)->Setup(DoSetup)->ThreadRange(1, 8)->UseRealTime();
+
 BENCHMARK_MAIN();
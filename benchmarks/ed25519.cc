@@ -11,6 +11,7 @@
 #include "util.h"
 
 #define HACL_SIGNATURE_ED25519_SECRETKEY_PRECOMP_LEN 96
+#define HACL_SIGNATURE_ED25519_PUBLICKEY_PRECOMP_LEN 644
 
 static bytes sk = hex_to_bytes(
   "53b94cbed7c63839112f544f910227c31162d6c0701b790283219eba9247560a");
@@ -144,4 +145,24 @@ HACL_Ed25519_Sign_Precomputed(benchmark::State& state)
 
 BENCHMARK(HACL_Ed25519_Sign_Precomputed)->Setup(DoSetup);
 
+static void
+HACL_Ed25519_Verify_Precomputed(benchmark::State& state)
+{
+  bytes pk(32);
+  Hacl_Ed25519_secret_to_public(pk.data(), sk.data());
+
+  bytes sig(64);
+  Hacl_Ed25519_sign(sig.data(), sk.data(), msg.size(), msg.data());
+
+  vector<uint64_t> pk_expanded(HACL_SIGNATURE_ED25519_PUBLICKEY_PRECOMP_LEN);
+  Hacl_Ed25519_expand_public_key(pk_expanded.data(), pk.data());
+
+  for (auto _ : state) {
+    Hacl_Ed25519_verify_expanded(
+      pk_expanded.data(), msg.size(), msg.data(), sig.data());
+  }
+}
+
+BENCHMARK(HACL_Ed25519_Verify_Precomputed)->Setup(DoSetup);
+
 BENCHMARK_MAIN();
@@ -0,0 +1,90 @@
+/*
+ *    Copyright 2022 Cryspen Sarl
+ *
+ *    Licensed under the Apache License, Version 2.0 or MIT.
+ *    - http://www.apache.org/licenses/LICENSE-2.0
+ *    - http://opensource.org/licenses/MIT
+ */
+
+#include "EverCrypt_FFDHE.h"
+#include "Hacl_FFDHE.h"
+
+#include "util.h"
+
+// Key generation uses the fixed-base comb table of the group; the shared
+// secret is a variable-base exponentiation. Running the latter with the public
+// key 2 gives the cost of key generation without the comb.
+
+static void
+FFDHE_keygen(benchmark::State& state, Spec_FFDHE_ffdhe_alg a)
+{
+  uint32_t len = Hacl_FFDHE_ffdhe_len(a);
+  bytes sk(len), pk(len);
+  generate_random(sk.data(), len);
+  sk[0] = 0;
+  // Builds the cached context outside of the timed loop.
+  Hacl_FFDHE_ffdhe_secret_to_public(a, sk.data(), pk.data());
+
+  for (auto _ : state) {
+    Hacl_FFDHE_ffdhe_secret_to_public(a, sk.data(), pk.data());
+  }
+}
+
+// Same as FFDHE_keygen, on the AVX-512 IFMA table where the CPU has it.
+static void
+FFDHE_keygen_evercrypt(benchmark::State& state, Spec_FFDHE_ffdhe_alg a)
+{
+  uint32_t len = Hacl_FFDHE_ffdhe_len(a);
+  bytes sk(len), pk(len);
+  generate_random(sk.data(), len);
+  sk[0] = 0;
+  EverCrypt_FFDHE_secret_to_public(a, sk.data(), pk.data());
+
+  for (auto _ : state) {
+    EverCrypt_FFDHE_secret_to_public(a, sk.data(), pk.data());
+  }
+}
+
+static void
+FFDHE_keygen_generic(benchmark::State& state, Spec_FFDHE_ffdhe_alg a)
+{
+  uint32_t len = Hacl_FFDHE_ffdhe_len(a);
+  bytes sk(len), g(len, 0), pk(len);
+  generate_random(sk.data(), len);
+  sk[0] = 0;
+  g[len - 1] = 2;
+
+  for (auto _ : state) {
+    Hacl_FFDHE_ffdhe_shared_secret(a, sk.data(), g.data(), pk.data());
+  }
+}
+
+static void
+FFDHE_shared_secret(benchmark::State& state, Spec_FFDHE_ffdhe_alg a)
+{
+  uint32_t len = Hacl_FFDHE_ffdhe_len(a);
+  bytes sk1(len), sk2(len), pk2(len), ss(len);
+  generate_random(sk1.data(), len);
+  generate_random(sk2.data(), len);
+  sk1[0] = 0;
+  sk2[0] = 0;
+  Hacl_FFDHE_ffdhe_secret_to_public(a, sk2.data(), pk2.data());
+
+  for (auto _ : state) {
+    Hacl_FFDHE_ffdhe_shared_secret(a, sk1.data(), pk2.data(), ss.data());
+  }
+}
+
+#define FFDHE_BENCHMARKS(NAME, A)                                              \
+  BENCHMARK_CAPTURE(FFDHE_keygen, NAME, A)->Setup(DoSetup);                    \
+  BENCHMARK_CAPTURE(FFDHE_keygen_evercrypt, NAME, A)->Setup(DoSetup);          \
+  BENCHMARK_CAPTURE(FFDHE_keygen_generic, NAME, A)->Setup(DoSetup);            \
+  BENCHMARK_CAPTURE(FFDHE_shared_secret, NAME, A)->Setup(DoSetup);
+
+FFDHE_BENCHMARKS(ffdhe2048, Spec_FFDHE_FFDHE2048)
+FFDHE_BENCHMARKS(ffdhe3072, Spec_FFDHE_FFDHE3072)
+FFDHE_BENCHMARKS(ffdhe4096, Spec_FFDHE_FFDHE4096)
+FFDHE_BENCHMARKS(ffdhe6144, Spec_FFDHE_FFDHE6144)
+FFDHE_BENCHMARKS(ffdhe8192, Spec_FFDHE_FFDHE8192)
+
+BENCHMARK_MAIN();
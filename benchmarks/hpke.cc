@@ -0,0 +1,246 @@
+/*
+ *    Copyright 2022 Cryspen Sarl
+ *
+ *    Licensed under the Apache License, Version 2.0 or MIT.
+ *    - http://www.apache.org/licenses/LICENSE-2.0
+ *    - http://opensource.org/licenses/MIT
+ */
+
+#include "Hacl_Curve25519_51.h"
+#include "Hacl_HPKE_Curve51_CP32_SHA256.h"
+#include "Hacl_HPKE_P256_CP32_SHA256.h"
+#include "Hacl_P256.h"
+
+#include "util.h"
+
+#ifdef HACL_CAN_COMPILE_VEC256
+#include "Hacl_HPKE_Curve64_CP256_SHA256.h"
+#endif
+
+// The payload is encrypted once; every recipient adds a KEM, a key schedule
+// and a 48 byte wrapped key. The complexity coefficient reported by the
+// multi-recipient benchmarks is the cost of one extra recipient.
+static const size_t payload_len = 4096;
+
+typedef uint32_t (*seal_base_multi)(uint32_t,
+                                    uint8_t*,
+                                    uint8_t*,
+                                    uint32_t,
+                                    uint8_t*,
+                                    uint32_t,
+                                    uint8_t*,
+                                    uint32_t,
+                                    uint8_t*,
+                                    uint8_t*,
+                                    uint8_t*,
+                                    uint8_t*,
+                                    uint8_t*);
+
+static void
+x25519_recipients(uint32_t n, bytes& skE, bytes& pkR)
+{
+  skE = bytes(32 * n);
+  pkR = bytes(32 * n);
+  bytes skR(32 * n);
+  generate_random(skE.data(), skE.size());
+  generate_random(skR.data(), skR.size());
+  for (uint32_t i = 0; i < n; i++) {
+    Hacl_Curve25519_51_secret_to_public(&pkR[32 * i], &skR[32 * i]);
+  }
+}
+
+// Baseline: one single-shot HPKE message per recipient.
+static void
+HACL_HPKE_Curve51_sealBase_each(benchmark::State& state)
+{
+  uint32_t n = static_cast<uint32_t>(state.range(0));
+  bytes skE, pkR;
+  x25519_recipients(n, skE, pkR);
+  bytes plain(payload_len, 0x61);
+  bytes enc(32), ct(payload_len + 16);
+
+  for (auto _ : state) {
+    for (uint32_t i = 0; i < n; i++) {
+      if (Hacl_HPKE_Curve51_CP32_SHA256_sealBase(&skE[32 * i],
+                                                 &pkR[32 * i],
+                                                 0,
+                                                 NULL,
+                                                 0,
+                                                 NULL,
+                                                 plain.size(),
+                                                 plain.data(),
+                                                 enc.data(),
+                                                 ct.data()) != 0) {
+        state.SkipWithError("Error in HPKE sealBase");
+        break;
+      }
+    }
+  }
+  state.SetItemsProcessed(n * state.iterations());
+  state.SetComplexityN(n);
+}
+
+BENCHMARK(HACL_HPKE_Curve51_sealBase_each)
+  ->Setup(DoSetup)
+  ->RangeMultiplier(4)
+  ->Range(1, 64)
+  ->Complexity(benchmark::oN);
+
+static void
+x25519_sealBaseMulti(benchmark::State& state, seal_base_multi seal)
+{
+  uint32_t n = static_cast<uint32_t>(state.range(0));
+  bytes skE, pkR;
+  x25519_recipients(n, skE, pkR);
+  bytes plain(payload_len, 0x61), dek(32);
+  generate_random(dek.data(), dek.size());
+  bytes enc(32 * n), wrapped(48 * n), ct(payload_len + 16);
+
+  for (auto _ : state) {
+    if (seal(n,
+             skE.data(),
+             pkR.data(),
+             0,
+             NULL,
+             0,
+             NULL,
+             plain.size(),
+             plain.data(),
+             dek.data(),
+             enc.data(),
+             wrapped.data(),
+             ct.data()) != 0) {
+      state.SkipWithError("Error in HPKE sealBaseMulti");
+      break;
+    }
+  }
+  state.SetItemsProcessed(n * state.iterations());
+  state.SetComplexityN(n);
+}
+
+static void
+HACL_HPKE_Curve51_sealBaseMulti(benchmark::State& state)
+{
+  x25519_sealBaseMulti(state, Hacl_HPKE_Curve51_CP32_SHA256_sealBaseMulti);
+}
+
+BENCHMARK(HACL_HPKE_Curve51_sealBaseMulti)
+  ->Setup(DoSetup)
+  ->RangeMultiplier(4)
+  ->Range(1, 64)
+  ->Complexity(benchmark::oN);
+
+#ifdef HACL_CAN_COMPILE_VEC256
+static void
+HACL_HPKE_Curve64_CP256_sealBaseMulti(benchmark::State& state)
+{
+  if (!vec256_support()) {
+    state.SkipWithError("No vec256 support");
+    return;
+  }
+  x25519_sealBaseMulti(state, Hacl_HPKE_Curve64_CP256_SHA256_sealBaseMulti);
+}
+
+BENCHMARK(HACL_HPKE_Curve64_CP256_sealBaseMulti)
+  ->Setup(DoSetup)
+  ->RangeMultiplier(4)
+  ->Range(1, 64)
+  ->Complexity(benchmark::oN);
+#endif
+
+static void
+HACL_HPKE_P256_sealBaseMulti(benchmark::State& state)
+{
+  uint32_t n = static_cast<uint32_t>(state.range(0));
+  bytes skE(32 * n, 0x11), skR(32 * n, 0x22), pkR(64 * n);
+  for (uint32_t i = 0; i < n; i++) {
+    skE[32 * i] = (uint8_t)i;
+    skR[32 * i] = (uint8_t)i;
+    Hacl_P256_dh_initiator(&pkR[64 * i], &skR[32 * i]);
+  }
+  bytes plain(payload_len, 0x61), dek(32);
+  generate_random(dek.data(), dek.size());
+  bytes enc(65 * n), wrapped(48 * n), ct(payload_len + 16);
+
+  for (auto _ : state) {
+    if (Hacl_HPKE_P256_CP32_SHA256_sealBaseMulti(n,
+                                                 skE.data(),
+                                                 pkR.data(),
+                                                 0,
+                                                 NULL,
+                                                 0,
+                                                 NULL,
+                                                 plain.size(),
+                                                 plain.data(),
+                                                 dek.data(),
+                                                 enc.data(),
+                                                 wrapped.data(),
+                                                 ct.data()) != 0) {
+      state.SkipWithError("Error in HPKE sealBaseMulti");
+      break;
+    }
+  }
+  state.SetItemsProcessed(n * state.iterations());
+  state.SetComplexityN(n);
+}
+
+BENCHMARK(HACL_HPKE_P256_sealBaseMulti)
+  ->Setup(DoSetup)
+  ->RangeMultiplier(4)
+  ->Range(1, 16)
+  ->Complexity(benchmark::oN);
+
+// Decapsulation with and without a cached receiver key.
+static void
+HACL_HPKE_Curve51_setupBaseR(benchmark::State& state)
+{
+  bytes skE, pkR, skR(32);
+  x25519_recipients(1, skE, pkR);
+  generate_random(skR.data(), skR.size());
+  Hacl_Curve25519_51_secret_to_public(pkR.data(), skR.data());
+  bytes enc(32);
+  Hacl_Impl_HPKE_context_s ctx = Hacl_HPKE_Curve51_CP32_SHA256_context_malloc();
+  Hacl_HPKE_Curve51_CP32_SHA256_setupBaseS(
+    enc.data(), ctx, skE.data(), pkR.data(), 0, NULL);
+
+  for (auto _ : state) {
+    if (Hacl_HPKE_Curve51_CP32_SHA256_setupBaseR(
+          ctx, enc.data(), skR.data(), 0, NULL) != 0) {
+      state.SkipWithError("Error in HPKE setupBaseR");
+      break;
+    }
+  }
+  Hacl_HPKE_Curve51_CP32_SHA256_context_free(ctx);
+}
+
+BENCHMARK(HACL_HPKE_Curve51_setupBaseR)->Setup(DoSetup);
+
+static void
+HACL_HPKE_Curve51_setupBaseR_key(benchmark::State& state)
+{
+  bytes skE, pkR, skR(32);
+  x25519_recipients(1, skE, pkR);
+  generate_random(skR.data(), skR.size());
+  Hacl_Curve25519_51_secret_to_public(pkR.data(), skR.data());
+  bytes enc(32);
+  Hacl_Impl_HPKE_context_s ctx = Hacl_HPKE_Curve51_CP32_SHA256_context_malloc();
+  Hacl_HPKE_Curve51_CP32_SHA256_setupBaseS(
+    enc.data(), ctx, skE.data(), pkR.data(), 0, NULL);
+  Hacl_Impl_HPKE_receiver_key_s key =
+    Hacl_HPKE_Curve51_CP32_SHA256_receiver_key_malloc();
+  Hacl_HPKE_Curve51_CP32_SHA256_receiver_key_init(key, skR.data());
+
+  for (auto _ : state) {
+    if (Hacl_HPKE_Curve51_CP32_SHA256_setupBaseR_key(
+          ctx, key, enc.data(), 0, NULL) != 0) {
+      state.SkipWithError("Error in HPKE setupBaseR_key");
+      break;
+    }
+  }
+  Hacl_HPKE_Curve51_CP32_SHA256_receiver_key_free(key);
+  Hacl_HPKE_Curve51_CP32_SHA256_context_free(ctx);
+}
+
+BENCHMARK(HACL_HPKE_Curve51_setupBaseR_key)->Setup(DoSetup);
+
+BENCHMARK_MAIN();
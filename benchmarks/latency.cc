@@ -0,0 +1,147 @@
+/*
+ *    Copyright 2022 Cryspen Sarl
+ *
+ *    Licensed under the Apache License, Version 2.0 or MIT.
+ *    - http://www.apache.org/licenses/LICENSE-2.0
+ *    - http://opensource.org/licenses/MIT
+ */
+
+// Latency distribution of the signing functions. Every iteration is timed in
+// cycles (see `latency_recorder` in util.h); the counters are the p50, p99
+// and p999 latency, the coefficient of variation `cv`, and the Welch
+// statistic `t` between fixed and random inputs, which is reported on stderr
+// when it exceeds 4.5. The iteration counts are fixed so that p999 rests on
+// enough samples; run with --benchmark_repetitions for stable tails.
+
+#include "Hacl_Ed25519.h"
+#include "Hacl_P256.h"
+#include "Hacl_RSAPSS.h"
+
+#include "util.h"
+
+// Random inputs are drawn from a pool, filled before timing starts; the fixed
+// class reads copies of one input from a pool of the same shape, so that both
+// classes touch the same amount of memory.
+static const size_t pool_size = 64;
+
+typedef struct
+{
+  vector<bytes> inputs[2];
+  bytes order;
+} input_pool;
+
+static input_pool
+make_pool(size_t len, const bytes& fixed, size_t iterations)
+{
+  input_pool p;
+  for (size_t i = 0; i < pool_size; i++) {
+    bytes r(len);
+    generate_random(r.data(), (uint32_t)len);
+    p.inputs[0].push_back(fixed);
+    p.inputs[1].push_back(r);
+  }
+  p.order = bytes(iterations);
+  generate_random(p.order.data(), (uint32_t)iterations);
+  for (auto& c : p.order) {
+    c &= 1;
+  }
+  return p;
+}
+
+// Runs the benchmark loop, handing `op` the input for the current iteration.
+template<typename F>
+static void
+latency_loop(benchmark::State& state,
+             const char* name,
+             size_t len,
+             const bytes& fixed,
+             F op)
+{
+  input_pool p = make_pool(len, fixed, (size_t)state.max_iterations);
+  latency_recorder rec;
+  size_t i = 0;
+  for (auto _ : state) {
+    int c = p.order[i];
+    uint8_t* input = p.inputs[c][i % pool_size].data();
+    rec.record(c, [&]() { op(input); });
+    i++;
+  }
+  rec.report(state, name);
+}
+
+static bytes msg = from_hex("CAFECAFECAFECAFE");
+
+// The secret key varies.
+static void
+HACL_Ed25519_sign_latency(benchmark::State& state)
+{
+  bytes sk = from_hex(
+    "53b94cbed7c63839112f544f910227c31162d6c0701b790283219eba9247560a");
+  bytes signature(64);
+  latency_loop(
+    state, "HACL_Ed25519_sign_latency", 32, sk, [&](uint8_t* key) {
+      Hacl_Ed25519_sign(signature.data(), key, msg.size(), msg.data());
+    });
+}
+
+BENCHMARK(HACL_Ed25519_sign_latency)->Setup(DoSetup)->Iterations(20000);
+
+// The private key and the nonce vary. A random scalar is out of range with
+// probability 2^-32, in which case signing fails early; this is too rare to
+// show in the statistics.
+static void
+HACL_P256_ecdsa_sign_latency(benchmark::State& state)
+{
+  bytes fixed = from_hex(
+    "a3e290cddf3d24be55622be07645551510cd70ecca0fc86ae6bc6f48ac2688e1"
+    "AAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAAA");
+  bytes signature(64);
+  latency_loop(
+    state, "HACL_P256_ecdsa_sign_latency", 64, fixed, [&](uint8_t* keys) {
+      Hacl_P256_ecdsa_sign_p256_sha2(
+        signature.data(), msg.size(), msg.data(), keys, keys + 32);
+    });
+}
+
+BENCHMARK(HACL_P256_ecdsa_sign_latency)->Setup(DoSetup)->Iterations(20000);
+
+// Loading an RSA key is too slow to do per iteration: the key is fixed and
+// the message varies, which changes the value that goes through the modular
+// exponentiation with the secret exponent.
+static void
+HACL_RSAPSS_sign_latency(benchmark::State& state)
+{
+  uint8_t* e;
+  uint32_t eBits;
+  uint8_t* d;
+  uint32_t dBits;
+  uint8_t* mod;
+  uint32_t modBits;
+  generate_rsapss_key(&e, &eBits, &d, &dBits, &mod, &modBits);
+  uint64_t* skey =
+    Hacl_RSAPSS_new_rsapss_load_skey(modBits, eBits, dBits, mod, e, d);
+  bytes salt(32), sgnt(modBits / 8);
+
+  latency_loop(
+    state, "HACL_RSAPSS_sign_latency", 32, bytes(32, 0x5c), [&](uint8_t* m) {
+      Hacl_RSAPSS_rsapss_sign(Spec_Hash_Definitions_SHA2_256,
+                              modBits,
+                              eBits,
+                              dBits,
+                              skey,
+                              (uint32_t)salt.size(),
+                              salt.data(),
+                              32,
+                              m,
+                              sgnt.data());
+    });
+
+  free(skey);
+  free(mod);
+  free(d);
+  free(e);
+}
+
+BENCHMARK(HACL_RSAPSS_sign_latency)->Setup(DoSetup)->Iterations(2000);
+
+BENCHMARK_MAIN();
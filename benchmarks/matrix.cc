@@ -0,0 +1,1007 @@
+/*
+ *    Copyright 2022 Cryspen Sarl
+ *
+ *    Licensed under the Apache License, Version 2.0 or MIT.
+ *    - http://www.apache.org/licenses/LICENSE-2.0
+ *    - http://opensource.org/licenses/MIT
+ */
+
+// Head-to-head comparison with OpenSSL and libsodium.
+//
+// Every primitive that another library implements as well is benchmarked
+// once per library, with the same keys, nonces and messages. Benchmarks are
+// named `<primitive>/<library>` or, for hashes, MACs and AEADs,
+// `<primitive>/<library>/<size>`. Outputs of deterministic operations are
+// checked against HACL before timing, so that a mismatch (i.e., the two
+// libraries don't do the same thing) fails the benchmark instead of
+// producing a number. `mach benchmark --matrix` turns the results into one
+// table.
+//
+// OpenSSL is left out with `--no-openssl`; libsodium is only built with
+// `--libsodium`. Neither implements everything: missing cells are empty.
+
+#include <functional>
+
+#include "EverCrypt_AEAD.h"
+#include "EverCrypt_Chacha20Poly1305.h"
+#include "EverCrypt_Curve25519.h"
+#include "EverCrypt_HKDF.h"
+#include "EverCrypt_HMAC.h"
+#include "EverCrypt_Hash.h"
+#include "Hacl_Ed25519.h"
+#include "Hacl_K256_ECDSA.h"
+#include "Hacl_P256.h"
+#include "Hacl_RSAPSS.h"
+
+#include "util.h"
+
+#ifndef NO_OPENSSL
+#include <openssl/core_names.h>
+#include <openssl/hmac.h>
+#include <openssl/kdf.h>
+#include <openssl/param_build.h>
+#include <openssl/rsa.h>
+#endif
+
+#ifdef LIBSODIUM
+#include <sodium.h>
+#endif
+
+typedef enum
+{
+  // Fixed-size output (hashes, MACs).
+  DIGEST,
+  // Ciphertext followed by the tag.
+  AEAD,
+  // Fixed inputs, e.g. signatures and key exchange.
+  OPERATION
+} kind;
+
+typedef enum
+{
+  PORTABLE,
+  VALE_AES,
+  SODIUM_AES
+} requirement;
+
+// Returns false if the library reported an error.
+typedef std::function<bool(uint8_t* out, uint8_t* in, uint32_t len)> kernel_fn;
+
+typedef struct
+{
+  string primitive;
+  string library;
+  kind k;
+  requirement req;
+  // Bytes of output that must match HACL (plus `len` for AEADs); 0 for
+  // randomized operations.
+  size_t out_len;
+  kernel_fn run;
+} kernel;
+
+static const vector<int64_t> sizes = { 64, 1024, 16384 };
+
+// Room after the output for digests, tags and signatures.
+static const size_t out_slack = 512;
+
+static bytes key(32, 0x11);
+static bytes nonce(12, 0x22);
+static bytes salt(32, 0x33);
+static bytes info(32, 0x44);
+static bytes msg(32, 0x55);
+
+// Key material, shared by all libraries. Signatures to verify are made by
+// HACL in `setup_keys`.
+static bytes x25519_sk(32), x25519_pk(32), x25519_peer_sk(32),
+  x25519_peer_pk(32);
+static bytes ed25519_sk = from_hex(
+  "53b94cbed7c63839112f544f910227c31162d6c0701b790283219eba9247560a");
+static bytes ed25519_pk(32), ed25519_sig(64);
+static bytes p256_sk = from_hex(
+  "f6bbfeced354cfcd0fb7e647f3dca33116b1287b07d6a2dcc6d545248e4a6489");
+static bytes p256_peer_sk = from_hex(
+  "0612465c89a023ab17855b0a6bcebfd3febb53aef84138647b5352e02c10c346");
+static bytes p256_pk(64), p256_peer_pk(64), p256_sig(64);
+static bytes k256_sk = from_hex(
+  "a32aa1699dcaf84c231dc805981942aa8793b4256d6a21de3e78c9036d39cc1f");
+static bytes k256_pk(64), k256_sig(64);
+// HACL's ECDSA takes the nonce as an argument; OpenSSL draws a fresh one for
+// every signature, which is part of its cost.
+static bytes ecdsa_nonce(32, 'A');
+static bytes rsa_e, rsa_d, rsa_n, rsa_sig;
+static uint64_t *rsa_skey, *rsa_pkey;
+// The CRT parameters of the key from `generate_rsapss_key`. HACL doesn't
+// implement the CRT; OpenSSL signs with it whenever they are loaded.
+static bytes rsa_p = from_hex(
+  "eda55740c2a3e0149636fa9d06fd243344eb111119b15cdcba3ea5dcd23b8cd1"
+  "060d37ce0f415ae5d525e793a4c52e07eee141bed58506dd2036d4d28522148a"
+  "9579933a8ed4c21a5777ea1b840a2280f3813dff99f8560ceade159eeb9c98d4"
+  "63152d8d2716678135fe6685d866d105c16284bf77345746fd29fc9ca6f2d2ed");
+static bytes rsa_q = from_hex(
+  "c9e04ade5a57bb70e727a2b8f3698efdd5d925ade0e2c8eed6a69175ec1bcefc"
+  "75335122db7f74c82f0f408aee933a92b9e322644b4759d5ade7b5aa8ff676fe"
+  "0a263985afc1520fd2cdaca0287b9badbece1627b150a772de49b6ff0b31ae54"
+  "9117632843e09f57744892b735fe330024bd7e23b8fbb9e7dc3b8a5d195624e3");
+static bytes rsa_dp = from_hex(
+  "bd3e86ae2691d396f14c54e489353b07ace13895128dc032720a039146c56f4c"
+  "e0f1d3b7bf443f3b7932972866f532c3d482031611f8be4f8720c2f7e6570e5e"
+  "91cbdfe7a8e85aae196b7fbd6bb79a64700542b6f208e595a1cf3b0e73f81f68"
+  "3a8319e426f55b7574e6e303c12197606af0a65fc670a2f40014d87a732439bd");
+static bytes rsa_dq = from_hex(
+  "be93d47a16d58de966ff1ef9f528e8c9af114125e610925a0f1fce6081963b10"
+  "4fe0332f7201e0107f84a98cbeef14b3a172d06bd8393290ab8cfc0e59bbf5d7"
+  "9b633c987d3446b11374010c6d4b4bcb793e7ae1dbdde546669d36798d6ac845"
+  "a3776daf7c6cd8602a31bcf7e2abe81fb18f863e590aa31544ee9c8f8934aebb");
+static bytes rsa_qinv = from_hex(
+  "53e0683106b4e3589c78feb0b8a7246a312b3a8cb977f38bc02d4a847be43c42"
+  "c4ec09a967010d69435be097ecbee9350a43304dfeba194364c76f826d89c943"
+  "ca58bd8ad933338be87aaed1efe46eb95547701945f98e936bc36683acd679cb"
+  "27483f07074b1dda8fc0c6e73d21f6f133ef97bccc964d3c4ef492e3b6db890b");
+
+static void
+setup_keys()
+{
+  crypto_box_keypair_alice(x25519_sk.data(), x25519_pk.data());
+  crypto_box_keypair_bob(x25519_peer_sk.data(), x25519_peer_pk.data());
+
+  Hacl_Ed25519_secret_to_public(ed25519_pk.data(), ed25519_sk.data());
+  Hacl_Ed25519_sign(ed25519_sig.data(), ed25519_sk.data(), 32, msg.data());
+
+  Hacl_P256_dh_initiator(p256_pk.data(), p256_sk.data());
+  Hacl_P256_dh_initiator(p256_peer_pk.data(), p256_peer_sk.data());
+  Hacl_P256_ecdsa_sign_p256_sha2(
+    p256_sig.data(), 32, msg.data(), p256_sk.data(), ecdsa_nonce.data());
+
+  Hacl_K256_ECDSA_secret_to_public(k256_pk.data(), k256_sk.data());
+  Hacl_K256_ECDSA_ecdsa_sign_sha256(
+    k256_sig.data(), 32, msg.data(), k256_sk.data(), ecdsa_nonce.data());
+
+  uint8_t *e, *d, *n;
+  uint32_t eBits, dBits, nBits;
+  generate_rsapss_key(&e, &eBits, &d, &dBits, &n, &nBits);
+  rsa_e = bytes(e, e + eBits / 8);
+  rsa_d = bytes(d, d + dBits / 8);
+  rsa_n = bytes(n, n + nBits / 8);
+  free(n);
+  free(d);
+  free(e);
+  rsa_skey = Hacl_RSAPSS_new_rsapss_load_skey(nBits,
+                                              eBits,
+                                              dBits,
+                                              rsa_n.data(),
+                                              rsa_e.data(),
+                                              rsa_d.data());
+  rsa_pkey =
+    Hacl_RSAPSS_new_rsapss_load_pkey(nBits, eBits, rsa_n.data(), rsa_e.data());
+  rsa_sig = bytes(nBits / 8);
+  Hacl_RSAPSS_rsapss_sign(Spec_Hash_Definitions_SHA2_256,
+                          nBits,
+                          eBits,
+                          dBits,
+                          rsa_skey,
+                          32,
+                          salt.data(),
+                          32,
+                          msg.data(),
+                          rsa_sig.data());
+}
+
+static EverCrypt_AEAD_state_s*
+aead_state(Spec_Agile_AEAD_alg alg)
+{
+  EverCrypt_AEAD_state_s* s = NULL;
+  if (EverCrypt_AEAD_create_in(alg, &s, key.data()) != EverCrypt_Error_Success) {
+    return NULL;
+  }
+  return s;
+}
+
+static bool
+supported(requirement req)
+{
+  switch (req) {
+    case VALE_AES: {
+      EverCrypt_AEAD_state_s* s = aead_state(Spec_Agile_AEAD_AES128_GCM);
+      if (s == NULL) {
+        return false;
+      }
+      EverCrypt_AEAD_free(s);
+      return true;
+    }
+    case SODIUM_AES:
+#ifdef LIBSODIUM
+      return crypto_aead_aes256gcm_is_available() == 1;
+#else
+      return false;
+#endif
+    default:
+      return true;
+  }
+}
+
+static size_t
+output_len(const kernel& k, uint32_t len)
+{
+  return k.k == AEAD ? len + k.out_len : k.out_len;
+}
+
+static void
+compare(benchmark::State& state, const kernel& k, const kernel* reference)
+{
+  if (!supported(k.req) || (reference != NULL && !supported(reference->req))) {
+    state.SkipWithError("Unsupported on this CPU");
+    return;
+  }
+  uint32_t len =
+    k.k == OPERATION ? (uint32_t)msg.size() : (uint32_t)state.range(0);
+  bytes in(len, 0x37), out(len + out_slack), expected(len + out_slack);
+  if (k.k == OPERATION) {
+    in = msg;
+  }
+
+  if (!k.run(out.data(), in.data(), len)) {
+    state.SkipWithError("Operation failed");
+    return;
+  }
+  size_t n = output_len(k, len);
+  if (reference != NULL && n > 0) {
+    reference->run(expected.data(), in.data(), len);
+    if (!equal(out.begin(), out.begin() + n, expected.begin())) {
+      state.SkipWithError("Output differs from HACL");
+      return;
+    }
+  }
+
+  bool ok = true;
+  for (auto _ : state) {
+    ok &= k.run(out.data(), in.data(), len);
+    benchmark::ClobberMemory();
+  }
+  if (!ok) {
+    state.SkipWithError("Operation failed");
+    return;
+  }
+  if (k.k != OPERATION) {
+    state.SetBytesProcessed(state.iterations() * (int64_t)len);
+  }
+}
+
+// HACL
+
+static kernel_fn
+hacl_hash(Spec_Hash_Definitions_hash_alg alg)
+{
+  return [alg](uint8_t* out, uint8_t* in, uint32_t len) {
+    EverCrypt_Hash_Incremental_hash(alg, out, in, len);
+    return true;
+  };
+}
+
+static kernel_fn
+hacl_hmac(Spec_Hash_Definitions_hash_alg alg)
+{
+  return [alg](uint8_t* out, uint8_t* in, uint32_t len) {
+    EverCrypt_HMAC_compute(alg, out, key.data(), 32, in, len);
+    return true;
+  };
+}
+
+static kernel_fn
+hacl_aead(Spec_Agile_AEAD_alg alg)
+{
+  EverCrypt_AEAD_state_s* s = aead_state(alg);
+  return [s](uint8_t* out, uint8_t* in, uint32_t len) {
+    return EverCrypt_AEAD_encrypt(
+             s, nonce.data(), 12, NULL, 0, in, len, out, out + len) ==
+           EverCrypt_Error_Success;
+  };
+}
+
+static vector<kernel>
+hacl_kernels()
+{
+  uint32_t nBits = (uint32_t)rsa_n.size() * 8;
+  uint32_t eBits = (uint32_t)rsa_e.size() * 8;
+  uint32_t dBits = (uint32_t)rsa_d.size() * 8;
+  kernel_fn rsa_sign = [=](uint8_t* out, uint8_t* in, uint32_t len) {
+    return Hacl_RSAPSS_rsapss_sign(Spec_Hash_Definitions_SHA2_256,
+                                   nBits,
+                                   eBits,
+                                   dBits,
+                                   rsa_skey,
+                                   32,
+                                   salt.data(),
+                                   len,
+                                   in,
+                                   out);
+  };
+  return {
+    { "sha2_256",
+      "hacl",
+      DIGEST,
+      PORTABLE,
+      32,
+      hacl_hash(Spec_Hash_Definitions_SHA2_256) },
+    { "sha2_512",
+      "hacl",
+      DIGEST,
+      PORTABLE,
+      64,
+      hacl_hash(Spec_Hash_Definitions_SHA2_512) },
+    { "sha3_256",
+      "hacl",
+      DIGEST,
+      PORTABLE,
+      32,
+      hacl_hash(Spec_Hash_Definitions_SHA3_256) },
+    { "blake2b",
+      "hacl",
+      DIGEST,
+      PORTABLE,
+      64,
+      hacl_hash(Spec_Hash_Definitions_Blake2B) },
+    { "blake2s",
+      "hacl",
+      DIGEST,
+      PORTABLE,
+      32,
+      hacl_hash(Spec_Hash_Definitions_Blake2S) },
+    { "hmac_sha2_256",
+      "hacl",
+      DIGEST,
+      PORTABLE,
+      32,
+      hacl_hmac(Spec_Hash_Definitions_SHA2_256) },
+    { "hmac_sha2_512",
+      "hacl",
+      DIGEST,
+      PORTABLE,
+      64,
+      hacl_hmac(Spec_Hash_Definitions_SHA2_512) },
+    { "chacha20poly1305",
+      "hacl",
+      AEAD,
+      PORTABLE,
+      16,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        EverCrypt_Chacha20Poly1305_aead_encrypt(
+          key.data(), nonce.data(), 0, NULL, len, in, out, out + len);
+        return true;
+      } },
+    { "aes128_gcm",
+      "hacl",
+      AEAD,
+      VALE_AES,
+      16,
+      hacl_aead(Spec_Agile_AEAD_AES128_GCM) },
+    { "aes256_gcm",
+      "hacl",
+      AEAD,
+      VALE_AES,
+      16,
+      hacl_aead(Spec_Agile_AEAD_AES256_GCM) },
+    { "hkdf_sha2_256",
+      "hacl",
+      OPERATION,
+      PORTABLE,
+      32,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        uint8_t prk[32];
+        EverCrypt_HKDF_extract(
+          Spec_Hash_Definitions_SHA2_256, prk, salt.data(), 32, in, len);
+        EverCrypt_HKDF_expand(
+          Spec_Hash_Definitions_SHA2_256, out, prk, 32, info.data(), 32, 32);
+        return true;
+      } },
+    { "x25519",
+      "hacl",
+      OPERATION,
+      PORTABLE,
+      32,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        EverCrypt_Curve25519_scalarmult(
+          out, x25519_sk.data(), x25519_peer_pk.data());
+        return true;
+      } },
+    { "ed25519_sign",
+      "hacl",
+      OPERATION,
+      PORTABLE,
+      64,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_Ed25519_sign(out, ed25519_sk.data(), len, in);
+        return true;
+      } },
+    { "ed25519_verify",
+      "hacl",
+      OPERATION,
+      PORTABLE,
+      0,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        return Hacl_Ed25519_verify(
+          ed25519_pk.data(), len, in, ed25519_sig.data());
+      } },
+    { "p256_ecdsa_sign",
+      "hacl",
+      OPERATION,
+      PORTABLE,
+      0,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        return Hacl_P256_ecdsa_sign_p256_sha2(
+          out, len, in, p256_sk.data(), ecdsa_nonce.data());
+      } },
+    { "p256_ecdsa_verify",
+      "hacl",
+      OPERATION,
+      PORTABLE,
+      0,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        return Hacl_P256_ecdsa_verif_p256_sha2(
+          len, in, p256_pk.data(), p256_sig.data(), p256_sig.data() + 32);
+      } },
+    { "p256_ecdh",
+      "hacl",
+      OPERATION,
+      PORTABLE,
+      32,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        return Hacl_P256_dh_responder(
+          out, p256_peer_pk.data(), p256_sk.data());
+      } },
+    { "secp256k1_ecdsa_sign",
+      "hacl",
+      OPERATION,
+      PORTABLE,
+      0,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        return Hacl_K256_ECDSA_ecdsa_sign_sha256(
+          out, len, in, k256_sk.data(), ecdsa_nonce.data());
+      } },
+    { "secp256k1_ecdsa_verify",
+      "hacl",
+      OPERATION,
+      PORTABLE,
+      0,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        return Hacl_K256_ECDSA_ecdsa_verify_sha256(
+          len, in, k256_pk.data(), k256_sig.data());
+      } },
+    // HACL only signs without the CRT, so the same kernel is the reference
+    // for both rows.
+    { "rsa2048_pss_sign_crt", "hacl", OPERATION, PORTABLE, 0, rsa_sign },
+    { "rsa2048_pss_sign_no_crt", "hacl", OPERATION, PORTABLE, 0, rsa_sign },
+    { "rsa2048_pss_verify",
+      "hacl",
+      OPERATION,
+      PORTABLE,
+      0,
+      [=](uint8_t* out, uint8_t* in, uint32_t len) {
+        return Hacl_RSAPSS_rsapss_verify(Spec_Hash_Definitions_SHA2_256,
+                                         nBits,
+                                         eBits,
+                                         rsa_pkey,
+                                         32,
+                                         (uint32_t)rsa_sig.size(),
+                                         rsa_sig.data(),
+                                         len,
+                                         in);
+      } },
+  };
+}
+
+// OpenSSL
+
+#ifndef NO_OPENSSL
+static kernel_fn
+openssl_hash(const EVP_MD* md)
+{
+  return [md](uint8_t* out, uint8_t* in, uint32_t len) {
+    return EVP_Digest(in, len, out, NULL, md, NULL) == 1;
+  };
+}
+
+static kernel_fn
+openssl_hmac(const EVP_MD* md)
+{
+  return [md](uint8_t* out, uint8_t* in, uint32_t len) {
+    return HMAC(md, key.data(), 32, in, len, out, NULL) != NULL;
+  };
+}
+
+// The key is set up once; every message gets its own nonce.
+static kernel_fn
+openssl_aead(const EVP_CIPHER* cipher)
+{
+  EVP_CIPHER_CTX* ctx = EVP_CIPHER_CTX_new();
+  EVP_EncryptInit_ex(ctx, cipher, NULL, key.data(), NULL);
+  return [ctx](uint8_t* out, uint8_t* in, uint32_t len) {
+    int l = 0, f = 0;
+    return EVP_EncryptInit_ex(ctx, NULL, NULL, NULL, nonce.data()) == 1 &&
+           EVP_EncryptUpdate(ctx, out, &l, in, (int)len) == 1 &&
+           EVP_EncryptFinal_ex(ctx, out + l, &f) == 1 &&
+           EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_AEAD_GET_TAG, 16, out + len) == 1;
+  };
+}
+
+static kernel_fn
+openssl_hkdf()
+{
+  EVP_KDF* kdf = EVP_KDF_fetch(NULL, "HKDF", NULL);
+  EVP_KDF_CTX* ctx = EVP_KDF_CTX_new(kdf);
+  EVP_KDF_free(kdf);
+  return [ctx](uint8_t* out, uint8_t* in, uint32_t len) {
+    OSSL_PARAM params[] = {
+      OSSL_PARAM_construct_utf8_string(
+        OSSL_KDF_PARAM_DIGEST, (char*)"SHA256", 0),
+      OSSL_PARAM_construct_octet_string(OSSL_KDF_PARAM_KEY, in, len),
+      OSSL_PARAM_construct_octet_string(
+        OSSL_KDF_PARAM_SALT, salt.data(), salt.size()),
+      OSSL_PARAM_construct_octet_string(
+        OSSL_KDF_PARAM_INFO, info.data(), info.size()),
+      OSSL_PARAM_construct_end()
+    };
+    return EVP_KDF_derive(ctx, out, 32, params) == 1;
+  };
+}
+
+// Takes ownership of `bld`.
+static EVP_PKEY*
+openssl_key(const char* type, OSSL_PARAM_BLD* bld, int selection)
+{
+  OSSL_PARAM* params = OSSL_PARAM_BLD_to_param(bld);
+  EVP_PKEY_CTX* ctx = EVP_PKEY_CTX_new_from_name(NULL, type, NULL);
+  EVP_PKEY* pkey = NULL;
+  if (EVP_PKEY_fromdata_init(ctx) != 1 ||
+      EVP_PKEY_fromdata(ctx, &pkey, selection, params) != 1) {
+    pkey = NULL;
+  }
+  EVP_PKEY_CTX_free(ctx);
+  OSSL_PARAM_free(params);
+  OSSL_PARAM_BLD_free(bld);
+  return pkey;
+}
+
+// `pk` is the raw x || y; `sk` may be empty for a public key.
+static EVP_PKEY*
+openssl_ec_key(const char* group, const bytes& sk, const bytes& pk)
+{
+  bytes pub = { 0x04 };
+  pub.insert(pub.end(), pk.begin(), pk.end());
+  OSSL_PARAM_BLD* bld = OSSL_PARAM_BLD_new();
+  OSSL_PARAM_BLD_push_utf8_string(bld, OSSL_PKEY_PARAM_GROUP_NAME, group, 0);
+  OSSL_PARAM_BLD_push_octet_string(
+    bld, OSSL_PKEY_PARAM_PUB_KEY, pub.data(), pub.size());
+  BIGNUM* priv = NULL;
+  if (!sk.empty()) {
+    priv = BN_bin2bn(sk.data(), (int)sk.size(), NULL);
+    OSSL_PARAM_BLD_push_BN(bld, OSSL_PKEY_PARAM_PRIV_KEY, priv);
+  }
+  EVP_PKEY* pkey = openssl_key(
+    "EC", bld, sk.empty() ? EVP_PKEY_PUBLIC_KEY : EVP_PKEY_KEYPAIR);
+  BN_free(priv);
+  return pkey;
+}
+
+// With `crt`, the key includes the primes and OpenSSL signs with the CRT, as
+// it does with any key it generates or parses. Without them OpenSSL computes
+// the same exponentiation with the full private exponent as HACL.
+static EVP_PKEY*
+openssl_rsa_key(bool with_private, bool crt)
+{
+  vector<pair<const char*, const bytes*>> params = {
+    { OSSL_PKEY_PARAM_RSA_N, &rsa_n }, { OSSL_PKEY_PARAM_RSA_E, &rsa_e }
+  };
+  if (with_private) {
+    params.push_back({ OSSL_PKEY_PARAM_RSA_D, &rsa_d });
+  }
+  if (with_private && crt) {
+    params.push_back({ OSSL_PKEY_PARAM_RSA_FACTOR1, &rsa_p });
+    params.push_back({ OSSL_PKEY_PARAM_RSA_FACTOR2, &rsa_q });
+    params.push_back({ OSSL_PKEY_PARAM_RSA_EXPONENT1, &rsa_dp });
+    params.push_back({ OSSL_PKEY_PARAM_RSA_EXPONENT2, &rsa_dq });
+    params.push_back({ OSSL_PKEY_PARAM_RSA_COEFFICIENT1, &rsa_qinv });
+  }
+  OSSL_PARAM_BLD* bld = OSSL_PARAM_BLD_new();
+  vector<BIGNUM*> bns;
+  for (auto& [name, value] : params) {
+    bns.push_back(BN_bin2bn(value->data(), (int)value->size(), NULL));
+    OSSL_PARAM_BLD_push_BN(bld, name, bns.back());
+  }
+  EVP_PKEY* pkey = openssl_key(
+    "RSA", bld, with_private ? EVP_PKEY_KEYPAIR : EVP_PKEY_PUBLIC_KEY);
+  for (BIGNUM* bn : bns) {
+    BN_free(bn);
+  }
+  return pkey;
+}
+
+// OpenSSL expects DER-encoded ECDSA signatures.
+static bytes
+openssl_der_signature(const bytes& rs)
+{
+  ECDSA_SIG* sig = ECDSA_SIG_new();
+  ECDSA_SIG_set0(sig,
+                 BN_bin2bn(rs.data(), 32, NULL),
+                 BN_bin2bn(rs.data() + 32, 32, NULL));
+  unsigned char* der = NULL;
+  int len = i2d_ECDSA_SIG(sig, &der);
+  bytes out(der, der + len);
+  OPENSSL_free(der);
+  ECDSA_SIG_free(sig);
+  return out;
+}
+
+static bool
+openssl_pss(EVP_PKEY_CTX* pctx, bool pss)
+{
+  return !pss || (EVP_PKEY_CTX_set_rsa_padding(pctx, RSA_PKCS1_PSS_PADDING) ==
+                    1 &&
+                  EVP_PKEY_CTX_set_rsa_pss_saltlen(pctx, 32) == 1);
+}
+
+// The context is initialized for every message, as an application that
+// signs different messages has to.
+static kernel_fn
+openssl_sign(EVP_PKEY* pkey, const EVP_MD* md, bool pss = false)
+{
+  EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+  return [=](uint8_t* out, uint8_t* in, uint32_t len) {
+    EVP_PKEY_CTX* pctx = NULL;
+    size_t sig_len = out_slack;
+    return EVP_DigestSignInit(ctx, &pctx, md, NULL, pkey) == 1 &&
+           openssl_pss(pctx, pss) &&
+           EVP_DigestSign(ctx, out, &sig_len, in, len) == 1;
+  };
+}
+
+static kernel_fn
+openssl_verify(EVP_PKEY* pkey,
+               const EVP_MD* md,
+               const bytes& sig,
+               bool pss = false)
+{
+  EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+  return [=](uint8_t* out, uint8_t* in, uint32_t len) {
+    EVP_PKEY_CTX* pctx = NULL;
+    return EVP_DigestVerifyInit(ctx, &pctx, md, NULL, pkey) == 1 &&
+           openssl_pss(pctx, pss) &&
+           EVP_DigestVerify(ctx, sig.data(), sig.size(), in, len) == 1;
+  };
+}
+
+static kernel_fn
+openssl_derive(EVP_PKEY* pkey, EVP_PKEY* peer)
+{
+  EVP_PKEY_CTX* ctx = EVP_PKEY_CTX_new(pkey, NULL);
+  EVP_PKEY_derive_init(ctx);
+  EVP_PKEY_derive_set_peer(ctx, peer);
+  return [ctx](uint8_t* out, uint8_t* in, uint32_t len) {
+    size_t shared_len = 32;
+    return EVP_PKEY_derive(ctx, out, &shared_len) == 1;
+  };
+}
+
+static vector<kernel>
+openssl_kernels()
+{
+  EVP_PKEY* x25519 = EVP_PKEY_new_raw_private_key(
+    EVP_PKEY_X25519, NULL, x25519_sk.data(), x25519_sk.size());
+  EVP_PKEY* x25519_peer = EVP_PKEY_new_raw_public_key(
+    EVP_PKEY_X25519, NULL, x25519_peer_pk.data(), x25519_peer_pk.size());
+  EVP_PKEY* ed25519 = EVP_PKEY_new_raw_private_key(
+    EVP_PKEY_ED25519, NULL, ed25519_sk.data(), ed25519_sk.size());
+  EVP_PKEY* p256 = openssl_ec_key("P-256", p256_sk, p256_pk);
+  EVP_PKEY* p256_peer = openssl_ec_key("P-256", bytes(), p256_peer_pk);
+  EVP_PKEY* k256 = openssl_ec_key("secp256k1", k256_sk, k256_pk);
+  EVP_PKEY* rsa_crt = openssl_rsa_key(true, true);
+  EVP_PKEY* rsa_private = openssl_rsa_key(true, false);
+  EVP_PKEY* rsa_public = openssl_rsa_key(false, false);
+
+  return {
+    { "sha2_256", "openssl", DIGEST, PORTABLE, 32, openssl_hash(EVP_sha256()) },
+    { "sha2_512", "openssl", DIGEST, PORTABLE, 64, openssl_hash(EVP_sha512()) },
+    { "sha3_256",
+      "openssl",
+      DIGEST,
+      PORTABLE,
+      32,
+      openssl_hash(EVP_sha3_256()) },
+    { "blake2b",
+      "openssl",
+      DIGEST,
+      PORTABLE,
+      64,
+      openssl_hash(EVP_blake2b512()) },
+    { "blake2s",
+      "openssl",
+      DIGEST,
+      PORTABLE,
+      32,
+      openssl_hash(EVP_blake2s256()) },
+    { "hmac_sha2_256",
+      "openssl",
+      DIGEST,
+      PORTABLE,
+      32,
+      openssl_hmac(EVP_sha256()) },
+    { "hmac_sha2_512",
+      "openssl",
+      DIGEST,
+      PORTABLE,
+      64,
+      openssl_hmac(EVP_sha512()) },
+    { "chacha20poly1305",
+      "openssl",
+      AEAD,
+      PORTABLE,
+      16,
+      openssl_aead(EVP_chacha20_poly1305()) },
+    { "aes128_gcm",
+      "openssl",
+      AEAD,
+      PORTABLE,
+      16,
+      openssl_aead(EVP_aes_128_gcm()) },
+    { "aes256_gcm",
+      "openssl",
+      AEAD,
+      PORTABLE,
+      16,
+      openssl_aead(EVP_aes_256_gcm()) },
+    { "hkdf_sha2_256", "openssl", OPERATION, PORTABLE, 32, openssl_hkdf() },
+    { "x25519",
+      "openssl",
+      OPERATION,
+      PORTABLE,
+      32,
+      openssl_derive(x25519, x25519_peer) },
+    { "ed25519_sign",
+      "openssl",
+      OPERATION,
+      PORTABLE,
+      64,
+      openssl_sign(ed25519, NULL) },
+    { "ed25519_verify",
+      "openssl",
+      OPERATION,
+      PORTABLE,
+      0,
+      openssl_verify(ed25519, NULL, ed25519_sig) },
+    { "p256_ecdsa_sign",
+      "openssl",
+      OPERATION,
+      PORTABLE,
+      0,
+      openssl_sign(p256, EVP_sha256()) },
+    { "p256_ecdsa_verify",
+      "openssl",
+      OPERATION,
+      PORTABLE,
+      0,
+      openssl_verify(p256, EVP_sha256(), openssl_der_signature(p256_sig)) },
+    { "p256_ecdh",
+      "openssl",
+      OPERATION,
+      PORTABLE,
+      32,
+      openssl_derive(p256, p256_peer) },
+    { "secp256k1_ecdsa_sign",
+      "openssl",
+      OPERATION,
+      PORTABLE,
+      0,
+      openssl_sign(k256, EVP_sha256()) },
+    { "secp256k1_ecdsa_verify",
+      "openssl",
+      OPERATION,
+      PORTABLE,
+      0,
+      openssl_verify(k256, EVP_sha256(), openssl_der_signature(k256_sig)) },
+    { "rsa2048_pss_sign_crt",
+      "openssl",
+      OPERATION,
+      PORTABLE,
+      0,
+      openssl_sign(rsa_crt, EVP_sha256(), true) },
+    { "rsa2048_pss_sign_no_crt",
+      "openssl",
+      OPERATION,
+      PORTABLE,
+      0,
+      openssl_sign(rsa_private, EVP_sha256(), true) },
+    { "rsa2048_pss_verify",
+      "openssl",
+      OPERATION,
+      PORTABLE,
+      0,
+      openssl_verify(rsa_public, EVP_sha256(), rsa_sig, true) },
+  };
+}
+#endif
+
+// libsodium
+
+#ifdef LIBSODIUM
+static unsigned char sodium_ed25519_pk[crypto_sign_PUBLICKEYBYTES];
+static unsigned char sodium_ed25519_sk[crypto_sign_SECRETKEYBYTES];
+
+static vector<kernel>
+sodium_kernels()
+{
+  // libsodium's secret key is the seed followed by the public key.
+  crypto_sign_seed_keypair(
+    sodium_ed25519_pk, sodium_ed25519_sk, ed25519_sk.data());
+
+  return {
+    { "sha2_256",
+      "libsodium",
+      DIGEST,
+      PORTABLE,
+      32,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        return crypto_hash_sha256(out, in, len) == 0;
+      } },
+    { "sha2_512",
+      "libsodium",
+      DIGEST,
+      PORTABLE,
+      64,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        return crypto_hash_sha512(out, in, len) == 0;
+      } },
+    { "blake2b",
+      "libsodium",
+      DIGEST,
+      PORTABLE,
+      64,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        return crypto_generichash(out, 64, in, len, NULL, 0) == 0;
+      } },
+    { "hmac_sha2_256",
+      "libsodium",
+      DIGEST,
+      PORTABLE,
+      32,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        return crypto_auth_hmacsha256(out, in, len, key.data()) == 0;
+      } },
+    { "hmac_sha2_512",
+      "libsodium",
+      DIGEST,
+      PORTABLE,
+      64,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        return crypto_auth_hmacsha512(out, in, len, key.data()) == 0;
+      } },
+    { "chacha20poly1305",
+      "libsodium",
+      AEAD,
+      PORTABLE,
+      16,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        return crypto_aead_chacha20poly1305_ietf_encrypt_detached(out,
+                                                                 out + len,
+                                                                 NULL,
+                                                                 in,
+                                                                 len,
+                                                                 NULL,
+                                                                 0,
+                                                                 NULL,
+                                                                 nonce.data(),
+                                                                 key.data()) ==
+               0;
+      } },
+    { "aes256_gcm",
+      "libsodium",
+      AEAD,
+      SODIUM_AES,
+      16,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        return crypto_aead_aes256gcm_encrypt_detached(out,
+                                                      out + len,
+                                                      NULL,
+                                                      in,
+                                                      len,
+                                                      NULL,
+                                                      0,
+                                                      NULL,
+                                                      nonce.data(),
+                                                      key.data()) == 0;
+      } },
+#ifdef crypto_kdf_hkdf_sha256_KEYBYTES
+    // Since libsodium 1.0.19.
+    { "hkdf_sha2_256",
+      "libsodium",
+      OPERATION,
+      PORTABLE,
+      32,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        uint8_t prk[crypto_kdf_hkdf_sha256_KEYBYTES];
+        return crypto_kdf_hkdf_sha256_extract(
+                 prk, salt.data(), salt.size(), in, len) == 0 &&
+               crypto_kdf_hkdf_sha256_expand(
+                 out, 32, (const char*)info.data(), info.size(), prk) == 0;
+      } },
+#endif
+    { "x25519",
+      "libsodium",
+      OPERATION,
+      PORTABLE,
+      32,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        return crypto_scalarmult(
+                 out, x25519_sk.data(), x25519_peer_pk.data()) == 0;
+      } },
+    { "ed25519_sign",
+      "libsodium",
+      OPERATION,
+      PORTABLE,
+      64,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        return crypto_sign_detached(out, NULL, in, len, sodium_ed25519_sk) ==
+               0;
+      } },
+    { "ed25519_verify",
+      "libsodium",
+      OPERATION,
+      PORTABLE,
+      0,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        return crypto_sign_verify_detached(
+                 ed25519_sig.data(), in, len, sodium_ed25519_pk) == 0;
+      } },
+  };
+}
+#endif
+
+int
+main(int argc, char** argv)
+{
+  cpu_init();
+#ifdef LIBSODIUM
+  if (sodium_init() < 0) {
+    cerr << "libsodium failed to initialize" << endl;
+    return 1;
+  }
+#endif
+  setup_keys();
+
+  // Kernels are passed to the benchmarks by reference and must outlive them.
+  static vector<kernel> hacl = hacl_kernels();
+  static vector<kernel> others;
+#ifndef NO_OPENSSL
+  vector<kernel> openssl = openssl_kernels();
+  others.insert(others.end(), openssl.begin(), openssl.end());
+#endif
+#ifdef LIBSODIUM
+  vector<kernel> sodium = sodium_kernels();
+  others.insert(others.end(), sodium.begin(), sodium.end());
+#endif
+
+  // One primitive after the other, HACL first.
+  for (const kernel& reference : hacl) {
+    vector<pair<const kernel*, const kernel*>> row = { { &reference, NULL } };
+    for (const kernel& k : others) {
+      if (k.primitive == reference.primitive) {
+        row.push_back({ &k, &reference });
+      }
+    }
+    for (auto& [k, ref] : row) {
+      string name = k->primitive + "/" + k->library;
+      auto* b = benchmark::RegisterBenchmark(name.c_str(), compare, *k, ref);
+      if (k->k != OPERATION) {
+        for (int64_t size : sizes) {
+          b->Arg(size);
+        }
+      }
+    }
+  }
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -179,4 +179,54 @@ HACL_NaCl_secret_detached(benchmark::State& state)
 
 BENCHMARK(HACL_NaCl_secret_detached)->Setup(DoSetup);
 
+// Encryption under a precomputed key, with and without a session. The session
+// also keeps the Salsa20 and Poly1305 implementation picked at allocation and
+// fuses both passes over 4 KB chunks.
+static void
+HACL_NaCl_precomputed_easy(benchmark::State& state)
+{
+  bytes msg(state.range(0), 0x37), ct(HACL_NACL_MACBYTES + msg.size());
+  generate_random(k.data(), k.size());
+  generate_random(nonce.data(), nonce.size());
+
+  for (auto _ : state) {
+    Hacl_NaCl_crypto_box_easy_afternm(
+      ct.data(), msg.data(), msg.size(), nonce.data(), k.data());
+  }
+  state.SetBytesProcessed(msg.size() * state.iterations());
+}
+
+BENCHMARK(HACL_NaCl_precomputed_easy)
+  ->Setup(DoSetup)
+  ->RangeMultiplier(8)
+  ->Range(64, 1 << 18);
+
+static void
+HACL_NaCl_session_easy(benchmark::State& state)
+{
+  bytes msg(state.range(0), 0x37), ct(HACL_NACL_MACBYTES + msg.size());
+  generate_random(k.data(), k.size());
+  generate_random(nonce.data(), nonce.size());
+  Hacl_NaCl_impl impl = Hacl_NaCl_Portable;
+  if (EverCrypt_AutoConfig2_has_vec256()) {
+    impl = Hacl_NaCl_Vec256;
+  } else if (EverCrypt_AutoConfig2_has_vec128()) {
+    impl = Hacl_NaCl_Vec128;
+  }
+  Hacl_NaCl_crypto_box_session_s* s = Hacl_NaCl_crypto_box_session_malloc(impl);
+  Hacl_NaCl_crypto_box_session_init_afternm(s, k.data());
+
+  for (auto _ : state) {
+    Hacl_NaCl_crypto_box_session_easy(
+      s, ct.data(), msg.data(), msg.size(), nonce.data());
+  }
+  state.SetBytesProcessed(msg.size() * state.iterations());
+  Hacl_NaCl_crypto_box_session_free(s);
+}
+
+BENCHMARK(HACL_NaCl_session_easy)
+  ->Setup(DoSetup)
+  ->RangeMultiplier(8)
+  ->Range(64, 1 << 18);
+
 BENCHMARK_MAIN();
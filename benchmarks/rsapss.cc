@@ -62,6 +62,19 @@ BENCHMARK_CAPTURE(HACL_Rsapss_sign, sha2_384, Spec_Hash_Definitions_SHA2_384)
 BENCHMARK_CAPTURE(HACL_Rsapss_sign, sha2_512, Spec_Hash_Definitions_SHA2_512)
   ->Setup(DoSetup);
 
+// The same signature with the AVX-512 IFMA bignum backend turned off.
+static void
+DoSetupNoIfma(const benchmark::State& state)
+{
+  cpu_init();
+  EverCrypt_AutoConfig2_disable_avx512ifma();
+}
+
+BENCHMARK_CAPTURE(HACL_Rsapss_sign,
+                  sha2_256_no_ifma,
+                  Spec_Hash_Definitions_SHA2_256)
+  ->Setup(DoSetupNoIfma);
+
 template<class... Args>
 void
 HACL_Rsapss_verify(benchmark::State& state, Args&&... args)
@@ -0,0 +1,454 @@
+/*
+ *    Copyright 2022 Cryspen Sarl
+ *
+ *    Licensed under the Apache License, Version 2.0 or MIT.
+ *    - http://www.apache.org/licenses/LICENSE-2.0
+ *    - http://opensource.org/licenses/MIT
+ */
+
+// Size sweep over every hash, MAC and AEAD implementation.
+//
+// Each benchmark is named `<kind>/<primitive>/<implementation>/<size>` and
+// reports `cycles_per_byte` next to the usual timings. Run it with
+// `--benchmark_out=sweep.json --benchmark_out_format=json` (or through
+// `mach benchmark --sweep`) to get a file that `tools/benchmark.py` can
+// compare between two builds and turn into a per-size ranking.
+
+#include <functional>
+
+#include "EverCrypt_AEAD.h"
+#include "EverCrypt_Chacha20Poly1305.h"
+#include "EverCrypt_HMAC.h"
+#include "EverCrypt_Hash.h"
+#include "EverCrypt_Poly1305.h"
+#include "Hacl_Chacha20Poly1305_32.h"
+#include "Hacl_HMAC.h"
+#include "Hacl_Hash_Blake2.h"
+#include "Hacl_Hash_MD5.h"
+#include "Hacl_Hash_SHA1.h"
+#include "Hacl_Hash_SHA2.h"
+#include "Hacl_Hash_SHA3.h"
+#include "Hacl_NaCl.h"
+#include "Hacl_Poly1305_32.h"
+
+#include "util.h"
+
+#ifdef HACL_CAN_COMPILE_VEC128
+#include "Hacl_Chacha20Poly1305_128.h"
+#include "Hacl_HMAC_Blake2s_128.h"
+#include "Hacl_Hash_Blake2s_128.h"
+#include "Hacl_Poly1305_128.h"
+#include "Hacl_SHA2_Vec128.h"
+#endif
+
+#ifdef HACL_CAN_COMPILE_VEC256
+#include "Hacl_Chacha20Poly1305_256.h"
+#include "Hacl_HMAC_Blake2b_256.h"
+#include "Hacl_Hash_Blake2b_256.h"
+#include "Hacl_Poly1305_256.h"
+#include "Hacl_SHA2_Vec256.h"
+#endif
+
+// 16 B to 64 MiB.
+static const int64_t min_size = 16;
+static const int64_t max_size = 64 << 20;
+
+// Room after the output for digests, tags and the multi-buffer digests.
+static const size_t out_slack = 512;
+
+typedef enum
+{
+  PORTABLE,
+  VEC128,
+  VEC256,
+  VALE_AES
+} requirement;
+
+typedef std::function<void(uint8_t* out, uint8_t* in, uint32_t len)> kernel_fn;
+
+typedef struct
+{
+  string name;
+  requirement req;
+  kernel_fn run;
+} kernel;
+
+static bytes key(64, 0x11);
+static bytes nonce(24, 0x22);
+
+static EverCrypt_AEAD_state_s*
+aead_state(Spec_Agile_AEAD_alg alg)
+{
+  EverCrypt_AEAD_state_s* s = NULL;
+  if (EverCrypt_AEAD_create_in(alg, &s, key.data()) != EverCrypt_Error_Success) {
+    return NULL;
+  }
+  return s;
+}
+
+static bool
+supported(requirement req)
+{
+  switch (req) {
+    case VEC128:
+      return vec128_support();
+    case VEC256:
+      return vec256_support();
+    case VALE_AES: {
+      // Covers both the CPU flags and builds without Vale.
+      EverCrypt_AEAD_state_s* s = aead_state(Spec_Agile_AEAD_AES128_GCM);
+      if (s == NULL) {
+        return false;
+      }
+      EverCrypt_AEAD_free(s);
+      return true;
+    }
+    default:
+      return true;
+  }
+}
+
+static void
+sweep(benchmark::State& state, const kernel& k)
+{
+  if (!supported(k.req)) {
+    state.SkipWithError("Unsupported on this CPU");
+    return;
+  }
+  uint32_t len = static_cast<uint32_t>(state.range(0));
+  bytes in(len, 0x37), out(len + out_slack);
+
+  uint64_t start = cpu_cycles();
+  for (auto _ : state) {
+    k.run(out.data(), in.data(), len);
+    benchmark::ClobberMemory();
+  }
+  uint64_t cycles = cpu_cycles() - start;
+
+  state.SetBytesProcessed(state.iterations() * (int64_t)len);
+  state.counters["cycles_per_byte"] =
+    (double)cycles / ((double)len * (double)state.iterations());
+}
+
+static kernel_fn
+evercrypt_aead(Spec_Agile_AEAD_alg alg)
+{
+  EverCrypt_AEAD_state_s* s = aead_state(alg);
+  return [s](uint8_t* out, uint8_t* in, uint32_t len) {
+    EverCrypt_AEAD_encrypt(
+      s, nonce.data(), 12, NULL, 0, in, len, out, out + len);
+  };
+}
+
+static kernel_fn
+evercrypt_hash(Spec_Hash_Definitions_hash_alg alg)
+{
+  return [alg](uint8_t* out, uint8_t* in, uint32_t len) {
+    EverCrypt_Hash_Incremental_hash(alg, out, in, len);
+  };
+}
+
+static kernel_fn
+evercrypt_hmac(Spec_Hash_Definitions_hash_alg alg)
+{
+  return [alg](uint8_t* out, uint8_t* in, uint32_t len) {
+    EverCrypt_HMAC_compute(alg, out, key.data(), 32, in, len);
+  };
+}
+
+static vector<kernel>
+kernels()
+{
+  vector<kernel> ks = {
+    // Hashes
+    { "hash/md5/hacl",
+      PORTABLE,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_Streaming_MD5_legacy_hash(in, len, out);
+      } },
+    { "hash/sha1/hacl",
+      PORTABLE,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_Streaming_SHA1_legacy_hash(in, len, out);
+      } },
+    { "hash/sha2_224/hacl",
+      PORTABLE,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_Streaming_SHA2_hash_224(in, len, out);
+      } },
+    { "hash/sha2_256/hacl",
+      PORTABLE,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_Streaming_SHA2_hash_256(in, len, out);
+      } },
+    { "hash/sha2_384/hacl",
+      PORTABLE,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_Streaming_SHA2_hash_384(in, len, out);
+      } },
+    { "hash/sha2_512/hacl",
+      PORTABLE,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_Streaming_SHA2_hash_512(in, len, out);
+      } },
+    { "hash/sha3_224/hacl",
+      PORTABLE,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_SHA3_sha3_224(len, in, out);
+      } },
+    { "hash/sha3_256/hacl",
+      PORTABLE,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_SHA3_sha3_256(len, in, out);
+      } },
+    { "hash/sha3_384/hacl",
+      PORTABLE,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_SHA3_sha3_384(len, in, out);
+      } },
+    { "hash/sha3_512/hacl",
+      PORTABLE,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_SHA3_sha3_512(len, in, out);
+      } },
+    { "hash/blake2s/hacl_32",
+      PORTABLE,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_Blake2s_32_blake2s(32, out, len, in, 0, NULL);
+      } },
+    { "hash/blake2b/hacl_32",
+      PORTABLE,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_Blake2b_32_blake2b(64, out, len, in, 0, NULL);
+      } },
+    { "hash/md5/evercrypt", PORTABLE, evercrypt_hash(Spec_Hash_Definitions_MD5) },
+    { "hash/sha1/evercrypt",
+      PORTABLE,
+      evercrypt_hash(Spec_Hash_Definitions_SHA1) },
+    { "hash/sha2_224/evercrypt",
+      PORTABLE,
+      evercrypt_hash(Spec_Hash_Definitions_SHA2_224) },
+    { "hash/sha2_256/evercrypt",
+      PORTABLE,
+      evercrypt_hash(Spec_Hash_Definitions_SHA2_256) },
+    { "hash/sha2_384/evercrypt",
+      PORTABLE,
+      evercrypt_hash(Spec_Hash_Definitions_SHA2_384) },
+    { "hash/sha2_512/evercrypt",
+      PORTABLE,
+      evercrypt_hash(Spec_Hash_Definitions_SHA2_512) },
+    { "hash/sha3_256/evercrypt",
+      PORTABLE,
+      evercrypt_hash(Spec_Hash_Definitions_SHA3_256) },
+    { "hash/blake2s/evercrypt",
+      PORTABLE,
+      evercrypt_hash(Spec_Hash_Definitions_Blake2S) },
+    { "hash/blake2b/evercrypt",
+      PORTABLE,
+      evercrypt_hash(Spec_Hash_Definitions_Blake2B) },
+
+    // MACs
+    { "mac/poly1305/hacl_32",
+      PORTABLE,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_Poly1305_32_poly1305_mac(out, len, in, key.data());
+      } },
+    { "mac/poly1305/evercrypt",
+      PORTABLE,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        EverCrypt_Poly1305_poly1305(out, in, len, key.data());
+      } },
+    { "mac/hmac_sha1/hacl",
+      PORTABLE,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_HMAC_legacy_compute_sha1(out, key.data(), 32, in, len);
+      } },
+    { "mac/hmac_sha2_256/hacl",
+      PORTABLE,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_HMAC_compute_sha2_256(out, key.data(), 32, in, len);
+      } },
+    { "mac/hmac_sha2_384/hacl",
+      PORTABLE,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_HMAC_compute_sha2_384(out, key.data(), 32, in, len);
+      } },
+    { "mac/hmac_sha2_512/hacl",
+      PORTABLE,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_HMAC_compute_sha2_512(out, key.data(), 32, in, len);
+      } },
+    { "mac/hmac_blake2s/hacl_32",
+      PORTABLE,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_HMAC_compute_blake2s_32(out, key.data(), 32, in, len);
+      } },
+    { "mac/hmac_blake2b/hacl_32",
+      PORTABLE,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_HMAC_compute_blake2b_32(out, key.data(), 32, in, len);
+      } },
+    { "mac/hmac_sha2_256/evercrypt",
+      PORTABLE,
+      evercrypt_hmac(Spec_Hash_Definitions_SHA2_256) },
+    { "mac/hmac_sha2_512/evercrypt",
+      PORTABLE,
+      evercrypt_hmac(Spec_Hash_Definitions_SHA2_512) },
+
+    // AEADs
+    { "aead/chacha20poly1305/hacl_32",
+      PORTABLE,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_Chacha20Poly1305_32_aead_encrypt(
+          key.data(), nonce.data(), 0, NULL, len, in, out, out + len);
+      } },
+    { "aead/chacha20poly1305/evercrypt",
+      PORTABLE,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        EverCrypt_Chacha20Poly1305_aead_encrypt(
+          key.data(), nonce.data(), 0, NULL, len, in, out, out + len);
+      } },
+    { "aead/chacha20poly1305/evercrypt_aead",
+      PORTABLE,
+      evercrypt_aead(Spec_Agile_AEAD_CHACHA20_POLY1305) },
+    { "aead/aes128_gcm/vale",
+      VALE_AES,
+      evercrypt_aead(Spec_Agile_AEAD_AES128_GCM) },
+    { "aead/aes256_gcm/vale",
+      VALE_AES,
+      evercrypt_aead(Spec_Agile_AEAD_AES256_GCM) },
+    { "aead/xsalsa20poly1305/hacl",
+      PORTABLE,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_NaCl_crypto_secretbox_easy(out, in, len, nonce.data(), key.data());
+      } },
+  };
+
+#ifdef HACL_CAN_COMPILE_VEC128
+  vector<kernel> ks128 = {
+    { "hash/blake2s/hacl_128",
+      VEC128,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_Blake2s_128_blake2s(32, out, len, in, 0, NULL);
+      } },
+    // Multi-buffer: the input is split into one message per lane.
+    { "hash/sha2_256/hacl_128x4",
+      VEC128,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        uint32_t l = len / 4;
+        Hacl_SHA2_Vec128_sha256_4(out,
+                                  out + 32,
+                                  out + 64,
+                                  out + 96,
+                                  l,
+                                  in,
+                                  in + l,
+                                  in + 2 * l,
+                                  in + 3 * l);
+      } },
+    { "mac/poly1305/hacl_128",
+      VEC128,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_Poly1305_128_poly1305_mac(out, len, in, key.data());
+      } },
+    { "mac/hmac_blake2s/hacl_128",
+      VEC128,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_HMAC_Blake2s_128_compute_blake2s_128(
+          out, key.data(), 32, in, len);
+      } },
+    { "aead/chacha20poly1305/hacl_128",
+      VEC128,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_Chacha20Poly1305_128_aead_encrypt(
+          key.data(), nonce.data(), 0, NULL, len, in, out, out + len);
+      } },
+  };
+  ks.insert(ks.end(), ks128.begin(), ks128.end());
+#endif
+
+#ifdef HACL_CAN_COMPILE_VEC256
+  vector<kernel> ks256 = {
+    { "hash/blake2b/hacl_256",
+      VEC256,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_Blake2b_256_blake2b(64, out, len, in, 0, NULL);
+      } },
+    { "hash/sha2_256/hacl_256x8",
+      VEC256,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        uint32_t l = len / 8;
+        Hacl_SHA2_Vec256_sha256_8(out,
+                                  out + 32,
+                                  out + 64,
+                                  out + 96,
+                                  out + 128,
+                                  out + 160,
+                                  out + 192,
+                                  out + 224,
+                                  l,
+                                  in,
+                                  in + l,
+                                  in + 2 * l,
+                                  in + 3 * l,
+                                  in + 4 * l,
+                                  in + 5 * l,
+                                  in + 6 * l,
+                                  in + 7 * l);
+      } },
+    { "hash/sha2_512/hacl_256x4",
+      VEC256,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        uint32_t l = len / 4;
+        Hacl_SHA2_Vec256_sha512_4(out,
+                                  out + 64,
+                                  out + 128,
+                                  out + 192,
+                                  l,
+                                  in,
+                                  in + l,
+                                  in + 2 * l,
+                                  in + 3 * l);
+      } },
+    { "mac/poly1305/hacl_256",
+      VEC256,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_Poly1305_256_poly1305_mac(out, len, in, key.data());
+      } },
+    { "mac/hmac_blake2b/hacl_256",
+      VEC256,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_HMAC_Blake2b_256_compute_blake2b_256(
+          out, key.data(), 32, in, len);
+      } },
+    { "aead/chacha20poly1305/hacl_256",
+      VEC256,
+      [](uint8_t* out, uint8_t* in, uint32_t len) {
+        Hacl_Chacha20Poly1305_256_aead_encrypt(
+          key.data(), nonce.data(), 0, NULL, len, in, out, out + len);
+      } },
+  };
+  ks.insert(ks.end(), ks256.begin(), ks256.end());
+#endif
+
+  return ks;
+}
+
+int
+main(int argc, char** argv)
+{
+  // The kernel list creates EverCrypt states, which needs the CPU flags.
+  cpu_init();
+  for (const kernel& k : kernels()) {
+    benchmark::RegisterBenchmark(k.name.c_str(), sweep, k)
+      ->RangeMultiplier(4)
+      ->Range(min_size, max_size);
+  }
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
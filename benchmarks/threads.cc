@@ -0,0 +1,376 @@
+/*
+ *    Copyright 2022 Cryspen Sarl
+ *
+ *    Licensed under the Apache License, Version 2.0 or MIT.
+ *    - http://www.apache.org/licenses/LICENSE-2.0
+ *    - http://opensource.org/licenses/MIT
+ */
+
+// Multi-threaded scaling of the stateless primitives.
+//
+// Every benchmark runs on 1, 2, 4, ... threads up to the number of hardware
+// threads (or HACL_BENCHMARK_THREADS, if set). `items_per_second` is the
+// aggregate rate over all threads; `efficiency` is the average per-thread rate
+// divided by the single-thread rate of the same benchmark, so 1.0 is perfect
+// scaling. `shared` variants have all threads read the same key or state
+// object, `per_thread` variants give each thread its own copy, and
+// `create_in` variants allocate and free a state for every operation.
+
+#include <chrono>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include "EverCrypt_AEAD.h"
+#include "EverCrypt_Curve25519.h"
+#include "EverCrypt_Hash.h"
+#include "Hacl_Ed25519.h"
+
+#include "util.h"
+
+static const size_t msg_len = 1024;
+
+static int
+max_threads()
+{
+  const char* env = getenv("HACL_BENCHMARK_THREADS");
+  int n = env != NULL ? atoi(env) : (int)std::thread::hardware_concurrency();
+  return n > 0 ? n : 1;
+}
+
+static void
+Threads(benchmark::internal::Benchmark* b)
+{
+  int max = max_threads();
+  for (int t = 1; t < max; t *= 2) {
+    b->Threads(t);
+  }
+  b->Threads(max);
+  b->UseRealTime();
+}
+
+static std::mutex baseline_lock;
+static std::map<string, double> baseline;
+
+// Runs `op` for the benchmark loop and reports the per-thread efficiency. The
+// clock starts after the first iteration, so that time spent waiting for the
+// other threads to start is not counted.
+template<typename F>
+static void
+scaling_loop(benchmark::State& state, const string& key, F op)
+{
+  std::chrono::steady_clock::time_point start;
+  bool first = true;
+  for (auto _ : state) {
+    op();
+    if (first) {
+      start = std::chrono::steady_clock::now();
+      first = false;
+    }
+  }
+  std::chrono::duration<double> elapsed =
+    std::chrono::steady_clock::now() - start;
+  state.SetItemsProcessed(state.iterations());
+  if (state.iterations() < 2 || elapsed.count() <= 0) {
+    return;
+  }
+
+  double rate = (double)(state.iterations() - 1) / elapsed.count();
+  double single;
+  {
+    std::lock_guard<std::mutex> guard(baseline_lock);
+    if (state.threads() == 1) {
+      baseline[key] = rate;
+    }
+    single = baseline.count(key) ? baseline[key] : 0;
+  }
+  if (single > 0) {
+    state.counters["efficiency"] =
+      benchmark::Counter(rate / single, benchmark::Counter::kAvgThreads);
+  }
+}
+
+// ----- Ed25519 ---------------------------------------------------------------
+
+typedef struct
+{
+  bytes sk;
+  bytes pk;
+  bytes expanded_keys;
+  vector<uint64_t> expanded_pk;
+  bytes msg;
+  bytes signature;
+} ed25519_keys;
+
+static ed25519_keys
+ed25519_setup()
+{
+  ed25519_keys k = { bytes(32), bytes(32), bytes(96), vector<uint64_t>(644),
+                     bytes(msg_len, 0x37), bytes(64) };
+  generate_random(k.sk.data(), 32);
+  Hacl_Ed25519_secret_to_public(k.pk.data(), k.sk.data());
+  Hacl_Ed25519_expand_keys(k.expanded_keys.data(), k.sk.data());
+  Hacl_Ed25519_expand_public_key(k.expanded_pk.data(), k.pk.data());
+  Hacl_Ed25519_sign(k.signature.data(), k.sk.data(), msg_len, k.msg.data());
+  return k;
+}
+
+static ed25519_keys&
+ed25519_shared()
+{
+  static ed25519_keys k = ed25519_setup();
+  return k;
+}
+
+static void
+Ed25519_sign_shared(benchmark::State& state)
+{
+  ed25519_keys& k = ed25519_shared();
+  bytes signature(64);
+  scaling_loop(state, "Ed25519_sign_shared", [&]() {
+    Hacl_Ed25519_sign_expanded(
+      signature.data(), k.expanded_keys.data(), msg_len, k.msg.data());
+  });
+}
+
+BENCHMARK(Ed25519_sign_shared)->Setup(DoSetup)->Apply(Threads);
+
+static void
+Ed25519_sign_per_thread(benchmark::State& state)
+{
+  ed25519_keys k = ed25519_shared();
+  bytes signature(64);
+  scaling_loop(state, "Ed25519_sign_per_thread", [&]() {
+    Hacl_Ed25519_sign_expanded(
+      signature.data(), k.expanded_keys.data(), msg_len, k.msg.data());
+  });
+}
+
+BENCHMARK(Ed25519_sign_per_thread)->Setup(DoSetup)->Apply(Threads);
+
+static void
+Ed25519_verify(benchmark::State& state)
+{
+  ed25519_keys& k = ed25519_shared();
+  scaling_loop(state, "Ed25519_verify", [&]() {
+    if (!Hacl_Ed25519_verify(
+          k.pk.data(), msg_len, k.msg.data(), k.signature.data())) {
+      state.SkipWithError("Invalid signature");
+    }
+  });
+}
+
+BENCHMARK(Ed25519_verify)->Setup(DoSetup)->Apply(Threads);
+
+// The expanded public key is a 5 KB table: shared, all threads read the same
+// cache lines; per thread, each reads its own copy.
+static void
+Ed25519_verify_expanded_shared(benchmark::State& state)
+{
+  ed25519_keys& k = ed25519_shared();
+  scaling_loop(state, "Ed25519_verify_expanded_shared", [&]() {
+    if (!Hacl_Ed25519_verify_expanded(
+          k.expanded_pk.data(), msg_len, k.msg.data(), k.signature.data())) {
+      state.SkipWithError("Invalid signature");
+    }
+  });
+}
+
+BENCHMARK(Ed25519_verify_expanded_shared)->Setup(DoSetup)->Apply(Threads);
+
+static void
+Ed25519_verify_expanded_per_thread(benchmark::State& state)
+{
+  ed25519_keys k = ed25519_shared();
+  scaling_loop(state, "Ed25519_verify_expanded_per_thread", [&]() {
+    if (!Hacl_Ed25519_verify_expanded(
+          k.expanded_pk.data(), msg_len, k.msg.data(), k.signature.data())) {
+      state.SkipWithError("Invalid signature");
+    }
+  });
+}
+
+BENCHMARK(Ed25519_verify_expanded_per_thread)->Setup(DoSetup)->Apply(Threads);
+
+// ----- X25519 ----------------------------------------------------------------
+
+static void
+X25519_ecdh(benchmark::State& state)
+{
+  bytes sk(32), pk(32), peer(32), shared(32);
+  generate_random(sk.data(), 32);
+  generate_random(peer.data(), 32);
+  EverCrypt_Curve25519_secret_to_public(pk.data(), peer.data());
+  scaling_loop(state, "X25519_ecdh", [&]() {
+    EverCrypt_Curve25519_ecdh(shared.data(), sk.data(), pk.data());
+  });
+}
+
+BENCHMARK(X25519_ecdh)->Setup(DoSetup)->Apply(Threads);
+
+// ----- AEAD ------------------------------------------------------------------
+
+static Spec_Agile_AEAD_alg
+aead_alg()
+{
+  EverCrypt_AEAD_state_s* s;
+  bytes key(32);
+  if (EverCrypt_AEAD_create_in(Spec_Agile_AEAD_AES128_GCM, &s, key.data()) ==
+      EverCrypt_Error_Success) {
+    EverCrypt_AEAD_free(s);
+    return Spec_Agile_AEAD_AES128_GCM;
+  }
+  return Spec_Agile_AEAD_CHACHA20_POLY1305;
+}
+
+static EverCrypt_AEAD_state_s*
+aead_state()
+{
+  EverCrypt_AEAD_state_s* s;
+  bytes key(32, 0x11);
+  EverCrypt_AEAD_create_in(aead_alg(), &s, key.data());
+  return s;
+}
+
+// AES-128-GCM when the CPU supports the Vale implementation, ChaCha20-Poly1305
+// otherwise.
+static void
+AEAD_encrypt_shared(benchmark::State& state)
+{
+  static EverCrypt_AEAD_state_s* s = aead_state();
+  bytes nonce(12), msg(msg_len, 0x37), cipher(msg_len), tag(16);
+  scaling_loop(state, "AEAD_encrypt_shared", [&]() {
+    EverCrypt_AEAD_encrypt(s,
+                           nonce.data(),
+                           12,
+                           NULL,
+                           0,
+                           msg.data(),
+                           msg_len,
+                           cipher.data(),
+                           tag.data());
+  });
+}
+
+BENCHMARK(AEAD_encrypt_shared)->Setup(DoSetup)->Apply(Threads);
+
+static void
+AEAD_encrypt_per_thread(benchmark::State& state)
+{
+  EverCrypt_AEAD_state_s* s = aead_state();
+  bytes nonce(12), msg(msg_len, 0x37), cipher(msg_len), tag(16);
+  scaling_loop(state, "AEAD_encrypt_per_thread", [&]() {
+    EverCrypt_AEAD_encrypt(s,
+                           nonce.data(),
+                           12,
+                           NULL,
+                           0,
+                           msg.data(),
+                           msg_len,
+                           cipher.data(),
+                           tag.data());
+  });
+  EverCrypt_AEAD_free(s);
+}
+
+BENCHMARK(AEAD_encrypt_per_thread)->Setup(DoSetup)->Apply(Threads);
+
+static void
+AEAD_encrypt_create_in(benchmark::State& state)
+{
+  Spec_Agile_AEAD_alg alg = aead_alg();
+  bytes key(32, 0x11), nonce(12), msg(msg_len, 0x37), cipher(msg_len), tag(16);
+  scaling_loop(state, "AEAD_encrypt_create_in", [&]() {
+    EverCrypt_AEAD_state_s* s;
+    EverCrypt_AEAD_create_in(alg, &s, key.data());
+    EverCrypt_AEAD_encrypt(s,
+                           nonce.data(),
+                           12,
+                           NULL,
+                           0,
+                           msg.data(),
+                           msg_len,
+                           cipher.data(),
+                           tag.data());
+    EverCrypt_AEAD_free(s);
+  });
+}
+
+BENCHMARK(AEAD_encrypt_create_in)->Setup(DoSetup)->Apply(Threads);
+
+static void
+AEAD_encrypt_in_place(benchmark::State& state)
+{
+  Spec_Agile_AEAD_alg alg = aead_alg();
+  bytes key(32, 0x11), nonce(12), msg(msg_len, 0x37), cipher(msg_len), tag(16);
+  uint8_t* mem = (uint8_t*)KRML_ALIGNED_MALLOC(EVERCRYPT_AEAD_STATE_ALIGN,
+                                               EverCrypt_AEAD_state_size(alg));
+  scaling_loop(state, "AEAD_encrypt_in_place", [&]() {
+    EverCrypt_AEAD_state_s* s;
+    EverCrypt_AEAD_init_in_place(alg, mem, &s, key.data());
+    EverCrypt_AEAD_encrypt(s,
+                           nonce.data(),
+                           12,
+                           NULL,
+                           0,
+                           msg.data(),
+                           msg_len,
+                           cipher.data(),
+                           tag.data());
+  });
+  KRML_ALIGNED_FREE(mem);
+}
+
+BENCHMARK(AEAD_encrypt_in_place)->Setup(DoSetup)->Apply(Threads);
+
+// ----- SHA-2 -----------------------------------------------------------------
+
+static void
+SHA2_256_oneshot(benchmark::State& state)
+{
+  bytes msg(msg_len, 0x37), digest(32);
+  scaling_loop(state, "SHA2_256_oneshot", [&]() {
+    EverCrypt_Hash_Incremental_hash(
+      Spec_Hash_Definitions_SHA2_256, digest.data(), msg.data(), msg_len);
+  });
+}
+
+BENCHMARK(SHA2_256_oneshot)->Setup(DoSetup)->Apply(Threads);
+
+static void
+SHA2_256_streaming_create_in(benchmark::State& state)
+{
+  bytes msg(msg_len, 0x37), digest(32);
+  scaling_loop(state, "SHA2_256_streaming_create_in", [&]() {
+    EverCrypt_Hash_Incremental_hash_state* s =
+      EverCrypt_Hash_Incremental_create_in(Spec_Hash_Definitions_SHA2_256);
+    EverCrypt_Hash_Incremental_update(s, msg.data(), msg_len);
+    EverCrypt_Hash_Incremental_finish(s, digest.data());
+    EverCrypt_Hash_Incremental_free(s);
+  });
+}
+
+BENCHMARK(SHA2_256_streaming_create_in)->Setup(DoSetup)->Apply(Threads);
+
+static void
+SHA2_256_streaming_per_thread(benchmark::State& state)
+{
+  bytes msg(msg_len, 0x37), digest(32);
+  uint8_t* mem = (uint8_t*)KRML_ALIGNED_MALLOC(
+    EVERCRYPT_HASH_INCREMENTAL_STATE_ALIGN,
+    EverCrypt_Hash_Incremental_state_size(Spec_Hash_Definitions_SHA2_256));
+  EverCrypt_Hash_Incremental_hash_state* s =
+    EverCrypt_Hash_Incremental_init_in_place(Spec_Hash_Definitions_SHA2_256,
+                                             mem);
+  scaling_loop(state, "SHA2_256_streaming_per_thread", [&]() {
+    EverCrypt_Hash_Incremental_init(s);
+    EverCrypt_Hash_Incremental_update(s, msg.data(), msg_len);
+    EverCrypt_Hash_Incremental_finish(s, digest.data());
+  });
+  KRML_ALIGNED_FREE(mem);
+}
+
+BENCHMARK(SHA2_256_streaming_per_thread)->Setup(DoSetup)->Apply(Threads);
+
+BENCHMARK_MAIN();
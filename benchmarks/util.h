@@ -12,6 +12,9 @@
 #include <openssl/sha.h>
 #endif
 
+#include <chrono>
+#include <cmath>
+#include <cstdint>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -23,6 +26,12 @@
 #include "config.h"
 #include "hacl-cpu-features.h"
 
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
 using namespace ::std;
 typedef vector<uint8_t> bytes;
 
@@ -79,6 +88,179 @@ vec256_support()
   return hacl_vec256_support() || EverCrypt_AutoConfig2_has_vec256();
 }
 
+// Cycle counter for per-byte and per-iteration figures. On x86 this is the
+// time-stamp counter, which ticks at the nominal frequency: numbers are only
+// comparable between runs on the same machine, with frequency scaling off.
+// Other targets fall back to the virtual timer (AArch64) or nanoseconds.
+static inline uint64_t
+cpu_cycles()
+{
+#if (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))) ||            \
+  defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#elif defined(__aarch64__) && !defined(_MSC_VER)
+  uint64_t t;
+  __asm__ volatile("mrs %0, cntvct_el0" : "=r"(t));
+  return t;
+#else
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+           std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+#endif
+}
+
+// Log-linear histogram of cycle counts: values below 64 are exact, larger
+// values land in one of 64 buckets per power of two (within 1.6%).
+class latency_histogram
+{
+public:
+  static const int sub_bits = 6;
+  static const uint64_t sub = (uint64_t)1 << sub_bits;
+
+  latency_histogram()
+    : counts(sub * (64 - sub_bits + 1), 0)
+    , n(0)
+  {
+  }
+
+  void add(uint64_t v)
+  {
+    counts[bucket(v)]++;
+    n++;
+  }
+
+  uint64_t count() const { return n; }
+
+  // Smallest bucket index below which at least a fraction `q` of the samples
+  // lie.
+  size_t quantile_bucket(double q) const
+  {
+    uint64_t target = (uint64_t)ceil(q * (double)n), seen = 0;
+    for (size_t i = 0; i < counts.size(); i++) {
+      seen += counts[i];
+      if (seen >= target && seen > 0) {
+        return i;
+      }
+    }
+    return counts.size() - 1;
+  }
+
+  double quantile(double q) const { return value(quantile_bucket(q)); }
+
+  // Mean and variance of the samples in buckets [0, last].
+  void moments(size_t last, double& mean, double& var, uint64_t& k) const
+  {
+    double s = 0, s2 = 0;
+    k = 0;
+    for (size_t i = 0; i <= last && i < counts.size(); i++) {
+      double v = value(i);
+      s += v * (double)counts[i];
+      s2 += v * v * (double)counts[i];
+      k += counts[i];
+    }
+    mean = k > 0 ? s / (double)k : 0;
+    var = k > 1 ? (s2 - s * mean) / (double)(k - 1) : 0;
+  }
+
+  void merge(const latency_histogram& h)
+  {
+    for (size_t i = 0; i < counts.size(); i++) {
+      counts[i] += h.counts[i];
+    }
+    n += h.n;
+  }
+
+private:
+  vector<uint64_t> counts;
+  uint64_t n;
+
+  static size_t bucket(uint64_t v)
+  {
+    if (v < sub) {
+      return (size_t)v;
+    }
+    int msb = sub_bits;
+    while (v >> (msb + 1)) {
+      msb++;
+    }
+    int shift = msb - sub_bits;
+    return (size_t)(shift + 1) * sub + (size_t)((v >> shift) - sub);
+  }
+
+  // Midpoint of a bucket.
+  static double value(size_t i)
+  {
+    if (i < sub) {
+      return (double)i;
+    }
+    int shift = (int)(i / sub) - 1;
+    double lower = (double)((i % sub + sub) << shift);
+    return lower + (double)(((uint64_t)1 << shift) - 1) / 2;
+  }
+};
+
+// Per-iteration latency of a benchmark, split into two input classes in the
+// style of dudect: class 0 repeats one fixed input, class 1 draws fresh
+// inputs. Besides the percentiles and the coefficient of variation of all
+// samples, `report` runs Welch's t-test between the two classes; |t| above
+// 4.5 means the running time depends on the input, which for constant-time
+// code is a regression. The classes should be interleaved at random so that
+// drift affects both alike.
+class latency_recorder
+{
+public:
+  template<typename F>
+  void record(int input_class, F op)
+  {
+    uint64_t start = cpu_cycles();
+    op();
+    uint64_t end = cpu_cycles();
+    classes[input_class].add(end - start);
+  }
+
+  void report(benchmark::State& state, const char* name)
+  {
+    latency_histogram all;
+    all.merge(classes[0]);
+    all.merge(classes[1]);
+    if (all.count() == 0) {
+      return;
+    }
+
+    double mean, var;
+    uint64_t k;
+    all.moments(SIZE_MAX, mean, var, k);
+    state.counters["p50"] = all.quantile(0.5);
+    state.counters["p99"] = all.quantile(0.99);
+    state.counters["p999"] = all.quantile(0.999);
+    state.counters["cv"] = mean > 0 ? sqrt(var) / mean : 0;
+
+    // Interrupts and migrations only ever add time, so, as in dudect, the
+    // test is repeated on the samples below several percentiles of the
+    // whole and the largest statistic is kept.
+    double t = 0;
+    for (double q : { 0.5, 0.75, 0.9, 0.99 }) {
+      size_t crop = all.quantile_bucket(q);
+      double m0, v0, m1, v1;
+      uint64_t k0, k1;
+      classes[0].moments(crop, m0, v0, k0);
+      classes[1].moments(crop, m1, v1, k1);
+      if (k0 > 1 && k1 > 1 && v0 + v1 > 0) {
+        t = max(t, fabs(m0 - m1) / sqrt(v0 / (double)k0 + v1 / (double)k1));
+      }
+    }
+    state.counters["t"] = t;
+    if (t > 4.5) {
+      cerr << "warning: " << name
+           << ": running time depends on the input (|t| = " << t << ")"
+           << endl;
+    }
+  }
+
+private:
+  latency_histogram classes[2];
+};
+
 vector<uint8_t>
 from_hex(const string& hex)
 {
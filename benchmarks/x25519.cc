@@ -9,12 +9,18 @@
 #include "EverCrypt_Curve25519.h"
 #include "Hacl_Curve25519_51.h"
 
+#include <memory>
+
 #include "util.h"
 
 #if HACL_CAN_COMPILE_VALE
 #include "Hacl_Curve25519_64.h"
 #endif
 
+#ifdef HACL_CAN_COMPILE_VEC256
+#include "Hacl_Curve25519_Vec256.h"
+#endif
+
 static void
 setup(bytes& x, bytes& y, bytes& pk_x, bytes& expected_res)
 {
@@ -97,6 +103,77 @@ EverCrypt_x25519(benchmark::State& state)
 
 BENCHMARK(EverCrypt_x25519)->Setup(DoSetup);
 
+// Batched exchanges. Items processed are handshakes, so the reported
+// items_per_second is the aggregate handshake rate.
+
+#ifdef HACL_CAN_COMPILE_VEC256
+static void
+HACL_x25519_vec256_4x(benchmark::State& state)
+{
+  if (!vec256_support()) {
+    state.SkipWithError("No vec256 support");
+    return;
+  }
+
+  bytes x, y, pk_x, expected_res;
+  setup(x, y, pk_x, expected_res);
+  bytes pk(32);
+  Hacl_Curve25519_51_secret_to_public(pk.data(), x.data());
+
+  bytes priv(4 * 32), pub(4 * 32);
+  for (size_t i = 0; i < 4; i++) {
+    copy(y.begin(), y.end(), priv.begin() + 32 * i);
+    copy(pk.begin(), pk.end(), pub.begin() + 32 * i);
+  }
+
+  bytes res(4 * 32);
+  bool valid[4];
+  for (auto _ : state) {
+    Hacl_Curve25519_Vec256_ecdh4(res.data(), priv.data(), pub.data(), valid);
+    if (!equal(expected_res.begin(), expected_res.end(), res.begin() + 96)) {
+      state.SkipWithError("Error in x25519");
+      break;
+    }
+  }
+  state.SetItemsProcessed(4 * state.iterations());
+}
+
+BENCHMARK(HACL_x25519_vec256_4x)->Setup(DoSetup);
+#endif
+
+static void
+EverCrypt_x25519_batch(benchmark::State& state)
+{
+  bytes x, y, pk_x, expected_res;
+  setup(x, y, pk_x, expected_res);
+  bytes pk(32);
+  EverCrypt_Curve25519_secret_to_public(pk.data(), x.data());
+
+  uint32_t len = static_cast<uint32_t>(state.range(0));
+  bytes priv(len * 32), pub(len * 32);
+  for (size_t i = 0; i < len; i++) {
+    copy(y.begin(), y.end(), priv.begin() + 32 * i);
+    copy(pk.begin(), pk.end(), pub.begin() + 32 * i);
+  }
+
+  bytes res(len * 32);
+  unique_ptr<bool[]> valid(new bool[len]);
+  for (auto _ : state) {
+    EverCrypt_Curve25519_ecdh_batch(len,
+                                    res.data(),
+                                    priv.data(),
+                                    pub.data(),
+                                    valid.get());
+    if (!equal(expected_res.begin(), expected_res.end(), res.begin())) {
+      state.SkipWithError("Error in x25519");
+      break;
+    }
+  }
+  state.SetItemsProcessed(len * state.iterations());
+}
+
+BENCHMARK(EverCrypt_x25519_batch)->Setup(DoSetup)->Arg(1)->Arg(4)->Arg(16);
+
 #ifndef NO_OPENSSL
 static void
 OpenSSL_x25519(benchmark::State& state)
@@ -1,6 +1,7 @@
 set(SOURCES_std
 	${PROJECT_SOURCE_DIR}/src/Hacl_NaCl.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_Salsa20.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_AES128.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_Poly1305_32.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_Curve25519_51.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_HMAC_DRBG.c
@@ -40,7 +41,11 @@ set(SOURCES_std
 	${PROJECT_SOURCE_DIR}/src/Hacl_Frodo640.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_Frodo976.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_Frodo64.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_Frodo640_AES.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_Frodo976_AES.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_Frodo1344_AES.c
 	${PROJECT_SOURCE_DIR}/src/EverCrypt_DRBG.c
+	${PROJECT_SOURCE_DIR}/src/EverCrypt_Random.c
 	${PROJECT_SOURCE_DIR}/src/Lib_RandomBuffer_System.c
 	${PROJECT_SOURCE_DIR}/src/EverCrypt_HMAC.c
 	${PROJECT_SOURCE_DIR}/src/EverCrypt_Hash.c
@@ -48,11 +53,14 @@ set(SOURCES_std
 	${PROJECT_SOURCE_DIR}/src/Lib_Memzero0.c
 	${PROJECT_SOURCE_DIR}/src/EverCrypt_Ed25519.c
 	${PROJECT_SOURCE_DIR}/src/EverCrypt_Curve25519.c
+	${PROJECT_SOURCE_DIR}/src/EverCrypt_FFDHE.c
+	${PROJECT_SOURCE_DIR}/src/EverCrypt_Frodo.c
 	${PROJECT_SOURCE_DIR}/src/EverCrypt_HKDF.c
 	${PROJECT_SOURCE_DIR}/src/EverCrypt_Cipher.c
 	${PROJECT_SOURCE_DIR}/src/EverCrypt_Chacha20Poly1305.c
 	${PROJECT_SOURCE_DIR}/src/EverCrypt_Poly1305.c
 	${PROJECT_SOURCE_DIR}/src/EverCrypt_AEAD.c
+	${PROJECT_SOURCE_DIR}/src/EverCrypt_Instrumentation.c
 )
 set(SOURCES_vec256
 	${PROJECT_SOURCE_DIR}/src/Hacl_Hash_Blake2b_256.c
@@ -60,6 +68,7 @@ set(SOURCES_vec256
 	${PROJECT_SOURCE_DIR}/src/Hacl_Chacha20Poly1305_256.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_Poly1305_256.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_Chacha20_Vec256.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_Salsa20_Vec256.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_Streaming_Poly1305_256.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_SHA2_Vec256.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_HKDF_Blake2b_256.c
@@ -67,6 +76,8 @@ set(SOURCES_vec256
 	${PROJECT_SOURCE_DIR}/src/Hacl_HPKE_Curve51_CP256_SHA256.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_HPKE_Curve51_CP256_SHA512.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_HPKE_P256_CP256_SHA256.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_Curve25519_Vec256.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_Frodo_Matrix_Vec256.c
 )
 set(SOURCES_vec128
 	${PROJECT_SOURCE_DIR}/src/Hacl_Hash_Blake2s_128.c
@@ -77,6 +88,8 @@ set(SOURCES_vec128
 	${PROJECT_SOURCE_DIR}/src/Hacl_Chacha20Poly1305_128.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_Poly1305_128.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_Chacha20_Vec128.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_Salsa20_Vec128.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_AES128_NI.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_Streaming_Poly1305_128.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_SHA2_Vec128.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_HKDF_Blake2s_128.c
@@ -84,6 +97,10 @@ set(SOURCES_vec128
 	${PROJECT_SOURCE_DIR}/src/Hacl_HPKE_Curve51_CP128_SHA256.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_HPKE_Curve51_CP128_SHA512.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_HPKE_P256_CP128_SHA256.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_Frodo_Matrix_Vec128.c
+)
+set(SOURCES_ifma
+	${PROJECT_SOURCE_DIR}/src/Hacl_Bignum_IFMA.c
 )
 set(SOURCES_m32
 	
@@ -152,6 +169,8 @@ set(INCLUDES
 	${PROJECT_SOURCE_DIR}/include/Hacl_Bignum256_32.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Bignum.h
 	${PROJECT_SOURCE_DIR}/include/internal/Hacl_Bignum.h
+	${PROJECT_SOURCE_DIR}/include/internal/Hacl_Bignum_IFMA.h
+	${PROJECT_SOURCE_DIR}/include/internal/Hacl_Bignum_ADX.h
 	${PROJECT_SOURCE_DIR}/include/internal/../Hacl_Bignum.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Bignum256.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Bignum32.h
@@ -169,12 +188,14 @@ set(INCLUDES
 	${PROJECT_SOURCE_DIR}/include/Hacl_Chacha20Poly1305_128.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Poly1305_128.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Chacha20_Vec128.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_Salsa20_Vec128.h
 	${PROJECT_SOURCE_DIR}/include/internal/Hacl_Poly1305_128.h
 	${PROJECT_SOURCE_DIR}/include/internal/../Hacl_Poly1305_128.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Streaming_Poly1305_128.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Chacha20Poly1305_256.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Poly1305_256.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Chacha20_Vec256.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_Salsa20_Vec256.h
 	${PROJECT_SOURCE_DIR}/include/internal/Hacl_Poly1305_256.h
 	${PROJECT_SOURCE_DIR}/include/internal/../Hacl_Poly1305_256.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Streaming_Poly1305_256.h
@@ -189,7 +210,8 @@ set(INCLUDES
 	${PROJECT_SOURCE_DIR}/include/internal/Hacl_Bignum_K256.h
 	${PROJECT_SOURCE_DIR}/include/internal/../Hacl_K256_ECDSA.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_EC_K256.h
-	${PROJECT_SOURCE_DIR}/include/Hacl_FFDHE.h
+	${PROJECT_SOURCE_DIR}/include/internal/Hacl_FFDHE.h
+	${PROJECT_SOURCE_DIR}/include/internal/../Hacl_FFDHE.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Spec.h
 	${PROJECT_SOURCE_DIR}/include/internal/Hacl_Impl_FFDHE_Constants.h
 	${PROJECT_SOURCE_DIR}/include/internal/Hacl_Hash_SHA3.h
@@ -224,15 +246,36 @@ set(INCLUDES
 	${PROJECT_SOURCE_DIR}/include/Hacl_HPKE_P256_CP128_SHA256.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_HPKE_P256_CP32_SHA256.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Frodo1344.h
+	${PROJECT_SOURCE_DIR}/include/internal/Hacl_Frodo1344.h
+	${PROJECT_SOURCE_DIR}/include/internal/../Hacl_Frodo1344.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Hash_SHA3.h
 	${PROJECT_SOURCE_DIR}/include/internal/Hacl_Spec.h
 	${PROJECT_SOURCE_DIR}/include/internal/../Hacl_Spec.h
 	${PROJECT_SOURCE_DIR}/include/internal/Hacl_Frodo_KEM.h
 	${PROJECT_SOURCE_DIR}/include/Lib_RandomBuffer_System.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Frodo640.h
+	${PROJECT_SOURCE_DIR}/include/internal/Hacl_Frodo640.h
+	${PROJECT_SOURCE_DIR}/include/internal/../Hacl_Frodo640.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Frodo976.h
+	${PROJECT_SOURCE_DIR}/include/internal/Hacl_Frodo976.h
+	${PROJECT_SOURCE_DIR}/include/internal/../Hacl_Frodo976.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Frodo64.h
+	${PROJECT_SOURCE_DIR}/include/internal/Hacl_Frodo64.h
+	${PROJECT_SOURCE_DIR}/include/internal/../Hacl_Frodo64.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_Frodo640_AES.h
+	${PROJECT_SOURCE_DIR}/include/internal/Hacl_Frodo640_AES.h
+	${PROJECT_SOURCE_DIR}/include/internal/../Hacl_Frodo640_AES.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_Frodo976_AES.h
+	${PROJECT_SOURCE_DIR}/include/internal/Hacl_Frodo976_AES.h
+	${PROJECT_SOURCE_DIR}/include/internal/../Hacl_Frodo976_AES.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_Frodo1344_AES.h
+	${PROJECT_SOURCE_DIR}/include/internal/Hacl_Frodo1344_AES.h
+	${PROJECT_SOURCE_DIR}/include/internal/../Hacl_Frodo1344_AES.h
+	${PROJECT_SOURCE_DIR}/include/internal/Hacl_AES128.h
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_DRBG.h
+	${PROJECT_SOURCE_DIR}/include/internal/EverCrypt_DRBG.h
+	${PROJECT_SOURCE_DIR}/include/internal/../EverCrypt_DRBG.h
+	${PROJECT_SOURCE_DIR}/include/EverCrypt_Random.h
 	${PROJECT_SOURCE_DIR}/include/internal/EverCrypt_HMAC.h
 	${PROJECT_SOURCE_DIR}/include/internal/EverCrypt_Hash.h
 	${PROJECT_SOURCE_DIR}/include/internal/../EverCrypt_Hash.h
@@ -242,11 +285,16 @@ set(INCLUDES
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_Ed25519.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Ed25519.h
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_Curve25519.h
+	${PROJECT_SOURCE_DIR}/include/EverCrypt_FFDHE.h
+	${PROJECT_SOURCE_DIR}/include/EverCrypt_Frodo.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_Curve25519_Vec256.h
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_HKDF.h
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_Cipher.h
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_Chacha20Poly1305.h
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_Poly1305.h
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_AEAD.h
+	${PROJECT_SOURCE_DIR}/include/EverCrypt_Instrumentation.h
+	${PROJECT_SOURCE_DIR}/include/internal/EverCrypt_Instrumentation.h
 )
 set(PUBLIC_INCLUDES
 	${PROJECT_SOURCE_DIR}/include/Hacl_NaCl.h
@@ -300,11 +348,13 @@ set(PUBLIC_INCLUDES
 	${PROJECT_SOURCE_DIR}/include/Hacl_Chacha20Poly1305_128.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Poly1305_128.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Chacha20_Vec128.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_Salsa20_Vec128.h
 	${PROJECT_SOURCE_DIR}/include/internal/../Hacl_Poly1305_128.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Streaming_Poly1305_128.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Chacha20Poly1305_256.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Poly1305_256.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Chacha20_Vec256.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_Salsa20_Vec256.h
 	${PROJECT_SOURCE_DIR}/include/internal/../Hacl_Poly1305_256.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Streaming_Poly1305_256.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Curve25519_64.h
@@ -348,7 +398,11 @@ set(PUBLIC_INCLUDES
 	${PROJECT_SOURCE_DIR}/include/Hacl_Frodo640.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Frodo976.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Frodo64.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_Frodo640_AES.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_Frodo976_AES.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_Frodo1344_AES.h
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_DRBG.h
+	${PROJECT_SOURCE_DIR}/include/EverCrypt_Random.h
 	${PROJECT_SOURCE_DIR}/include/internal/../EverCrypt_Hash.h
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_Error.h
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_AutoConfig2.h
@@ -356,11 +410,15 @@ set(PUBLIC_INCLUDES
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_Ed25519.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Ed25519.h
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_Curve25519.h
+	${PROJECT_SOURCE_DIR}/include/EverCrypt_FFDHE.h
+	${PROJECT_SOURCE_DIR}/include/EverCrypt_Frodo.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_Curve25519_Vec256.h
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_HKDF.h
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_Cipher.h
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_Chacha20Poly1305.h
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_Poly1305.h
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_AEAD.h
+	${PROJECT_SOURCE_DIR}/include/EverCrypt_Instrumentation.h
 )
 set(ALGORITHMS
 	nacl
@@ -418,6 +476,9 @@ set(TEST_SOURCES
 	${PROJECT_SOURCE_DIR}/tests/nacl.cc
 	${PROJECT_SOURCE_DIR}/tests/evercrypt.cc
 	${PROJECT_SOURCE_DIR}/tests/aead.cc
+	${PROJECT_SOURCE_DIR}/tests/hpke.cc
+	${PROJECT_SOURCE_DIR}/tests/frodo.cc
+	${PROJECT_SOURCE_DIR}/tests/ffdhe.cc
 )
 set(BENCHMARK_SOURCES
 	${PROJECT_SOURCE_DIR}/benchmarks/blake.cc
@@ -434,7 +495,14 @@ set(BENCHMARK_SOURCES
 	${PROJECT_SOURCE_DIR}/benchmarks/kdf.cc
 	${PROJECT_SOURCE_DIR}/benchmarks/drbg.cc
 	${PROJECT_SOURCE_DIR}/benchmarks/hmac.cc
+	${PROJECT_SOURCE_DIR}/benchmarks/hpke.cc
 	${PROJECT_SOURCE_DIR}/benchmarks/rsapss.cc
+	${PROJECT_SOURCE_DIR}/benchmarks/frodo.cc
+	${PROJECT_SOURCE_DIR}/benchmarks/ffdhe.cc
+	${PROJECT_SOURCE_DIR}/benchmarks/sweep.cc
+	${PROJECT_SOURCE_DIR}/benchmarks/threads.cc
+	${PROJECT_SOURCE_DIR}/benchmarks/latency.cc
+	${PROJECT_SOURCE_DIR}/benchmarks/matrix.cc
 )
 set(VALE_SOURCES_osx
 	${PROJECT_SOURCE_DIR}/vale/src/cpuid-x86_64-darwin.S
@@ -486,6 +554,9 @@ set(ALGORITHM_TEST_FILES
 	TEST_FILES_nacl
 	TEST_FILES_evercrypt
 	TEST_FILES_aead
+	TEST_FILES_hpke
+	TEST_FILES_frodo
+	TEST_FILES_ffdh
 )
 set(TEST_FILES_detection
 	detection.cc
@@ -553,3 +624,12 @@ set(TEST_FILES_evercrypt
 set(TEST_FILES_aead
 	aead.cc
 )
+set(TEST_FILES_hpke
+	hpke.cc
+)
+set(TEST_FILES_frodo
+	frodo.cc
+)
+set(TEST_FILES_ffdh
+	ffdhe.cc
+)
@@ -0,0 +1,11 @@
+#include <immintrin.h>
+#include <stdint.h>
+
+int main () {
+  uint64_t block[8] = { 0 };
+  __m512i a = _mm512_loadu_si512((void *)block);
+  __m512i b = _mm512_madd52lo_epu64(a, a, a);
+  __m512i c = _mm512_madd52hi_epu64(b, a, a);
+  _mm512_storeu_si512((void *)block, c);
+  return (int)block[0];
+}
@@ -3,6 +3,7 @@
 # They all default to off and have to be explicitely enabled.
 option(DISABLE_VEC128 "Disable code requiring vec128 hardware support.")
 option(DISABLE_VEC256 "Disable code requiring vec256 hardware support.")
+option(DISABLE_IFMA "Disable code requiring AVX-512 IFMA hardware support.")
 option(DISABLE_VALE "Disable vale code.")
 option(DISABLE_INLINE_ASM "Disable inline assembly code.")
 option(DISABLE_INTRINSICS "Disable intrinsics.")
@@ -14,6 +15,10 @@ if(DISABLE_VEC256)
     set(TOOLCHAIN_CAN_COMPILE_VEC256 OFF)
     message(STATUS "vec256 support: ${TOOLCHAIN_CAN_COMPILE_VEC256} (MANUALLY DISABLED)")
 endif()
+if(DISABLE_IFMA)
+    set(TOOLCHAIN_CAN_COMPILE_IFMA OFF)
+    message(STATUS "ifma support: ${TOOLCHAIN_CAN_COMPILE_IFMA} (MANUALLY DISABLED)")
+endif()
 if(DISABLE_VALE)
     set(TOOLCHAIN_CAN_COMPILE_VALE OFF)
     message(STATUS "vale support: ${TOOLCHAIN_CAN_COMPILE_VALE} (MANUALLY DISABLED)")
@@ -25,6 +30,19 @@ if(DISABLE_INTRINSICS)
     set(TOOLCHAIN_CAN_COMPILE_INTRINSICS OFF)
 endif()
 
+# Instrumentation of the EverCrypt agile layer (EverCrypt_Instrumentation.h).
+# Off by default; call sites compile to nothing unless enabled.
+option(ENABLE_INSTRUMENTATION "Enable EverCrypt implementation counters and tracing hooks.")
+if(ENABLE_INSTRUMENTATION)
+    set(HACL_INSTRUMENTATION 1)
+    include(CheckIncludeFile)
+    check_include_file(sys/sdt.h HACL_HAS_SYS_SDT_H)
+    if(HACL_HAS_SYS_SDT_H)
+        set(HACL_INSTRUMENTATION_USDT 1)
+    endif()
+    message(STATUS "EverCrypt instrumentation: ON (USDT probes: ${HACL_INSTRUMENTATION_USDT})")
+endif()
+
 # Enable tests.
 # By default tests aren't built
 option(ENABLE_TESTS "Enable HACL tests.")
@@ -82,6 +82,20 @@ if(NOT DEFINED TOOLCHAIN_CAN_COMPILE_VEC256)
 endif()
 message(STATUS "vec256 support: ${TOOLCHAIN_CAN_COMPILE_VEC256}")
 
+## Check for AVX-512 IFMA support
+if(NOT DEFINED TOOLCHAIN_CAN_COMPILE_IFMA)
+    set(TOOLCHAIN_CAN_COMPILE_IFMA FALSE)
+    # Only on x64, where the CPU support is detected with the vale cpuid checks.
+    if(CMAKE_SYSTEM_PROCESSOR MATCHES "x86_64|amd64|AMD64")
+        try_compile(TOOLCHAIN_CAN_COMPILE_IFMA
+                            ${PROJECT_SOURCE_DIR}/config/build
+                            ${PROJECT_SOURCE_DIR}/config/ifma.c
+                            COMPILE_DEFINITIONS "-mavx512f -mavx512ifma"
+                    )
+    endif()
+endif()
+message(STATUS "ifma support: ${TOOLCHAIN_CAN_COMPILE_IFMA}")
+
 ## Check for vale support
 if(NOT DEFINED TOOLCHAIN_CAN_COMPILE_VALE)
     # Always enable for x64
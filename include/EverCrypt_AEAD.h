@@ -42,6 +42,9 @@ extern "C" {
 
 typedef struct EverCrypt_AEAD_state_s_s EverCrypt_AEAD_state_s;
 
+/* Alignment of the memory passed to `EverCrypt_AEAD_init_in_place`. */
+#define EVERCRYPT_AEAD_STATE_ALIGN ((uint32_t)16U)
+
 /**
 Both encryption and decryption require a state that holds the key.
 The state may be reused as many times as desired.
@@ -76,6 +79,41 @@ Note: The caller must free the AEAD state by calling `EverCrypt_AEAD_free`.
 EverCrypt_Error_error_code
 EverCrypt_AEAD_create_in(Spec_Agile_AEAD_alg a, EverCrypt_AEAD_state_s **dst, uint8_t *k);
 
+/**
+Size in bytes of the memory that `EverCrypt_AEAD_init_in_place` needs for a
+state of algorithm `a`, or 0 for an unknown algorithm. The memory must be
+aligned on `EVERCRYPT_AEAD_STATE_ALIGN` bytes.
+*/
+uint32_t EverCrypt_AEAD_state_size(Spec_Agile_AEAD_alg a);
+
+/**
+Create the AEAD state for the algorithm in caller-provided memory.
+
+This is `EverCrypt_AEAD_create_in` without allocation: the state and the
+expanded key are stored in `mem`, so they can be embedded in a connection
+structure or taken from an arena or a pool. The state must not be passed to
+`EverCrypt_AEAD_free`; `mem` holds key material and should be wiped (e.g. with
+`Lib_Memzero0_memzero`) before it is reused or released.
+
+@param a The algorithm, as for `EverCrypt_AEAD_create_in`.
+@param mem Pointer to `EverCrypt_AEAD_state_size(a)` bytes of memory, aligned on
+  `EVERCRYPT_AEAD_STATE_ALIGN` bytes.
+@param dst Pointer to a pointer where the address of the state (equal to `mem`)
+  will be written to.
+@param k Pointer to `KEY_LEN` bytes of memory where the key is read from.
+
+@return The function returns `EverCrypt_Error_Success` on success or
+  `EverCrypt_Error_UnsupportedAlgorithm` in case of a bad algorithm identifier
+  or, for AES-GCM, a CPU without the required instructions.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_init_in_place(
+  Spec_Agile_AEAD_alg a,
+  uint8_t *mem,
+  EverCrypt_AEAD_state_s **dst,
+  uint8_t *k
+);
+
 /**
 Encrypt and authenticate a message (`plain`) with associated data (`ad`).
 
@@ -342,6 +380,76 @@ EverCrypt_AEAD_decrypt_expand(
   uint8_t *dst
 );
 
+/**
+Encrypt and authenticate a batch of `n` messages with one call.
+
+The messages are laid out back to back: the `i`-th plaintext takes `plain_len[i]`
+bytes of `plain` and is encrypted into the same range of `cipher`, and the `i`-th
+associated data takes `ad_len[i]` bytes of `ad`.
+
+@param s Pointer to the AEAD state created by `EverCrypt_AEAD_create_in`. It already contains the encryption key.
+@param n Number of messages in the batch.
+@param iv Pointer to `n * iv_len` bytes of memory where the nonces are read from.
+@param iv_len Length of each nonce.
+@param ad Pointer to the concatenated associated data.
+@param ad_len Pointer to `n` lengths of associated data.
+@param plain Pointer to the concatenated plaintexts.
+@param plain_len Pointer to `n` plaintext lengths.
+@param cipher Pointer to memory of the combined plaintext length where the ciphertexts are written to.
+@param tag Pointer to `n * 16` bytes of memory where the tags are written to.
+
+@return `EverCrypt_Error_Success`, or the first error returned by `EverCrypt_AEAD_encrypt`, in which case the remaining messages are not encrypted.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_batch(
+  EverCrypt_AEAD_state_s *s,
+  uint32_t n,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t *ad_len,
+  uint8_t *plain,
+  uint32_t *plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+);
+
+/**
+Verify and decrypt a batch of `n` messages with one call.
+
+The layout is the one of `EverCrypt_AEAD_encrypt_batch`: the `i`-th ciphertext takes
+`cipher_len[i]` bytes of `cipher` and is decrypted into the same range of `dst`.
+A message that fails to authenticate does not stop the batch.
+
+@param s Pointer to the AEAD state created by `EverCrypt_AEAD_create_in`. It already contains the encryption key.
+@param n Number of messages in the batch.
+@param iv Pointer to `n * iv_len` bytes of memory where the nonces are read from.
+@param iv_len Length of each nonce.
+@param ad Pointer to the concatenated associated data.
+@param ad_len Pointer to `n` lengths of associated data.
+@param cipher Pointer to the concatenated ciphertexts.
+@param cipher_len Pointer to `n` ciphertext lengths.
+@param tag Pointer to `n * 16` bytes of memory where the tags are read from.
+@param dst Pointer to memory of the combined ciphertext length where the plaintexts are written to.
+@param valid Pointer to `n` booleans, set to whether the corresponding message was authenticated.
+
+@return `EverCrypt_Error_Success` if every message was authenticated, and the error of the first message that was not otherwise. Only the plaintexts whose `valid` entry is `true` may be used.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_batch(
+  EverCrypt_AEAD_state_s *s,
+  uint32_t n,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t *ad_len,
+  uint8_t *cipher,
+  uint32_t *cipher_len,
+  uint8_t *tag,
+  uint8_t *dst,
+  bool *valid
+);
+
 /**
 Cleanup and free the AEAD state.
 
@@ -65,6 +65,17 @@ EverCrypt_Ed25519_verify(
   uint8_t *signature
 );
 
+bool
+EverCrypt_Ed25519_expand_public_key(uint64_t *expanded_public_key, uint8_t *public_key);
+
+bool
+EverCrypt_Ed25519_verify_expanded(
+  uint64_t *expanded_public_key,
+  uint32_t msg_len,
+  uint8_t *msg,
+  uint8_t *signature
+);
+
 #if defined(__cplusplus)
 }
 #endif
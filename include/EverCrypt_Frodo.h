@@ -0,0 +1,87 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __EverCrypt_Frodo_H
+#define __EverCrypt_Frodo_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "Hacl_Frodo64.h"
+#include "Hacl_Frodo640.h"
+#include "Hacl_Frodo976.h"
+#include "Hacl_Frodo1344.h"
+#include "Hacl_Frodo640_AES.h"
+#include "Hacl_Frodo976_AES.h"
+#include "Hacl_Frodo1344_AES.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#define EverCrypt_Frodo_Frodo64 0
+#define EverCrypt_Frodo_Frodo640 1
+#define EverCrypt_Frodo_Frodo976 2
+#define EverCrypt_Frodo_Frodo1344 3
+#define EverCrypt_Frodo_Frodo640_AES 4
+#define EverCrypt_Frodo_Frodo976_AES 5
+#define EverCrypt_Frodo_Frodo1344_AES 6
+
+typedef uint8_t EverCrypt_Frodo_alg;
+
+/*
+  FrodoKEM with the CPU features reported by EverCrypt_AutoConfig2 (256- or
+  128-bit vectors for the matrix products, AES-NI for the AES128 sets), which
+  must have been initialized. The results are those of the corresponding
+  Hacl_Frodo* functions, and the key, ciphertext and shared secret sizes are the
+  Hacl_Frodo*_crypto_* constants of the parameter set.
+*/
+
+/**
+Same as `Hacl_Frodo*_crypto_kem_keypair` for the parameter set `a`.
+*/
+uint32_t EverCrypt_Frodo_crypto_kem_keypair(EverCrypt_Frodo_alg a, uint8_t *pk, uint8_t *sk);
+
+/**
+Same as `Hacl_Frodo*_crypto_kem_enc` for the parameter set `a`.
+*/
+uint32_t
+EverCrypt_Frodo_crypto_kem_enc(EverCrypt_Frodo_alg a, uint8_t *ct, uint8_t *ss, uint8_t *pk);
+
+/**
+Same as `Hacl_Frodo*_crypto_kem_dec` for the parameter set `a`.
+*/
+uint32_t
+EverCrypt_Frodo_crypto_kem_dec(EverCrypt_Frodo_alg a, uint8_t *ss, uint8_t *ct, uint8_t *sk);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __EverCrypt_Frodo_H_DEFINED
+#endif
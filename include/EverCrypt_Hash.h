@@ -57,15 +57,35 @@ typedef struct EverCrypt_Hash_Incremental_hash_state_s
 }
 EverCrypt_Hash_Incremental_hash_state;
 
+/* Alignment of the memory passed to `EverCrypt_Hash_Incremental_init_in_place`. */
+#define EVERCRYPT_HASH_INCREMENTAL_STATE_ALIGN ((uint32_t)32U)
+
 /**
 Allocate initial state for the agile hash. The argument `a` stands for the
 choice of algorithm (see Hacl_Spec.h). This API will automatically pick the most
 efficient implementation, provided you have called EverCrypt_AutoConfig2_init()
-before. The state is to be freed by calling `free`.
+before. The state is to be freed by calling `free`. See `init_in_place` for
+an allocation-free variant.
 */
 EverCrypt_Hash_Incremental_hash_state
 *EverCrypt_Hash_Incremental_create_in(Spec_Hash_Definitions_hash_alg a);
 
+/**
+Size in bytes of the memory that `init_in_place` needs for a state of algorithm
+`a`. The memory must be aligned on `EVERCRYPT_HASH_INCREMENTAL_STATE_ALIGN` bytes.
+*/
+uint32_t EverCrypt_Hash_Incremental_state_size(Spec_Hash_Definitions_hash_alg a);
+
+/**
+Initialize a state for algorithm `a` in caller-provided memory `mem`, of
+`state_size(a)` bytes, and return it. The implementation is picked as in
+`create_in`. The state lives entirely in `mem`, so it can be embedded in a larger
+structure or taken from an arena or a pool: it must not be passed to `free`, and
+`mem` may be reused once the state is no longer needed.
+*/
+EverCrypt_Hash_Incremental_hash_state
+*EverCrypt_Hash_Incremental_init_in_place(Spec_Hash_Definitions_hash_alg a, uint8_t *mem);
+
 /**
 Reset an existing state to the initial hash state with empty data.
 */
@@ -121,6 +141,22 @@ EverCrypt_Hash_Incremental_hash(
   uint32_t len
 );
 
+/**
+Hash a batch of `n` messages with one call.
+
+The messages are read back to back from `input`, the `i`-th one taking
+`input_len[i]` bytes, and the digests are written back to back to `dst`, each
+taking `EverCrypt_Hash_Incremental_hash_len(a)` bytes.
+*/
+void
+EverCrypt_Hash_Incremental_hash_batch(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t n,
+  uint8_t *dst,
+  uint8_t *input,
+  uint32_t *input_len
+);
+
 #define MD5_HASH_LEN ((uint32_t)16U)
 
 #define SHA1_HASH_LEN ((uint32_t)20U)
@@ -0,0 +1,150 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __EverCrypt_Instrumentation_H
+#define __EverCrypt_Instrumentation_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+/*******************************************************************************
+
+Counters and tracing hooks for the implementations picked by the agile layer.
+
+`EverCrypt_Hash_Incremental`, `EverCrypt_AEAD` and `EverCrypt_Chacha20Poly1305`
+count, for every implementation they dispatch to, the number of calls and the
+number of bytes processed. Counting only happens when the library is built with
+`ENABLE_INSTRUMENTATION` (which defines `HACL_INSTRUMENTATION` in config.h);
+otherwise the call sites compile to nothing, `EverCrypt_Instrumentation_enabled`
+returns false and snapshots are all zero.
+
+Every thread counts into its own cache-line-aligned slot, so counting never
+takes a lock and never shares a cache line with another thread. Snapshots sum
+over all slots, including those of threads that have exited.
+
+*******************************************************************************/
+
+#define EverCrypt_Instrumentation_MD5 0
+#define EverCrypt_Instrumentation_SHA1 1
+#define EverCrypt_Instrumentation_SHA2_224 2
+#define EverCrypt_Instrumentation_SHA2_224_Vale 3
+#define EverCrypt_Instrumentation_SHA2_256 4
+#define EverCrypt_Instrumentation_SHA2_256_Vale 5
+#define EverCrypt_Instrumentation_SHA2_384 6
+#define EverCrypt_Instrumentation_SHA2_512 7
+#define EverCrypt_Instrumentation_SHA3_224 8
+#define EverCrypt_Instrumentation_SHA3_256 9
+#define EverCrypt_Instrumentation_SHA3_384 10
+#define EverCrypt_Instrumentation_SHA3_512 11
+#define EverCrypt_Instrumentation_Blake2S_32 12
+#define EverCrypt_Instrumentation_Blake2S_128 13
+#define EverCrypt_Instrumentation_Blake2B_32 14
+#define EverCrypt_Instrumentation_Blake2B_256 15
+#define EverCrypt_Instrumentation_AES128_GCM_Vale 16
+#define EverCrypt_Instrumentation_AES256_GCM_Vale 17
+#define EverCrypt_Instrumentation_Chacha20Poly1305_32 18
+#define EverCrypt_Instrumentation_Chacha20Poly1305_128 19
+#define EverCrypt_Instrumentation_Chacha20Poly1305_256 20
+
+typedef uint8_t EverCrypt_Instrumentation_impl;
+
+/**
+Number of implementations; snapshots have this many entries.
+*/
+#define EVERCRYPT_INSTRUMENTATION_IMPLS (21U)
+
+#define EverCrypt_Instrumentation_Enter 0
+#define EverCrypt_Instrumentation_Exit 1
+
+typedef uint8_t EverCrypt_Instrumentation_event;
+
+typedef struct EverCrypt_Instrumentation_counters_s
+{
+  uint64_t calls;
+  uint64_t bytes;
+}
+EverCrypt_Instrumentation_counters;
+
+/**
+Tracing callback, called on entry to and exit from every counted call with the
+implementation and the number of bytes (plaintext or ciphertext for AEADs,
+input for hashes).
+*/
+typedef void
+(*EverCrypt_Instrumentation_hook)(
+  void *ctx,
+  EverCrypt_Instrumentation_event ev,
+  EverCrypt_Instrumentation_impl impl,
+  uint32_t len
+);
+
+/**
+Returns true if the library was built with instrumentation.
+*/
+bool EverCrypt_Instrumentation_enabled(void);
+
+/**
+Name of an implementation, e.g. "SHA2_256_Vale", or NULL if `impl` is out of
+range.
+*/
+const char *EverCrypt_Instrumentation_impl_name(EverCrypt_Instrumentation_impl impl);
+
+/**
+Write the counters of all threads to `dst`, which must point to
+`EVERCRYPT_INSTRUMENTATION_IMPLS` entries indexed by implementation.
+
+Counters are monotonic; take the difference of two snapshots for the activity
+over an interval. A snapshot taken while other threads run may miss their most
+recent calls, but never sees a count go backwards.
+*/
+void EverCrypt_Instrumentation_snapshot(EverCrypt_Instrumentation_counters *dst);
+
+/**
+Install `hook` (or remove it, with NULL) for all threads. `ctx` is passed back
+to every call. A call always sees a hook together with its own `ctx`, but
+calls already in flight may still see the previous hook, so `ctx` must stay
+valid until the process has quiesced. Every distinct (`hook`, `ctx`) pair ever
+installed keeps a small allocation for the lifetime of the process.
+
+When built with `ENABLE_INSTRUMENTATION` on a system that has `<sys/sdt.h>`,
+the library also fires the USDT probes `hacl:enter` and `hacl:exit` (arguments:
+implementation, length), whether or not a hook is installed.
+*/
+void
+EverCrypt_Instrumentation_set_hook(EverCrypt_Instrumentation_hook hook, void *ctx);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __EverCrypt_Instrumentation_H_DEFINED
+#endif
@@ -0,0 +1,96 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __EverCrypt_Random_H
+#define __EverCrypt_Random_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "EverCrypt_DRBG.h"
+
+/**
+Size of the per-thread output buffer. Requests shorter than this are served
+from the buffer, which is refilled with a single DRBG call.
+*/
+#define EVERCRYPT_RANDOM_BUFFER_LEN (4096U)
+
+/**
+Fill a buffer with cryptographically secure random bytes.
+
+Each thread owns a ChaCha20 `EverCrypt_DRBG` instance (see
+`EverCrypt_DRBG_create_chacha20`). It is instantiated from the operating
+system on first use and reseeds itself from the OS every
+`EverCrypt_DRBG_reseed_interval` refills. Output is produced in bulk. Short
+requests are served from a per-thread buffer, and long ones are generated
+directly into `buf` with a single DRBG call, since the ChaCha20 DRBG has no
+limit on the output length of a call. Calls never take a lock. After
+`fork`, the child discards the state, including any buffered output.
+
+@param buf Pointer to `len` bytes of memory where random output is written to.
+@param len Length of desired output. There is no upper bound.
+
+@return True if and only if `len` random bytes were written. This can only fail
+  if the operating system entropy source fails.
+*/
+bool EverCrypt_Random_bytes(uint8_t *buf, uint32_t len);
+
+/**
+Reseed the calling thread's DRBG from the operating system and drop any
+buffered output.
+
+@return True if and only if the reseed was successful.
+*/
+bool EverCrypt_Random_reseed(void);
+
+/**
+Release the calling thread's DRBG state.
+
+This happens automatically when a thread exits. Call it explicitly to wipe the
+state early. The next call to `EverCrypt_Random_bytes` creates a fresh state.
+*/
+void EverCrypt_Random_thread_cleanup(void);
+
+/**
+Shorthand for `EverCrypt_Random_bytes`.
+*/
+static inline bool hacl_random_bytes(uint8_t *buf, uint32_t len)
+{
+  return EverCrypt_Random_bytes(buf, len);
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __EverCrypt_Random_H_DEFINED
+#endif
@@ -86,6 +86,304 @@ Hacl_HPKE_Curve64_CP128_SHA512_openBase(
   uint8_t *o_pt
 );
 
+/**
+Allocate an HPKE context for `Hacl_HPKE_Curve64_CP128_SHA512_setupBaseS` / `Hacl_HPKE_Curve64_CP128_SHA512_setupBaseR`.
+
+The context keeps the AEAD key, base nonce, sequence number and exporter secret
+between messages, so a stream of messages only pays for the KEM once. It must be
+freed with `Hacl_HPKE_Curve64_CP128_SHA512_context_free`, which also wipes it.
+*/
+Hacl_Impl_HPKE_context_s Hacl_HPKE_Curve64_CP128_SHA512_context_malloc(void);
+
+/**
+Wipe and free a context allocated with `Hacl_HPKE_Curve64_CP128_SHA512_context_malloc`.
+*/
+void Hacl_HPKE_Curve64_CP128_SHA512_context_free(Hacl_Impl_HPKE_context_s ctx);
+
+/**
+Encrypt the next message on a sender context (RFC 9180, Section 5.2).
+
+The nonce is derived from the base nonce and the sequence number, which is
+then incremented.
+
+@param ctx Sender context set up with `Hacl_HPKE_Curve64_CP128_SHA512_setupBaseS`.
+@param o_ct Output buffer of `plainlen + 16` bytes: ciphertext followed by the tag.
+
+@return 0 on success, 1 if the sequence number is exhausted.
+*/
+uint32_t
+Hacl_HPKE_Curve64_CP128_SHA512_seal(
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t plainlen,
+  uint8_t *plain,
+  uint8_t *o_ct
+);
+
+/**
+Decrypt the next message on a receiver context (RFC 9180, Section 5.2).
+
+The sequence number is only incremented if decryption succeeds.
+
+@param ctx Receiver context set up with `Hacl_HPKE_Curve64_CP128_SHA512_setupBaseR`.
+@param ct Ciphertext followed by the 16-byte tag, `ctlen` bytes in total.
+@param o_pt Output buffer of `ctlen - 16` bytes.
+
+@return 0 on success, 1 if authentication fails or the sequence number is exhausted.
+*/
+uint32_t
+Hacl_HPKE_Curve64_CP128_SHA512_open(
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t ctlen,
+  uint8_t *ct,
+  uint8_t *o_pt
+);
+
+/**
+Derive a secret from the exporter secret of a context (RFC 9180, Section 5.3).
+
+@param exp_ctx Exporter context of `exp_ctxlen` bytes.
+@param l Length of the exported secret, at most 255 * 64 bytes.
+@param o_secret Output buffer of `l` bytes.
+
+@return 0 on success, 1 if `l` is too large.
+*/
+uint32_t
+Hacl_HPKE_Curve64_CP128_SHA512_export(
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t exp_ctxlen,
+  uint8_t *exp_ctx,
+  uint32_t l,
+  uint8_t *o_secret
+);
+
+/**
+Encrypt one message for `n` recipients (multi-recipient Base mode).
+
+The payload is encrypted once with ChaCha20-Poly1305 under the caller-provided
+data encryption key `dek`, with an all-zero nonce; `dek` must therefore be fresh
+random bytes for every call. `dek` is then wrapped for each recipient with
+`Hacl_HPKE_Curve64_CP128_SHA512_sealBase` (empty aad), using a distinct ephemeral key per recipient, so
+each (`enc`, `wrapped`) pair is a standard single-shot HPKE ciphertext.
+
+Any recipient can decrypt the payload, and hence also forge payloads for the
+other recipients; sign the message if recipients must not trust each other.
+
+@param n Number of recipients.
+@param skE Ephemeral secret keys, `32 * n` bytes.
+@param pkR Recipient public keys, `32 * n` bytes.
+@param dek Data encryption key, 32 bytes.
+@param o_enc Output buffer of `32 * n` bytes for the encapsulated keys.
+@param o_wrapped Output buffer of `48 * n` bytes for the wrapped `dek`s.
+@param o_ct Output buffer of `plainlen + 16` bytes: ciphertext followed by the tag.
+
+@return 0 on success, 1 if the key exchange failed for any recipient.
+*/
+uint32_t
+Hacl_HPKE_Curve64_CP128_SHA512_sealBaseMulti(
+  uint32_t n,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t plainlen,
+  uint8_t *plain,
+  uint8_t *dek,
+  uint8_t *o_enc,
+  uint8_t *o_wrapped,
+  uint8_t *o_ct
+);
+
+/**
+Decrypt a message produced by `Hacl_HPKE_Curve64_CP128_SHA512_sealBaseMulti`.
+
+@param pkE Encapsulated key of this recipient.
+@param wrapped Wrapped `dek` of this recipient, 48 bytes.
+@param ct Ciphertext followed by the 16-byte tag, `ctlen` bytes in total.
+@param o_pt Output buffer of `ctlen - 16` bytes.
+
+@return 0 on success, 1 on failure.
+*/
+uint32_t
+Hacl_HPKE_Curve64_CP128_SHA512_openBaseMulti(
+  uint8_t *pkE,
+  uint8_t *skR,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint8_t *wrapped,
+  uint32_t ctlen,
+  uint8_t *ct,
+  uint8_t *o_pt
+);
+
+/**
+Allocate a receiver key object for the `Hacl_HPKE_Curve64_CP128_SHA512_setup*R` functions that take one.
+
+The object holds the receiver's secret key together with its serialized public
+key, which is also the constant half of the KEM context. Decapsulating with it
+saves the `secret_to_public` computation that `Hacl_HPKE_Curve64_CP128_SHA512_setupBaseR` does for every
+message. The object is never modified after `Hacl_HPKE_Curve64_CP128_SHA512_receiver_key_init`, so it can
+be shared between threads. It must be freed with `Hacl_HPKE_Curve64_CP128_SHA512_receiver_key_free`.
+*/
+Hacl_Impl_HPKE_receiver_key_s Hacl_HPKE_Curve64_CP128_SHA512_receiver_key_malloc(void);
+
+/**
+Load the secret key `skR` (32 bytes) into a receiver key object and compute
+its public key.
+
+@return 0 on success, 1 if `skR` is not a valid secret key.
+*/
+uint32_t Hacl_HPKE_Curve64_CP128_SHA512_receiver_key_init(Hacl_Impl_HPKE_receiver_key_s key, uint8_t *skR);
+
+/**
+Wipe and free a receiver key object allocated with `Hacl_HPKE_Curve64_CP128_SHA512_receiver_key_malloc`.
+*/
+void Hacl_HPKE_Curve64_CP128_SHA512_receiver_key_free(Hacl_Impl_HPKE_receiver_key_s key);
+
+/**
+Return the serialized public key (`32` bytes) of a receiver key object.
+*/
+uint8_t *Hacl_HPKE_Curve64_CP128_SHA512_receiver_key_public(Hacl_Impl_HPKE_receiver_key_s key);
+
+/**
+Same as `Hacl_HPKE_Curve64_CP128_SHA512_setupBaseR`, with the receiver's key pair taken from `key`.
+*/
+uint32_t
+Hacl_HPKE_Curve64_CP128_SHA512_setupBaseR_key(
+  Hacl_Impl_HPKE_context_s o_ctx,
+  Hacl_Impl_HPKE_receiver_key_s key,
+  uint8_t *enc,
+  uint32_t infolen,
+  uint8_t *info
+);
+
+/**
+Set up a sender context in PSK mode (RFC 9180, Section 5.1.2): the key schedule also depends on a
+pre-shared key `psk` and its identifier `psk_id`, which must both be non-empty.
+
+@param o_pkE Output buffer of 32 bytes for the encapsulated key.
+
+@return 0 on success, 1 if a key exchange fails or the PSK inputs are
+inconsistent.
+*/
+uint32_t
+Hacl_HPKE_Curve64_CP128_SHA512_setupPSKS(
+  uint8_t *o_pkE,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id,
+  uint32_t infolen,
+  uint8_t *info
+);
+
+/**
+Set up a receiver context in PSK mode, the counterpart of `Hacl_HPKE_Curve64_CP128_SHA512_setupPSKS`.
+
+@return 0 on success, 1 if a key exchange fails or the PSK inputs are
+inconsistent.
+*/
+uint32_t
+Hacl_HPKE_Curve64_CP128_SHA512_setupPSKR(
+  Hacl_Impl_HPKE_context_s o_ctx,
+  Hacl_Impl_HPKE_receiver_key_s key,
+  uint8_t *enc,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id,
+  uint32_t infolen,
+  uint8_t *info
+);
+
+/**
+Set up a sender context in Auth mode (RFC 9180, Section 5.1.3): the sender authenticates with its
+static key pair, `skS` (32 bytes) on the sender side and `pkS` (32 bytes) on the
+receiver side.
+
+@param o_pkE Output buffer of 32 bytes for the encapsulated key.
+
+@return 0 on success, 1 if a key exchange fails.
+*/
+uint32_t
+Hacl_HPKE_Curve64_CP128_SHA512_setupAuthS(
+  uint8_t *o_pkE,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint8_t *skS,
+  uint32_t infolen,
+  uint8_t *info
+);
+
+/**
+Set up a receiver context in Auth mode, the counterpart of `Hacl_HPKE_Curve64_CP128_SHA512_setupAuthS`.
+
+@return 0 on success, 1 if a key exchange fails.
+*/
+uint32_t
+Hacl_HPKE_Curve64_CP128_SHA512_setupAuthR(
+  Hacl_Impl_HPKE_context_s o_ctx,
+  Hacl_Impl_HPKE_receiver_key_s key,
+  uint8_t *enc,
+  uint8_t *pkS,
+  uint32_t infolen,
+  uint8_t *info
+);
+
+/**
+Set up a sender context in AuthPSK mode (RFC 9180, Section 5.1.4): combines the Auth and PSK modes.
+
+@param o_pkE Output buffer of 32 bytes for the encapsulated key.
+
+@return 0 on success, 1 if a key exchange fails or the PSK inputs are
+inconsistent.
+*/
+uint32_t
+Hacl_HPKE_Curve64_CP128_SHA512_setupAuthPSKS(
+  uint8_t *o_pkE,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint8_t *skS,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id,
+  uint32_t infolen,
+  uint8_t *info
+);
+
+/**
+Set up a receiver context in AuthPSK mode, the counterpart of `Hacl_HPKE_Curve64_CP128_SHA512_setupAuthPSKS`.
+
+@return 0 on success, 1 if a key exchange fails or the PSK inputs are
+inconsistent.
+*/
+uint32_t
+Hacl_HPKE_Curve64_CP128_SHA512_setupAuthPSKR(
+  Hacl_Impl_HPKE_context_s o_ctx,
+  Hacl_Impl_HPKE_receiver_key_s key,
+  uint8_t *enc,
+  uint8_t *pkS,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id,
+  uint32_t infolen,
+  uint8_t *info
+);
+
 #if defined(__cplusplus)
 }
 #endif
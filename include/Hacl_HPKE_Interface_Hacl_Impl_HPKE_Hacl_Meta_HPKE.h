@@ -44,6 +44,13 @@ typedef struct Hacl_Impl_HPKE_context_s_s
 }
 Hacl_Impl_HPKE_context_s;
 
+typedef struct Hacl_Impl_HPKE_receiver_key_s_s
+{
+  uint8_t *rk_skR;
+  uint8_t *rk_pkRm;
+}
+Hacl_Impl_HPKE_receiver_key_s;
+
 #if defined(__cplusplus)
 }
 #endif
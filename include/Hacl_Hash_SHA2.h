@@ -46,12 +46,29 @@ typedef Hacl_Streaming_MD_state_64 Hacl_Streaming_SHA2_state_sha2_384;
 
 typedef Hacl_Streaming_MD_state_64 Hacl_Streaming_SHA2_state_sha2_512;
 
+/* Alignment of the memory passed to the `init_in_place_*` functions. */
+#define HACL_STREAMING_SHA2_STATE_ALIGN ((uint32_t)8U)
+
 /**
 Allocate initial state for the SHA2_256 hash. The state is to be freed by
 calling `free_256`.
 */
 Hacl_Streaming_MD_state_32 *Hacl_Streaming_SHA2_create_in_256(void);
 
+/**
+Size in bytes of the memory that `init_in_place_256` needs for a SHA2_256
+state. The memory must be aligned on `HACL_STREAMING_SHA2_STATE_ALIGN` bytes.
+*/
+uint32_t Hacl_Streaming_SHA2_state_size_256(void);
+
+/**
+Initialize a SHA2_256 state in caller-provided memory `mem`, of
+`state_size_256()` bytes, and return it. The state lives entirely in `mem`: it
+must not be passed to `free_256`, and `mem` may be reused once the state is no
+longer needed. No allocation takes place.
+*/
+Hacl_Streaming_MD_state_32 *Hacl_Streaming_SHA2_init_in_place_256(uint8_t *mem);
+
 /**
 Copies the state passed as argument into a newly allocated state (deep copy).
 The state is to be freed by calling `free_256`. Cloning the state this way is
@@ -101,6 +118,10 @@ void Hacl_Streaming_SHA2_hash_256(uint8_t *input, uint32_t input_len, uint8_t *d
 
 Hacl_Streaming_MD_state_32 *Hacl_Streaming_SHA2_create_in_224(void);
 
+uint32_t Hacl_Streaming_SHA2_state_size_224(void);
+
+Hacl_Streaming_MD_state_32 *Hacl_Streaming_SHA2_init_in_place_224(uint8_t *mem);
+
 void Hacl_Streaming_SHA2_init_224(Hacl_Streaming_MD_state_32 *s);
 
 Hacl_Streaming_Types_error_code
@@ -126,6 +147,19 @@ void Hacl_Streaming_SHA2_hash_224(uint8_t *input, uint32_t input_len, uint8_t *d
 
 Hacl_Streaming_MD_state_64 *Hacl_Streaming_SHA2_create_in_512(void);
 
+/**
+Size in bytes of the memory that `init_in_place_512` needs for a SHA2_512
+state. The memory must be aligned on `HACL_STREAMING_SHA2_STATE_ALIGN` bytes.
+*/
+uint32_t Hacl_Streaming_SHA2_state_size_512(void);
+
+/**
+Initialize a SHA2_512 state in caller-provided memory `mem`, of
+`state_size_512()` bytes, and return it. As for `init_in_place_256`, the state
+must not be passed to `free_512`.
+*/
+Hacl_Streaming_MD_state_64 *Hacl_Streaming_SHA2_init_in_place_512(uint8_t *mem);
+
 /**
 Copies the state passed as argument into a newly allocated state (deep copy).
 The state is to be freed by calling `free_512`. Cloning the state this way is
@@ -172,6 +206,10 @@ void Hacl_Streaming_SHA2_hash_512(uint8_t *input, uint32_t input_len, uint8_t *d
 
 Hacl_Streaming_MD_state_64 *Hacl_Streaming_SHA2_create_in_384(void);
 
+uint32_t Hacl_Streaming_SHA2_state_size_384(void);
+
+Hacl_Streaming_MD_state_64 *Hacl_Streaming_SHA2_init_in_place_384(uint8_t *mem);
+
 void Hacl_Streaming_SHA2_init_384(Hacl_Streaming_MD_state_64 *s);
 
 Hacl_Streaming_Types_error_code
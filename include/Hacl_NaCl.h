@@ -39,6 +39,20 @@ extern "C" {
 #include "Hacl_Poly1305_32.h"
 #include "Hacl_Curve25519_51.h"
 
+#define Hacl_NaCl_Portable 0
+#define Hacl_NaCl_Vec128 1
+#define Hacl_NaCl_Vec256 2
+
+typedef uint8_t Hacl_NaCl_impl;
+
+typedef struct Hacl_NaCl_crypto_box_session_s_s
+{
+  uint8_t *k;
+  uint8_t *poly;
+  uint32_t impl;
+}
+Hacl_NaCl_crypto_box_session_s;
+
 /**
 Encrypt a message with a key and nonce.
 
@@ -256,6 +270,97 @@ Hacl_NaCl_crypto_box_open_easy(
   uint8_t *sk
 );
 
+/**
+Allocate a crypto_box session. Returns NULL if the allocation fails.
+
+The session must be initialized with `Hacl_NaCl_crypto_box_session_init` or
+`Hacl_NaCl_crypto_box_session_init_afternm` and freed with
+`Hacl_NaCl_crypto_box_session_free`.
+
+@param impl The Salsa20 and Poly1305 implementation used for messages of 256 bytes
+or more. The caller must check that the CPU supports it, e.g. with
+`EverCrypt_AutoConfig2_has_vec256` for `Hacl_NaCl_Vec256`. A vectorized
+implementation that is not compiled in falls back to the portable code.
+*/
+Hacl_NaCl_crypto_box_session_s *Hacl_NaCl_crypto_box_session_malloc(Hacl_NaCl_impl impl);
+
+/**
+Initialize a session with the shared key of `Hacl_NaCl_crypto_box_beforenm`.
+
+@param s Session allocated with `Hacl_NaCl_crypto_box_session_malloc`.
+@param pk Pointer to 32 bytes of memory where **their** public key is read from.
+@param sk Pointer to 32 bytes of memory where **my** secret key is read from.
+*/
+uint32_t
+Hacl_NaCl_crypto_box_session_init(Hacl_NaCl_crypto_box_session_s *s, uint8_t *pk, uint8_t *sk);
+
+/**
+Initialize a session with a key computed earlier by `Hacl_NaCl_crypto_box_beforenm`.
+
+@param s Session allocated with `Hacl_NaCl_crypto_box_session_malloc`.
+@param k Pointer to 32 (`crypto_box_BEFORENMBYTES`) bytes of memory where the shared key is read from.
+*/
+void Hacl_NaCl_crypto_box_session_init_afternm(Hacl_NaCl_crypto_box_session_s *s, uint8_t *k);
+
+/**
+Wipe and free a session allocated with `Hacl_NaCl_crypto_box_session_malloc`.
+*/
+void Hacl_NaCl_crypto_box_session_free(Hacl_NaCl_crypto_box_session_s *s);
+
+/**
+Same as `Hacl_NaCl_crypto_box_detached_afternm`, with the key of the session.
+
+The session holds mutable scratch state: it must not be used by several threads at once.
+*/
+uint32_t
+Hacl_NaCl_crypto_box_session_detached(
+  Hacl_NaCl_crypto_box_session_s *s,
+  uint8_t *c,
+  uint8_t *tag,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *n
+);
+
+/**
+Same as `Hacl_NaCl_crypto_box_open_detached_afternm`, with the key of the session.
+*/
+uint32_t
+Hacl_NaCl_crypto_box_session_open_detached(
+  Hacl_NaCl_crypto_box_session_s *s,
+  uint8_t *m,
+  uint8_t *c,
+  uint8_t *tag,
+  uint32_t mlen,
+  uint8_t *n
+);
+
+/**
+Same as `Hacl_NaCl_crypto_box_easy_afternm`, with the key of the session.
+*/
+uint32_t
+Hacl_NaCl_crypto_box_session_easy(
+  Hacl_NaCl_crypto_box_session_s *s,
+  uint8_t *c,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *n
+);
+
+/**
+Same as `Hacl_NaCl_crypto_box_open_easy_afternm`, with the key of the session.
+
+Fails if `clen` is smaller than the 16-byte tag.
+*/
+uint32_t
+Hacl_NaCl_crypto_box_session_open_easy(
+  Hacl_NaCl_crypto_box_session_s *s,
+  uint8_t *m,
+  uint8_t *c,
+  uint32_t clen,
+  uint8_t *n
+);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -23,8 +23,8 @@
  */
 
 
-#ifndef __Hacl_AES128_H
-#define __Hacl_AES128_H
+#ifndef __Hacl_Salsa20_Vec256_H
+#define __Hacl_Salsa20_Vec256_H
 
 #if defined(__cplusplus)
 extern "C" {
@@ -35,14 +35,29 @@ extern "C" {
 #include "krml/lowstar_endianness.h"
 #include "krml/internal/target.h"
 
-extern void Hacl_AES128_aes128_key_expansion(uint8_t *key, uint8_t *expanded_key);
-
-extern void
-Hacl_AES128_aes128_encrypt_block(uint16_t *cipher, uint16_t *plain, uint8_t *expanded_key);
+void
+Hacl_Salsa20_Vec256_salsa20_encrypt_256(
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *text,
+  uint8_t *key,
+  uint8_t *n,
+  uint32_t ctr
+);
+
+void
+Hacl_Salsa20_Vec256_salsa20_decrypt_256(
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *cipher,
+  uint8_t *key,
+  uint8_t *n,
+  uint32_t ctr
+);
 
 #if defined(__cplusplus)
 }
 #endif
 
-#define __Hacl_AES128_H_DEFINED
+#define __Hacl_Salsa20_Vec256_H_DEFINED
 #endif
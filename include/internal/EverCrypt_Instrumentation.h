@@ -0,0 +1,68 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __internal_EverCrypt_Instrumentation_H
+#define __internal_EverCrypt_Instrumentation_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "../EverCrypt_Instrumentation.h"
+#include "config.h"
+
+/* Call-site macros for the agile layer. `impl` may be any expression; it is
+   not evaluated when instrumentation is disabled. */
+
+#if HACL_INSTRUMENTATION
+
+void EverCrypt_Instrumentation_enter(EverCrypt_Instrumentation_impl impl, uint32_t len);
+
+void EverCrypt_Instrumentation_exit(EverCrypt_Instrumentation_impl impl, uint32_t len);
+
+#define EVERCRYPT_INSTRUMENTATION_ENTER(impl, len)                             \
+  EverCrypt_Instrumentation_enter((impl), (len))
+#define EVERCRYPT_INSTRUMENTATION_EXIT(impl, len)                              \
+  EverCrypt_Instrumentation_exit((impl), (len))
+
+#else
+
+#define EVERCRYPT_INSTRUMENTATION_ENTER(impl, len) ((void)0)
+#define EVERCRYPT_INSTRUMENTATION_EXIT(impl, len) ((void)0)
+
+#endif
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __internal_EverCrypt_Instrumentation_H_DEFINED
+#endif
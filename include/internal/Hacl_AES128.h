@@ -0,0 +1,102 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __internal_Hacl_AES128_H
+#define __internal_Hacl_AES128_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "internal/Vale.h"
+
+/*
+  AES-128 block encryption for FrodoKEM-AES, where the key is the public seed_A.
+
+  The aesni argument selects AES-NI; the caller must only set it on CPUs with
+  AES-NI and SSE, e.g. after checking EverCrypt_AutoConfig2_has_aesni. Builds
+  without the AES-NI code ignore it.
+
+  Timing: with AES-NI, key expansion and encryption run in constant time.
+  Otherwise they use a portable implementation that indexes an
+  S-box table with key and state bytes, so its cache timing depends on both.
+  This fallback is *NOT* constant-time and must not be used with secret keys or
+  secret plaintexts.
+*/
+
+/**
+Expand a 16-byte AES-128 key into the 176-byte schedule of eleven round keys.
+*/
+void Hacl_AES128_aes128_key_expansion(bool aesni, uint8_t *key, uint8_t *expanded_key);
+
+/**
+Encrypt one block, given as eight 16-bit words in little-endian order.
+*/
+void
+Hacl_AES128_aes128_encrypt_block(
+  bool aesni,
+  uint16_t *cipher,
+  uint16_t *plain,
+  uint8_t *expanded_key
+);
+
+/**
+Encrypt `len` consecutive 16-byte blocks in ECB mode with an expanded key.
+`out` may be equal to `in`.
+
+Uses AES-NI if aesni is true, and the portable implementation otherwise.
+*/
+void
+Hacl_AES128_aes128_encrypt_blocks(
+  bool aesni,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *in,
+  uint8_t *expanded_key
+);
+
+/**
+AES-NI implementation of `Hacl_AES128_aes128_encrypt_blocks`, for x86 CPUs with AES-NI.
+*/
+void
+Hacl_AES128_NI_aes128_encrypt_blocks(
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *in,
+  uint8_t *expanded_key
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __internal_Hacl_AES128_H_DEFINED
+#endif
@@ -338,6 +338,134 @@ Hacl_Bignum_Exponentiation_bn_mod_exp_consttime_u64(
   uint64_t *res
 );
 
+bool
+Hacl_Bignum_MultiExponentiation_bn_multi_exp_vartime_u32(
+  uint32_t len,
+  uint32_t *n,
+  uint32_t mu,
+  uint32_t *r2,
+  uint32_t num,
+  uint32_t *aM,
+  uint32_t bBits,
+  uint32_t *b,
+  uint32_t *resM
+);
+
+bool
+Hacl_Bignum_MultiExponentiation_bn_multi_exp_consttime_u32(
+  uint32_t len,
+  uint32_t *n,
+  uint32_t mu,
+  uint32_t *r2,
+  uint32_t num,
+  uint32_t *aM,
+  uint32_t bBits,
+  uint32_t *b,
+  uint32_t *resM
+);
+
+void
+Hacl_Bignum_MultiExponentiation_bn_comb_precomp_u32(
+  uint32_t len,
+  uint32_t *n,
+  uint32_t mu,
+  uint32_t *r2,
+  uint32_t teeth,
+  uint32_t bBits,
+  uint32_t *gM,
+  uint32_t *table
+);
+
+void
+Hacl_Bignum_MultiExponentiation_bn_comb_exp_vartime_u32(
+  uint32_t len,
+  uint32_t *n,
+  uint32_t mu,
+  uint32_t *r2,
+  uint32_t teeth,
+  uint32_t bBits,
+  uint32_t *table,
+  uint32_t *b,
+  uint32_t *resM
+);
+
+void
+Hacl_Bignum_MultiExponentiation_bn_comb_exp_consttime_u32(
+  uint32_t len,
+  uint32_t *n,
+  uint32_t mu,
+  uint32_t *r2,
+  uint32_t teeth,
+  uint32_t bBits,
+  uint32_t *table,
+  uint32_t *b,
+  uint32_t *resM
+);
+
+bool
+Hacl_Bignum_MultiExponentiation_bn_multi_exp_vartime_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint32_t num,
+  uint64_t *aM,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *resM
+);
+
+bool
+Hacl_Bignum_MultiExponentiation_bn_multi_exp_consttime_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint32_t num,
+  uint64_t *aM,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *resM
+);
+
+void
+Hacl_Bignum_MultiExponentiation_bn_comb_precomp_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint32_t teeth,
+  uint32_t bBits,
+  uint64_t *gM,
+  uint64_t *table
+);
+
+void
+Hacl_Bignum_MultiExponentiation_bn_comb_exp_vartime_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint32_t teeth,
+  uint32_t bBits,
+  uint64_t *table,
+  uint64_t *b,
+  uint64_t *resM
+);
+
+void
+Hacl_Bignum_MultiExponentiation_bn_comb_exp_consttime_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint32_t teeth,
+  uint32_t bBits,
+  uint64_t *table,
+  uint64_t *b,
+  uint64_t *resM
+);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -0,0 +1,270 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __internal_Hacl_Bignum_ADX_H
+#define __internal_Hacl_Bignum_ADX_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "internal/Hacl_Bignum_Base.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "config.h"
+
+/*******************************************************************************
+
+ADX/BMI2 kernels for bignum multiplication, squaring and Montgomery reduction.
+
+Every kernel is built on a single multiply-accumulate row, `res += a * b` for a
+limb b, that runs two independent carry chains with mulx/adcx/adox. The kernels
+work for any number of limbs; callers use them for 256-, 2048-, 3072- and
+4096-bit operands (P-256, RSA, FFDHE) when `Hacl_Bignum_ADX_is_available`
+returns true, and keep their portable code otherwise.
+
+When inline assembly is not available, the row falls back to the portable
+mul_wide_add2 chain so that these functions are correct on every target.
+
+*******************************************************************************/
+
+/**
+Returns true if the CPU supports both the ADX and BMI2 extensions and the
+kernels below were compiled with inline assembly.
+*/
+static inline bool Hacl_Bignum_ADX_is_available(void)
+{
+  #if HACL_CAN_COMPILE_INLINE_ASM
+  return EverCrypt_AutoConfig2_has_adx() && EverCrypt_AutoConfig2_has_bmi2();
+  #else
+  return false;
+  #endif
+}
+
+#if HACL_CAN_COMPILE_INLINE_ASM
+/**
+Straight-line version of Hacl_Bignum_ADX_bn_mul_add_row_u64 for 4 limbs.
+*/
+static inline uint64_t Hacl_Bignum_ADX_bn_mul_add_row4_u64(uint64_t *a, uint64_t b, uint64_t *res)
+{
+  uint64_t top;
+  __asm__ volatile(
+    "  xor %%r8d, %%r8d;"
+    "  mulxq 0(%[a]), %%r9, %%r10;"
+    "  adcxq 0(%[r]), %%r9;"
+    "  adoxq %%r8, %%r9;"
+    "  movq %%r9, 0(%[r]);"
+    "  mulxq 8(%[a]), %%r9, %%r8;"
+    "  adcxq 8(%[r]), %%r9;"
+    "  adoxq %%r10, %%r9;"
+    "  movq %%r9, 8(%[r]);"
+    "  mulxq 16(%[a]), %%r9, %%r10;"
+    "  adcxq 16(%[r]), %%r9;"
+    "  adoxq %%r8, %%r9;"
+    "  movq %%r9, 16(%[r]);"
+    "  mulxq 24(%[a]), %%r9, %%r8;"
+    "  adcxq 24(%[r]), %%r9;"
+    "  adoxq %%r10, %%r9;"
+    "  movq %%r9, 24(%[r]);"
+    "  mov $0, %%r9d;"
+    "  adcxq %%r9, %%r8;"
+    "  adoxq %%r9, %%r8;"
+    "  movq %%r8, %[top];"
+  : [top] "=&r" (top)
+  : [a] "r" (a), [r] "r" (res), "d" (b)
+  : "%r8", "%r9", "%r10", "memory", "cc"
+  );
+  return top;
+}
+#endif
+
+/**
+Write `res + a * b` in `res`, where res and a are `len` limbs and b is a limb,
+and return the top limb of the result.
+*/
+static inline uint64_t
+Hacl_Bignum_ADX_bn_mul_add_row_u64(uint32_t len, uint64_t *a, uint64_t b, uint64_t *res)
+{
+  #if HACL_CAN_COMPILE_INLINE_ASM
+  if (len == (uint32_t)4U)
+  {
+    return Hacl_Bignum_ADX_bn_mul_add_row4_u64(a, b, res);
+  }
+  uint64_t n4 = (uint64_t)(len / (uint32_t)4U);
+  uint64_t n1 = (uint64_t)(len % (uint32_t)4U);
+  uint64_t top;
+  __asm__ volatile(
+    // r8 holds the high half of the previous product. Clearing it also
+    // clears CF and OF, which carry the two independent addition chains:
+    // CF adds res[i] to the low half, OF adds the previous high half.
+    "  xor %%r8d, %%r8d;"
+    "  mov %[n4], %%rcx;"
+    "  jrcxz 2f;"
+    "1:"
+    "  mulxq 0(%[a]), %%r9, %%r10;"
+    "  adcxq 0(%[r]), %%r9;"
+    "  adoxq %%r8, %%r9;"
+    "  movq %%r9, 0(%[r]);"
+    "  mulxq 8(%[a]), %%r9, %%r8;"
+    "  adcxq 8(%[r]), %%r9;"
+    "  adoxq %%r10, %%r9;"
+    "  movq %%r9, 8(%[r]);"
+    "  mulxq 16(%[a]), %%r9, %%r10;"
+    "  adcxq 16(%[r]), %%r9;"
+    "  adoxq %%r8, %%r9;"
+    "  movq %%r9, 16(%[r]);"
+    "  mulxq 24(%[a]), %%r9, %%r8;"
+    "  adcxq 24(%[r]), %%r9;"
+    "  adoxq %%r10, %%r9;"
+    "  movq %%r9, 24(%[r]);"
+    // lea and jrcxz leave both carry flags untouched
+    "  lea 32(%[a]), %[a];"
+    "  lea 32(%[r]), %[r];"
+    "  lea -1(%%rcx), %%rcx;"
+    "  jrcxz 2f;"
+    "  jmp 1b;"
+    "2:"
+    "  mov %[n1], %%rcx;"
+    "  jrcxz 4f;"
+    "3:"
+    "  mulxq 0(%[a]), %%r9, %%r10;"
+    "  adcxq 0(%[r]), %%r9;"
+    "  adoxq %%r8, %%r9;"
+    "  movq %%r9, 0(%[r]);"
+    "  movq %%r10, %%r8;"
+    "  lea 8(%[a]), %[a];"
+    "  lea 8(%[r]), %[r];"
+    "  lea -1(%%rcx), %%rcx;"
+    "  jrcxz 4f;"
+    "  jmp 3b;"
+    "4:"
+    // Fold both pending carries into the top limb
+    "  mov $0, %%r9d;"
+    "  adcxq %%r9, %%r8;"
+    "  adoxq %%r9, %%r8;"
+    "  movq %%r8, %[top];"
+  : [a] "+&r" (a), [r] "+&r" (res), [top] "=&r" (top)
+  : [n4] "r" (n4), [n1] "r" (n1), "d" (b)
+  : "%rcx", "%r8", "%r9", "%r10", "memory", "cc"
+  );
+  return top;
+  #else
+  uint64_t c = (uint64_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < len; i++)
+  {
+    c = Hacl_Bignum_Base_mul_wide_add2_u64(a[i], b, c, res + i);
+  }
+  return c;
+  #endif
+}
+
+/**
+Write `a * b` in `res`.
+
+  The arguments a and b are meant to be `aLen` limbs in size, i.e. uint64_t[aLen].
+  The outparam res is meant to be `aLen + aLen` limbs in size, i.e. uint64_t[aLen + aLen].
+*/
+static inline void
+Hacl_Bignum_ADX_bn_mul_u64(uint32_t aLen, uint64_t *a, uint64_t *b, uint64_t *res)
+{
+  memset(res, 0U, (aLen + aLen) * sizeof (uint64_t));
+  for (uint32_t i = (uint32_t)0U; i < aLen; i++)
+  {
+    res[aLen + i] = Hacl_Bignum_ADX_bn_mul_add_row_u64(aLen, a, b[i], res + i);
+  }
+}
+
+/**
+Write `a * a` in `res`.
+
+  The argument a is meant to be `aLen` limbs in size, i.e. uint64_t[aLen].
+  The outparam res is meant to be `aLen + aLen` limbs in size, i.e. uint64_t[aLen + aLen].
+*/
+static inline void Hacl_Bignum_ADX_bn_sqr_u64(uint32_t aLen, uint64_t *a, uint64_t *res)
+{
+  memset(res, 0U, (aLen + aLen) * sizeof (uint64_t));
+  for (uint32_t i = (uint32_t)0U; i + (uint32_t)1U < aLen; i++)
+  {
+    uint64_t *a1 = a + i + (uint32_t)1U;
+    uint64_t *res1 = res + i + i + (uint32_t)1U;
+    res[aLen + i] = Hacl_Bignum_ADX_bn_mul_add_row_u64(aLen - i - (uint32_t)1U, a1, a[i], res1);
+  }
+  uint64_t c0 = Hacl_Bignum_Addition_bn_add_eq_len_u64(aLen + aLen, res, res, res);
+  KRML_HOST_IGNORE(c0);
+  uint64_t c = (uint64_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < aLen; i++)
+  {
+    FStar_UInt128_uint128 res1 = FStar_UInt128_mul_wide(a[i], a[i]);
+    uint64_t hi = FStar_UInt128_uint128_to_uint64(FStar_UInt128_shift_right(res1, (uint32_t)64U));
+    uint64_t lo = FStar_UInt128_uint128_to_uint64(res1);
+    c = Lib_IntTypes_Intrinsics_add_carry_u64((uint8_t)c, res[(uint32_t)2U * i], lo, res + (uint32_t)2U * i);
+    c =
+      Lib_IntTypes_Intrinsics_add_carry_u64((uint8_t)c,
+        res[(uint32_t)2U * i + (uint32_t)1U],
+        hi,
+        res + (uint32_t)2U * i + (uint32_t)1U);
+  }
+  KRML_HOST_IGNORE(c);
+}
+
+/**
+Run the `len` word-by-word Montgomery reduction steps on c and return the carry
+out of `c[len + len - 1]`.
+
+  The argument c is meant to be `len + len` limbs in size, i.e. uint64_t[len + len].
+  On return, `c[len..len + len]` together with the carry hold `c * R^(-1) mod n`
+  up to one final subtraction of n, which is left to the caller.
+*/
+static inline uint64_t
+Hacl_Bignum_ADX_bn_mont_reduction_loop_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t nInv,
+  uint64_t *c
+)
+{
+  uint64_t c0 = (uint64_t)0U;
+  for (uint32_t i0 = (uint32_t)0U; i0 < len; i0++)
+  {
+    uint64_t qj = nInv * c[i0];
+    uint64_t c1 = Hacl_Bignum_ADX_bn_mul_add_row_u64(len, n, qj, c + i0);
+    uint64_t *resb = c + len + i0;
+    uint64_t res_j = c[len + i0];
+    c0 = Lib_IntTypes_Intrinsics_add_carry_u64((uint8_t)c0, c1, res_j, resb);
+  }
+  return c0;
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __internal_Hacl_Bignum_ADX_H_DEFINED
+#endif
@@ -0,0 +1,206 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __internal_Hacl_Bignum_IFMA_H
+#define __internal_Hacl_Bignum_IFMA_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "internal/Hacl_Krmllib.h"
+
+/*******************************************************************************
+
+AVX-512 IFMA backend for 2048-, 3072- and 4096-bit Montgomery arithmetic.
+
+Bignums are converted to radix 2^52 on entry and back to radix 2^64 on exit,
+so the functions below take and return the same uint64_t[len] values as their
+counterparts in Hacl_Bignum. Callers select this backend at runtime with
+`EverCrypt_AutoConfig2_has_avx512ifma` and only for the lengths accepted by
+`Hacl_Bignum_IFMA_bn_len_is_supported`.
+
+*******************************************************************************/
+
+/**
+Number of 52-bit limbs of the radix 2^52 buffers taken by the functions below.
+*/
+#define Hacl_Bignum_IFMA_MAX_LIMBS ((uint32_t)80U)
+
+/**
+Returns true if `len` 64-bit limbs is a modulus size handled by this backend,
+i.e. 2048, 3072 or 4096 bits.
+*/
+static inline bool Hacl_Bignum_IFMA_bn_len_is_supported(uint32_t len)
+{
+  return len == (uint32_t)32U || len == (uint32_t)48U || len == (uint32_t)64U;
+}
+
+/**
+Write `a * b * 2^(-52 * k) mod n` in `res`, where all arguments are in radix 2^52.
+
+  The arguments n, a, b and the outparam res are bignums of 80 limbs of 52 bits,
+  of which the first k are significant and the remaining ones are zero.
+  `mu` is `-n^(-1) mod 2^52`.
+
+  The result is only almost reduced: if a, b < 2n then res < 2n.
+
+  Before calling this function, the caller will need to ensure that the following
+  preconditions are observed.
+  • k is 40, 60 or 79, i.e. the radix 2^52 length for 2048-, 3072- and 4096-bit moduli
+  • 4 * n < 2^(52 * k)
+*/
+void
+Hacl_Bignum_IFMA_bn_almost_mont_mul_u52(
+  uint32_t k,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *a,
+  uint64_t *b,
+  uint64_t *res
+);
+
+/**
+Write `a * a * 2^(-52 * k) mod n` in `res`, under the same conditions as
+`Hacl_Bignum_IFMA_bn_almost_mont_mul_u52`.
+*/
+void
+Hacl_Bignum_IFMA_bn_almost_mont_sqr_u52(
+  uint32_t k,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *a,
+  uint64_t *res
+);
+
+/**
+Returns the number k of significant radix 2^52 limbs for a modulus of `len`
+64-bit limbs.
+*/
+uint32_t Hacl_Bignum_IFMA_bn_radix52_len(uint32_t len);
+
+/**
+Compute the radix 2^52 Montgomery constants of the modulus `n`.
+
+  `mu` and `r2` are the radix 2^64 constants of `n`, as computed for
+  `Hacl_Bignum_Montgomery_bn_to_mont_u64`. The outparams n52 and r252 have
+  `Hacl_Bignum_IFMA_MAX_LIMBS` limbs; mu52 is a single limb.
+*/
+void
+Hacl_Bignum_IFMA_bn_precomp_u52(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint64_t *n52,
+  uint64_t *mu52,
+  uint64_t *r252
+);
+
+/**
+Convert the radix 2^64 bignum `a < n` of `len` limbs to radix 2^52 Montgomery form.
+*/
+void
+Hacl_Bignum_IFMA_bn_to_mont_u52(
+  uint32_t len,
+  uint64_t *n52,
+  uint64_t mu52,
+  uint64_t *r252,
+  uint64_t *a,
+  uint64_t *aM
+);
+
+/**
+Convert the almost reduced radix 2^52 Montgomery value `aM` back to a fully
+reduced radix 2^64 bignum of `len` limbs.
+*/
+void
+Hacl_Bignum_IFMA_bn_from_mont_u52(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t *n52,
+  uint64_t mu52,
+  uint64_t *aM,
+  uint64_t *a
+);
+
+/**
+Copy entry `i` of `table`, an array of `len` radix 2^52 bignums, to `res`.
+
+  All entries are read, so the memory access pattern does not depend on `i`.
+*/
+void Hacl_Bignum_IFMA_bn_select_u52(uint32_t len, uint64_t *table, uint64_t i, uint64_t *res);
+
+/**
+Write `a ^ b mod n` in `res`.
+
+  This function has the same signature and preconditions as
+  `Hacl_Bignum_Exponentiation_bn_mod_exp_vartime_precomp_u64`, with the
+  additional requirement that `Hacl_Bignum_IFMA_bn_len_is_supported(len)` holds.
+*/
+void
+Hacl_Bignum_IFMA_bn_mod_exp_vartime_precomp_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+);
+
+/**
+Write `a ^ b mod n` in `res`.
+
+  This function has the same signature and preconditions as
+  `Hacl_Bignum_Exponentiation_bn_mod_exp_consttime_precomp_u64`, with the
+  additional requirement that `Hacl_Bignum_IFMA_bn_len_is_supported(len)` holds.
+  The execution time depends only on len and bBits, not on the values of a and b.
+*/
+void
+Hacl_Bignum_IFMA_bn_mod_exp_consttime_precomp_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __internal_Hacl_Bignum_IFMA_H_DEFINED
+#endif
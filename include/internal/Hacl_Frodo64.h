@@ -0,0 +1,74 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __internal_Hacl_Frodo64_H
+#define __internal_Hacl_Frodo64_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "../Hacl_Frodo64.h"
+#include "internal/Hacl_Frodo_KEM.h"
+
+/**
+Same as Hacl_Frodo64_crypto_kem_keypair, with the CPU features in impl.
+*/
+uint32_t
+Hacl_Frodo64_crypto_kem_keypair_impl(Hacl_Impl_Frodo_Params_impl impl, uint8_t *pk, uint8_t *sk);
+
+/**
+Same as Hacl_Frodo64_crypto_kem_enc, with the CPU features in impl.
+*/
+uint32_t
+Hacl_Frodo64_crypto_kem_enc_impl(
+  Hacl_Impl_Frodo_Params_impl impl,
+  uint8_t *ct,
+  uint8_t *ss,
+  uint8_t *pk
+);
+
+/**
+Same as Hacl_Frodo64_crypto_kem_dec, with the CPU features in impl.
+*/
+uint32_t
+Hacl_Frodo64_crypto_kem_dec_impl(
+  Hacl_Impl_Frodo_Params_impl impl,
+  uint8_t *ss,
+  uint8_t *ct,
+  uint8_t *sk
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __internal_Hacl_Frodo64_H_DEFINED
+#endif
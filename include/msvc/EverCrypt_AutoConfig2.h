@@ -57,6 +57,8 @@ bool EverCrypt_AutoConfig2_has_rdrand(void);
 
 bool EverCrypt_AutoConfig2_has_avx512(void);
 
+bool EverCrypt_AutoConfig2_has_avx512ifma(void);
+
 void EverCrypt_AutoConfig2_recall(void);
 
 void EverCrypt_AutoConfig2_init(void);
@@ -85,6 +87,8 @@ void EverCrypt_AutoConfig2_disable_rdrand(void);
 
 void EverCrypt_AutoConfig2_disable_avx512(void);
 
+void EverCrypt_AutoConfig2_disable_avx512ifma(void);
+
 bool EverCrypt_AutoConfig2_has_vec128(void);
 
 bool EverCrypt_AutoConfig2_has_vec256(void);
@@ -37,6 +37,7 @@ extern "C" {
 
 #include "Hacl_Curve25519_64.h"
 #include "Hacl_Curve25519_51.h"
+#include "Hacl_Curve25519_Vec256.h"
 #include "EverCrypt_AutoConfig2.h"
 
 /**
@@ -67,6 +68,50 @@ Execute the diffie-hellmann key exchange.
 */
 bool EverCrypt_Curve25519_ecdh(uint8_t *shared, uint8_t *my_priv, uint8_t *their_pub);
 
+/**
+Compute four scalar multiples of points.
+
+On platforms with AVX2 support the four scalar multiplications run in parallel.
+
+@param shared Pointer to 128 bytes of memory where the four resulting points are written to, each taking 32 bytes.
+@param my_priv Pointer to 128 bytes of memory where the four secret/private keys are read from, each taking 32 bytes.
+@param their_pub Pointer to 128 bytes of memory where the four public points are read from, each taking 32 bytes.
+*/
+void
+EverCrypt_Curve25519_scalarmult_4x(uint8_t *shared, uint8_t *my_priv, uint8_t *their_pub);
+
+/**
+Execute a batch of diffie-hellmann key exchanges.
+
+The function returns `true` if all shared secrets are non-zero, and `false` otherwise.
+On platforms with AVX2 support, groups of four key exchanges run in parallel.
+
+@param len Number of key exchanges in the batch.
+@param shared Pointer to `32 * len` bytes of memory where the resulting points are written to.
+@param my_priv Pointer to `32 * len` bytes of memory where **our** secret/private keys are read from.
+@param their_pub Pointer to `32 * len` bytes of memory where **their** public points are read from.
+@param valid Pointer to `len` booleans where the result of each key exchange is written to.
+*/
+bool
+EverCrypt_Curve25519_ecdh_batch(
+  uint32_t len,
+  uint8_t *shared,
+  uint8_t *my_priv,
+  uint8_t *their_pub,
+  bool *valid
+);
+
+/**
+Calculate a batch of public points from secret/private keys.
+
+On platforms with AVX2 support, groups of four public points are computed in parallel.
+
+@param len Number of public points to compute.
+@param pub Pointer to `32 * len` bytes of memory where the resulting points are written to.
+@param priv Pointer to `32 * len` bytes of memory where the secret/private keys are read from.
+*/
+void EverCrypt_Curve25519_secret_to_public_batch(uint32_t len, uint8_t *pub, uint8_t *priv);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -38,6 +38,10 @@ extern "C" {
 #include "Lib_RandomBuffer_System.h"
 #include "Hacl_Streaming_Types.h"
 #include "Hacl_HMAC_DRBG.h"
+#include "Hacl_Chacha20_Vec32.h"
+#include "Hacl_Chacha20_Vec256.h"
+#include "Hacl_Chacha20_Vec128.h"
+#include "EverCrypt_AutoConfig2.h"
 
 typedef Spec_Hash_Definitions_hash_alg EverCrypt_DRBG_supported_alg;
 
@@ -94,6 +98,25 @@ Create a DRBG state.
 */
 EverCrypt_DRBG_state_s *EverCrypt_DRBG_create(Spec_Hash_Definitions_hash_alg a);
 
+/**
+Create a ChaCha20 DRBG state.
+
+The generator keeps a single 256-bit key. Every generate call expands it with
+ChaCha20 (using the widest vectorized implementation the CPU supports),
+replaces it with the first 32 bytes of keystream, and returns the following
+bytes, so past outputs cannot be recovered from a later state. The key is
+derived and updated with HMAC-SHA2-256 on instantiate, reseed and when
+additional input is supplied, and the generator reseeds itself from the
+operating system every `EverCrypt_DRBG_reseed_interval` generate calls.
+
+Unlike the HMAC-DRBG instantiations, generate is not limited to
+`EverCrypt_DRBG_max_output_length` bytes per call.
+
+@return DRBG state, or NULL if it cannot be allocated. Needs to be freed via
+`EverCrypt_DRBG_uninstantiate`.
+*/
+EverCrypt_DRBG_state_s *EverCrypt_DRBG_create_chacha20(void);
+
 /**
 Instantiate the DRBG.
 
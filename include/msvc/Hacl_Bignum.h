@@ -56,6 +56,24 @@ typedef struct Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64_s
 }
 Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64;
 
+typedef struct Hacl_Bignum_MontArithmetic_bn_comb_table_u32_s
+{
+  uint32_t len;
+  uint32_t bBits;
+  uint32_t teeth;
+  uint32_t *table;
+}
+Hacl_Bignum_MontArithmetic_bn_comb_table_u32;
+
+typedef struct Hacl_Bignum_MontArithmetic_bn_comb_table_u64_s
+{
+  uint32_t len;
+  uint32_t bBits;
+  uint32_t teeth;
+  uint64_t *table;
+}
+Hacl_Bignum_MontArithmetic_bn_comb_table_u64;
+
 #if defined(__cplusplus)
 }
 #endif
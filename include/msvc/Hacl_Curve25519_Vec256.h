@@ -0,0 +1,77 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_Curve25519_Vec256_H
+#define __Hacl_Curve25519_Vec256_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "Hacl_Krmllib.h"
+
+/**
+Compute four scalar multiples of points in parallel.
+
+@param out Pointer to 128 bytes of memory, allocated by the caller, where the four resulting points are written to, each taking 32 bytes.
+@param priv Pointer to 128 bytes of memory where the four secret/private keys are read from, each taking 32 bytes.
+@param pub Pointer to 128 bytes of memory where the four public points are read from, each taking 32 bytes.
+*/
+void Hacl_Curve25519_Vec256_scalarmult4(uint8_t *out, uint8_t *priv, uint8_t *pub);
+
+/**
+Calculate four public points from secret/private keys in parallel.
+
+This computes a scalar multiplication of each secret/private key with the curve's basepoint.
+
+@param pub Pointer to 128 bytes of memory, allocated by the caller, where the four resulting points are written to, each taking 32 bytes.
+@param priv Pointer to 128 bytes of memory where the four secret/private keys are read from, each taking 32 bytes.
+*/
+void Hacl_Curve25519_Vec256_secret_to_public4(uint8_t *pub, uint8_t *priv);
+
+/**
+Execute four diffie-hellmann key exchanges in parallel.
+
+The function returns `true` if all four shared secrets are non-zero, and `false` otherwise.
+The outparam `valid` records the result of each individual key exchange.
+
+@param out Pointer to 128 bytes of memory, allocated by the caller, where the four resulting points are written to, each taking 32 bytes.
+@param priv Pointer to 128 bytes of memory where **our** four secret/private keys are read from, each taking 32 bytes.
+@param pub Pointer to 128 bytes of memory where **their** four public points are read from, each taking 32 bytes.
+@param valid Pointer to 4 booleans, allocated by the caller, where the result of each key exchange is written to.
+*/
+bool Hacl_Curve25519_Vec256_ecdh4(uint8_t *out, uint8_t *priv, uint8_t *pub, bool *valid);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Curve25519_Vec256_H_DEFINED
+#endif
@@ -110,6 +110,48 @@ Verify an Ed25519 signature.
 bool
 Hacl_Ed25519_verify(uint8_t *public_key, uint32_t msg_len, uint8_t *msg, uint8_t *signature);
 
+/**
+Compute the expanded public key for Ed25519 signature verification.
+
+  The function returns `true` if `public_key` is a valid encoding of a point and `false`
+  otherwise. If `false` is returned, the contents of `expanded_public_key` are unspecified
+  and must not be passed to `verify_expanded`.
+
+  The outparam `expanded_public_key` points to 644 limbs of valid memory, i.e., uint64_t[644].
+  The argument `public_key`          points to 32 bytes of valid memory, i.e., uint8_t[32].
+
+  The expanded public key holds the public key itself, followed by a table of multiples of
+  the negated, decompressed public key point.
+
+  If one needs to verify several signatures under the same public key, it is more efficient
+  to call `expand_public_key` only once and `verify_expanded` multiple times, for each
+  signature.
+*/
+bool Hacl_Ed25519_expand_public_key(uint64_t *expanded_public_key, uint8_t *public_key);
+
+/**
+Verify an Ed25519 signature with the (precomputed) expanded public key.
+
+  The function returns `true` if the signature is valid and `false` otherwise.
+
+  The argument `expanded_public_key` points to 644 limbs of valid memory, i.e., uint64_t[644].
+  The argument `msg` points to `msg_len` bytes of valid memory, i.e., uint8_t[msg_len].
+  The argument `signature`           points to 64 bytes of valid memory, i.e., uint8_t[64].
+
+  The argument `expanded_public_key` is obtained through `expand_public_key`.
+
+  If one needs to verify several signatures under the same public key, it is more efficient
+  to call `expand_public_key` only once and `verify_expanded` multiple times, for each
+  signature.
+*/
+bool
+Hacl_Ed25519_verify_expanded(
+  uint64_t *expanded_public_key,
+  uint32_t msg_len,
+  uint8_t *msg,
+  uint8_t *signature
+);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -50,6 +50,13 @@ Hacl_FFDHE_ffdhe_secret_to_public_precomp(
   uint8_t *pk
 );
 
+/**
+Compute g^sk mod p with the portable fixed-base comb.
+
+  This function never queries the CPU. EverCrypt_FFDHE_secret_to_public computes
+  the same result and uses the AVX-512 IFMA backend where EverCrypt_AutoConfig2
+  reports it.
+*/
 void Hacl_FFDHE_ffdhe_secret_to_public(Spec_FFDHE_ffdhe_alg a, uint8_t *sk, uint8_t *pk);
 
 uint64_t
@@ -244,6 +244,160 @@ Hacl_GenericField64_exp_vartime(
   uint64_t *resM
 );
 
+/**
+Write `aM[0] ^ b[0] * aM[1] ^ b[1] * ... * aM[num - 1] ^ b[num - 1] mod n` in `resM`.
+
+  The argument aM is meant to be `num * len` limbs in size, i.e. uint64_t[num * len],
+  and holds the `num` bases one after another. The outparam resM is meant to be
+  `len` limbs in size, i.e. uint64_t[len].
+  The argument k is a montgomery context obtained through Hacl_GenericField64_field_init.
+
+  The argument b is meant to be `num * bLen` limbs in size, where bLen is the
+  number of limbs needed to hold bBits bits, and holds the `num` exponents one
+  after another. All the exponents share the squarings of a single pass over
+  bBits bits (Straus' interleaving with 4-bit windows), which makes this function
+  faster than `num` calls to exp_vartime.
+
+  The function is *NOT* constant-time on the argument b. See the
+  multi_exp_consttime function for constant-time variant.
+
+  The precomputed tables for the `num` bases are heap-allocated. The function
+  returns false if they cannot be allocated, and true otherwise.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • b[i] < pow2 bBits for every i
+*/
+bool
+Hacl_GenericField64_multi_exp_vartime(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint32_t num,
+  uint64_t *aM,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *resM
+);
+
+/**
+Write `aM[0] ^ b[0] * aM[1] ^ b[1] * ... * aM[num - 1] ^ b[num - 1] mod n` in `resM`.
+
+  The argument aM is meant to be `num * len` limbs in size, i.e. uint64_t[num * len],
+  and holds the `num` bases one after another. The outparam resM is meant to be
+  `len` limbs in size, i.e. uint64_t[len].
+  The argument k is a montgomery context obtained through Hacl_GenericField64_field_init.
+
+  The argument b is meant to be `num * bLen` limbs in size, where bLen is the
+  number of limbs needed to hold bBits bits, and holds the `num` exponents one
+  after another.
+
+  This function is constant-time over its argument b, at the cost of a slower
+  execution time than multi_exp_vartime.
+
+  The precomputed tables for the `num` bases are heap-allocated. The function
+  returns false if they cannot be allocated, and true otherwise.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • b[i] < pow2 bBits for every i
+*/
+bool
+Hacl_GenericField64_multi_exp_consttime(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint32_t num,
+  uint64_t *aM,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *resM
+);
+
+/**
+Heap-allocate and initialize a comb table for the fixed base `gM`.
+
+  The argument gM is meant to be `len` limbs in size, i.e. uint64_t[len].
+  The argument k is a montgomery context obtained through Hacl_GenericField64_field_init.
+
+  The table holds 2 ^ 5 precomputed powers of gM, so that any exponent of at most
+  bBits bits can then be applied with about bBits / 5 squarings instead of bBits.
+  It is meant to be reused across many calls to comb_exp_vartime or
+  comb_exp_consttime with the same base and context.
+
+  The caller will need to call Hacl_GenericField64_comb_table_free on the return
+  value to avoid memory leaks.
+
+  The function returns NULL if bBits is 0 or if the allocation fails.
+*/
+Hacl_Bignum_MontArithmetic_bn_comb_table_u64
+*Hacl_GenericField64_comb_table_init(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *gM,
+  uint32_t bBits
+);
+
+/**
+Deallocate the memory previously allocated by Hacl_GenericField64_comb_table_init.
+
+  The argument t is a comb table obtained through Hacl_GenericField64_comb_table_init.
+*/
+void Hacl_GenericField64_comb_table_free(Hacl_Bignum_MontArithmetic_bn_comb_table_u64 *t);
+
+/**
+Write `gM ^ b mod n` in `resM`, where gM is the base of the comb table t.
+
+  The outparam resM is meant to be `len` limbs in size, i.e. uint64_t[len].
+  The argument k is a montgomery context obtained through Hacl_GenericField64_field_init.
+  The argument t is a comb table obtained through Hacl_GenericField64_comb_table_init
+  with the same context k.
+
+  The argument b is meant to hold bBits bits, where bBits is the bound the table t
+  was initialized with, i.e. uint64_t[(bBits - 1) / 64 + 1].
+
+  The function returns false if t was initialized with a context of a different
+  length than k, and true otherwise.
+
+  The function is *NOT* constant-time on the argument b. See the
+  comb_exp_consttime function for constant-time variant.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • b < pow2 bBits
+*/
+bool
+Hacl_GenericField64_comb_exp_vartime(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  Hacl_Bignum_MontArithmetic_bn_comb_table_u64 *t,
+  uint64_t *b,
+  uint64_t *resM
+);
+
+/**
+Write `gM ^ b mod n` in `resM`, where gM is the base of the comb table t.
+
+  The outparam resM is meant to be `len` limbs in size, i.e. uint64_t[len].
+  The argument k is a montgomery context obtained through Hacl_GenericField64_field_init.
+  The argument t is a comb table obtained through Hacl_GenericField64_comb_table_init
+  with the same context k.
+
+  The argument b is meant to hold bBits bits, where bBits is the bound the table t
+  was initialized with, i.e. uint64_t[(bBits - 1) / 64 + 1].
+
+  The function returns false if t was initialized with a context of a different
+  length than k, and true otherwise.
+
+  This function is constant-time over its argument b, at the cost of a slower
+  execution time than comb_exp_vartime.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • b < pow2 bBits
+*/
+bool
+Hacl_GenericField64_comb_exp_consttime(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  Hacl_Bignum_MontArithmetic_bn_comb_table_u64 *t,
+  uint64_t *b,
+  uint64_t *resM
+);
+
 /**
 Write `aM ^ (-1) mod n` in `aInvM`.
 
@@ -0,0 +1,62 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __internal_Hacl_FFDHE_H
+#define __internal_Hacl_FFDHE_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "../Hacl_FFDHE.h"
+
+/**
+Same as Hacl_FFDHE_ffdhe_secret_to_public, with the representation of the comb
+table chosen by the caller.
+
+  If ifma is true, the 2048-, 3072- and 4096-bit groups use the radix 2^52 table
+  and the AVX-512 IFMA Montgomery multiplication; the caller must have checked
+  that the CPU supports AVX-512 IFMA. Other groups, and builds without the IFMA
+  backend, use the portable table either way.
+*/
+void
+Hacl_FFDHE_ffdhe_secret_to_public_impl(
+  Spec_FFDHE_ffdhe_alg a,
+  bool ifma,
+  uint8_t *sk,
+  uint8_t *pk
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __internal_Hacl_FFDHE_H_DEFINED
+#endif
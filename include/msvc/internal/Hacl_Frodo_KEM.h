@@ -40,6 +40,33 @@ extern "C" {
 #include "Lib_RandomBuffer_System.h"
 #include "Hacl_Krmllib.h"
 #include "Hacl_Hash_SHA3.h"
+#include "internal/Hacl_AES128.h"
+
+/*
+  Optional CPU features used by the Frodo code, chosen by the caller. The
+  Hacl_Frodo* entry points use Hacl_Impl_Frodo_Params_portable; EverCrypt_Frodo
+  fills this in from EverCrypt_AutoConfig2. A feature must only be enabled on a
+  CPU that supports it.
+
+  matrix: kernel for the streaming A * S and S' * A products. A vector kernel
+  that is not compiled in falls back to the portable one.
+  aesni: AES-NI for the AES128 generator of A.
+*/
+#define Hacl_Impl_Frodo_Params_Portable 0
+#define Hacl_Impl_Frodo_Params_Vec128 1
+#define Hacl_Impl_Frodo_Params_Vec256 2
+
+typedef uint8_t Hacl_Impl_Frodo_Params_matrix;
+
+typedef struct Hacl_Impl_Frodo_Params_impl_s
+{
+  Hacl_Impl_Frodo_Params_matrix matrix;
+  bool aesni;
+}
+Hacl_Impl_Frodo_Params_impl;
+
+static const Hacl_Impl_Frodo_Params_impl
+Hacl_Impl_Frodo_Params_portable = { Hacl_Impl_Frodo_Params_Portable, false };
 
 static inline void
 Hacl_Keccak_shake128_4x(
@@ -190,61 +217,100 @@ Hacl_Impl_Matrix_matrix_from_lbytes(uint32_t n1, uint32_t n2, uint8_t *b, uint16
 }
 
 static inline void
-Hacl_Impl_Frodo_Gen_frodo_gen_matrix_shake_4x(uint32_t n, uint8_t *seed, uint16_t *res)
+Hacl_Impl_Frodo_Gen_frodo_gen_rows_shake_4x(
+  uint32_t n,
+  uint8_t *seed,
+  uint32_t i,
+  uint16_t *res
+)
 {
-  KRML_CHECK_SIZE(sizeof (uint8_t), (uint32_t)8U * n);
-  uint8_t *r = (uint8_t *)alloca((uint32_t)8U * n * sizeof (uint8_t));
-  memset(r, 0U, (uint32_t)8U * n * sizeof (uint8_t));
+  /* Rows 4i, ..., 4i + 3 of A. The SHAKE128 output is written straight into res and
+   * decoded from little-endian in place. */
   uint8_t tmp_seed[72U] = { 0U };
   memcpy(tmp_seed + (uint32_t)2U, seed, (uint32_t)16U * sizeof (uint8_t));
   memcpy(tmp_seed + (uint32_t)20U, seed, (uint32_t)16U * sizeof (uint8_t));
   memcpy(tmp_seed + (uint32_t)38U, seed, (uint32_t)16U * sizeof (uint8_t));
   memcpy(tmp_seed + (uint32_t)56U, seed, (uint32_t)16U * sizeof (uint8_t));
-  memset(res, 0U, n * n * sizeof (uint16_t));
+  uint8_t *r = (uint8_t *)res;
+  uint8_t *r0 = r + (uint32_t)0U * n;
+  uint8_t *r1 = r + (uint32_t)2U * n;
+  uint8_t *r2 = r + (uint32_t)4U * n;
+  uint8_t *r3 = r + (uint32_t)6U * n;
+  uint8_t *tmp_seed0 = tmp_seed;
+  uint8_t *tmp_seed1 = tmp_seed + (uint32_t)18U;
+  uint8_t *tmp_seed2 = tmp_seed + (uint32_t)36U;
+  uint8_t *tmp_seed3 = tmp_seed + (uint32_t)54U;
+  store16_le(tmp_seed0, (uint16_t)((uint32_t)4U * i + (uint32_t)0U));
+  store16_le(tmp_seed1, (uint16_t)((uint32_t)4U * i + (uint32_t)1U));
+  store16_le(tmp_seed2, (uint16_t)((uint32_t)4U * i + (uint32_t)2U));
+  store16_le(tmp_seed3, (uint16_t)((uint32_t)4U * i + (uint32_t)3U));
+  Hacl_Keccak_shake128_4x((uint32_t)18U,
+    tmp_seed0,
+    tmp_seed1,
+    tmp_seed2,
+    tmp_seed3,
+    (uint32_t)2U * n,
+    r0,
+    r1,
+    r2,
+    r3);
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)4U * n; i0++)
+  {
+    res[i0] = le16toh(res[i0]);
+  }
+}
+
+static inline void
+Hacl_Impl_Frodo_Gen_frodo_gen_matrix_shake_4x(uint32_t n, uint8_t *seed, uint16_t *res)
+{
   for (uint32_t i = (uint32_t)0U; i < n / (uint32_t)4U; i++)
   {
-    uint8_t *r0 = r + (uint32_t)0U * n;
-    uint8_t *r1 = r + (uint32_t)2U * n;
-    uint8_t *r2 = r + (uint32_t)4U * n;
-    uint8_t *r3 = r + (uint32_t)6U * n;
-    uint8_t *tmp_seed0 = tmp_seed;
-    uint8_t *tmp_seed1 = tmp_seed + (uint32_t)18U;
-    uint8_t *tmp_seed2 = tmp_seed + (uint32_t)36U;
-    uint8_t *tmp_seed3 = tmp_seed + (uint32_t)54U;
-    store16_le(tmp_seed0, (uint16_t)((uint32_t)4U * i + (uint32_t)0U));
-    store16_le(tmp_seed1, (uint16_t)((uint32_t)4U * i + (uint32_t)1U));
-    store16_le(tmp_seed2, (uint16_t)((uint32_t)4U * i + (uint32_t)2U));
-    store16_le(tmp_seed3, (uint16_t)((uint32_t)4U * i + (uint32_t)3U));
-    Hacl_Keccak_shake128_4x((uint32_t)18U,
-      tmp_seed0,
-      tmp_seed1,
-      tmp_seed2,
-      tmp_seed3,
-      (uint32_t)2U * n,
-      r0,
-      r1,
-      r2,
-      r3);
-    for (uint32_t i0 = (uint32_t)0U; i0 < n; i0++)
+    Hacl_Impl_Frodo_Gen_frodo_gen_rows_shake_4x(n, seed, i, res + (uint32_t)4U * i * n);
+  }
+}
+
+static inline void
+Hacl_Impl_Frodo_Gen_frodo_gen_rows_aes(
+  bool aesni,
+  uint32_t n,
+  uint8_t *key,
+  uint32_t i,
+  uint32_t nrows,
+  uint16_t *res
+)
+{
+  /* Row i is AES128(seed, i || j || 0) for j = 0, 8, 16, ..., all little-endian. The
+   * counter blocks are laid out in res and encrypted in place in a single call. */
+  uint8_t *r = (uint8_t *)res;
+  uint8_t *b = r;
+  for (uint32_t i0 = (uint32_t)0U; i0 < nrows; i0++)
+  {
+    for (uint32_t j = (uint32_t)0U; j < n / (uint32_t)8U; j++)
     {
-      uint8_t *resij0 = r0 + i0 * (uint32_t)2U;
-      uint8_t *resij1 = r1 + i0 * (uint32_t)2U;
-      uint8_t *resij2 = r2 + i0 * (uint32_t)2U;
-      uint8_t *resij3 = r3 + i0 * (uint32_t)2U;
-      uint16_t u = load16_le(resij0);
-      res[((uint32_t)4U * i + (uint32_t)0U) * n + i0] = u;
-      uint16_t u0 = load16_le(resij1);
-      res[((uint32_t)4U * i + (uint32_t)1U) * n + i0] = u0;
-      uint16_t u1 = load16_le(resij2);
-      res[((uint32_t)4U * i + (uint32_t)2U) * n + i0] = u1;
-      uint16_t u2 = load16_le(resij3);
-      res[((uint32_t)4U * i + (uint32_t)3U) * n + i0] = u2;
+      memset(b, 0U, (uint32_t)16U * sizeof (uint8_t));
+      store16_le(b, (uint16_t)(i + i0));
+      store16_le(b + (uint32_t)2U, (uint16_t)((uint32_t)8U * j));
+      b = b + (uint32_t)16U;
     }
   }
+  Hacl_AES128_aes128_encrypt_blocks(aesni, nrows * (n / (uint32_t)8U), r, r, key);
+  for (uint32_t i0 = (uint32_t)0U; i0 < nrows * n; i0++)
+  {
+    res[i0] = le16toh(res[i0]);
+  }
+}
+
+static inline void
+Hacl_Impl_Frodo_Gen_frodo_gen_matrix_aes(bool aesni, uint32_t n, uint8_t *seed, uint16_t *res)
+{
+  uint8_t key[176U] = { 0U };
+  Hacl_AES128_aes128_key_expansion(aesni, seed, key);
+  Hacl_Impl_Frodo_Gen_frodo_gen_rows_aes(aesni, n, key, (uint32_t)0U, n, res);
 }
 
 static inline void
 Hacl_Impl_Frodo_Params_frodo_gen_matrix(
+  Hacl_Impl_Frodo_Params_impl impl,
   Spec_Frodo_Params_frodo_gen_a a,
   uint32_t n,
   uint8_t *seed,
@@ -258,6 +324,11 @@ Hacl_Impl_Frodo_Params_frodo_gen_matrix(
         Hacl_Impl_Frodo_Gen_frodo_gen_matrix_shake_4x(n, seed, a_matrix);
         break;
       }
+    case Spec_Frodo_Params_AES128:
+      {
+        Hacl_Impl_Frodo_Gen_frodo_gen_matrix_aes(impl.aesni, n, seed, a_matrix);
+        break;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -266,6 +337,82 @@ Hacl_Impl_Frodo_Params_frodo_gen_matrix(
   }
 }
 
+/**
+Compute B = A * S + E for the n x n matrix A expanded from `seed`, with S given
+transposed (n_bar x n) and B, E of size n x n_bar.
+
+A is generated and consumed eight rows at a time, so only 16 * n bytes of it are
+live at any point instead of the 2 * n * n bytes of the full matrix.
+*/
+void
+Hacl_Impl_Frodo_Params_frodo_mul_add_as_plus_e(
+  Hacl_Impl_Frodo_Params_impl impl,
+  Spec_Frodo_Params_frodo_gen_a a,
+  uint32_t n,
+  uint8_t *seed,
+  uint16_t *s,
+  uint16_t *e,
+  uint16_t *b
+);
+
+/**
+Compute B' = S' * A + E' for the n x n matrix A expanded from `seed`, with S', E'
+and B' of size n_bar x n. A is streamed as in `frodo_mul_add_as_plus_e`.
+*/
+void
+Hacl_Impl_Frodo_Params_frodo_mul_add_sa_plus_e(
+  Hacl_Impl_Frodo_Params_impl impl,
+  Spec_Frodo_Params_frodo_gen_a a,
+  uint32_t n,
+  uint8_t *seed,
+  uint16_t *sp,
+  uint16_t *ep,
+  uint16_t *bp
+);
+
+/**
+SIMD kernels for the streaming products, for `nrows` consecutive rows of A.
+
+`mul_as_rows` adds (A * S) for these rows to the matching nrows x n_bar block of B.
+`mul_sa_rows` adds S'[:, rows] * A[rows, :] to B', with `sp` pointing at the
+column of S' that matches the first row.
+*/
+void
+Hacl_Impl_Frodo_Matrix_Vec128_mul_as_rows(
+  uint32_t n,
+  uint32_t nrows,
+  uint16_t *a,
+  uint16_t *s,
+  uint16_t *b
+);
+
+void
+Hacl_Impl_Frodo_Matrix_Vec128_mul_sa_rows(
+  uint32_t n,
+  uint32_t nrows,
+  uint16_t *a,
+  uint16_t *sp,
+  uint16_t *bp
+);
+
+void
+Hacl_Impl_Frodo_Matrix_Vec256_mul_as_rows(
+  uint32_t n,
+  uint32_t nrows,
+  uint16_t *a,
+  uint16_t *s,
+  uint16_t *b
+);
+
+void
+Hacl_Impl_Frodo_Matrix_Vec256_mul_sa_rows(
+  uint32_t n,
+  uint32_t nrows,
+  uint16_t *a,
+  uint16_t *sp,
+  uint16_t *bp
+);
+
 static const
 uint16_t
 Hacl_Impl_Frodo_Params_cdf_table640[13U] =
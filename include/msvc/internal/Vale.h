@@ -61,6 +61,8 @@ extern uint64_t check_rdrand(void);
 
 extern uint64_t check_avx512(void);
 
+extern uint64_t check_avx512ifma(void);
+
 extern uint64_t check_osxsave(void);
 
 extern uint64_t check_avx_xcr0(void);
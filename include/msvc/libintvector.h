@@ -921,6 +921,209 @@ typedef vector128_8 vector128;
 
 #endif /* HACL_CAN_COMPILE_VEC128 */
 
+#elif defined(__wasm_simd128__) // WebAssembly with the simd128 proposal
+
+#if defined(HACL_CAN_COMPILE_VEC128)
+
+#include <wasm_simd128.h>
+
+typedef v128_t Lib_IntVector_Intrinsics_vec128;
+
+// The shuffles below take their lane indices as immediates: all the
+// arguments which end up there must be constants.
+
+#define Lib_IntVector_Intrinsics_vec128_xor(x0, x1) \
+  (wasm_v128_xor(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec128_eq64(x0, x1) \
+  (wasm_i64x2_eq(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec128_eq32(x0, x1) \
+  (wasm_i32x4_eq(x0, x1))
+
+// Signed, like on Intel
+#define Lib_IntVector_Intrinsics_vec128_gt64(x0, x1) \
+  (wasm_i64x2_gt(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec128_gt32(x0, x1) \
+  (wasm_i32x4_gt(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec128_or(x0, x1) \
+  (wasm_v128_or(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec128_and(x0, x1) \
+  (wasm_v128_and(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec128_lognot(x0) \
+  (wasm_v128_not(x0))
+
+
+#define Lib_IntVector_Intrinsics_vec128_zero  \
+  (wasm_i64x2_const(0, 0))
+
+// Byte shifts: lanes 0-15 are those of the first operand, 16-31 those of the
+// second one, which is zero.
+#define Lib_IntVector_Intrinsics_vec128_shift_left(x0, x1)		\
+  (wasm_i8x16_shuffle(Lib_IntVector_Intrinsics_vec128_zero, x0,		\
+    16-(x1)/8, 17-(x1)/8, 18-(x1)/8, 19-(x1)/8, 20-(x1)/8, 21-(x1)/8, 22-(x1)/8, 23-(x1)/8, \
+    24-(x1)/8, 25-(x1)/8, 26-(x1)/8, 27-(x1)/8, 28-(x1)/8, 29-(x1)/8, 30-(x1)/8, 31-(x1)/8))
+
+#define Lib_IntVector_Intrinsics_vec128_shift_right(x0, x1)		\
+  (wasm_i8x16_shuffle(x0, Lib_IntVector_Intrinsics_vec128_zero,		\
+    (x1)/8, 1+(x1)/8, 2+(x1)/8, 3+(x1)/8, 4+(x1)/8, 5+(x1)/8, 6+(x1)/8, 7+(x1)/8, \
+    8+(x1)/8, 9+(x1)/8, 10+(x1)/8, 11+(x1)/8, 12+(x1)/8, 13+(x1)/8, 14+(x1)/8, 15+(x1)/8))
+
+#define Lib_IntVector_Intrinsics_vec128_shift_left64(x0, x1) \
+  (wasm_i64x2_shl(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec128_shift_right64(x0, x1) \
+  (wasm_u64x2_shr(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec128_shift_left32(x0, x1) \
+  (wasm_i32x4_shl(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec128_shift_right32(x0, x1) \
+  (wasm_u32x4_shr(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec128_rotate_left32_8(x0) \
+  (wasm_i8x16_shuffle(x0, x0, 3,0,1,2,7,4,5,6,11,8,9,10,15,12,13,14))
+
+#define Lib_IntVector_Intrinsics_vec128_rotate_left32_16(x0) \
+  (wasm_i8x16_shuffle(x0, x0, 2,3,0,1,6,7,4,5,10,11,8,9,14,15,12,13))
+
+#define Lib_IntVector_Intrinsics_vec128_rotate_left32_24(x0) \
+  (wasm_i8x16_shuffle(x0, x0, 1,2,3,0,5,6,7,4,9,10,11,8,13,14,15,12))
+
+#define Lib_IntVector_Intrinsics_vec128_rotate_left32(x0,x1)	\
+  (((x1) == 8? Lib_IntVector_Intrinsics_vec128_rotate_left32_8(x0) : \
+   ((x1) == 16? Lib_IntVector_Intrinsics_vec128_rotate_left32_16(x0) : \
+   ((x1) == 24? Lib_IntVector_Intrinsics_vec128_rotate_left32_24(x0) : \
+    wasm_v128_xor(wasm_i32x4_shl(x0,x1),wasm_u32x4_shr(x0,32-(x1)))))))
+
+#define Lib_IntVector_Intrinsics_vec128_rotate_right32(x0,x1)	\
+  (Lib_IntVector_Intrinsics_vec128_rotate_left32(x0,32-(x1)))
+
+#define Lib_IntVector_Intrinsics_vec128_rotate_right32_16(x0) \
+  (Lib_IntVector_Intrinsics_vec128_rotate_left32_16(x0))
+
+#define Lib_IntVector_Intrinsics_vec128_shuffle32(x0, x1, x2, x3, x4)	\
+  (wasm_i32x4_shuffle(x0, x0, x1, x2, x3, x4))
+
+#define Lib_IntVector_Intrinsics_vec128_shuffle64(x0, x1, x2) \
+  (wasm_i64x2_shuffle(x0, x0, x2, x1))
+
+#define Lib_IntVector_Intrinsics_vec128_rotate_right_lanes32(x0, x1)	\
+  (wasm_i32x4_shuffle(x0, x0, (x1)%4, ((x1)+1)%4, ((x1)+2)%4, ((x1)+3)%4))
+
+#define Lib_IntVector_Intrinsics_vec128_rotate_right_lanes64(x0, x1)	\
+  (wasm_i64x2_shuffle(x0, x0, (x1)%2, ((x1)+1)%2))
+
+#define Lib_IntVector_Intrinsics_vec128_load32_le(x0) \
+  (wasm_v128_load(x0))
+
+#define Lib_IntVector_Intrinsics_vec128_load64_le(x0) \
+  (wasm_v128_load(x0))
+
+#define Lib_IntVector_Intrinsics_vec128_store32_le(x0, x1) \
+  (wasm_v128_store(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec128_store64_le(x0, x1) \
+  (wasm_v128_store(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec128_load_be(x0)		\
+  (wasm_i8x16_shuffle(wasm_v128_load(x0), wasm_v128_load(x0), 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))
+
+#define Lib_IntVector_Intrinsics_vec128_load32_be(x0)		\
+  (wasm_i8x16_shuffle(wasm_v128_load(x0), wasm_v128_load(x0), 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12))
+
+#define Lib_IntVector_Intrinsics_vec128_load64_be(x0)		\
+  (wasm_i8x16_shuffle(wasm_v128_load(x0), wasm_v128_load(x0), 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8))
+
+#define Lib_IntVector_Intrinsics_vec128_store_be(x0, x1)	\
+  (wasm_v128_store(x0, wasm_i8x16_shuffle(x1, x1, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)))
+
+#define Lib_IntVector_Intrinsics_vec128_store32_be(x0, x1)	\
+  (wasm_v128_store(x0, wasm_i8x16_shuffle(x1, x1, 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12)))
+
+#define Lib_IntVector_Intrinsics_vec128_store64_be(x0, x1)	\
+  (wasm_v128_store(x0, wasm_i8x16_shuffle(x1, x1, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8)))
+
+
+#define Lib_IntVector_Intrinsics_vec128_insert8(x0, x1, x2)	\
+  (wasm_i8x16_replace_lane(x0, x2, x1))
+
+#define Lib_IntVector_Intrinsics_vec128_insert32(x0, x1, x2)	\
+  (wasm_i32x4_replace_lane(x0, x2, x1))
+
+#define Lib_IntVector_Intrinsics_vec128_insert64(x0, x1, x2)	\
+  (wasm_i64x2_replace_lane(x0, x2, x1))
+
+#define Lib_IntVector_Intrinsics_vec128_extract8(x0, x1)	\
+  (wasm_u8x16_extract_lane(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec128_extract32(x0, x1)	\
+  (wasm_u32x4_extract_lane(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec128_extract64(x0, x1)	\
+  (wasm_u64x2_extract_lane(x0, x1))
+
+
+#define Lib_IntVector_Intrinsics_vec128_add64(x0, x1) \
+  (wasm_i64x2_add(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec128_sub64(x0, x1)		\
+  (wasm_i64x2_sub(x0, x1))
+
+// Like _mm_mul_epu32: multiplies the low 32 bits of each 64-bit lane, which
+// the even 32-bit lanes are first moved to the low half for.
+#define Lib_IntVector_Intrinsics_vec128_mul64(x0, x1) \
+  (wasm_u64x2_extmul_low_u32x4(wasm_i32x4_shuffle(x0, x0, 0, 2, 0, 2), \
+                               wasm_i32x4_shuffle(x1, x1, 0, 2, 0, 2)))
+
+#define Lib_IntVector_Intrinsics_vec128_smul64(x0, x1) \
+  (Lib_IntVector_Intrinsics_vec128_mul64(x0, wasm_u64x2_splat(x1)))
+
+#define Lib_IntVector_Intrinsics_vec128_add32(x0, x1) \
+  (wasm_i32x4_add(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec128_sub32(x0, x1)		\
+  (wasm_i32x4_sub(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec128_mul32(x0, x1) \
+  (wasm_i32x4_mul(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec128_smul32(x0, x1) \
+  (wasm_i32x4_mul(x0, wasm_u32x4_splat(x1)))
+
+#define Lib_IntVector_Intrinsics_vec128_load128(x) \
+  ((v128_t)x)
+
+#define Lib_IntVector_Intrinsics_vec128_load64(x) \
+  (wasm_u64x2_splat(x))
+
+#define Lib_IntVector_Intrinsics_vec128_load64s(x0, x1) \
+  (wasm_u64x2_make(x0, x1)) /* lo hi */
+
+#define Lib_IntVector_Intrinsics_vec128_load32(x) \
+  (wasm_u32x4_splat(x))
+
+#define Lib_IntVector_Intrinsics_vec128_load32s(x0, x1, x2, x3) \
+  (wasm_u32x4_make(x0, x1, x2, x3)) /* lo hi */
+
+#define Lib_IntVector_Intrinsics_vec128_interleave_low32(x1, x2) \
+  (wasm_i32x4_shuffle(x1, x2, 0, 4, 1, 5))
+
+#define Lib_IntVector_Intrinsics_vec128_interleave_high32(x1, x2) \
+  (wasm_i32x4_shuffle(x1, x2, 2, 6, 3, 7))
+
+#define Lib_IntVector_Intrinsics_vec128_interleave_low64(x1, x2) \
+  (wasm_i64x2_shuffle(x1, x2, 0, 2))
+
+#define Lib_IntVector_Intrinsics_vec128_interleave_high64(x1, x2) \
+  (wasm_i64x2_shuffle(x1, x2, 1, 3))
+
+#endif /* HACL_CAN_COMPILE_VEC128 */
+
 #endif // PowerPC64
 
 // DEBUGGING:
@@ -27,6 +27,34 @@ function getModulesPromise(modules=shell.my_modules) {
   ));
 }
 
+// The SIMD128 builds of the vectorized implementations are position-independent
+// side modules (see tools/js.py) and are optional: a module that is missing
+// from the `simd` directory is simply not used.
+function getSimdModulesPromise(modules) {
+  const readModule = async m => {
+    try {
+      if (typeof module !== 'undefined')
+        return new Uint8Array(await fs.promises.readFile(path.resolve(__dirname, './simd/' + m)));
+      let r = await fetch("simd/" + m);
+      return r.ok ? await r.arrayBuffer() : null;
+    } catch (e) {
+      return null;
+    }
+  };
+  return Promise.all(modules.map(async name =>
+    ({ buf: await readModule(name + ".wasm"), name })
+  )).then(ms => ms.filter(m => m.buf !== null));
+}
+
+// A function returning `i8x16.popcnt(i8x16.splat(0))`, which only validates on
+// engines that implement SIMD128.
+var simdSupported = () =>
+  typeof WebAssembly.validate === 'function' &&
+  WebAssembly.validate(new Uint8Array([
+    0, 97, 115, 109, 1, 0, 0, 0, 1, 5, 1, 96, 0, 1, 123, 3, 2, 1, 0, 10, 10, 1,
+    8, 0, 65, 0, 253, 15, 253, 98, 11
+  ]));
+
 // Comment out for debug
 loader.setMyPrint((x) => {});
 
@@ -161,6 +189,8 @@ var validateJSON = function(json) {
         throw Error("please provide a 'name' field for " + obj_name + " in api.json");
       if (!("args" in func_obj))
         throw Error("please provide a 'args' field for " + obj_name + " in api.json");
+      if ("simd" in func_obj && !("module" in func_obj.simd && "name" in func_obj.simd))
+        throw Error("the 'simd' field for " + obj_name + " should have a 'module' and a 'name'");
       if (!Array.isArray(func_obj.args))
         throw Error("the 'args' field for " + obj_name + " should be an array");
 
@@ -213,6 +243,8 @@ var HaclWasm = (function() {
   'use strict';
   var isInitialized = false;
   var Module = {};
+  // The SIMD side modules that could be linked, by module name.
+  var SimdModule = {};
 
   // We defined a few WASM-specific "compile-time macros".
   var my_imports = {
@@ -237,6 +269,94 @@ var HaclWasm = (function() {
     }
   };
 
+  // Space reserved for the stack of a SIMD side module during a call: unlike
+  // KaRaMeL's, clang's stack grows downwards and lives in a global.
+  const simd_stack_size = 64 * 1024;
+
+  // Reads the memory and table requirements of a side module from its
+  // `dylink.0` section.
+  var dylinkMemInfo = (mod) => {
+    let sections = WebAssembly.Module.customSections(mod, "dylink.0");
+    if (sections.length != 1)
+      throw new Error("not a position-independent module");
+    let b = new Uint8Array(sections[0]);
+    let i = 0;
+    let leb = () => {
+      let r = 0, shift = 0, c;
+      do {
+        c = b[i++];
+        r |= (c & 0x7f) << shift;
+        shift += 7;
+      } while (c & 0x80);
+      return r >>> 0;
+    };
+    while (i < b.length) {
+      let type = b[i++];
+      let len = leb();
+      // WASM_DYLINK_MEM_INFO
+      if (type == 1) {
+        let memory_size = leb(), memory_align = leb();
+        let table_size = leb(), table_align = leb();
+        return { memory_size, memory_align, table_size, table_align };
+      }
+      i += len;
+    }
+    return { memory_size: 0, memory_align: 0, table_size: 0, table_align: 0 };
+  };
+
+  // Calls to the C library that clang may leave in; anything else traps.
+  var simdHelpers = (mem) => ({
+    memcpy: (dst, src, n) => {
+      (new Uint8Array(mem.buffer)).copyWithin(dst, src, src + n);
+      return dst;
+    },
+    memmove: (dst, src, n) => {
+      (new Uint8Array(mem.buffer)).copyWithin(dst, src, src + n);
+      return dst;
+    },
+    memset: (dst, c, n) => {
+      (new Uint8Array(mem.buffer)).fill(c, dst, dst + n);
+      return dst;
+    },
+  });
+
+  // The side modules share the KaRaMeL memory: their data segment goes right
+  // after the data of the KaRaMeL modules, below the stack. A module that
+  // fails to link is left out, and the scalar code is used instead.
+  var linkSimd = async (modules) => {
+    let mem = Module.Karamel.mem;
+    for (let { name, buf } of modules) {
+      try {
+        let mod = await WebAssembly.compile(buf);
+        let info = dylinkMemInfo(mod);
+        let memory_base = loader.reserve(mem, info.memory_size, Math.max(1 << info.memory_align, 16));
+        let stack_pointer = new WebAssembly.Global({ value: "i32", mutable: true }, 0);
+        let env = {
+          memory: mem,
+          __memory_base: new WebAssembly.Global({ value: "i32", mutable: false }, memory_base),
+          __table_base: new WebAssembly.Global({ value: "i32", mutable: false }, 0),
+          __indirect_function_table: new WebAssembly.Table({ initial: info.table_size, element: "anyfunc" }),
+          __stack_pointer: stack_pointer,
+        };
+        let helpers = simdHelpers(mem);
+        WebAssembly.Module.imports(mod).forEach(({ module, name: f, kind }) => {
+          if (module == "env" && kind == "function" && !(f in env))
+            env[f] = f in helpers ? helpers[f] : () => {
+              throw new Error(f + " is not available to " + name);
+            };
+        });
+        let instance = await WebAssembly.instantiate(mod, { env });
+        if (instance.exports.__wasm_apply_data_relocs)
+          instance.exports.__wasm_apply_data_relocs();
+        if (instance.exports.__wasm_call_ctors)
+          instance.exports.__wasm_call_ctors();
+        SimdModule[name] = { exports: instance.exports, stack_pointer };
+      } catch (e) {
+        // console.log("Not using the SIMD module " + name + ": " + e);
+      }
+    }
+  };
+
   /*
   Inside WebAssembly, the functions only take pointers to memory and integers.
   However, we want to expose the functions of the wasm module with a nice Javascript
@@ -276,6 +396,10 @@ var HaclWasm = (function() {
         of the WebAssembly function does not coincide with the name of the
         WebAssembly module; the module name will not be used when calling it,
         instead 'name' will contain the full name of the function
+      - 'simd', optionally, the `module`, `name` and `custom_module_name` of
+        the same function in a SIMD side module, used instead when the engine
+        supports SIMD128 and the side module is present; the scalar function
+        is then the `scalar` property of the generated one
   */
 
   var array_type = function(type) {
@@ -548,10 +672,39 @@ var HaclWasm = (function() {
 
   // END HELPERS FOR HEAP LAYOUT
 
+  // Looks up the WebAssembly function of an api.json entry. For a SIMD side
+  // module, this also reserves its stack, so the caller must restore the
+  // KaRaMeL stack pointer afterwards.
+  var lookupFunction = function(proto) {
+    if (proto.custom_module_name) {
+      var func_name = proto.name;
+    } else {
+      var func_name = proto.module + "_" + proto.name;
+    }
+    var exports;
+    if (proto.simd_instance !== undefined) {
+      exports = proto.simd_instance.exports;
+      let stack = loader.reserve(Module.Karamel.mem, simd_stack_size, 16);
+      proto.simd_instance.stack_pointer.value = stack + simd_stack_size;
+    } else {
+      if (!(proto.module in Module))
+        throw new Error(proto.module + " is not in Module");
+      exports = Module[proto.module];
+    }
+    if (!(func_name in exports)) {
+      console.log(Object.keys(exports));
+      throw new Error(func_name + " is not in Module["+proto.module+"]");
+    }
+    return exports[func_name];
+  };
+
   // The object being filled:
   // - first level of keys = modules,
   // - second level of keys = functions within a module
   var api_obj = {};
+  // The entries of api.json that api_obj calls, i.e. with their SIMD
+  // alternative substituted in when it is available.
+  var api_obj_protos = {};
 
   // This is the main logic; this function is partially applied to its
   // first two arguments for each API entry. We assume JITs are working well
@@ -627,6 +780,12 @@ var HaclWasm = (function() {
         var arg_byte_buffer;
         if (arg.kind === "input") {
           var func_arg = args[arg.interface_index];
+          if (func_arg instanceof WasmBuffer && arg.type === "buffer") {
+            // Already in WebAssembly memory, nothing to copy.
+            if (func_arg.length !== size)
+              throw new Error("name: Please ensure the argument " + arg.name + " has length " + size);
+            return debug("array", func_arg.pointer());
+          }
           arg_byte_buffer = new (array_type(arg.type))(func_arg);
         } else if (arg.kind === "output") {
           arg_byte_buffer = new (array_type(arg.type))(size);
@@ -660,18 +819,7 @@ var HaclWasm = (function() {
     // loader.dump(Module.Karamel.mem, 2048, args[0] - (args[0] % 0x20));
 
     // Calling the wasm function !
-    if (proto.custom_module_name) {
-      var func_name = proto.name;
-    } else {
-      var func_name = proto.module + "_" + proto.name;
-    }
-    if (!(proto.module in Module))
-      throw new Error(proto.module + " is not in Module");
-    if (!(func_name in Module[proto.module])) {
-      console.log(Object.keys(Module[proto.module]));
-      throw new Error(func_name + " is not in Module["+proto.module+"]");
-    }
-    var call_return = Module[proto.module][func_name](...args);
+    var call_return = lookupFunction(proto)(...args);
 
     // console.log("After function call");
     // loader.dump(Module.Karamel.mem, 256, args[0] - (args[0] % 0x20));
@@ -701,7 +849,9 @@ var HaclWasm = (function() {
       }
     }).filter(v => v !== null);
 
-    // Resetting the stack pointer to its old value
+    // Resetting the stack pointer to its old value; the memory may have grown
+    // since `memory` was created.
+    memory = new Uint32Array(Module.Karamel.mem.buffer);
     memory[0] = sp;
     if ("kind" in proto.return && proto.return.kind === "layout") {
       // Heap-allocated value
@@ -732,7 +882,375 @@ var HaclWasm = (function() {
     if (proto.return.type === "void") {
       return return_buffers;
     }
-    throw new Error(func_name+": Unimplemented ! "+proto.return.type);
+    throw new Error(proto.name+": Unimplemented ! "+proto.return.type);
+  };
+
+  // RESIDENT MEMORY
+  // ---------------
+
+  // Every call above copies its arguments onto the stack and its results back
+  // out. Objects that outlive a call (WasmBuffers and streaming states) are
+  // instead placed below the stack, by permanently raising the stack pointer
+  // between two calls. Freed blocks are zeroed and kept for reuse in free lists
+  // indexed by their size, which is a multiple of 16.
+  var free_blocks = {};
+
+  var residentSize = size => Math.max(16, Math.ceil(size / 16) * 16);
+
+  // Must not be called with a stack frame in progress (see withStack), since
+  // restoring the stack pointer would release the block.
+  var residentAlloc = (size) => {
+    size = residentSize(size);
+    let l = free_blocks[size];
+    if (l !== undefined && l.length > 0)
+      return l.pop();
+    return loader.reserve(Module.Karamel.mem, size, 16);
+  };
+
+  var residentFree = (ptr, size) => {
+    size = residentSize(size);
+    (new Uint8Array(Module.Karamel.mem.buffer)).fill(0, ptr, ptr + size);
+    if (free_blocks[size] === undefined)
+      free_blocks[size] = [];
+    free_blocks[size].push(ptr);
+  };
+
+  // The size of a layout that was written with residentWriteLayout, by `key`.
+  // The key must identify the size of the object graph, e.g. a hash state and
+  // its algorithm.
+  var layout_sizes = {};
+
+  // Writes the object graph `v` below the stack, reusing a freed block of the
+  // same size if there is one.
+  var residentWriteLayout = (key, layout, v) => {
+    let top = new Uint32Array(Module.Karamel.mem.buffer)[0];
+    let size = layout_sizes[key];
+    let l = size !== undefined ? free_blocks[size] : undefined;
+    let block;
+    if (l !== undefined && l.length > 0)
+      block = l.pop();
+    else
+      block = loader.reserve(Module.Karamel.mem, 0, 16);
+    new Uint32Array(Module.Karamel.mem.buffer)[0] = block;
+    let ptr = stackWriteLayout(layout, v);
+    let end = new Uint32Array(Module.Karamel.mem.buffer)[0];
+    size = residentSize(end - block);
+    layout_sizes[key] = size;
+    new Uint32Array(Module.Karamel.mem.buffer)[0] = block < top ? top : block + size;
+    return { ptr, block, size };
+  };
+
+  // Runs `f`, which may reserve scratch space on the stack, and then releases
+  // that space as well as anything that the WebAssembly code allocated on the
+  // heap.
+  var withStack = (f) => {
+    let sp = new Uint32Array(Module.Karamel.mem.buffer)[0];
+    try {
+      return f();
+    } finally {
+      let memory = new Uint32Array(Module.Karamel.mem.buffer);
+      memory[0] = sp;
+      memory[memory.length - 1] = 0;
+    }
+  };
+
+  // A buffer that lives in WebAssembly memory. It can be passed instead of a
+  // Uint8Array to any function, which saves copying it onto the stack. Since
+  // the memory may grow (and the underlying ArrayBuffer be replaced) during
+  // any call, `array` returns a fresh view every time; do not hold on to it
+  // across calls.
+  class WasmBuffer {
+    constructor(ptr, length, owner) {
+      this._ptr = ptr;
+      this.length = length;
+      this._owner = owner;
+    }
+
+    pointer() {
+      if ((this._owner || this)._ptr === null)
+        throw new Error("WasmBuffer: use after free");
+      return this._ptr;
+    }
+
+    get array() {
+      return new Uint8Array(Module.Karamel.mem.buffer, this.pointer(), this.length);
+    }
+
+    // A view of [begin, end) that shares the memory of this buffer.
+    subarray(begin, end = this.length) {
+      if (begin < 0 || end > this.length || begin > end)
+        throw new Error("WasmBuffer.subarray: out of bounds");
+      return new WasmBuffer(this.pointer() + begin, end - begin, this._owner || this);
+    }
+
+    free() {
+      if (this._owner !== undefined)
+        throw new Error("WasmBuffer.free: cannot free a subarray");
+      residentFree(this.pointer(), this.length);
+      this._ptr = null;
+    }
+  }
+
+  var allocBuffer = (length) => new WasmBuffer(residentAlloc(length), length);
+
+  // Returns the address of `data` in WebAssembly memory, copying it onto the
+  // stack unless it is a WasmBuffer.
+  var copyIn = (data) => {
+    if (data instanceof WasmBuffer)
+      return data.pointer();
+    let ptr = loader.reserve(Module.Karamel.mem, data.length, 1);
+    (new Uint8Array(Module.Karamel.mem.buffer)).set(data, ptr);
+    return ptr;
+  };
+
+  // Space for an output of `length` bytes: `out` if provided, the stack
+  // otherwise.
+  var outputPointer = (out, length, name) => {
+    if (out === undefined)
+      return loader.reserve(Module.Karamel.mem, length, 8);
+    if (!(out instanceof WasmBuffer) || out.length !== length)
+      throw new Error(name + ": the output should be a WasmBuffer of length " + length);
+    return out.pointer();
+  };
+
+  // The WebAssembly code puts its own stack frames above the stack pointer,
+  // without growing the memory: make sure that there is room for them after
+  // the arguments.
+  const stack_headroom = 64 * 1024;
+
+  var ensureHeadroom = () => {
+    let sp = loader.reserve(Module.Karamel.mem, stack_headroom, 1);
+    new Uint32Array(Module.Karamel.mem.buffer)[0] = sp;
+  };
+
+  var exportOf = (module, name) => {
+    if (!(module in Module) || !(name in Module[module]))
+      throw new Error(name + " is not available: please load " + module);
+    return Module[module][name];
+  };
+
+  // STREAMING
+  // ---------
+
+  const hash_state = "EverCrypt_Hash_Incremental_hash_state";
+
+  // An EverCrypt_Hash state that stays in WebAssembly memory, so that update
+  // only copies the data (and nothing if it is a WasmBuffer).
+  class HashStream {
+    constructor(alg) {
+      this.alg = alg;
+      this.hash_len = api_obj.EverCrypt_Hash.hash_len(alg)[0];
+      let state = api_obj.EverCrypt_Hash.create(alg);
+      this._state = residentWriteLayout(hash_state + ":" + alg, hash_state, state);
+    }
+
+    _pointer() {
+      if (this._state === null)
+        throw new Error("HashStream: use after free");
+      return this._state.ptr;
+    }
+
+    update(data) {
+      let update = exportOf("EverCrypt_Hash", "EverCrypt_Hash_Incremental_update");
+      let err = withStack(() => {
+        let ptr = copyIn(data);
+        ensureHeadroom();
+        return update(this._pointer(), ptr, data.length);
+      });
+      if (err != 0)
+        throw new Error("HashStream.update: error " + err);
+      return this;
+    }
+
+    // Does not modify the state, so that more data may follow.
+    digest(out) {
+      let finish = exportOf("EverCrypt_Hash", "EverCrypt_Hash_Incremental_finish");
+      return withStack(() => {
+        let dst = outputPointer(out, this.hash_len, "HashStream.digest");
+        ensureHeadroom();
+        finish(this._pointer(), dst);
+        return out || read_memory("buffer", dst, this.hash_len);
+      });
+    }
+
+    reset() {
+      let init = exportOf("EverCrypt_Hash", "EverCrypt_Hash_Incremental_init");
+      withStack(() => {
+        ensureHeadroom();
+        init(this._pointer());
+      });
+      return this;
+    }
+
+    free() {
+      residentFree(this._state.block, this._state.size);
+      this._state = null;
+    }
+  }
+
+  // The algorithms of EverCrypt_HMAC, with their block length.
+  const hmac_block_len = { 1: 64, 2: 128, 3: 128, 4: 64, 6: 64, 7: 128 };
+
+  // HMAC on top of a HashStream: the inner hash is streamed, the outer one is
+  // computed by digest.
+  class HmacStream {
+    constructor(alg, key) {
+      if (!(alg in hmac_block_len))
+        throw new Error("HmacStream: unsupported algorithm " + alg);
+      let block_len = hmac_block_len[alg];
+      this._inner = new HashStream(alg);
+      // ipad, then opad
+      this._pads = allocBuffer(2 * block_len);
+      let k = key.length > block_len ? api_obj.EverCrypt_Hash.hash(alg, key)[0] : key;
+      if (k instanceof WasmBuffer)
+        k = k.array;
+      let pads = this._pads.array;
+      for (let i = 0; i < block_len; i++) {
+        let b = i < k.length ? k[i] : 0;
+        pads[i] = b ^ 0x36;
+        pads[block_len + i] = b ^ 0x5c;
+      }
+      this.alg = alg;
+      this.hash_len = this._inner.hash_len;
+      this.reset();
+    }
+
+    update(data) {
+      this._inner.update(data);
+      return this;
+    }
+
+    // Does not modify the state, so that more data may follow.
+    digest(out) {
+      let hash = exportOf("EverCrypt_Hash", "EverCrypt_Hash_Incremental_hash");
+      let block_len = hmac_block_len[this.alg];
+      return withStack(() => {
+        let input = loader.reserve(Module.Karamel.mem, block_len + this.hash_len, 8);
+        let opad = this._pads.pointer() + block_len;
+        (new Uint8Array(Module.Karamel.mem.buffer)).copyWithin(input, opad, opad + block_len);
+        let dst = outputPointer(out, this.hash_len, "HmacStream.digest");
+        ensureHeadroom();
+        exportOf("EverCrypt_Hash", "EverCrypt_Hash_Incremental_finish")(this._inner._pointer(), input + block_len);
+        hash(this.alg, dst, input, block_len + this.hash_len);
+        return out || read_memory("buffer", dst, this.hash_len);
+      });
+    }
+
+    reset() {
+      this._inner.reset();
+      this._inner.update(this._pads.subarray(0, hmac_block_len[this.alg]));
+      return this;
+    }
+
+    free() {
+      this._inner.free();
+      this._pads.free();
+    }
+  }
+
+  // BATCHES
+  // -------
+
+  // The batch functions make all their calls within a single stack frame and
+  // read all the outputs back with a single copy. Each message may be a
+  // Uint8Array or a WasmBuffer; `out`, if provided, is a WasmBuffer that
+  // receives the concatenated outputs, and is then returned instead.
+
+  // Splits a copy of `len` bytes at `ptr` into `n` arrays of `len / n` bytes.
+  var readMany = (ptr, n, len) => {
+    let all = read_memory("buffer", ptr, n * len);
+    return Array.from({ length: n }, (_, i) => all.subarray(i * len, (i + 1) * len));
+  };
+
+  var hashBatch = (alg, messages, out) => {
+    let hash = exportOf("EverCrypt_Hash", "EverCrypt_Hash_Incremental_hash");
+    let hash_len = api_obj.EverCrypt_Hash.hash_len(alg)[0];
+    return withStack(() => {
+      let dst = outputPointer(out, messages.length * hash_len, "Batch.hash");
+      messages.forEach((m, i) => {
+        let ptr = copyIn(m);
+        ensureHeadroom();
+        hash(alg, dst + i * hash_len, ptr, m.length);
+      });
+      return out || readMany(dst, messages.length, hash_len);
+    });
+  };
+
+  const hmac_functions = {
+    1: "Hacl_HMAC_compute_sha2_256",
+    2: "Hacl_HMAC_compute_sha2_384",
+    3: "Hacl_HMAC_compute_sha2_512",
+    4: "Hacl_HMAC_legacy_compute_sha1",
+    6: "Hacl_HMAC_compute_blake2s_32",
+    7: "Hacl_HMAC_compute_blake2b_32",
+  };
+
+  var hmacBatch = (alg, key, messages, out) => {
+    if (!(alg in hmac_functions))
+      throw new Error("Batch.hmac: unsupported algorithm " + alg);
+    let hmac = exportOf("Hacl_HMAC", hmac_functions[alg]);
+    let tag_len = api_obj.EverCrypt_Hash.hash_len(alg)[0];
+    return withStack(() => {
+      let k = copyIn(key);
+      let dst = outputPointer(out, messages.length * tag_len, "Batch.hmac");
+      messages.forEach((m, i) => {
+        let ptr = copyIn(m);
+        ensureHeadroom();
+        hmac(dst + i * tag_len, k, key.length, ptr, m.length);
+      });
+      return out || readMany(dst, messages.length, tag_len);
+    });
+  };
+
+  var checkLengths = (name, what, arrays, length) => {
+    arrays.forEach((a, i) => {
+      if (a.length !== length)
+        throw new Error(name + ": " + what + " #" + i + " should have length " + length);
+    });
+  };
+
+  var checkAead = (name, key, nonces, aads, inputs) => {
+    checkLengths(name, "key", [ key ], 32);
+    checkLengths(name, "nonce", nonces, 12);
+    if (nonces.length !== inputs.length || aads.length !== inputs.length)
+      throw new Error(name + ": expected as many nonces and aads as messages");
+  };
+
+  // Returns the ciphertexts and the tags.
+  var aeadEncryptBatch = (key, nonces, aads, plaintexts) => {
+    checkAead("Batch.aead_encrypt", key, nonces, aads, plaintexts);
+    return withStack(() => {
+      let encrypt = lookupFunction(api_obj_protos.Chacha20Poly1305.aead_encrypt);
+      let k = copyIn(key);
+      let tags = loader.reserve(Module.Karamel.mem, 16 * plaintexts.length, 8);
+      let ciphertexts = plaintexts.map((m, i) => {
+        let c = loader.reserve(Module.Karamel.mem, m.length, 8);
+        let n = copyIn(nonces[i]), aad = copyIn(aads[i]), ptr = copyIn(m);
+        ensureHeadroom();
+        encrypt(k, n, aads[i].length, aad, m.length, ptr, c, tags + 16 * i);
+        return [ c, m.length ];
+      });
+      return [ ciphertexts.map(([ c, len ]) => read_memory("buffer", c, len)), readMany(tags, plaintexts.length, 16) ];
+    });
+  };
+
+  // Returns the plaintexts, with null for those that failed to authenticate.
+  var aeadDecryptBatch = (key, nonces, aads, ciphertexts, tags) => {
+    checkAead("Batch.aead_decrypt", key, nonces, aads, ciphertexts);
+    checkLengths("Batch.aead_decrypt", "tag", tags, 16);
+    if (tags.length !== ciphertexts.length)
+      throw new Error("Batch.aead_decrypt: expected as many tags as messages");
+    return withStack(() => {
+      let decrypt = lookupFunction(api_obj_protos.Chacha20Poly1305.aead_decrypt);
+      let k = copyIn(key);
+      return ciphertexts.map((c, i) => {
+        let m = loader.reserve(Module.Karamel.mem, c.length, 8);
+        let n = copyIn(nonces[i]), aad = copyIn(aads[i]), ptr = copyIn(c), tag = copyIn(tags[i]);
+        ensureHeadroom();
+        let r = decrypt(k, n, aads[i].length, aad, c.length, m, ptr, tag);
+        return r === 0 ? read_memory("buffer", m, c.length) : null;
+      });
+    });
   };
 
   var getInitializedHaclModule = async function (modules) {
@@ -746,6 +1264,15 @@ var HaclWasm = (function() {
       let api_json = await api_promise;
       validateJSON(api_json);
 
+      if (simdSupported()) {
+        let simd_modules = new Set();
+        for (let key_module in api_json)
+          for (let key_func in api_json[key_module])
+            if ("simd" in api_json[key_module][key_func])
+              simd_modules.add(api_json[key_module][key_func].simd.module);
+        await linkSimd(await getSimdModulesPromise([...simd_modules]));
+      }
+
       // We follow the structure of api.json to expose an object whose structure
       // follows the keys of api.json; each entry is a partial application of
       // `callWithProto` (generic API wrapper) to its specific entry in api.json
@@ -754,18 +1281,50 @@ var HaclWasm = (function() {
         for (let key_func in api_json[key_module]) {
           if (api_obj[key_module] == null) {
             api_obj[key_module] = {};
+            api_obj_protos[key_module] = {};
           }
+          let proto = api_json[key_module][key_func];
+          let scalar_proto = proto;
+          if ("simd" in proto && proto.simd.module in SimdModule) {
+            proto = Object.assign({}, proto, proto.simd, {
+              simd_instance: SimdModule[proto.simd.module]
+            });
+          }
+          api_obj_protos[key_module][key_func] = proto;
           api_obj[key_module][key_func] = function(...args) {
-            return callWithProto(api_json[key_module][key_func], args);
+            return callWithProto(proto, args);
           };
+          // When the SIMD128 version is used, the scalar one remains available
+          // as `scalar`, e.g. to check one against the other.
+          if (proto !== scalar_proto) {
+            api_obj[key_module][key_func].scalar = function(...args) {
+              return callWithProto(scalar_proto, args);
+            };
+          }
         };
       };
+
+      // Entry points that are not described by api.json, see above.
+      api_obj.Memory = {
+        alloc: allocBuffer,
+      };
+      api_obj.Streaming = {
+        hash: alg => new HashStream(alg),
+        hmac: (alg, key) => new HmacStream(alg, key),
+      };
+      api_obj.Batch = {
+        hash: hashBatch,
+        hmac: hmacBatch,
+        aead_encrypt: aeadEncryptBatch,
+        aead_decrypt: aeadDecryptBatch,
+      };
     }
     return Promise.resolve(api_obj);
   };
 
   return {
     getInitializedHaclModule: getInitializedHaclModule,
+    simdModules: () => Object.keys(SimdModule),
     dump: (sz, ofs) => loader.dump(Module.Karamel.mem, sz, ofs)
   };
 })();
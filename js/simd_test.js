@@ -0,0 +1,88 @@
+// jshint esversion: 8
+
+// Checks the SIMD128 side modules in `simd/` against the scalar KaRaMeL code.
+// Run this with `node simd_test.js`; it does nothing when `simd/` is missing,
+// i.e. when the bindings were built without `WASI_SDK_PATH`.
+
+var fs = require('fs');
+var path = require('path');
+var HaclWasm = require('./api.js');
+
+// Test helpers
+// ------------
+
+const buf2hex = buffer => [...new Uint8Array(buffer)].map(x => `00${x.toString(16)}`.slice(-2)).join('');
+
+function assert(b, msg) {
+  if (!b)
+    throw new Error(msg);
+}
+
+// Results of the generated functions are arrays of buffers and integers.
+const results2hex = rs => rs.map(r => typeof r === 'object' ? buf2hex(r) : r.toString()).join(',');
+
+function bytes(n, seed) {
+  return Uint8Array.from({ length: n }, (_, i) => (seed * 131 + i * 7) & 0xff);
+}
+
+// The vectorized code handles 4 blocks (ChaCha20) or 1 block (BLAKE2s) at a
+// time; the lengths cover partial, single and several such groups.
+const lengths = [ 0, 1, 15, 16, 63, 64, 65, 255, 256, 257, 1000, 4096 + 3 ];
+
+// Functional test
+// ---------------
+
+function testSimdModules() {
+  let modules = HaclWasm.simdModules();
+  assert(modules.length > 0, "no SIMD module was linked although simd/ exists");
+  console.log("testSimdModules successful: " + modules.join(", "));
+}
+
+function testChacha20Poly1305(Hacl) {
+  let { aead_encrypt, aead_decrypt } = Hacl.Chacha20Poly1305;
+  assert(aead_encrypt.scalar !== undefined && aead_decrypt.scalar !== undefined,
+    "Chacha20Poly1305 is not using the SIMD module");
+  lengths.forEach((len, i) => {
+    let key = bytes(32, i), nonce = bytes(12, i + 1), aad = bytes(i % 20, i + 2);
+    let m = bytes(len, i + 3);
+    let simd = aead_encrypt(key, nonce, aad, m);
+    let scalar = aead_encrypt.scalar(key, nonce, aad, m);
+    assert(results2hex(simd) == results2hex(scalar), "aead_encrypt, length " + len);
+    let [ c, mac ] = simd;
+    assert(results2hex(aead_decrypt(key, nonce, aad, c, mac)) ==
+      results2hex(aead_decrypt.scalar(key, nonce, aad, c, mac)), "aead_decrypt, length " + len);
+    mac = Uint8Array.from(mac);
+    mac[0] ^= 1;
+    assert(results2hex(aead_decrypt(key, nonce, aad, c, mac)) ==
+      results2hex(aead_decrypt.scalar(key, nonce, aad, c, mac)), "aead_decrypt, forged tag, length " + len);
+  });
+  console.log("testChacha20Poly1305 successful");
+}
+
+function testBlake2s(Hacl) {
+  let { blake2s } = Hacl.Blake2;
+  assert(blake2s.scalar !== undefined, "Blake2s is not using the SIMD module");
+  lengths.forEach((len, i) => {
+    let data = bytes(len, i);
+    [ [ 32, 0 ], [ 16, 32 ], [ 1, 7 ] ].forEach(([ out_len, key_len ]) => {
+      let key = bytes(key_len, i + 1);
+      assert(results2hex(blake2s(out_len, data, key)) == results2hex(blake2s.scalar(out_len, data, key)),
+        "blake2s, length " + len + ", output " + out_len + ", key " + key_len);
+    });
+  });
+  console.log("testBlake2s successful");
+}
+
+// Main test driver
+if (!fs.existsSync(path.resolve(__dirname, './simd'))) {
+  console.log("simd/ is missing, skipping the SIMD tests");
+} else {
+  HaclWasm.getInitializedHaclModule().then(function(Hacl) {
+    testSimdModules();
+    testChacha20Poly1305(Hacl);
+    testBlake2s(Hacl);
+  }).catch(e => {
+    console.log(e);
+    process.exit(1);
+  });
+}
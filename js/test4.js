@@ -0,0 +1,157 @@
+// jshint esversion: 8
+
+// Tests for the entry points of api.js that are not described by api.json:
+// streaming hashes and HMACs whose state stays in WebAssembly memory, batches,
+// and buffers allocated in WebAssembly memory. Run this with `node test4.js`.
+
+var HaclWasm = require('./api.js');
+
+// Test helpers
+// ------------
+
+const buf2hex = buffer => [...new Uint8Array(buffer)].map(x => `00${x.toString(16)}`.slice(-2)).join('');
+
+function assert(b, msg) {
+  if (!b)
+    throw new Error(msg);
+}
+
+function stringToUint8Array(s) {
+  let b = new Uint8Array(s.length);
+  (new TextEncoder).encodeInto(s, b);
+  return b;
+}
+
+// Deterministic messages of lengths 0, 7, 14, ...
+function messages(n) {
+  return Array.from({ length: n }, (_, i) =>
+    Uint8Array.from({ length: 7 * i }, (_, j) => (i * 31 + j) & 0xff));
+}
+
+const SHA2_256 = 1;
+const SHA2_512 = 3;
+const Blake2S = 6;
+
+// Functional test
+// ---------------
+
+function testStreamingHash(Hacl) {
+  let msg = messages(40)[39];
+  let [ expected ] = Hacl.SHA2.hash_256(msg);
+  let s = Hacl.Streaming.hash(SHA2_256);
+  for (let i = 0; i < msg.length; i += 17)
+    s.update(msg.subarray(i, i + 17));
+  assert(buf2hex(s.digest()) == buf2hex(expected), "streaming SHA2-256");
+  // digest does not consume the state
+  assert(buf2hex(s.digest()) == buf2hex(expected), "second digest");
+  s.reset();
+  s.update(stringToUint8Array("hello world"));
+  assert(buf2hex(s.digest()) == "b94d27b9934d3e08a52e52d7da7dabfac484efe37a5380ee9088f7ace2efcde9", "reset");
+  s.free();
+
+  // Reuses the block that was just freed.
+  let t = Hacl.Streaming.hash(SHA2_256);
+  let buf = Hacl.Memory.alloc(msg.length);
+  buf.array.set(msg);
+  t.update(buf.subarray(0, 100)).update(buf.subarray(100));
+  assert(buf2hex(t.digest()) == buf2hex(expected), "streaming from a WasmBuffer");
+  t.free();
+  buf.free();
+  console.log("testStreamingHash successful");
+}
+
+function testStreamingHmac(Hacl) {
+  let s = Hacl.Streaming.hmac(SHA2_256, stringToUint8Array("Jefe"));
+  s.update(stringToUint8Array("what do ya want ")).update(stringToUint8Array("for nothing?"));
+  assert(buf2hex(s.digest()) == "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843", "RFC 4231, test case 2");
+  s.free();
+
+  let msg = messages(20)[19];
+  // Keys shorter and longer than a block
+  [ 20, 131 ].forEach(key_len => {
+    let key = Uint8Array.from({ length: key_len }, (_, i) => i);
+    let [ expected256 ] = Hacl.HMAC.sha256(key, msg);
+    let [ expected512 ] = Hacl.HMAC.sha512(key, msg);
+    let s256 = Hacl.Streaming.hmac(SHA2_256, key);
+    let s512 = Hacl.Streaming.hmac(SHA2_512, key);
+    for (let i = 0; i < msg.length; i += 50) {
+      s256.update(msg.subarray(i, i + 50));
+      s512.update(msg.subarray(i, i + 50));
+    }
+    assert(buf2hex(s256.digest()) == buf2hex(expected256), "streaming HMAC-SHA2-256, key length " + key_len);
+    assert(buf2hex(s512.digest()) == buf2hex(expected512), "streaming HMAC-SHA2-512, key length " + key_len);
+    s256.reset().update(msg);
+    assert(buf2hex(s256.digest()) == buf2hex(expected256), "HMAC reset");
+    s256.free();
+    s512.free();
+  });
+  console.log("testStreamingHmac successful");
+}
+
+function testBatch(Hacl) {
+  let msgs = messages(16);
+  let digests = Hacl.Batch.hash(SHA2_256, msgs);
+  msgs.forEach((m, i) =>
+    assert(buf2hex(digests[i]) == buf2hex(Hacl.SHA2.hash_256(m)[0]), "Batch.hash #" + i));
+
+  // Outputs in WebAssembly memory
+  let out = Hacl.Memory.alloc(32 * msgs.length);
+  assert(Hacl.Batch.hash(SHA2_256, msgs, out) === out, "Batch.hash with out");
+  assert(buf2hex(out.array.subarray(32 * 5, 32 * 6)) == buf2hex(digests[5]), "Batch.hash into a WasmBuffer");
+  out.free();
+
+  let key = Uint8Array.from({ length: 32 }, (_, i) => i);
+  let tags = Hacl.Batch.hmac(SHA2_256, key, msgs);
+  msgs.forEach((m, i) =>
+    assert(buf2hex(tags[i]) == buf2hex(Hacl.HMAC.sha256(key, m)[0]), "Batch.hmac #" + i));
+  let tags_s = Hacl.Batch.hmac(Blake2S, key, msgs);
+  let s = Hacl.Streaming.hmac(Blake2S, key);
+  s.update(msgs[9]);
+  assert(buf2hex(s.digest()) == buf2hex(tags_s[9]), "HMAC-BLAKE2s");
+  s.free();
+
+  let nonces = msgs.map((_, i) => Uint8Array.from({ length: 12 }, (_, j) => i + j));
+  let aads = msgs.map((_, i) => Uint8Array.from({ length: i % 5 }, (_, j) => j));
+  let [ ciphertexts, macs ] = Hacl.Batch.aead_encrypt(key, nonces, aads, msgs);
+  msgs.forEach((m, i) => {
+    let [ c, mac ] = Hacl.Chacha20Poly1305.aead_encrypt(key, nonces[i], aads[i], m);
+    assert(buf2hex(ciphertexts[i]) == buf2hex(c) && buf2hex(macs[i]) == buf2hex(mac), "Batch.aead_encrypt #" + i);
+  });
+  macs[3] = Uint8Array.from(macs[3]);
+  macs[3][0] ^= 1;
+  let plaintexts = Hacl.Batch.aead_decrypt(key, nonces, aads, ciphertexts, macs);
+  msgs.forEach((m, i) => {
+    if (i == 3)
+      assert(plaintexts[i] === null, "Batch.aead_decrypt accepted a forged tag");
+    else
+      assert(buf2hex(plaintexts[i]) == buf2hex(m), "Batch.aead_decrypt #" + i);
+  });
+  console.log("testBatch successful");
+}
+
+function testWasmBufferArguments(Hacl) {
+  let msg = messages(30)[29];
+  let buf = Hacl.Memory.alloc(msg.length);
+  buf.array.set(msg);
+  assert(buf2hex(Hacl.SHA2.hash_256(buf)[0]) == buf2hex(Hacl.SHA2.hash_256(msg)[0]), "WasmBuffer argument");
+  buf.free();
+  let threw = false;
+  try {
+    Hacl.SHA2.hash_256(buf);
+  } catch (e) {
+    threw = true;
+  }
+  assert(threw, "use after free");
+  console.log("testWasmBufferArguments successful");
+}
+
+// Main test driver
+HaclWasm.getInitializedHaclModule().then(function(Hacl) {
+  testStreamingHash(Hacl);
+  testStreamingHmac(Hacl);
+  testBatch(Hacl);
+  testWasmBufferArguments(Hacl);
+}).catch(e => {
+  console.log(e);
+  process.exit(1);
+});
@@ -30,7 +30,8 @@
 #endif
 
 #if (                                                                          \
-    (defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L) &&             \
+    (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) ||          \
+     ((defined __cplusplus) && (__cplusplus >= 201103L))) &&                   \
     (!(defined KRML_HOST_EPRINTF)))
 #  define KRML_HOST_EPRINTF(...) fprintf(stderr, __VA_ARGS__)
 #elif !(defined KRML_HOST_EPRINTF) && defined(_MSC_VER)
@@ -7,3 +7,6 @@ rm -rf npm
 mkdir -p npm
 cp src/wasm/*.wasm src/wasm/layouts.json src/wasm/INFO.txt src/wasm/shell.js src/wasm/loader.js npm
 cp js/* npm
+if [ -d build/js/simd ]; then
+  cp -r build/js/simd npm
+fi
@@ -261,3 +261,132 @@ module DRBG = struct
     (* EverCrypt.DRBG.reseed_st *)
     everCrypt_DRBG_reseed st (C.ctypes_buf additional_input) (C.size_uint32 additional_input)
 end
+
+module Bigstring = struct
+  module Locked = EverCrypt_Bigstring_bindings.Bindings(EverCrypt_Bigstring_stubs.Locked)
+  module Unlocked = EverCrypt_Bigstring_bindings.Bindings(EverCrypt_Bigstring_stubs.Unlocked)
+
+  type t = (char, Bigarray.int8_unsigned_elt, Bigarray.c_layout) Bigarray.Array1.t
+
+  let unlock_threshold = ref 4096
+  let unlocked len = len >= !unlock_threshold
+
+  let size = Bigarray.Array1.dim
+  let size_uint32 b = UInt32.of_int (size b)
+  let buf b = coerce (ptr char) (ptr uint8_t) (bigarray_start array1 b)
+  (* The C call only sees raw pointers, so the buffers and states it works on
+   * must stay reachable until it returns: with the runtime lock released,
+   * another thread may run the GC and their finalisers in the meantime. *)
+  let keep_alive x = ignore (Sys.opaque_identity x)
+
+  let lengths lens =
+    Array.iter check_max_buffer_len lens;
+    CArray.of_list uint32_t (List.map UInt32.of_int (Array.to_list lens))
+  let total lens = Array.fold_left (+) 0 lens
+
+  module Hash = struct
+    open HashDefs
+    let hash ~alg ~msg ~digest =
+      check_max_buffer_len (size msg);
+      assert (size digest = digest_len alg);
+      let f = if unlocked (size msg) then Unlocked.everCrypt_Hash_Incremental_hash
+        else Locked.everCrypt_Hash_Incremental_hash in
+      f (alg_definition alg) (buf digest) (buf msg) (size_uint32 msg);
+      keep_alive (msg, digest)
+    let update ~st:(_alg, t) ~msg =
+      check_max_buffer_len (size msg);
+      let f = if unlocked (size msg) then Unlocked.everCrypt_Hash_Incremental_update
+        else Locked.everCrypt_Hash_Incremental_update in
+      let e = f t (buf msg) (size_uint32 msg) in
+      keep_alive (t, msg);
+      assert (Error.get_result e = Error.Success ())
+    let hash_batch ~alg ~msgs ~lens ~digests =
+      let n = Array.length lens in
+      assert (total lens = size msgs);
+      assert (size digests = n * digest_len alg);
+      let lens = lengths lens in
+      let f = if unlocked (size msgs) then Unlocked.everCrypt_Hash_Incremental_hash_batch
+        else Locked.everCrypt_Hash_Incremental_hash_batch in
+      f (alg_definition alg) (UInt32.of_int n) (buf digests) (buf msgs) (CArray.start lens);
+      keep_alive (msgs, lens, digests)
+  end
+
+  module HMAC = struct
+    let mac ~alg ~key ~msg ~tag =
+      assert (size tag = HashDefs.digest_len alg);
+      check_max_buffer_len (size key);
+      check_max_buffer_len (size msg);
+      let f = if unlocked (size msg) then Unlocked.everCrypt_HMAC_compute
+        else Locked.everCrypt_HMAC_compute in
+      f (HashDefs.alg_definition alg) (buf tag) (buf key) (size_uint32 key) (buf msg) (size_uint32 msg);
+      keep_alive (key, msg, tag)
+  end
+
+  module AEAD = struct
+    open SharedDefs.AEADDefs
+    let encrypt ~st:(alg, st) ~iv ~ad ~pt ~ct ~tag : unit Error.result =
+      check_sizes ~alg ~iv_len:(size iv) ~tag_len:(size tag)
+        ~ad_len:(size ad) ~pt_len:(size pt) ~ct_len:(size ct);
+      let f = if unlocked (size pt) then Unlocked.everCrypt_AEAD_encrypt
+        else Locked.everCrypt_AEAD_encrypt in
+      let r = f (!@st) (buf iv) (size_uint32 iv) (buf ad) (size_uint32 ad)
+          (buf pt) (size_uint32 pt) (buf ct) (buf tag) in
+      keep_alive (st, iv, ad, pt, ct, tag);
+      Error.get_result r
+    let decrypt ~st:(alg, st) ~iv ~ad ~ct ~tag ~pt : unit Error.result =
+      check_sizes ~alg ~iv_len:(size iv) ~tag_len:(size tag)
+        ~ad_len:(size ad) ~pt_len:(size pt) ~ct_len:(size ct);
+      let f = if unlocked (size ct) then Unlocked.everCrypt_AEAD_decrypt
+        else Locked.everCrypt_AEAD_decrypt in
+      let r = f (!@st) (buf iv) (size_uint32 iv) (buf ad) (size_uint32 ad)
+          (buf ct) (size_uint32 ct) (buf tag) (buf pt) in
+      keep_alive (st, iv, ad, ct, tag, pt);
+      Error.get_result r
+    let check_batch ~alg ~ivs ~ads ~ad_lens ~lens ~tags =
+      let n = Array.length lens in
+      assert (n > 0 && Array.length ad_lens = n);
+      assert (size ivs mod n = 0);
+      assert (size tags = n * tag_length alg);
+      assert (total ad_lens = size ads);
+      Array.iteri (fun i len ->
+          check_sizes ~alg ~iv_len:(size ivs / n) ~tag_len:(tag_length alg)
+            ~ad_len:ad_lens.(i) ~pt_len:len ~ct_len:len) lens;
+      n, size ivs / n
+    let encrypt_batch ~st:(alg, st) ~ivs ~ads ~ad_lens ~pts ~lens ~cts ~tags : unit Error.result =
+      let n, iv_len = check_batch ~alg ~ivs ~ads ~ad_lens ~lens ~tags in
+      assert (total lens = size pts && size pts = size cts);
+      let ad_lens = lengths ad_lens in
+      let lens = lengths lens in
+      let f = if unlocked (size pts) then Unlocked.everCrypt_AEAD_encrypt_batch
+        else Locked.everCrypt_AEAD_encrypt_batch in
+      let r = f (!@st) (UInt32.of_int n) (buf ivs) (UInt32.of_int iv_len)
+          (buf ads) (CArray.start ad_lens) (buf pts) (CArray.start lens) (buf cts) (buf tags) in
+      keep_alive (st, ivs, ads, ad_lens, pts, lens, cts, tags);
+      Error.get_result r
+    let decrypt_batch ~st:(alg, st) ~ivs ~ads ~ad_lens ~cts ~lens ~tags ~pts =
+      let n, iv_len = check_batch ~alg ~ivs ~ads ~ad_lens ~lens ~tags in
+      assert (total lens = size cts && size cts = size pts);
+      let ad_lens = lengths ad_lens in
+      let lens = lengths lens in
+      let valid = CArray.make bool n in
+      let f = if unlocked (size cts) then Unlocked.everCrypt_AEAD_decrypt_batch
+        else Locked.everCrypt_AEAD_decrypt_batch in
+      ignore (f (!@st) (UInt32.of_int n) (buf ivs) (UInt32.of_int iv_len)
+                (buf ads) (CArray.start ad_lens) (buf cts) (CArray.start lens) (buf tags) (buf pts)
+                (CArray.start valid));
+      keep_alive (st, ivs, ads, ad_lens, cts, lens, tags, pts);
+      Array.of_list (CArray.to_list valid)
+  end
+
+  module Curve25519 = struct
+    let ecdh_batch ~sks ~pks ~shared =
+      let n = size sks / 32 in
+      assert (size sks = 32 * n && size pks = size sks && size shared = size sks);
+      let valid = CArray.make bool n in
+      (* Every key exchange is long enough to release the lock for. *)
+      ignore (Unlocked.everCrypt_Curve25519_ecdh_batch (UInt32.of_int n)
+                (buf shared) (buf sks) (buf pks) (CArray.start valid));
+      keep_alive (sks, pks, shared);
+      Array.of_list (CArray.to_list valid)
+  end
+end
@@ -296,3 +296,76 @@ end
 
     Users have the possibility to reseed, but it is not required.
 *)
+
+
+(** {1 Bigarray buffers}
+
+Versions of the functions above for buffers that live outside the OCaml heap.
+*)
+
+module Bigstring : sig
+  type t = (char, Bigarray.int8_unsigned_elt, Bigarray.c_layout) Bigarray.Array1.t
+
+  val unlock_threshold : int ref
+  (** Calls whose main input is at least [!unlock_threshold] bytes long (4096 by default)
+      release the OCaml runtime lock while the C code runs, so that other threads,
+      or other domains in OCaml 5, can make progress. Smaller inputs keep the lock,
+      which is cheaper than releasing and reacquiring it.
+
+      While the lock is released, the caller must not modify the buffers of the call from
+      another thread, and a {!EverCrypt.Hash.t} or {!EverCrypt.AEAD.t} must not be used
+      by two threads at the same time. Output buffers must not overlap input buffers. *)
+
+  module Hash : sig
+    val hash : alg:HashDefs.alg -> msg:t -> digest:t -> unit
+    (** Same as {!EverCrypt.Hash.Noalloc.hash}. *)
+
+    val update : st:Hash.t -> msg:t -> unit
+    (** Same as {!EverCrypt.Hash.update}. *)
+
+    val hash_batch : alg:HashDefs.alg -> msgs:t -> lens:int array -> digests:t -> unit
+    (** [hash_batch alg msgs lens digests] hashes the messages stored back to back
+        in [msgs], the [i]-th one being [lens.(i)] bytes long, with a single C call,
+        and writes their digests back to back in [digests]. *)
+  end
+
+  module HMAC : sig
+    val mac : alg:HashDefs.alg -> key:t -> msg:t -> tag:t -> unit
+    (** Same as {!EverCrypt.HMAC.Noalloc.mac}. *)
+  end
+
+  module AEAD : sig
+    val encrypt : st:AEAD.t -> iv:t -> ad:t -> pt:t -> ct:t -> tag:t -> unit Error.result
+    (** Same as {!EverCrypt.AEAD.Noalloc.encrypt}. *)
+
+    val decrypt : st:AEAD.t -> iv:t -> ad:t -> ct:t -> tag:t -> pt:t -> unit Error.result
+    (** Same as {!EverCrypt.AEAD.Noalloc.decrypt}. *)
+
+    val encrypt_batch : st:AEAD.t -> ivs:t -> ads:t -> ad_lens:int array -> pts:t -> lens:int array
+      -> cts:t -> tags:t -> unit Error.result
+    (** [encrypt_batch st ivs ads ad_lens pts lens cts tags] encrypts [Array.length lens]
+        messages with a single C call. The plaintexts are stored back to back in [pts],
+        the [i]-th one being [lens.(i)] bytes long, and are encrypted into the same
+        ranges of [cts]; the associated data are stored likewise in [ads], with lengths
+        [ad_lens]. [ivs] holds one nonce per message, all of the same length, and
+        [tags] receives one 16-byte tag per message. *)
+
+    val decrypt_batch : st:AEAD.t -> ivs:t -> ads:t -> ad_lens:int array -> cts:t -> lens:int array
+      -> tags:t -> pts:t -> bool array
+    (** [decrypt_batch st ivs ads ad_lens cts lens tags pts] decrypts the batch laid out
+        as for {!encrypt_batch} with a single C call, and returns for each message
+        whether it was authenticated. The plaintext of a message that was not must
+        not be used. *)
+  end
+
+  module Curve25519 : sig
+    val ecdh_batch : sks:t -> pks:t -> shared:t -> bool array
+    (** [ecdh_batch sks pks shared] computes [size sks / 32] ECDH shared keys from the
+        32-byte secret keys in [sks] and public keys in [pks] with a single C call, which
+        always releases the runtime lock, and writes them to [shared]. It returns, for
+        each key exchange, whether the shared key is non-zero. *)
+  end
+end
+(** Bigarrays are not moved by the garbage collector, which makes it possible to release
+    the OCaml runtime lock while C code reads and writes them, and to pass a whole batch
+    of messages to C at once instead of crossing the FFI once per message. *)
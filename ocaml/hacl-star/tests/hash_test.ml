@@ -205,6 +205,44 @@ let test_agile (v: Bytes.t hash_test) =
     test_result Failure "incremental hash"
 
 
+let bigstring_of_bytes b =
+  let bs = Bigarray.(Array1.create char c_layout (Bytes.length b)) in
+  Bytes.iteri (Bigarray.Array1.set bs) b;
+  bs
+
+let bytes_of_bigstring bs =
+  Bytes.init (Bigarray.Array1.dim bs) (Bigarray.Array1.get bs)
+
+(* The message sizes straddle the threshold for releasing the runtime lock. *)
+let test_bigstring () =
+  let test_result = test_result "EverCrypt.Bigstring.Hash" in
+  let alg = HashDefs.SHA2_256 in
+  let lens = [| 0; 3; 64; 4096; 10000 |] in
+  let msgs = Bytes.init (Array.fold_left (+) 0 lens) (fun i -> Char.chr (i land 0xff)) in
+  let expected = Bytes.create (32 * Array.length lens) in
+  let _ = Array.fold_left (fun (i, off) len ->
+      Bytes.blit (Hash.hash ~alg ~msg:(Bytes.sub msgs off len)) 0 expected (32 * i) 32;
+      i + 1, off + len) (0, 0) lens in
+
+  let digests = bigstring_of_bytes (Bytes.make (32 * Array.length lens) '\x00') in
+  Bigstring.Hash.hash_batch ~alg ~msgs:(bigstring_of_bytes msgs) ~lens ~digests;
+  if Bytes.equal (bytes_of_bigstring digests) expected then
+    test_result Success "batch"
+  else
+    test_result Failure "batch";
+
+  let digest = bigstring_of_bytes (Bytes.make 32 '\x00') in
+  let msg = Bytes.sub msgs (3 + 64 + 4096) 10000 in
+  Bigstring.Hash.hash ~alg ~msg:(bigstring_of_bytes msg) ~digest;
+  let st = Hash.init ~alg in
+  Bigstring.Hash.update ~st ~msg:(bigstring_of_bytes msg);
+  if Bytes.equal (bytes_of_bigstring digest) (Bytes.sub expected (32 * 4) 32) &&
+     Bytes.equal (Hash.finish ~st) (Bytes.sub expected (32 * 4) 32) then
+    test_result Success "one-shot and incremental hash"
+  else
+    test_result Failure "one-shot and incremental hash"
+
+
 let test_nonagile (n: string) (v: Bytes.t hash_test) hash hash_noalloc =
   let test_result = test_result (n ^ "." ^ v.name) in
   let digest = Test_utils.init_bytes (output_len v.alg) in
@@ -335,6 +373,8 @@ let _ =
   test_agile test_sha1;
   test_agile test_md5;
 
+  test_bigstring ();
+
   test_nonagile "Hacl" test_sha1 Hacl.SHA1.hash Hacl.SHA1.Noalloc.hash;
   test_nonagile "Hacl" test_md5 Hacl.MD5.hash Hacl.MD5.Noalloc.hash;
 
@@ -25,6 +25,9 @@ module Bindings(F:Cstubs.FOREIGN) =
       foreign "EverCrypt_AutoConfig2_has_rdrand" (void @-> (returning bool))
     let everCrypt_AutoConfig2_has_avx512 =
       foreign "EverCrypt_AutoConfig2_has_avx512" (void @-> (returning bool))
+    let everCrypt_AutoConfig2_has_avx512ifma =
+      foreign "EverCrypt_AutoConfig2_has_avx512ifma"
+        (void @-> (returning bool))
     let everCrypt_AutoConfig2_recall =
       foreign "EverCrypt_AutoConfig2_recall" (void @-> (returning void))
     let everCrypt_AutoConfig2_init =
@@ -59,6 +62,9 @@ module Bindings(F:Cstubs.FOREIGN) =
     let everCrypt_AutoConfig2_disable_avx512 =
       foreign "EverCrypt_AutoConfig2_disable_avx512"
         (void @-> (returning void))
+    let everCrypt_AutoConfig2_disable_avx512ifma =
+      foreign "EverCrypt_AutoConfig2_disable_avx512ifma"
+        (void @-> (returning void))
     let everCrypt_AutoConfig2_has_vec128 =
       foreign "EverCrypt_AutoConfig2_has_vec128" (void @-> (returning bool))
     let everCrypt_AutoConfig2_has_vec256 =
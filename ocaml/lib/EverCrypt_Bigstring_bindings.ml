@@ -0,0 +1,69 @@
+(* Hand-written bindings over raw pointers, for buffers that the GC does not
+   move (Bigarrays). lib_gen/EverCrypt_Bigstring_gen.ml instantiates them
+   twice: once holding the runtime lock, and once releasing it for the
+   duration of the C call. *)
+open Ctypes
+module Bindings(F:Cstubs.FOREIGN) =
+struct
+  open F
+  module Hacl_Streaming_Types_applied =
+    (Hacl_Streaming_Types_bindings.Bindings)(Hacl_Streaming_Types_stubs)
+  open Hacl_Streaming_Types_applied
+  module EverCrypt_Error_applied =
+    (EverCrypt_Error_bindings.Bindings)(EverCrypt_Error_stubs)
+  open EverCrypt_Error_applied
+
+  (* Same types as in EverCrypt_Hash_bindings and EverCrypt_AEAD_bindings, so
+     that states created there can be passed here. *)
+  type everCrypt_Hash_Incremental_hash_state =
+    [ `everCrypt_Hash_Incremental_hash_state ] structure
+  let (everCrypt_Hash_Incremental_hash_state :
+    [ `everCrypt_Hash_Incremental_hash_state ] structure typ) =
+    structure "EverCrypt_Hash_Incremental_hash_state_s"
+  type everCrypt_AEAD_state_s = [ `everCrypt_AEAD_state_s ] structure
+  let (everCrypt_AEAD_state_s : [ `everCrypt_AEAD_state_s ] structure typ) =
+    structure "EverCrypt_AEAD_state_s_s"
+
+  let everCrypt_Hash_Incremental_hash =
+    foreign "EverCrypt_Hash_Incremental_hash"
+      (spec_Hash_Definitions_hash_alg @-> ptr uint8_t @-> ptr uint8_t @->
+       uint32_t @-> returning void)
+  let everCrypt_Hash_Incremental_hash_batch =
+    foreign "EverCrypt_Hash_Incremental_hash_batch"
+      (spec_Hash_Definitions_hash_alg @-> uint32_t @-> ptr uint8_t @->
+       ptr uint8_t @-> ptr uint32_t @-> returning void)
+  let everCrypt_Hash_Incremental_update =
+    foreign "EverCrypt_Hash_Incremental_update"
+      (ptr everCrypt_Hash_Incremental_hash_state @-> ptr uint8_t @->
+       uint32_t @-> returning everCrypt_Error_error_code)
+  let everCrypt_HMAC_compute =
+    foreign "EverCrypt_HMAC_compute"
+      (spec_Hash_Definitions_hash_alg @-> ptr uint8_t @-> ptr uint8_t @->
+       uint32_t @-> ptr uint8_t @-> uint32_t @-> returning void)
+  let everCrypt_AEAD_encrypt =
+    foreign "EverCrypt_AEAD_encrypt"
+      (ptr everCrypt_AEAD_state_s @-> ptr uint8_t @-> uint32_t @->
+       ptr uint8_t @-> uint32_t @-> ptr uint8_t @-> uint32_t @->
+       ptr uint8_t @-> ptr uint8_t @-> returning everCrypt_Error_error_code)
+  let everCrypt_AEAD_decrypt =
+    foreign "EverCrypt_AEAD_decrypt"
+      (ptr everCrypt_AEAD_state_s @-> ptr uint8_t @-> uint32_t @->
+       ptr uint8_t @-> uint32_t @-> ptr uint8_t @-> uint32_t @->
+       ptr uint8_t @-> ptr uint8_t @-> returning everCrypt_Error_error_code)
+  let everCrypt_AEAD_encrypt_batch =
+    foreign "EverCrypt_AEAD_encrypt_batch"
+      (ptr everCrypt_AEAD_state_s @-> uint32_t @-> ptr uint8_t @->
+       uint32_t @-> ptr uint8_t @-> ptr uint32_t @-> ptr uint8_t @->
+       ptr uint32_t @-> ptr uint8_t @-> ptr uint8_t @->
+       returning everCrypt_Error_error_code)
+  let everCrypt_AEAD_decrypt_batch =
+    foreign "EverCrypt_AEAD_decrypt_batch"
+      (ptr everCrypt_AEAD_state_s @-> uint32_t @-> ptr uint8_t @->
+       uint32_t @-> ptr uint8_t @-> ptr uint32_t @-> ptr uint8_t @->
+       ptr uint32_t @-> ptr uint8_t @-> ptr uint8_t @-> ptr bool @->
+       returning everCrypt_Error_error_code)
+  let everCrypt_Curve25519_ecdh_batch =
+    foreign "EverCrypt_Curve25519_ecdh_batch"
+      (uint32_t @-> ptr uint8_t @-> ptr uint8_t @-> ptr uint8_t @->
+       ptr bool @-> returning bool)
+end
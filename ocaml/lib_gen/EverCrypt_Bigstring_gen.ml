@@ -0,0 +1,23 @@
+(* Both instantiations go to the same files: the C stubs are told apart by
+   their prefix, the OCaml ones by the submodule they are wrapped in. *)
+let _ =
+  Format.set_formatter_out_channel (open_out_bin "lib/EverCrypt_Bigstring_stubs.ml");
+  Format.printf "module Locked = struct@.";
+  Cstubs.write_ml Format.std_formatter ~prefix:"hacl_locked"
+    (module EverCrypt_Bigstring_bindings.Bindings);
+  Format.printf "@.end@.module Unlocked = struct@.";
+  Cstubs.write_ml Format.std_formatter ~prefix:"hacl_unlocked"
+    ~concurrency:Cstubs.unlocked
+    (module EverCrypt_Bigstring_bindings.Bindings);
+  Format.printf "@.end@.";
+  Format.set_formatter_out_channel (open_out_bin "lib/EverCrypt_Bigstring_c_stubs.c");
+  Format.printf "#include \"EverCrypt_AEAD.h\"\n";
+  Format.printf "#include \"EverCrypt_Curve25519.h\"\n";
+  Format.printf "#include \"EverCrypt_HMAC.h\"\n";
+  Format.printf "#include \"EverCrypt_Hash.h\"\n";
+  Cstubs.write_c Format.std_formatter ~prefix:"hacl_locked"
+    (module EverCrypt_Bigstring_bindings.Bindings);
+  Cstubs.write_c Format.std_formatter ~prefix:"hacl_unlocked"
+    ~concurrency:Cstubs.unlocked
+    (module EverCrypt_Bigstring_bindings.Bindings);
+  Format.printf "@."
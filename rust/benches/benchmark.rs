@@ -1,4 +1,4 @@
-use criterion::{criterion_group, criterion_main, BatchSize, Criterion};
+use criterion::{black_box, criterion_group, criterion_main, BatchSize, Criterion};
 
 // 1 MB
 const PAYLOAD_SIZE: usize = 0x100000;
@@ -746,6 +746,67 @@ fn criterion_hkdf(c: &mut Criterion) {
     hkdf_bench!(c, "HKDF SHA512", HmacAlgorithm::Sha512);
 }
 
+// Small messages, where allocating the outputs is a large part of the cost.
+// Every pair compares the allocating API with the one writing into buffers
+// that are allocated once, outside of the measurement.
+fn criterion_small_messages(c: &mut Criterion) {
+    use hacl::aead::{Aead, Algorithm as AeadAlgorithm};
+    use hacl::digest::{self, Algorithm, Digest};
+    use hacl::hmac::{self, Algorithm as HmacAlgorithm};
+
+    const SMALL_PAYLOAD_SIZE: usize = 64;
+    let data = randombytes(SMALL_PAYLOAD_SIZE);
+    let key = randombytes(32);
+    let nonce = randombytes(12);
+    let aad = randombytes(16);
+
+    c.bench_function("SHA256 64B", |b| {
+        b.iter(|| digest::hash(Algorithm::Sha256, black_box(&data)))
+    });
+    c.bench_function("SHA256 64B into", |b| {
+        let mut out = [0u8; 32];
+        b.iter(|| digest::sha256_into(black_box(&data), &mut out))
+    });
+    c.bench_function("SHA256 64B stateful reset", |b| {
+        let mut state = Digest::new(Algorithm::Sha256).unwrap();
+        let mut out = [0u8; 32];
+        b.iter(|| {
+            state.reset();
+            state.update(black_box(&data)).unwrap();
+            state.finish_into(&mut out).unwrap();
+        })
+    });
+
+    c.bench_function("HMAC SHA256 64B", |b| {
+        b.iter(|| hmac::hmac(HmacAlgorithm::Sha256, &key, black_box(&data), None))
+    });
+    c.bench_function("HMAC SHA256 64B into", |b| {
+        let mut tag = [0u8; 32];
+        b.iter(|| hmac::hmac_into(HmacAlgorithm::Sha256, &key, black_box(&data), &mut tag))
+    });
+
+    let aead = Aead::new(AeadAlgorithm::Chacha20Poly1305, &key).unwrap();
+    c.bench_function("ChaCha20Poly1305 encrypt 64B", |b| {
+        b.iter(|| aead.encrypt(black_box(&data), &nonce, &aad).unwrap())
+    });
+    c.bench_function("ChaCha20Poly1305 encrypt 64B into", |b| {
+        let mut ct = [0u8; SMALL_PAYLOAD_SIZE];
+        let mut tag = [0u8; 16];
+        b.iter(|| {
+            aead.encrypt_into(black_box(&data), &nonce, &aad, &mut ct, &mut tag)
+                .unwrap()
+        })
+    });
+    c.bench_function("ChaCha20Poly1305 encrypt 64B in place", |b| {
+        let mut payload = [0u8; SMALL_PAYLOAD_SIZE];
+        let mut tag = [0u8; 16];
+        b.iter(|| {
+            aead.encrypt_in_place_into(black_box(&mut payload), &nonce, &aad, &mut tag)
+                .unwrap()
+        })
+    });
+}
+
 fn criterion_benchmark(c: &mut Criterion) {
     criterion_digest(c);
     criterion_aead(c);
@@ -755,6 +816,7 @@ fn criterion_benchmark(c: &mut Criterion) {
     criterion_ed25519(c);
     criterion_hmac(c);
     criterion_hkdf(c);
+    criterion_small_messages(c);
 }
 
 criterion_group!(benches, criterion_benchmark);
@@ -151,6 +151,9 @@ extern "C" {
 extern "C" {
     pub fn EverCrypt_AutoConfig2_has_avx512() -> bool;
 }
+extern "C" {
+    pub fn EverCrypt_AutoConfig2_has_avx512ifma() -> bool;
+}
 extern "C" {
     pub fn EverCrypt_AutoConfig2_recall();
 }
@@ -190,6 +193,9 @@ extern "C" {
 extern "C" {
     pub fn EverCrypt_AutoConfig2_disable_avx512();
 }
+extern "C" {
+    pub fn EverCrypt_AutoConfig2_disable_avx512ifma();
+}
 extern "C" {
     pub fn EverCrypt_AutoConfig2_has_vec128() -> bool;
 }
@@ -34,6 +34,35 @@
 //! assert_eq!(&msg[..], &msg_[..]);
 //! ```
 //!
+//! ## Allocation-free API
+//! The `_into` and `_in_place` functions write into buffers that are provided
+//! by the caller, so that an [`Aead`] can encrypt and decrypt any number of
+//! messages without allocating. An [`Aead`] is `Send`, so one instance can be
+//! kept per thread.
+//! ```rust
+//! use hacl::aead::{Aead, Algorithm, Tag};
+//!
+//! let key = [0x5b, 0x96, 0x04, 0xfe, 0x14, 0xea, 0xdb, 0xa9, 0x31, 0xb0, 0xcc,
+//!            0xf3, 0x48, 0x43, 0xda, 0xb9, 0x5b, 0x96, 0x04, 0xfe, 0x14, 0xea,
+//!            0xdb, 0xa9, 0x31, 0xb0, 0xcc, 0xf3, 0x48, 0x43, 0xda, 0xb9];
+//! let cipher = Aead::new(Algorithm::Chacha20Poly1305, &key).unwrap();
+//!
+//! let iv = [0x02, 0x83, 0x18, 0xab, 0xc1, 0x82, 0x40, 0x29, 0x13, 0x81, 0x41, 0xa2];
+//! let msg = [0x00, 0x1d, 0x0c, 0x23, 0x12, 0x87, 0xc1, 0x18, 0x27, 0x84, 0x55, 0x4c, 0xa3, 0xa2, 0x19, 0x08];
+//! let aad = [];
+//!
+//! let mut ciphertext = [0u8; 16];
+//! let mut tag: Tag = [0u8; 16];
+//! cipher.encrypt_into(&msg, &iv, &aad, &mut ciphertext, &mut tag).unwrap();
+//!
+//! let mut payload = ciphertext;
+//! cipher.decrypt_in_place(&mut payload, &tag, &iv, &aad).unwrap();
+//! assert_eq!(payload, msg);
+//!
+//! cipher.encrypt_in_place_into(&mut payload, &iv, &aad, &mut tag).unwrap();
+//! assert_eq!(payload, ciphertext);
+//! ```
+//!
 //! ## Single-shot API
 //! ```rust
 //! use hacl::aead::{self, Algorithm};
@@ -148,15 +177,23 @@ pub enum Error {
     Decrypting = 6,
     InvalidKeySize = 7,
     InvalidTagSize = 8,
+    InvalidOutputSize = 9,
 }
 
 /// The Aead struct allows to re-use a key without having to initialize it
 /// every time.
+///
+/// The key state is allocated once when the key is set. The `_into` and
+/// `_in_place` functions don't allocate.
 pub struct Aead {
     alg: Algorithm,
     c_state: Option<*mut EverCrypt_AEAD_state_s>,
 }
 
+// The C state is owned by the `Aead`, so it can be moved to another thread.
+// It is not `Sync`: AES-GCM uses scratch space inside the key state.
+unsafe impl Send for Aead {}
+
 /// Ciphertexts are byte vectors.
 pub type Ciphertext = Vec<u8>;
 
@@ -191,7 +228,9 @@ impl Aead {
             }
             state_ptr
         };
-        self.c_state = Some(state);
+        if let Some(c_state) = self.c_state.replace(state) {
+            unsafe { EverCrypt_AEAD_free(c_state) }
+        }
         Ok(())
     }
 
@@ -278,26 +317,29 @@ impl Aead {
         iv: &[u8],
         aad: &Aad,
     ) -> Result<(Ciphertext, Vec<u8>), Error> {
-        if iv.len() != self.nonce_size() {
-            return Err(Error::InvalidNonce);
-        }
-
         let mut ctxt = vec![0u8; msg.len()];
-        let mut tag = vec![0u8; self.tag_size()];
-        unsafe {
-            EverCrypt_AEAD_encrypt(
-                self.c_state.unwrap(),
-                iv.as_ptr() as _,
-                self.nonce_size().try_into().unwrap(),
-                aad.as_ptr() as _,
-                aad.len() as u32,
-                msg.as_ptr() as _,
-                msg.len() as u32,
-                ctxt.as_mut_ptr(),
-                tag.as_mut_ptr(),
-            );
+        let mut tag = [0u8; 16];
+        self.encrypt_into(msg, iv, aad, &mut ctxt, &mut tag)?;
+        Ok((ctxt, tag.to_vec()))
+    }
+
+    /// Encrypt with the algorithm and key of this Aead.
+    /// The cipher text is written into `ctxt`, which must have the same length
+    /// as `msg`, and the tag into `tag`.
+    // ANCHOR: aead_encrypt_into
+    pub fn encrypt_into(
+        &self,
+        msg: &[u8],
+        iv: &[u8],
+        aad: &Aad,
+        ctxt: &mut [u8],
+        tag: &mut Tag,
+    ) -> Result<(), Error> {
+        // ANCHOR_END: aead_encrypt_into
+        if ctxt.len() != msg.len() {
+            return Err(Error::InvalidOutputSize);
         }
-        Ok((ctxt, tag))
+        self._encrypt(msg.as_ptr(), msg.len(), iv, aad, ctxt.as_mut_ptr(), tag)
     }
 
     /// Encrypt with the algorithm and key of this Aead.
@@ -306,28 +348,36 @@ impl Aead {
     // ANCHOR: aead_encrypt_combined
     pub fn encrypt_combined(&self, msg: &[u8], iv: &[u8], aad: &Aad) -> Result<Ciphertext, Error> {
         // ANCHOR_END: aead_encrypt_combined
-        if iv.len() != self.nonce_size() {
-            return Err(Error::InvalidNonce);
-        }
-
         // combined cipher text and tag
         let mut ctxt = vec![0u8; msg.len() + self.tag_size()];
-        unsafe {
-            EverCrypt_AEAD_encrypt(
-                self.c_state.unwrap(),
-                iv.as_ptr() as _,
-                self.nonce_size().try_into().unwrap(),
-                aad.as_ptr() as _,
-                aad.len() as u32,
-                msg.as_ptr() as _,
-                msg.len() as u32,
-                ctxt.as_mut_ptr(),
-                ctxt.as_mut_ptr().offset(msg.len().try_into().unwrap()),
-            );
-        }
+        self.encrypt_combined_into(msg, iv, aad, &mut ctxt)?;
         Ok(ctxt)
     }
 
+    /// Encrypt with the algorithm and key of this Aead.
+    /// The combined `ctxt || tag` is written into `out`, which must be
+    /// `msg.len() + tag_size()` bytes long.
+    pub fn encrypt_combined_into(
+        &self,
+        msg: &[u8],
+        iv: &[u8],
+        aad: &Aad,
+        out: &mut [u8],
+    ) -> Result<(), Error> {
+        if out.len() != msg.len() + self.tag_size() {
+            return Err(Error::InvalidOutputSize);
+        }
+        let (ctxt, tag) = out.split_at_mut(msg.len());
+        self._encrypt(
+            msg.as_ptr(),
+            msg.len(),
+            iv,
+            aad,
+            ctxt.as_mut_ptr(),
+            tag.try_into().unwrap(),
+        )
+    }
+
     /// Encrypt with the algorithm and key of this Aead.
     /// Returns the cipher text in the `payload` and a `tag` or an `Error`.
     // ANCHOR: aead_encrypt_in_place
@@ -338,26 +388,59 @@ impl Aead {
         aad: &Aad,
     ) -> Result<Vec<u8>, Error> {
         // ANCHOR_END: aead_encrypt_in_place
+        let mut tag = [0u8; 16];
+        self.encrypt_in_place_into(payload, iv, aad, &mut tag)?;
+        Ok(tag.to_vec())
+    }
+
+    /// Encrypt with the algorithm and key of this Aead.
+    /// The cipher text is written into the `payload` and the tag into `tag`.
+    // ANCHOR: aead_encrypt_in_place_into
+    pub fn encrypt_in_place_into(
+        &self,
+        payload: &mut [u8],
+        iv: &[u8],
+        aad: &Aad,
+        tag: &mut Tag,
+    ) -> Result<(), Error> {
+        // ANCHOR_END: aead_encrypt_in_place_into
+        // The C code supports `plain` and `cipher` being the same buffer.
+        let ptr = payload.as_mut_ptr();
+        self._encrypt(ptr, payload.len(), iv, aad, ptr, tag)
+    }
+
+    #[inline]
+    fn _encrypt(
+        &self,
+        msg: *const u8,
+        msg_len: usize,
+        iv: &[u8],
+        aad: &Aad,
+        ctxt: *mut u8,
+        tag: &mut Tag,
+    ) -> Result<(), Error> {
         if iv.len() != self.nonce_size() {
             return Err(Error::InvalidNonce);
         }
 
-        // The tag
-        let mut tag = vec![0u8; self.tag_size()];
-        unsafe {
+        let r = unsafe {
             EverCrypt_AEAD_encrypt(
                 self.c_state.unwrap(),
                 iv.as_ptr() as _,
                 self.nonce_size().try_into().unwrap(),
                 aad.as_ptr() as _,
                 aad.len() as u32,
-                payload.as_ptr() as _,
-                payload.len() as u32,
-                payload.as_ptr() as _,
+                msg as _,
+                msg_len as u32,
+                ctxt,
                 tag.as_mut_ptr(),
-            );
+            )
+        };
+        if r as u32 != EverCrypt_Error_Success {
+            Err(Error::Encrypting)
+        } else {
+            Ok(())
         }
-        Ok(tag)
     }
 
     #[inline]
@@ -373,9 +456,25 @@ impl Aead {
 
     #[inline]
     fn _decrypt(&self, ctxt: &[u8], tag: &[u8], iv: &[u8], aad: &Aad) -> Result<Vec<u8>, Error> {
+        let mut msg = vec![0u8; ctxt.len()];
+        self._decrypt_into(ctxt, tag, iv, aad, &mut msg)?;
+        Ok(msg)
+    }
+
+    #[inline]
+    fn _decrypt_into(
+        &self,
+        ctxt: &[u8],
+        tag: &[u8],
+        iv: &[u8],
+        aad: &Aad,
+        msg: &mut [u8],
+    ) -> Result<(), Error> {
         self._decrypt_checks(tag, iv)?;
+        if msg.len() != ctxt.len() {
+            return Err(Error::InvalidOutputSize);
+        }
 
-        let mut msg = vec![0u8; ctxt.len()];
         let r = unsafe {
             EverCrypt_AEAD_decrypt(
                 self.c_state.unwrap(),
@@ -392,7 +491,7 @@ impl Aead {
         if r as u32 != EverCrypt_Error_Success {
             Err(Error::InvalidCiphertext)
         } else {
-            Ok(msg)
+            Ok(())
         }
     }
 
@@ -402,6 +501,22 @@ impl Aead {
         self._decrypt(ctxt, tag, iv, aad)
     }
 
+    /// Decrypt with the algorithm and key of this Aead.
+    /// The message is written into `msg`, which must have the same length as
+    /// `ctxt`. Returns an `Error` if decryption failed.
+    // ANCHOR: aead_decrypt_into
+    pub fn decrypt_into(
+        &self,
+        ctxt: &[u8],
+        tag: &[u8],
+        iv: &[u8],
+        aad: &Aad,
+        msg: &mut [u8],
+    ) -> Result<(), Error> {
+        // ANCHOR_END: aead_decrypt_into
+        self._decrypt_into(ctxt, tag, iv, aad, msg)
+    }
+
     /// Decrypt with the algorithm and key of this Aead.
     /// Returns `msg` or an `Error`.
     /// This takes the combined ctxt || tag as input and might be more efficient
@@ -418,6 +533,25 @@ impl Aead {
         self._decrypt(ctxt, tag, iv, aad)
     }
 
+    /// Decrypt the combined `ctxt || tag` with the algorithm and key of this
+    /// Aead. The message is written into `msg`, which must be
+    /// `ctxt.len() - tag_size()` bytes long.
+    pub fn decrypt_combined_into(
+        &self,
+        ctxt: &[u8],
+        iv: &[u8],
+        aad: &Aad,
+        msg: &mut [u8],
+    ) -> Result<(), Error> {
+        if ctxt.len() < self.tag_size() {
+            return Err(Error::InvalidTagSize);
+        }
+        let msg_len = ctxt.len() - self.tag_size();
+        let tag = &ctxt[msg_len..];
+        let ctxt = &ctxt[..msg_len];
+        self._decrypt_into(ctxt, tag, iv, aad, msg)
+    }
+
     /// Decrypt with the algorithm and key of this Aead.
     ///
     /// Returns an `Error` if decryption failed. The decrypted `payload` is written
@@ -76,6 +76,32 @@
 //!
 //! assert_eq!(&digest_256[..], &expected_digest_256[..]);
 //! assert_eq!(&digest_512[..], &expected_digest_512[..]);
+//!
+//! // Write into caller-provided buffers instead of allocating.
+//! let mut out = [0u8; 32];
+//! digest::sha256_into(data, &mut out);
+//! assert_eq!(out, expected_digest_256);
+//!
+//! let mut out = [0u8; 64];
+//! digest::hash_into(Algorithm::Sha512, data, &mut out).unwrap();
+//! assert_eq!(&out[..], &expected_digest_512[..]);
+//! ```
+//!
+//! ## Reusing a stateful digest
+//! A [`Digest`] allocates its state once in [`Digest::new`]. After that,
+//! [`Digest::finish_into`] and [`Digest::reset`] let it hash any number of
+//! messages without further allocations.
+//! ```rust
+//! use hacl::digest::{self, Algorithm, Digest};
+//!
+//! let mut digest = Digest::new(Algorithm::Sha256).unwrap();
+//! let mut out = [0u8; 32];
+//! for msg in [&b"first message"[..], &b"second message"[..]] {
+//!     digest.reset();
+//!     digest.update(msg).unwrap();
+//!     digest.finish_into(&mut out).unwrap();
+//!     assert_eq!(out, digest::sha256(msg));
+//! }
 //! ```
 //!
 //! ## SHA 3
@@ -182,6 +208,7 @@ use hacl_sys::*;
 pub enum Error {
     InvalidStateFinished,
     ModeUnsupportedForStreaming,
+    InvalidOutputLength,
 }
 
 /// The Digest Algorithm.
@@ -274,6 +301,9 @@ const fn does_not_support_streaming(alg: Algorithm) -> bool {
 }
 
 /// The digest struct for stateful hashing.
+///
+/// The state is allocated in [`Digest::new`] and can be reused for any number
+/// of messages with [`Digest::reset`], without allocating again.
 pub struct Digest {
     mode: Algorithm,
     finished: bool,
@@ -317,20 +347,44 @@ impl Digest {
     /// Finish the hash computation.
     /// Returns the digest or an `Error`.
     ///
-    /// **The struct can not be re-used after this!**
+    /// **The struct can not be re-used after this, unless it is [`reset`](Self::reset)!**
     pub fn finish(&mut self) -> Result<Vec<u8>, Error> {
+        let mut out = vec![0u8; digest_size(self.mode)];
+        self.finish_into(&mut out)?;
+        Ok(out)
+    }
+
+    /// Finish the hash computation and write the digest into `out`, which
+    /// must be exactly `digest_size(alg)` bytes long.
+    ///
+    /// **The struct can not be re-used after this, unless it is [`reset`](Self::reset)!**
+    pub fn finish_into(&mut self, out: &mut [u8]) -> Result<(), Error> {
         if self.finished {
             return Err(Error::InvalidStateFinished);
         }
-        let mut out = vec![0u8; digest_size(self.mode)];
+        if out.len() != digest_size(self.mode) {
+            return Err(Error::InvalidOutputLength);
+        }
         unsafe {
             EverCrypt_Hash_Incremental_finish(self.c_state, out.as_mut_ptr());
         }
         self.finished = true;
-        Ok(out)
+        Ok(())
+    }
+
+    /// Reset the state to hash a new message with the same algorithm.
+    /// This works on finished and unfinished states and doesn't allocate.
+    pub fn reset(&mut self) {
+        unsafe {
+            EverCrypt_Hash_Incremental_init(self.c_state);
+        }
+        self.finished = false;
     }
 }
 
+// The C state is owned by the `Digest` and only accessed through `&mut self`.
+unsafe impl Send for Digest {}
+
 impl Drop for Digest {
     fn drop(&mut self) {
         unsafe {
@@ -342,10 +396,16 @@ impl Drop for Digest {
 // Single-shot API with array returns.
 
 macro_rules! define_plain_digest {
-    ($name:ident, $version:expr, $l:literal) => {
+    ($name:ident, $name_into:ident, $version:expr, $l:literal) => {
         /// Single-shot API with a fixed length output.
         pub fn $name(data: &[u8]) -> [u8; $l] {
             let mut out = [0u8; $l];
+            $name_into(data, &mut out);
+            out
+        }
+
+        /// Single-shot API writing the digest into `out`.
+        pub fn $name_into(data: &[u8], out: &mut [u8; $l]) {
             unsafe {
                 // Make sure this happened.
                 EverCrypt_AutoConfig2_init();
@@ -373,23 +433,21 @@ macro_rules! define_plain_digest {
                     );
                 },
             }
-
-            out
         }
     };
 }
 
-define_plain_digest!(sha1, Algorithm::Sha1, 20);
-define_plain_digest!(sha224, Algorithm::Sha224, 28);
-define_plain_digest!(sha256, Algorithm::Sha256, 32);
-define_plain_digest!(sha384, Algorithm::Sha384, 48);
-define_plain_digest!(sha512, Algorithm::Sha512, 64);
-define_plain_digest!(sha3_224, Algorithm::Sha3_224, 28);
-define_plain_digest!(sha3_256, Algorithm::Sha3_256, 32);
-define_plain_digest!(sha3_384, Algorithm::Sha3_384, 48);
-define_plain_digest!(sha3_512, Algorithm::Sha3_512, 64);
-define_plain_digest!(blake2s, Algorithm::Blake2s, 32);
-define_plain_digest!(blake2b, Algorithm::Blake2b, 64);
+define_plain_digest!(sha1, sha1_into, Algorithm::Sha1, 20);
+define_plain_digest!(sha224, sha224_into, Algorithm::Sha224, 28);
+define_plain_digest!(sha256, sha256_into, Algorithm::Sha256, 32);
+define_plain_digest!(sha384, sha384_into, Algorithm::Sha384, 48);
+define_plain_digest!(sha512, sha512_into, Algorithm::Sha512, 64);
+define_plain_digest!(sha3_224, sha3_224_into, Algorithm::Sha3_224, 28);
+define_plain_digest!(sha3_256, sha3_256_into, Algorithm::Sha3_256, 32);
+define_plain_digest!(sha3_384, sha3_384_into, Algorithm::Sha3_384, 48);
+define_plain_digest!(sha3_512, sha3_512_into, Algorithm::Sha3_512, 64);
+define_plain_digest!(blake2s, blake2s_into, Algorithm::Blake2s, 32);
+define_plain_digest!(blake2b, blake2b_into, Algorithm::Blake2b, 64);
 
 // Single-shot API
 
@@ -411,6 +469,33 @@ pub fn hash(alg: Algorithm, data: &[u8]) -> Vec<u8> {
     }
 }
 
+/// Create the digest for the given `data` and mode `alg` and write it into
+/// `out`, which must be exactly `digest_size(alg)` bytes long.
+pub fn hash_into(alg: Algorithm, data: &[u8], out: &mut [u8]) -> Result<(), Error> {
+    macro_rules! into {
+        ($f:ident) => {
+            $f(
+                data,
+                out.try_into().map_err(|_| Error::InvalidOutputLength)?,
+            )
+        };
+    }
+    match alg {
+        Algorithm::Sha1 => into!(sha1_into),
+        Algorithm::Sha224 => into!(sha224_into),
+        Algorithm::Sha256 => into!(sha256_into),
+        Algorithm::Sha384 => into!(sha384_into),
+        Algorithm::Sha512 => into!(sha512_into),
+        Algorithm::Sha3_224 => into!(sha3_224_into),
+        Algorithm::Sha3_256 => into!(sha3_256_into),
+        Algorithm::Sha3_384 => into!(sha3_384_into),
+        Algorithm::Sha3_512 => into!(sha3_512_into),
+        Algorithm::Blake2s => into!(blake2s_into),
+        Algorithm::Blake2b => into!(blake2b_into),
+    }
+    Ok(())
+}
+
 // SHAKE messages from SHA 3
 
 /// SHAKE 128
@@ -419,15 +504,23 @@ pub fn hash(alg: Algorithm, data: &[u8]) -> Vec<u8> {
 /// the output will only return `u32::MAX` bytes.
 pub fn shake128<const BYTES: usize>(data: &[u8]) -> [u8; BYTES] {
     let mut out = [0u8; BYTES];
+    shake128_into(data, &mut out);
+    out
+}
+
+/// SHAKE 128, filling all of `out`.
+///
+/// Note that the length of `out` must fit into 32 bit. If it is longer,
+/// only the first `u32::MAX` bytes are written.
+pub fn shake128_into(data: &[u8], out: &mut [u8]) {
     unsafe {
         Hacl_SHA3_shake128_hacl(
             data.len() as u32,
             data.as_ptr() as _,
-            BYTES as u32,
+            out.len() as u32,
             out.as_mut_ptr(),
         );
     }
-    out
 }
 
 /// SHAKE 256
@@ -436,13 +529,21 @@ pub fn shake128<const BYTES: usize>(data: &[u8]) -> [u8; BYTES] {
 /// the output will only return `u32::MAX` bytes.
 pub fn shake256<const BYTES: usize>(data: &[u8]) -> [u8; BYTES] {
     let mut out = [0u8; BYTES];
+    shake256_into(data, &mut out);
+    out
+}
+
+/// SHAKE 256, filling all of `out`.
+///
+/// Note that the length of `out` must fit into 32 bit. If it is longer,
+/// only the first `u32::MAX` bytes are written.
+pub fn shake256_into(data: &[u8], out: &mut [u8]) {
     unsafe {
         Hacl_SHA3_shake256_hacl(
             data.len() as u32,
             data.as_ptr() as _,
-            BYTES as u32,
+            out.len() as u32,
             out.as_mut_ptr(),
         );
     }
-    out
 }
@@ -44,6 +44,12 @@ pub type Signature = [u8; 64];
 /// Returns a `Signature`.
 pub fn eddsa_sign(sk: &Scalar, msg: &[u8]) -> Signature {
     let mut out = [0u8; 64];
+    eddsa_sign_into(sk, msg, &mut out);
+    out
+}
+
+/// Sign message `msg` with secret key `sk` and write the signature into `out`.
+pub fn eddsa_sign_into(sk: &Scalar, msg: &[u8], out: &mut Signature) {
     unsafe {
         EverCrypt_Ed25519_sign(
             out.as_mut_ptr(),
@@ -52,7 +58,6 @@ pub fn eddsa_sign(sk: &Scalar, msg: &[u8]) -> Signature {
             msg.as_ptr() as _,
         );
     }
-    out
 }
 
 /// Verify signature `signature` on message `msg` with public key `pk`.
@@ -71,10 +76,15 @@ pub fn eddsa_verify(pk: &Point, signature: &Signature, msg: &[u8]) -> bool {
 /// Compute the public `Point` for the given secret key `sk`.
 pub fn sk2pk(sk: &Scalar) -> Point {
     let mut out = [0u8; 32];
+    sk2pk_into(sk, &mut out);
+    out
+}
+
+/// Compute the public `Point` for the given secret key `sk` and write it into `out`.
+pub fn sk2pk_into(sk: &Scalar, out: &mut Point) {
     unsafe {
         EverCrypt_Ed25519_secret_to_public(out.as_mut_ptr(), sk.as_ptr() as _);
     }
-    out
 }
 
 /// Generate a random `Scalar`.
@@ -20,10 +20,31 @@ use hacl_sys::*;
 
 use crate::hmac::{tag_size, Algorithm};
 
+/// HKDF Errors.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum Error {
+    /// The requested output key material in expand was too large for the used
+    /// hash function.
+    OkmTooLarge,
+    /// The output buffer for the pre-key material doesn't have the tag length.
+    InvalidPrkLength,
+}
+
 /// HKDF extract using hash function `mode`, `salt`, and the input key material `ikm`.
 /// Returns the pre-key material in a vector of tag length.
 pub fn extract(mode: Algorithm, salt: &[u8], ikm: &[u8]) -> Vec<u8> {
     let mut prk = vec![0u8; tag_size(mode)];
+    extract_into(mode, salt, ikm, &mut prk).unwrap();
+    prk
+}
+
+/// HKDF extract using hash function `mode`, `salt`, and the input key material `ikm`.
+/// Writes the pre-key material into `prk`, which must be `tag_size(mode)`
+/// bytes long.
+pub fn extract_into(mode: Algorithm, salt: &[u8], ikm: &[u8], prk: &mut [u8]) -> Result<(), Error> {
+    if prk.len() != tag_size(mode) {
+        return Err(Error::InvalidPrkLength);
+    }
     unsafe {
         EverCrypt_HKDF_extract(
             mode as u8,
@@ -34,7 +55,7 @@ pub fn extract(mode: Algorithm, salt: &[u8], ikm: &[u8]) -> Vec<u8> {
             ikm.len() as u32,
         );
     }
-    prk
+    Ok(())
 }
 
 /// HKDF expand using hash function `mode`, pre-key material `prk`, `info`, and output length `okm_len`.
@@ -45,6 +66,18 @@ pub fn expand(mode: Algorithm, prk: &[u8], info: &[u8], okm_len: usize) -> Vec<u
         return Vec::new();
     }
     let mut okm = vec![0u8; okm_len];
+    expand_into(mode, prk, info, &mut okm).unwrap();
+    okm
+}
+
+/// HKDF expand using hash function `mode`, pre-key material `prk`, and `info`.
+/// Fills `okm` with key material or returns [`Error::OkmTooLarge`] if `okm`
+/// is longer than `255 * tag_size(mode)` bytes.
+pub fn expand_into(mode: Algorithm, prk: &[u8], info: &[u8], okm: &mut [u8]) -> Result<(), Error> {
+    if okm.len() > 255 * tag_size(mode) {
+        // Output size is too large. HACL doesn't catch this.
+        return Err(Error::OkmTooLarge);
+    }
     unsafe {
         EverCrypt_HKDF_expand(
             mode as u8,
@@ -53,10 +86,10 @@ pub fn expand(mode: Algorithm, prk: &[u8], info: &[u8], okm_len: usize) -> Vec<u
             prk.len() as u32,
             info.as_ptr() as _,
             info.len() as u32,
-            okm_len as u32,
+            okm.len() as u32,
         );
     }
-    okm
+    Ok(())
 }
 
 /// HKDF using hash function `mode`, `salt`, input key material `ikm`, `info`, and output length `okm_len`.
@@ -66,3 +99,19 @@ pub fn hkdf(mode: Algorithm, salt: &[u8], ikm: &[u8], info: &[u8], okm_len: usiz
     let prk = extract(mode, salt, ikm);
     expand(mode, &prk, info, okm_len)
 }
+
+/// HKDF using hash function `mode`, `salt`, input key material `ikm`, and `info`.
+/// Calls `extract_into` and `expand_into` with the given input, keeping the
+/// pre-key material on the stack, and fills `okm` with key material.
+pub fn hkdf_into(
+    mode: Algorithm,
+    salt: &[u8],
+    ikm: &[u8],
+    info: &[u8],
+    okm: &mut [u8],
+) -> Result<(), Error> {
+    let mut prk = [0u8; 64];
+    let prk = &mut prk[..tag_size(mode)];
+    extract_into(mode, salt, ikm, prk)?;
+    expand_into(mode, prk, info, okm)
+}
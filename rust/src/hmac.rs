@@ -14,6 +14,11 @@
 //!
 //! let tag = hmac(HmacAlgorithm::Sha256, &key, &data, Some(len));
 //! assert_eq!(expected_tag[..], tag[..]);
+//!
+//! // Without allocating
+//! let mut tag = [0u8; 32];
+//! hmac::hmac_into(HmacAlgorithm::Sha256, &key, &data, &mut tag);
+//! assert_eq!(expected_tag, tag);
 //! ```
 
 #[cfg(feature = "serialization")]
@@ -53,6 +58,33 @@ pub fn hmac(mode: Algorithm, key: &[u8], data: &[u8], tag_length: Option<usize>)
         None => native_tag_length,
     };
     let mut dst = vec![0u8; native_tag_length];
+    compute(mode, key, data, &mut dst);
+    dst.truncate(tag_length);
+    dst
+}
+
+/// Compute the HMAC value with the given `mode` and `key` on `data` and write
+/// it into `tag`, truncated to the length of `tag`.
+/// Returns the number of bytes written, i.e., the length of `tag` or the tag
+/// size of `mode` if `tag` is longer.
+pub fn hmac_into(mode: Algorithm, key: &[u8], data: &[u8], tag: &mut [u8]) -> usize {
+    let native_tag_length = tag_size(mode);
+    if tag.len() >= native_tag_length {
+        compute(mode, key, data, &mut tag[..native_tag_length]);
+        return native_tag_length;
+    }
+
+    // Truncated tags are computed on the stack first.
+    let mut dst = [0u8; 64];
+    compute(mode, key, data, &mut dst[..native_tag_length]);
+    let tag_length = tag.len();
+    tag.copy_from_slice(&dst[..tag_length]);
+    tag_length
+}
+
+/// `dst` must be `tag_size(mode)` bytes long.
+fn compute(mode: Algorithm, key: &[u8], data: &[u8], dst: &mut [u8]) {
+    debug_assert_eq!(dst.len(), tag_size(mode));
     unsafe {
         EverCrypt_HMAC_compute(
             mode as u8,
@@ -63,6 +95,4 @@ pub fn hmac(mode: Algorithm, key: &[u8], data: &[u8], tag_length: Option<usize>)
             data.len() as u32,
         );
     }
-    dst.truncate(tag_length);
-    dst
 }
@@ -68,12 +68,18 @@ pub fn validate_sk(sk: &[u8]) -> Result<Scalar, Error> {
 
 /// Return base * s
 pub fn ecdh_base(s: &[u8]) -> Result<[u8; 64], Error> {
+    let mut out = [0u8; 64];
+    ecdh_base_into(s, &mut out)?;
+    Ok(out)
+}
+
+/// Write base * s into `out`
+pub fn ecdh_base_into(s: &[u8], out: &mut [u8; 64]) -> Result<(), Error> {
     let private = validate_sk(s)?;
 
-    let mut out = [0u8; 64];
     let success = unsafe { Hacl_P256_dh_initiator(out.as_mut_ptr(), private.as_ptr() as _) };
     if success {
-        Ok(out)
+        Ok(())
     } else {
         Err(Error::InvalidPoint)
     }
@@ -84,10 +90,19 @@ pub fn ecdh_base(s: &[u8]) -> Result<[u8; 64], Error> {
 /// The public key `p` can be in uncompressed or compressed form or a concatenation
 /// of the two 32 byte values.
 pub fn ecdh(p: &[u8], s: &[u8]) -> Result<[u8; 64], Error> {
+    let mut out = [0u8; 64];
+    ecdh_into(p, s, &mut out)?;
+    Ok(out)
+}
+
+/// Write p * s into `out`
+///
+/// The public key `p` can be in uncompressed or compressed form or a concatenation
+/// of the two 32 byte values.
+pub fn ecdh_into(p: &[u8], s: &[u8], out: &mut [u8; 64]) -> Result<(), Error> {
     let public = validate_pk(p)?;
     let private = validate_sk(s)?;
 
-    let mut out = [0u8; 64];
     let success = unsafe {
         Hacl_P256_dh_responder(
             out.as_mut_ptr(),
@@ -96,7 +111,7 @@ pub fn ecdh(p: &[u8], s: &[u8]) -> Result<[u8; 64], Error> {
         )
     };
     if success {
-        Ok(out)
+        Ok(())
     } else {
         Err(Error::InvalidPoint)
     }
@@ -20,7 +20,9 @@ pub use crate::ed25519::{
     Error as Ed25519Error, Point as Ed25519Point, Scalar as Ed25519Scalar,
     Signature as Ed25519Signature,
 };
-pub use crate::hkdf::{self, expand as hkdf_expand, extract as hkdf_extract, hkdf};
+pub use crate::hkdf::{
+    self, expand as hkdf_expand, extract as hkdf_extract, hkdf, Error as HkdfError,
+};
 pub use crate::hmac::{self, hmac, tag_size, Algorithm as HmacAlgorithm};
 pub use crate::p256::{
     self, ecdh as p256, ecdh_base as p256_base, ecdsa_sign as p256_sign,
@@ -44,21 +44,32 @@ pub type Scalar = [u8; 32];
 /// Return base * s
 pub fn dh_base(s: &Scalar) -> Point {
     let mut out = [0u8; 32];
+    dh_base_into(s, &mut out);
+    out
+}
+
+/// Write base * s into `out`
+pub fn dh_base_into(s: &Scalar, out: &mut Point) {
     unsafe {
         EverCrypt_Curve25519_secret_to_public(out.as_mut_ptr(), s.as_ptr() as _);
     }
-    out
 }
 
 /// Return p * s
 pub fn dh(p: &Point, s: &Scalar) -> Result<Point, Error> {
     let mut out = [0u8; 32];
+    dh_into(p, s, &mut out)?;
+    Ok(out)
+}
+
+/// Write p * s into `out`
+pub fn dh_into(p: &Point, s: &Scalar, out: &mut Point) -> Result<(), Error> {
     let r =
         unsafe { EverCrypt_Curve25519_ecdh(out.as_mut_ptr(), s.as_ptr() as _, p.as_ptr() as _) };
     if !r {
         Err(Error::InvalidPoint)
     } else {
-        Ok(out)
+        Ok(())
     }
 }
 
@@ -163,6 +163,40 @@ fn test_wycheproof() {
                     .decrypt_in_place(in_place_payload.as_mut_slice(), &tag_in_place, &nonce, &aad)
                     .unwrap();
                 assert_eq!(msg, in_place_payload);
+
+                // Allocation-free variants
+                let mut ctxt_into = vec![0u8; msg.len()];
+                let mut tag_into = [0u8; 16];
+                cipher
+                    .encrypt_into(&msg, &nonce, &aad, &mut ctxt_into, &mut tag_into)
+                    .unwrap();
+                assert_eq!((&ctxt_into[..], &tag_into[..]), (&ctxt[..], &tag[..]));
+                let mut ctxt_comb_into = vec![0u8; ctxt_comb.len()];
+                cipher
+                    .encrypt_combined_into(&msg, &nonce, &aad, &mut ctxt_comb_into)
+                    .unwrap();
+                assert_eq!(ctxt_comb_into, ctxt_comb);
+                cipher
+                    .encrypt_in_place_into(&mut in_place_payload, &nonce, &aad, &mut tag_into)
+                    .unwrap();
+                assert_eq!(
+                    (&in_place_payload[..], &tag_into[..]),
+                    (&ctxt[..], &tag[..])
+                );
+                let mut msg_into = vec![0u8; msg.len()];
+                cipher
+                    .decrypt_into(&ctxt, &tag, &nonce, &aad, &mut msg_into)
+                    .unwrap();
+                assert_eq!(msg, msg_into);
+                msg_into.fill(0);
+                cipher
+                    .decrypt_combined_into(&ctxt_comb, &nonce, &aad, &mut msg_into)
+                    .unwrap();
+                assert_eq!(msg, msg_into);
+                assert_eq!(
+                    cipher.encrypt_into(&msg, &nonce, &aad, &mut ctxt_comb_into, &mut tag_into),
+                    Err(Error::InvalidOutputSize)
+                );
                 *tests_run += 1;
             }
         }
@@ -212,6 +246,38 @@ fn key_gen_self_test() {
     run(Algorithm::Chacha20Poly1305);
 }
 
+#[test]
+fn send_self_test() {
+    let key = [0x5b; 32];
+    let nonce = [0x02; 12];
+    let msg = b"Evercrypt rulez";
+    let aad = b"associated data";
+
+    let cipher = Aead::new(Algorithm::Chacha20Poly1305, &key).unwrap();
+    let (ctxt, tag) = cipher.encrypt(msg, &nonce, aad).unwrap();
+
+    // Every thread owns one `Aead` and encrypts into its own buffers.
+    let threads: Vec<_> = (0..4)
+        .map(|_| {
+            let cipher = Aead::new(Algorithm::Chacha20Poly1305, &key).unwrap();
+            std::thread::spawn(move || {
+                let mut out = [0u8; 15];
+                let mut tag = [0u8; 16];
+                for _ in 0..100 {
+                    cipher
+                        .encrypt_into(msg, &nonce, aad, &mut out, &mut tag)
+                        .unwrap();
+                }
+                (out, tag)
+            })
+        })
+        .collect();
+    for t in threads {
+        let (out, t) = t.join().unwrap();
+        assert_eq!((&out[..], &t[..]), (&ctxt[..], &tag[..]));
+    }
+}
+
 #[cfg(feature = "hazmat")]
 #[test]
 fn raw_self_test() {
@@ -21,6 +21,20 @@ fn test(alg: Algorithm, expected: &str) {
     assert!(digest.finish().is_err());
     assert!(digest.update(&[]).is_err());
 
+    let mut out = vec![0u8; digest::digest_size(alg)];
+    digest::hash_into(alg, data, &mut out).unwrap();
+    assert_eq!(out, expected_digest);
+    assert!(digest::hash_into(alg, data, &mut out[1..]).is_err());
+
+    // Reuse the finished state for the same message, in two updates.
+    digest.reset();
+    assert!(digest.update(&data[..5]).is_ok());
+    assert!(digest.update(&data[5..]).is_ok());
+    out.fill(0);
+    digest.finish_into(&mut out).unwrap();
+    assert_eq!(out, expected_digest);
+    assert!(digest.finish_into(&mut out).is_err());
+
     #[cfg(feature = "hazmat")]
     match alg {
         Algorithm::Sha1 => (),
@@ -141,4 +155,8 @@ fn shake() {
     let expected_digest = hex_str_to_bytes("6e263a62077f11556d80cbe01f4bb251ca2c3637faff36f246194c142744188154cb522411658dfd57bbc6cefb9f11d8e1968213288c992d2f136a29acada08c");
     let digest: [u8; 64] = digest::shake256(data);
     assert_eq!(digest, expected_digest.as_slice());
+
+    let mut digest = [0u8; 64];
+    digest::shake256_into(data, &mut digest);
+    assert_eq!(digest, expected_digest.as_slice());
 }
@@ -27,6 +27,7 @@
 
 #include "internal/Vale.h"
 #include "internal/Hacl_Spec.h"
+#include "internal/EverCrypt_Instrumentation.h"
 #include "config.h"
 
 /**
@@ -195,6 +196,133 @@ EverCrypt_AEAD_create_in(Spec_Agile_AEAD_alg a, EverCrypt_AEAD_state_s **dst, ui
   }
 }
 
+/* In place, the expanded key follows the state, at the next multiple of
+   EVERCRYPT_AEAD_STATE_ALIGN bytes. */
+static uint32_t in_place_header_len(void)
+{
+  return
+    ((uint32_t)sizeof (EverCrypt_AEAD_state_s) + EVERCRYPT_AEAD_STATE_ALIGN - (uint32_t)1U)
+    & ~(EVERCRYPT_AEAD_STATE_ALIGN - (uint32_t)1U);
+}
+
+static uint32_t ek_len(Spec_Agile_AEAD_alg a)
+{
+  switch (a)
+  {
+    case Spec_Agile_AEAD_AES128_GCM:
+      {
+        return (uint32_t)480U;
+      }
+    case Spec_Agile_AEAD_AES256_GCM:
+      {
+        return (uint32_t)544U;
+      }
+    case Spec_Agile_AEAD_CHACHA20_POLY1305:
+      {
+        return (uint32_t)32U;
+      }
+    default:
+      {
+        return (uint32_t)0U;
+      }
+  }
+}
+
+/**
+Size in bytes of the memory that `EverCrypt_AEAD_init_in_place` needs for a
+state of algorithm `a`, or 0 for an unknown algorithm. The memory must be
+aligned on `EVERCRYPT_AEAD_STATE_ALIGN` bytes.
+*/
+uint32_t EverCrypt_AEAD_state_size(Spec_Agile_AEAD_alg a)
+{
+  uint32_t len = ek_len(a);
+  if (len == (uint32_t)0U)
+  {
+    return (uint32_t)0U;
+  }
+  return in_place_header_len() + len;
+}
+
+/**
+Create the AEAD state for the algorithm in caller-provided memory.
+
+This is `EverCrypt_AEAD_create_in` without allocation: the state and the
+expanded key are stored in `mem`, so they can be embedded in a connection
+structure or taken from an arena or a pool. The state must not be passed to
+`EverCrypt_AEAD_free`; `mem` holds key material and should be wiped (e.g. with
+`Lib_Memzero0_memzero`) before it is reused or released.
+
+@param a The algorithm, as for `EverCrypt_AEAD_create_in`.
+@param mem Pointer to `EverCrypt_AEAD_state_size(a)` bytes of memory, aligned on
+  `EVERCRYPT_AEAD_STATE_ALIGN` bytes.
+@param dst Pointer to a pointer where the address of the state (equal to `mem`)
+  will be written to.
+@param k Pointer to `KEY_LEN` bytes of memory where the key is read from.
+
+@return The function returns `EverCrypt_Error_Success` on success or
+  `EverCrypt_Error_UnsupportedAlgorithm` in case of a bad algorithm identifier
+  or, for AES-GCM, a CPU without the required instructions.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_init_in_place(
+  Spec_Agile_AEAD_alg a,
+  uint8_t *mem,
+  EverCrypt_AEAD_state_s **dst,
+  uint8_t *k
+)
+{
+  EverCrypt_AEAD_state_s *p = (EverCrypt_AEAD_state_s *)mem;
+  uint8_t *ek = mem + in_place_header_len();
+  switch (a)
+  {
+    case Spec_Agile_AEAD_CHACHA20_POLY1305:
+      {
+        p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Hacl_CHACHA20, .ek = ek });
+        memcpy(ek, k, (uint32_t)32U * sizeof (uint8_t));
+        dst[0U] = p;
+        return EverCrypt_Error_Success;
+      }
+    case Spec_Agile_AEAD_AES128_GCM:
+    case Spec_Agile_AEAD_AES256_GCM:
+      {
+        #if HACL_CAN_COMPILE_VALE
+        bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
+        bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
+        bool has_avx = EverCrypt_AutoConfig2_has_avx();
+        bool has_sse = EverCrypt_AutoConfig2_has_sse();
+        bool has_movbe = EverCrypt_AutoConfig2_has_movbe();
+        if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
+        {
+          memset(ek, 0U, ek_len(a) * sizeof (uint8_t));
+          if (a == Spec_Agile_AEAD_AES128_GCM)
+          {
+            uint8_t *keys_b = ek;
+            uint8_t *hkeys_b = ek + (uint32_t)176U;
+            KRML_HOST_IGNORE(aes128_key_expansion(k, keys_b));
+            KRML_HOST_IGNORE(aes128_keyhash_init(keys_b, hkeys_b));
+            p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Vale_AES128, .ek = ek });
+          }
+          else
+          {
+            uint8_t *keys_b = ek;
+            uint8_t *hkeys_b = ek + (uint32_t)240U;
+            KRML_HOST_IGNORE(aes256_key_expansion(k, keys_b));
+            KRML_HOST_IGNORE(aes256_keyhash_init(keys_b, hkeys_b));
+            p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Vale_AES256, .ek = ek });
+          }
+          dst[0U] = p;
+          return EverCrypt_Error_Success;
+        }
+        #endif
+        return EverCrypt_Error_UnsupportedAlgorithm;
+      }
+    default:
+      {
+        return EverCrypt_Error_UnsupportedAlgorithm;
+      }
+  }
+}
+
 static EverCrypt_Error_error_code
 encrypt_aes128_gcm(
   EverCrypt_AEAD_state_s *s,
@@ -502,11 +630,19 @@ EverCrypt_AEAD_encrypt(
   {
     case Spec_Cipher_Expansion_Vale_AES128:
       {
-        return encrypt_aes128_gcm(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+        EVERCRYPT_INSTRUMENTATION_ENTER(EverCrypt_Instrumentation_AES128_GCM_Vale, plain_len);
+        EverCrypt_Error_error_code
+        r = encrypt_aes128_gcm(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+        EVERCRYPT_INSTRUMENTATION_EXIT(EverCrypt_Instrumentation_AES128_GCM_Vale, plain_len);
+        return r;
       }
     case Spec_Cipher_Expansion_Vale_AES256:
       {
-        return encrypt_aes256_gcm(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+        EVERCRYPT_INSTRUMENTATION_ENTER(EverCrypt_Instrumentation_AES256_GCM_Vale, plain_len);
+        EverCrypt_Error_error_code
+        r = encrypt_aes256_gcm(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+        EVERCRYPT_INSTRUMENTATION_EXIT(EverCrypt_Instrumentation_AES256_GCM_Vale, plain_len);
+        return r;
       }
     case Spec_Cipher_Expansion_Hacl_CHACHA20:
       {
@@ -857,6 +993,7 @@ EverCrypt_AEAD_encrypt_expand_aes128_gcm(
   bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
   if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
   {
+    EVERCRYPT_INSTRUMENTATION_ENTER(EverCrypt_Instrumentation_AES128_GCM_Vale, plain_len);
     uint8_t ek[480U] = { 0U };
     uint8_t *keys_b0 = ek;
     uint8_t *hkeys_b0 = ek + (uint32_t)176U;
@@ -967,6 +1104,7 @@ EverCrypt_AEAD_encrypt_expand_aes128_gcm(
         (uint32_t)(uint64_t)plain_len % (uint32_t)16U * sizeof (uint8_t));
       KRML_HOST_IGNORE(EverCrypt_Error_Success);
     }
+    EVERCRYPT_INSTRUMENTATION_EXIT(EverCrypt_Instrumentation_AES128_GCM_Vale, plain_len);
     return EverCrypt_Error_Success;
   }
   return EverCrypt_Error_UnsupportedAlgorithm;
@@ -1005,6 +1143,7 @@ EverCrypt_AEAD_encrypt_expand_aes256_gcm(
   bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
   if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
   {
+    EVERCRYPT_INSTRUMENTATION_ENTER(EverCrypt_Instrumentation_AES256_GCM_Vale, plain_len);
     uint8_t ek[544U] = { 0U };
     uint8_t *keys_b0 = ek;
     uint8_t *hkeys_b0 = ek + (uint32_t)240U;
@@ -1115,6 +1254,7 @@ EverCrypt_AEAD_encrypt_expand_aes256_gcm(
         (uint32_t)(uint64_t)plain_len % (uint32_t)16U * sizeof (uint8_t));
       KRML_HOST_IGNORE(EverCrypt_Error_Success);
     }
+    EVERCRYPT_INSTRUMENTATION_EXIT(EverCrypt_Instrumentation_AES256_GCM_Vale, plain_len);
     return EverCrypt_Error_Success;
   }
   return EverCrypt_Error_UnsupportedAlgorithm;
@@ -1581,11 +1721,19 @@ EverCrypt_AEAD_decrypt(
   {
     case Spec_Cipher_Expansion_Vale_AES128:
       {
-        return decrypt_aes128_gcm(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+        EVERCRYPT_INSTRUMENTATION_ENTER(EverCrypt_Instrumentation_AES128_GCM_Vale, cipher_len);
+        EverCrypt_Error_error_code
+        r = decrypt_aes128_gcm(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+        EVERCRYPT_INSTRUMENTATION_EXIT(EverCrypt_Instrumentation_AES128_GCM_Vale, cipher_len);
+        return r;
       }
     case Spec_Cipher_Expansion_Vale_AES256:
       {
-        return decrypt_aes256_gcm(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+        EVERCRYPT_INSTRUMENTATION_ENTER(EverCrypt_Instrumentation_AES256_GCM_Vale, cipher_len);
+        EverCrypt_Error_error_code
+        r = decrypt_aes256_gcm(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+        EVERCRYPT_INSTRUMENTATION_EXIT(EverCrypt_Instrumentation_AES256_GCM_Vale, cipher_len);
+        return r;
       }
     case Spec_Cipher_Expansion_Hacl_CHACHA20:
       {
@@ -1947,6 +2095,7 @@ EverCrypt_AEAD_decrypt_expand_aes128_gcm(
   bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
   if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
   {
+    EVERCRYPT_INSTRUMENTATION_ENTER(EverCrypt_Instrumentation_AES128_GCM_Vale, cipher_len);
     uint8_t ek[480U] = { 0U };
     uint8_t *keys_b0 = ek;
     uint8_t *hkeys_b0 = ek + (uint32_t)176U;
@@ -1956,10 +2105,12 @@ EverCrypt_AEAD_decrypt_expand_aes128_gcm(
     EverCrypt_AEAD_state_s *s = &p;
     if (s == NULL)
     {
+      EVERCRYPT_INSTRUMENTATION_EXIT(EverCrypt_Instrumentation_AES128_GCM_Vale, cipher_len);
       return EverCrypt_Error_InvalidKey;
     }
     if (iv_len == (uint32_t)0U)
     {
+      EVERCRYPT_INSTRUMENTATION_EXIT(EverCrypt_Instrumentation_AES128_GCM_Vale, cipher_len);
       return EverCrypt_Error_InvalidIVLength;
     }
     uint8_t *ek0 = (*s).ek;
@@ -2063,8 +2214,10 @@ EverCrypt_AEAD_decrypt_expand_aes128_gcm(
     uint64_t r = c;
     if (r == (uint64_t)0U)
     {
+      EVERCRYPT_INSTRUMENTATION_EXIT(EverCrypt_Instrumentation_AES128_GCM_Vale, cipher_len);
       return EverCrypt_Error_Success;
     }
+    EVERCRYPT_INSTRUMENTATION_EXIT(EverCrypt_Instrumentation_AES128_GCM_Vale, cipher_len);
     return EverCrypt_Error_AuthenticationFailure;
   }
   return EverCrypt_Error_UnsupportedAlgorithm;
@@ -2103,6 +2256,7 @@ EverCrypt_AEAD_decrypt_expand_aes256_gcm(
   bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
   if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
   {
+    EVERCRYPT_INSTRUMENTATION_ENTER(EverCrypt_Instrumentation_AES256_GCM_Vale, cipher_len);
     uint8_t ek[544U] = { 0U };
     uint8_t *keys_b0 = ek;
     uint8_t *hkeys_b0 = ek + (uint32_t)240U;
@@ -2112,10 +2266,12 @@ EverCrypt_AEAD_decrypt_expand_aes256_gcm(
     EverCrypt_AEAD_state_s *s = &p;
     if (s == NULL)
     {
+      EVERCRYPT_INSTRUMENTATION_EXIT(EverCrypt_Instrumentation_AES256_GCM_Vale, cipher_len);
       return EverCrypt_Error_InvalidKey;
     }
     if (iv_len == (uint32_t)0U)
     {
+      EVERCRYPT_INSTRUMENTATION_EXIT(EverCrypt_Instrumentation_AES256_GCM_Vale, cipher_len);
       return EverCrypt_Error_InvalidIVLength;
     }
     uint8_t *ek0 = (*s).ek;
@@ -2219,8 +2375,10 @@ EverCrypt_AEAD_decrypt_expand_aes256_gcm(
     uint64_t r = c;
     if (r == (uint64_t)0U)
     {
+      EVERCRYPT_INSTRUMENTATION_EXIT(EverCrypt_Instrumentation_AES256_GCM_Vale, cipher_len);
       return EverCrypt_Error_Success;
     }
+    EVERCRYPT_INSTRUMENTATION_EXIT(EverCrypt_Instrumentation_AES256_GCM_Vale, cipher_len);
     return EverCrypt_Error_AuthenticationFailure;
   }
   return EverCrypt_Error_UnsupportedAlgorithm;
@@ -2314,6 +2472,132 @@ EverCrypt_AEAD_decrypt_expand(
   }
 }
 
+/**
+Encrypt and authenticate a batch of `n` messages with one call.
+
+The messages are laid out back to back: the `i`-th plaintext takes `plain_len[i]`
+bytes of `plain` and is encrypted into the same range of `cipher`, and the `i`-th
+associated data takes `ad_len[i]` bytes of `ad`.
+
+@param s Pointer to the AEAD state created by `EverCrypt_AEAD_create_in`. It already contains the encryption key.
+@param n Number of messages in the batch.
+@param iv Pointer to `n * iv_len` bytes of memory where the nonces are read from.
+@param iv_len Length of each nonce.
+@param ad Pointer to the concatenated associated data.
+@param ad_len Pointer to `n` lengths of associated data.
+@param plain Pointer to the concatenated plaintexts.
+@param plain_len Pointer to `n` plaintext lengths.
+@param cipher Pointer to memory of the combined plaintext length where the ciphertexts are written to.
+@param tag Pointer to `n * 16` bytes of memory where the tags are written to.
+
+@return `EverCrypt_Error_Success`, or the first error returned by `EverCrypt_AEAD_encrypt`, in which case the remaining messages are not encrypted.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_batch(
+  EverCrypt_AEAD_state_s *s,
+  uint32_t n,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t *ad_len,
+  uint8_t *plain,
+  uint32_t *plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  uint8_t *ad0 = ad;
+  uint8_t *plain0 = plain;
+  uint8_t *cipher0 = cipher;
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    EverCrypt_Error_error_code
+    r =
+      EverCrypt_AEAD_encrypt(s,
+        iv + i * iv_len,
+        iv_len,
+        ad0,
+        ad_len[i],
+        plain0,
+        plain_len[i],
+        cipher0,
+        tag + i * (uint32_t)16U);
+    if (r != EverCrypt_Error_Success)
+    {
+      return r;
+    }
+    ad0 = ad0 + ad_len[i];
+    plain0 = plain0 + plain_len[i];
+    cipher0 = cipher0 + plain_len[i];
+  }
+  return EverCrypt_Error_Success;
+}
+
+/**
+Verify and decrypt a batch of `n` messages with one call.
+
+The layout is the one of `EverCrypt_AEAD_encrypt_batch`: the `i`-th ciphertext takes
+`cipher_len[i]` bytes of `cipher` and is decrypted into the same range of `dst`.
+A message that fails to authenticate does not stop the batch.
+
+@param s Pointer to the AEAD state created by `EverCrypt_AEAD_create_in`. It already contains the encryption key.
+@param n Number of messages in the batch.
+@param iv Pointer to `n * iv_len` bytes of memory where the nonces are read from.
+@param iv_len Length of each nonce.
+@param ad Pointer to the concatenated associated data.
+@param ad_len Pointer to `n` lengths of associated data.
+@param cipher Pointer to the concatenated ciphertexts.
+@param cipher_len Pointer to `n` ciphertext lengths.
+@param tag Pointer to `n * 16` bytes of memory where the tags are read from.
+@param dst Pointer to memory of the combined ciphertext length where the plaintexts are written to.
+@param valid Pointer to `n` booleans, set to whether the corresponding message was authenticated.
+
+@return `EverCrypt_Error_Success` if every message was authenticated, and the error of the first message that was not otherwise. Only the plaintexts whose `valid` entry is `true` may be used.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_batch(
+  EverCrypt_AEAD_state_s *s,
+  uint32_t n,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t *ad_len,
+  uint8_t *cipher,
+  uint32_t *cipher_len,
+  uint8_t *tag,
+  uint8_t *dst,
+  bool *valid
+)
+{
+  EverCrypt_Error_error_code res = EverCrypt_Error_Success;
+  uint8_t *ad0 = ad;
+  uint8_t *cipher0 = cipher;
+  uint8_t *dst0 = dst;
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    EverCrypt_Error_error_code
+    r =
+      EverCrypt_AEAD_decrypt(s,
+        iv + i * iv_len,
+        iv_len,
+        ad0,
+        ad_len[i],
+        cipher0,
+        cipher_len[i],
+        tag + i * (uint32_t)16U,
+        dst0);
+    valid[i] = r == EverCrypt_Error_Success;
+    if (r != EverCrypt_Error_Success && res == EverCrypt_Error_Success)
+    {
+      res = r;
+    }
+    ad0 = ad0 + ad_len[i];
+    cipher0 = cipher0 + cipher_len[i];
+    dst0 = dst0 + cipher_len[i];
+  }
+  return res;
+}
+
 /**
 Cleanup and free the AEAD state.
 
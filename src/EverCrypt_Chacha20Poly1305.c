@@ -25,6 +25,7 @@
 
 #include "EverCrypt_Chacha20Poly1305.h"
 
+#include "internal/EverCrypt_Instrumentation.h"
 #include "config.h"
 
 void
@@ -45,7 +46,9 @@ EverCrypt_Chacha20Poly1305_aead_encrypt(
   if (vec256)
   {
     KRML_HOST_IGNORE(vec128);
+    EVERCRYPT_INSTRUMENTATION_ENTER(EverCrypt_Instrumentation_Chacha20Poly1305_256, mlen);
     Hacl_Chacha20Poly1305_256_aead_encrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
+    EVERCRYPT_INSTRUMENTATION_EXIT(EverCrypt_Instrumentation_Chacha20Poly1305_256, mlen);
     return;
   }
   #endif
@@ -53,13 +56,17 @@ EverCrypt_Chacha20Poly1305_aead_encrypt(
   if (vec128)
   {
     KRML_HOST_IGNORE(vec256);
+    EVERCRYPT_INSTRUMENTATION_ENTER(EverCrypt_Instrumentation_Chacha20Poly1305_128, mlen);
     Hacl_Chacha20Poly1305_128_aead_encrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
+    EVERCRYPT_INSTRUMENTATION_EXIT(EverCrypt_Instrumentation_Chacha20Poly1305_128, mlen);
     return;
   }
   #endif
   KRML_HOST_IGNORE(vec128);
   KRML_HOST_IGNORE(vec256);
+  EVERCRYPT_INSTRUMENTATION_ENTER(EverCrypt_Instrumentation_Chacha20Poly1305_32, mlen);
   Hacl_Chacha20Poly1305_32_aead_encrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
+  EVERCRYPT_INSTRUMENTATION_EXIT(EverCrypt_Instrumentation_Chacha20Poly1305_32, mlen);
 }
 
 uint32_t
@@ -80,18 +87,27 @@ EverCrypt_Chacha20Poly1305_aead_decrypt(
   if (vec256)
   {
     KRML_HOST_IGNORE(vec128);
-    return Hacl_Chacha20Poly1305_256_aead_decrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
+    EVERCRYPT_INSTRUMENTATION_ENTER(EverCrypt_Instrumentation_Chacha20Poly1305_256, mlen);
+    uint32_t r = Hacl_Chacha20Poly1305_256_aead_decrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
+    EVERCRYPT_INSTRUMENTATION_EXIT(EverCrypt_Instrumentation_Chacha20Poly1305_256, mlen);
+    return r;
   }
   #endif
   #if HACL_CAN_COMPILE_VEC128
   if (vec128)
   {
     KRML_HOST_IGNORE(vec256);
-    return Hacl_Chacha20Poly1305_128_aead_decrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
+    EVERCRYPT_INSTRUMENTATION_ENTER(EverCrypt_Instrumentation_Chacha20Poly1305_128, mlen);
+    uint32_t r = Hacl_Chacha20Poly1305_128_aead_decrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
+    EVERCRYPT_INSTRUMENTATION_EXIT(EverCrypt_Instrumentation_Chacha20Poly1305_128, mlen);
+    return r;
   }
   #endif
   KRML_HOST_IGNORE(vec128);
   KRML_HOST_IGNORE(vec256);
-  return Hacl_Chacha20Poly1305_32_aead_decrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
+  EVERCRYPT_INSTRUMENTATION_ENTER(EverCrypt_Instrumentation_Chacha20Poly1305_32, mlen);
+  uint32_t r = Hacl_Chacha20Poly1305_32_aead_decrypt(k, n, aadlen, aad, mlen, m, cipher, tag);
+  EVERCRYPT_INSTRUMENTATION_EXIT(EverCrypt_Instrumentation_Chacha20Poly1305_32, mlen);
+  return r;
 }
 
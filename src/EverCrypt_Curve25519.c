@@ -96,3 +96,111 @@ bool EverCrypt_Curve25519_ecdh(uint8_t *shared, uint8_t *my_priv, uint8_t *their
   #endif
 }
 
+/**
+Compute four scalar multiples of points.
+
+On platforms with AVX2 support the four scalar multiplications run in parallel.
+
+@param shared Pointer to 128 bytes of memory where the four resulting points are written to, each taking 32 bytes.
+@param my_priv Pointer to 128 bytes of memory where the four secret/private keys are read from, each taking 32 bytes.
+@param their_pub Pointer to 128 bytes of memory where the four public points are read from, each taking 32 bytes.
+*/
+void
+EverCrypt_Curve25519_scalarmult_4x(uint8_t *shared, uint8_t *my_priv, uint8_t *their_pub)
+{
+  #if HACL_CAN_COMPILE_VEC256
+  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+  if (vec256)
+  {
+    Hacl_Curve25519_Vec256_scalarmult4(shared, my_priv, their_pub);
+    return;
+  }
+  #endif
+  KRML_MAYBE_FOR4(i,
+    (uint32_t)0U,
+    (uint32_t)4U,
+    (uint32_t)1U,
+    EverCrypt_Curve25519_scalarmult(shared + i * (uint32_t)32U,
+      my_priv + i * (uint32_t)32U,
+      their_pub + i * (uint32_t)32U););
+}
+
+/**
+Execute a batch of diffie-hellmann key exchanges.
+
+The function returns `true` if all shared secrets are non-zero, and `false` otherwise.
+On platforms with AVX2 support, groups of four key exchanges run in parallel.
+
+@param len Number of key exchanges in the batch.
+@param shared Pointer to `32 * len` bytes of memory where the resulting points are written to.
+@param my_priv Pointer to `32 * len` bytes of memory where **our** secret/private keys are read from.
+@param their_pub Pointer to `32 * len` bytes of memory where **their** public points are read from.
+@param valid Pointer to `len` booleans where the result of each key exchange is written to.
+*/
+bool
+EverCrypt_Curve25519_ecdh_batch(
+  uint32_t len,
+  uint8_t *shared,
+  uint8_t *my_priv,
+  uint8_t *their_pub,
+  bool *valid
+)
+{
+  bool res = true;
+  uint32_t i0 = (uint32_t)0U;
+  #if HACL_CAN_COMPILE_VEC256
+  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+  if (vec256)
+  {
+    for (; i0 + (uint32_t)4U <= len; i0 = i0 + (uint32_t)4U)
+    {
+      bool r =
+        Hacl_Curve25519_Vec256_ecdh4(shared + i0 * (uint32_t)32U,
+          my_priv + i0 * (uint32_t)32U,
+          their_pub + i0 * (uint32_t)32U,
+          valid + i0);
+      res = res && r;
+    }
+  }
+  #endif
+  for (uint32_t i = i0; i < len; i++)
+  {
+    bool r =
+      EverCrypt_Curve25519_ecdh(shared + i * (uint32_t)32U,
+        my_priv + i * (uint32_t)32U,
+        their_pub + i * (uint32_t)32U);
+    valid[i] = r;
+    res = res && r;
+  }
+  return res;
+}
+
+/**
+Calculate a batch of public points from secret/private keys.
+
+On platforms with AVX2 support, groups of four public points are computed in parallel.
+
+@param len Number of public points to compute.
+@param pub Pointer to `32 * len` bytes of memory where the resulting points are written to.
+@param priv Pointer to `32 * len` bytes of memory where the secret/private keys are read from.
+*/
+void EverCrypt_Curve25519_secret_to_public_batch(uint32_t len, uint8_t *pub, uint8_t *priv)
+{
+  uint32_t i0 = (uint32_t)0U;
+  #if HACL_CAN_COMPILE_VEC256
+  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+  if (vec256)
+  {
+    for (; i0 + (uint32_t)4U <= len; i0 = i0 + (uint32_t)4U)
+    {
+      Hacl_Curve25519_Vec256_secret_to_public4(pub + i0 * (uint32_t)32U,
+        priv + i0 * (uint32_t)32U);
+    }
+  }
+  #endif
+  for (uint32_t i = i0; i < len; i++)
+  {
+    EverCrypt_Curve25519_secret_to_public(pub + i * (uint32_t)32U, priv + i * (uint32_t)32U);
+  }
+}
+
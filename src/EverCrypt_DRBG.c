@@ -23,10 +23,11 @@
  */
 
 
-#include "EverCrypt_DRBG.h"
+#include "internal/EverCrypt_DRBG.h"
 
 #include "internal/EverCrypt_HMAC.h"
 #include "lib_memzero0.h"
+#include "config.h"
 
 uint32_t EverCrypt_DRBG_reseed_interval = (uint32_t)1024U;
 
@@ -70,9 +71,18 @@ uint32_t EverCrypt_DRBG_min_length(Spec_Hash_Definitions_hash_alg a)
 #define SHA2_256_s 1
 #define SHA2_384_s 2
 #define SHA2_512_s 3
+#define ChaCha20_s 4
 
 typedef uint8_t state_s_tags;
 
+/* Fast-key-erasure ChaCha20 generator: `k` is the only secret state. */
+typedef struct chacha20_state_s
+{
+  uint8_t *k;
+  uint32_t *reseed_counter;
+}
+chacha20_state;
+
 typedef struct EverCrypt_DRBG_state_s_s
 {
   state_s_tags tag;
@@ -81,6 +91,7 @@ typedef struct EverCrypt_DRBG_state_s_s
     Hacl_HMAC_DRBG_state case_SHA2_256_s;
     Hacl_HMAC_DRBG_state case_SHA2_384_s;
     Hacl_HMAC_DRBG_state case_SHA2_512_s;
+    chacha20_state case_ChaCha20_s;
   }
   ;
 }
@@ -235,6 +246,47 @@ EverCrypt_DRBG_state_s *EverCrypt_DRBG_create(Spec_Hash_Definitions_hash_alg a)
   return EverCrypt_DRBG_create_in(a);
 }
 
+/**
+Create a ChaCha20 DRBG state.
+
+The generator keeps a single 256-bit key. Every generate call expands it with
+ChaCha20 (using the widest vectorized implementation the CPU supports),
+replaces it with the first 32 bytes of keystream, and returns the following
+bytes, so past outputs cannot be recovered from a later state. The key is
+derived and updated with HMAC-SHA2-256 on instantiate, reseed and when
+additional input is supplied, and the generator reseeds itself from the
+operating system every `EverCrypt_DRBG_reseed_interval` generate calls.
+
+Unlike the HMAC-DRBG instantiations, generate is not limited to
+`EverCrypt_DRBG_max_output_length` bytes per call.
+
+@return DRBG state, or NULL if it cannot be allocated. Needs to be freed via
+`EverCrypt_DRBG_uninstantiate`.
+*/
+EverCrypt_DRBG_state_s *EverCrypt_DRBG_create_chacha20(void)
+{
+  uint8_t *k = (uint8_t *)KRML_HOST_CALLOC((uint32_t)32U, sizeof (uint8_t));
+  uint32_t *ctr = (uint32_t *)KRML_HOST_MALLOC(sizeof (uint32_t));
+  EverCrypt_DRBG_state_s
+  *buf = (EverCrypt_DRBG_state_s *)KRML_HOST_MALLOC(sizeof (EverCrypt_DRBG_state_s));
+  if (k == NULL || ctr == NULL || buf == NULL)
+  {
+    KRML_HOST_FREE(k);
+    KRML_HOST_FREE(ctr);
+    KRML_HOST_FREE(buf);
+    return NULL;
+  }
+  ctr[0U] = (uint32_t)1U;
+  buf[0U] =
+    (
+      (EverCrypt_DRBG_state_s){
+        .tag = ChaCha20_s,
+        { .case_ChaCha20_s = { .k = k, .reseed_counter = ctr } }
+      }
+    );
+  return buf;
+}
+
 static bool
 instantiate_sha1(
   EverCrypt_DRBG_state_s *st,
@@ -1859,6 +1911,207 @@ static void uninstantiate_sha2_512(EverCrypt_DRBG_state_s *st)
   KRML_HOST_FREE(st);
 }
 
+static void chacha20_keystream(uint32_t len, uint8_t *out, uint8_t *key, uint32_t ctr)
+{
+  uint8_t nonce[12U] = { 0U };
+  memset(out, 0U, len * sizeof (uint8_t));
+  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+  bool vec128 = EverCrypt_AutoConfig2_has_vec128();
+  #if HACL_CAN_COMPILE_VEC256
+  if (vec256)
+  {
+    KRML_HOST_IGNORE(vec128);
+    Hacl_Chacha20_Vec256_chacha20_encrypt_256(len, out, out, key, nonce, ctr);
+    return;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC128
+  if (vec128)
+  {
+    KRML_HOST_IGNORE(vec256);
+    Hacl_Chacha20_Vec128_chacha20_encrypt_128(len, out, out, key, nonce, ctr);
+    return;
+  }
+  #endif
+  KRML_HOST_IGNORE(vec128);
+  KRML_HOST_IGNORE(vec256);
+  Hacl_Chacha20_Vec32_chacha20_encrypt_32(len, out, out, key, nonce, ctr);
+}
+
+/* k := HMAC-SHA2-256(k, label || a || b) */
+static void
+chacha20_update_key(uint8_t *k, uint8_t label, uint8_t *a, uint32_t a_len, uint8_t *b, uint32_t b_len)
+{
+  uint32_t input_len = (uint32_t)1U + a_len + b_len;
+  KRML_CHECK_SIZE(sizeof (uint8_t), input_len);
+  uint8_t input[input_len];
+  memset(input, 0U, input_len * sizeof (uint8_t));
+  input[0U] = label;
+  if (a_len != (uint32_t)0U)
+  {
+    memcpy(input + (uint32_t)1U, a, a_len * sizeof (uint8_t));
+  }
+  if (b_len != (uint32_t)0U)
+  {
+    memcpy(input + (uint32_t)1U + a_len, b, b_len * sizeof (uint8_t));
+  }
+  uint8_t k_[32U] = { 0U };
+  EverCrypt_HMAC_compute_sha2_256(k_, k, (uint32_t)32U, input, input_len);
+  memcpy(k, k_, (uint32_t)32U * sizeof (uint8_t));
+  Lib_Memzero0_memzero(k_, (uint32_t)32U, uint8_t);
+  Lib_Memzero0_memzero(input, input_len, uint8_t);
+}
+
+static chacha20_state chacha20_get(EverCrypt_DRBG_state_s *st)
+{
+  EverCrypt_DRBG_state_s st_s = *st;
+  if (st_s.tag == ChaCha20_s)
+  {
+    return st_s.case_ChaCha20_s;
+  }
+  return KRML_EABORT(chacha20_state, "unreachable (pattern matches are exhaustive in F*)");
+}
+
+bool
+EverCrypt_DRBG_instantiate_chacha20_derand(
+  EverCrypt_DRBG_state_s *st,
+  uint8_t *entropy,
+  uint8_t *personalization_string,
+  uint32_t personalization_string_len
+)
+{
+  if (personalization_string_len > EverCrypt_DRBG_max_personalization_string_length)
+  {
+    return false;
+  }
+  chacha20_state s = chacha20_get(st);
+  memset(s.k, 0U, (uint32_t)32U * sizeof (uint8_t));
+  chacha20_update_key(s.k,
+    (uint8_t)0U,
+    entropy,
+    (uint32_t)48U,
+    personalization_string,
+    personalization_string_len);
+  s.reseed_counter[0U] = (uint32_t)1U;
+  return true;
+}
+
+static bool
+instantiate_chacha20(
+  EverCrypt_DRBG_state_s *st,
+  uint8_t *personalization_string,
+  uint32_t personalization_string_len
+)
+{
+  if (personalization_string_len > EverCrypt_DRBG_max_personalization_string_length)
+  {
+    return false;
+  }
+  uint8_t entropy[48U] = { 0U };
+  if (!Lib_RandomBuffer_System_randombytes(entropy, (uint32_t)48U))
+  {
+    return false;
+  }
+  bool ok =
+    EverCrypt_DRBG_instantiate_chacha20_derand(st,
+      entropy,
+      personalization_string,
+      personalization_string_len);
+  Lib_Memzero0_memzero(entropy, (uint32_t)48U, uint8_t);
+  return ok;
+}
+
+static bool
+reseed_chacha20(
+  EverCrypt_DRBG_state_s *st,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+)
+{
+  if (additional_input_len > EverCrypt_DRBG_max_additional_input_length)
+  {
+    return false;
+  }
+  chacha20_state s = chacha20_get(st);
+  uint8_t entropy[32U] = { 0U };
+  if (!Lib_RandomBuffer_System_randombytes(entropy, (uint32_t)32U))
+  {
+    return false;
+  }
+  chacha20_update_key(s.k,
+    (uint8_t)1U,
+    entropy,
+    (uint32_t)32U,
+    additional_input,
+    additional_input_len);
+  Lib_Memzero0_memzero(entropy, (uint32_t)32U, uint8_t);
+  s.reseed_counter[0U] = (uint32_t)1U;
+  return true;
+}
+
+static bool
+generate_chacha20(
+  uint8_t *output,
+  EverCrypt_DRBG_state_s *st,
+  uint32_t n,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+)
+{
+  if (additional_input_len > EverCrypt_DRBG_max_additional_input_length)
+  {
+    return false;
+  }
+  chacha20_state s = chacha20_get(st);
+  if (s.reseed_counter[0U] > EverCrypt_DRBG_reseed_interval)
+  {
+    if (!reseed_chacha20(st, NULL, (uint32_t)0U))
+    {
+      return false;
+    }
+  }
+  if (additional_input_len > (uint32_t)0U)
+  {
+    chacha20_update_key(s.k,
+      (uint8_t)2U,
+      additional_input,
+      additional_input_len,
+      NULL,
+      (uint32_t)0U);
+  }
+  /* Block 0 of the keystream becomes the next key, the output starts at block 1.
+     Short requests are served from a single 512-byte batch. */
+  if (n <= (uint32_t)448U)
+  {
+    uint8_t tmp[512U] = { 0U };
+    chacha20_keystream((uint32_t)64U + n, tmp, s.k, (uint32_t)0U);
+    memcpy(output, tmp + (uint32_t)64U, n * sizeof (uint8_t));
+    memcpy(s.k, tmp, (uint32_t)32U * sizeof (uint8_t));
+    Lib_Memzero0_memzero(tmp, (uint32_t)512U, uint8_t);
+  }
+  else
+  {
+    uint8_t block[64U] = { 0U };
+    chacha20_keystream((uint32_t)64U, block, s.k, (uint32_t)0U);
+    chacha20_keystream(n, output, s.k, (uint32_t)1U);
+    memcpy(s.k, block, (uint32_t)32U * sizeof (uint8_t));
+    Lib_Memzero0_memzero(block, (uint32_t)64U, uint8_t);
+  }
+  uint32_t old_ctr = s.reseed_counter[0U];
+  s.reseed_counter[0U] = old_ctr + (uint32_t)1U;
+  return true;
+}
+
+static void uninstantiate_chacha20(EverCrypt_DRBG_state_s *st)
+{
+  chacha20_state s = chacha20_get(st);
+  Lib_Memzero0_memzero(s.k, (uint32_t)32U, uint8_t);
+  s.reseed_counter[0U] = (uint32_t)0U;
+  KRML_HOST_FREE(s.k);
+  KRML_HOST_FREE(s.reseed_counter);
+  KRML_HOST_FREE(st);
+}
+
 /**
 Instantiate the DRBG.
 
@@ -1892,6 +2145,10 @@ EverCrypt_DRBG_instantiate(
   {
     return instantiate_sha2_512(st, personalization_string, personalization_string_len);
   }
+  if (scrut.tag == ChaCha20_s)
+  {
+    return instantiate_chacha20(st, personalization_string, personalization_string_len);
+  }
   KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
@@ -1932,6 +2189,10 @@ EverCrypt_DRBG_reseed(
   {
     return reseed_sha2_512(st, additional_input, additional_input_len);
   }
+  if (scrut.tag == ChaCha20_s)
+  {
+    return reseed_chacha20(st, additional_input, additional_input_len);
+  }
   KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
@@ -1976,6 +2237,10 @@ EverCrypt_DRBG_generate(
   {
     return generate_sha2_512(output, st, n, additional_input, additional_input_len);
   }
+  if (scrut.tag == ChaCha20_s)
+  {
+    return generate_chacha20(output, st, n, additional_input, additional_input_len);
+  }
   KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
@@ -2011,6 +2276,11 @@ void EverCrypt_DRBG_uninstantiate(EverCrypt_DRBG_state_s *st)
     uninstantiate_sha2_512(st);
     return;
   }
+  if (scrut.tag == ChaCha20_s)
+  {
+    uninstantiate_chacha20(st);
+    return;
+  }
   KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
@@ -0,0 +1,365 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "internal/EverCrypt_Instrumentation.h"
+
+static const char
+*impl_names[EVERCRYPT_INSTRUMENTATION_IMPLS] =
+  {
+    "MD5", "SHA1", "SHA2_224", "SHA2_224_Vale", "SHA2_256", "SHA2_256_Vale", "SHA2_384",
+    "SHA2_512", "SHA3_224", "SHA3_256", "SHA3_384", "SHA3_512", "Blake2S_32", "Blake2S_128",
+    "Blake2B_32", "Blake2B_256", "AES128_GCM_Vale", "AES256_GCM_Vale", "Chacha20Poly1305_32",
+    "Chacha20Poly1305_128", "Chacha20Poly1305_256"
+  };
+
+const char *EverCrypt_Instrumentation_impl_name(EverCrypt_Instrumentation_impl impl)
+{
+  if (impl >= EVERCRYPT_INSTRUMENTATION_IMPLS)
+  {
+    return NULL;
+  }
+  return impl_names[impl];
+}
+
+#if HACL_INSTRUMENTATION
+
+/* Every thread lazily allocates a slot and is the only writer of its
+ * counters, so an increment is a plain load and store; the atomic accessors
+ * below only keep concurrent snapshots from seeing torn values. Slots sit on
+ * a list under `slots_lock`, which is only taken to add a slot, to fold the
+ * slot of an exiting thread into `retired`, and to take a snapshot. */
+
+#if HACL_INSTRUMENTATION_USDT
+#include <sys/sdt.h>
+#endif
+
+#define SLOT_ALIGN (64U)
+
+typedef struct slot_s
+{
+  EverCrypt_Instrumentation_counters counters[EVERCRYPT_INSTRUMENTATION_IMPLS];
+  struct slot_s *prev;
+  struct slot_s *next;
+}
+slot;
+
+/* Rounded up so that the next allocation never shares our last cache line. */
+#define SLOT_SIZE ((sizeof (slot) + SLOT_ALIGN - 1U) / SLOT_ALIGN * SLOT_ALIGN)
+
+#if (defined(_WIN32) || defined(_WIN64))
+
+#include <windows.h>
+
+#if defined(_MSC_VER)
+#define INSTRUMENTATION_TLS __declspec(thread)
+#else
+#define INSTRUMENTATION_TLS __thread
+#endif
+
+#if defined(_M_X64) || defined(_M_ARM64) || defined(__x86_64__) || defined(__aarch64__)
+#define load64(p) (*(volatile uint64_t *)(p))
+#define store64(p, v) (*(volatile uint64_t *)(p) = (v))
+#else
+#define load64(p) ((uint64_t)InterlockedCompareExchange64((volatile LONG64 *)(p), 0, 0))
+#define store64(p, v) InterlockedExchange64((volatile LONG64 *)(p), (LONG64)(v))
+#endif
+
+#define load_ptr(p) (*(void *volatile *)(p))
+#define store_ptr(p, v) (*(void *volatile *)(p) = (void *)(v))
+
+static SRWLOCK slots_lock = SRWLOCK_INIT;
+
+static void lock(void)
+{
+  AcquireSRWLockExclusive(&slots_lock);
+}
+
+static void unlock(void)
+{
+  ReleaseSRWLockExclusive(&slots_lock);
+}
+
+#else
+
+#include <pthread.h>
+
+#define INSTRUMENTATION_TLS _Thread_local
+
+#define load64(p) __atomic_load_n((p), __ATOMIC_RELAXED)
+#define store64(p, v) __atomic_store_n((p), (v), __ATOMIC_RELAXED)
+#define load_ptr(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define store_ptr(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+
+static pthread_mutex_t slots_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void lock(void)
+{
+  pthread_mutex_lock(&slots_lock);
+}
+
+static void unlock(void)
+{
+  pthread_mutex_unlock(&slots_lock);
+}
+
+#endif
+
+static INSTRUMENTATION_TLS slot *local_slot = NULL;
+
+static slot *slots = NULL;
+
+static EverCrypt_Instrumentation_counters retired[EVERCRYPT_INSTRUMENTATION_IMPLS];
+
+/* A hook and its context are published together as one immutable pair, so
+ * that a reader never calls one hook with the context of another. Pairs are
+ * never freed, since a reader may still hold one after it is replaced; they
+ * are kept on `hook_pairs` (under `slots_lock`) and reused when the same hook
+ * and context are installed again. */
+typedef struct hook_pair_s
+{
+  EverCrypt_Instrumentation_hook hook;
+  void *ctx;
+  struct hook_pair_s *next;
+}
+hook_pair;
+
+static hook_pair *hook_pairs = NULL;
+
+static hook_pair *hook_current = NULL;
+
+static void slot_retire(slot *sl)
+{
+  lock();
+  for (uint32_t i = 0U; i < EVERCRYPT_INSTRUMENTATION_IMPLS; i++)
+  {
+    retired[i].calls = retired[i].calls + sl->counters[i].calls;
+    retired[i].bytes = retired[i].bytes + sl->counters[i].bytes;
+  }
+  if (sl->prev == NULL)
+  {
+    slots = sl->next;
+  }
+  else
+  {
+    sl->prev->next = sl->next;
+  }
+  if (sl->next != NULL)
+  {
+    sl->next->prev = sl->prev;
+  }
+  unlock();
+  KRML_ALIGNED_FREE(sl);
+}
+
+#if (defined(_WIN32) || defined(_WIN64))
+
+static INIT_ONCE slots_once = INIT_ONCE_STATIC_INIT;
+
+static DWORD slots_fls = FLS_OUT_OF_INDEXES;
+
+static VOID NTAPI on_thread_exit(PVOID p)
+{
+  if (p != NULL)
+  {
+    local_slot = NULL;
+    slot_retire((slot *)p);
+  }
+}
+
+static BOOL CALLBACK slots_global_init(PINIT_ONCE once, PVOID param, PVOID *ctx)
+{
+  (void)once;
+  (void)param;
+  (void)ctx;
+  slots_fls = FlsAlloc(on_thread_exit);
+  return TRUE;
+}
+
+static void register_slot(slot *sl)
+{
+  InitOnceExecuteOnce(&slots_once, slots_global_init, NULL, NULL);
+  if (slots_fls != FLS_OUT_OF_INDEXES)
+  {
+    FlsSetValue(slots_fls, sl);
+  }
+}
+
+#else
+
+static pthread_once_t slots_once = PTHREAD_ONCE_INIT;
+
+static pthread_key_t slots_key;
+
+static void on_thread_exit(void *p)
+{
+  if (p != NULL)
+  {
+    local_slot = NULL;
+    slot_retire((slot *)p);
+  }
+}
+
+static void slots_global_init(void)
+{
+  pthread_key_create(&slots_key, on_thread_exit);
+}
+
+static void register_slot(slot *sl)
+{
+  pthread_once(&slots_once, slots_global_init);
+  pthread_setspecific(slots_key, sl);
+}
+
+#endif
+
+static slot *get_slot(void)
+{
+  slot *sl = local_slot;
+  if (sl != NULL)
+  {
+    return sl;
+  }
+  sl = (slot *)KRML_ALIGNED_MALLOC(SLOT_ALIGN, SLOT_SIZE);
+  if (sl == NULL)
+  {
+    return NULL;
+  }
+  memset(sl, 0U, SLOT_SIZE);
+  lock();
+  sl->next = slots;
+  if (slots != NULL)
+  {
+    slots->prev = sl;
+  }
+  slots = sl;
+  unlock();
+  register_slot(sl);
+  local_slot = sl;
+  return sl;
+}
+
+void EverCrypt_Instrumentation_enter(EverCrypt_Instrumentation_impl impl, uint32_t len)
+{
+  slot *sl = get_slot();
+  if (sl != NULL)
+  {
+    EverCrypt_Instrumentation_counters *c = &sl->counters[impl];
+    store64(&c->calls, c->calls + 1ULL);
+    store64(&c->bytes, c->bytes + (uint64_t)len);
+  }
+  #if HACL_INSTRUMENTATION_USDT
+  DTRACE_PROBE2(hacl, enter, impl, len);
+  #endif
+  hook_pair *h = (hook_pair *)load_ptr(&hook_current);
+  if (h != NULL)
+  {
+    h->hook(h->ctx, EverCrypt_Instrumentation_Enter, impl, len);
+  }
+}
+
+void EverCrypt_Instrumentation_exit(EverCrypt_Instrumentation_impl impl, uint32_t len)
+{
+  #if HACL_INSTRUMENTATION_USDT
+  DTRACE_PROBE2(hacl, exit, impl, len);
+  #endif
+  hook_pair *h = (hook_pair *)load_ptr(&hook_current);
+  if (h != NULL)
+  {
+    h->hook(h->ctx, EverCrypt_Instrumentation_Exit, impl, len);
+  }
+}
+
+bool EverCrypt_Instrumentation_enabled(void)
+{
+  return true;
+}
+
+void EverCrypt_Instrumentation_snapshot(EverCrypt_Instrumentation_counters *dst)
+{
+  lock();
+  memcpy(dst, retired, EVERCRYPT_INSTRUMENTATION_IMPLS * sizeof (EverCrypt_Instrumentation_counters));
+  for (slot *sl = slots; sl != NULL; sl = sl->next)
+  {
+    for (uint32_t i = 0U; i < EVERCRYPT_INSTRUMENTATION_IMPLS; i++)
+    {
+      dst[i].calls = dst[i].calls + load64(&sl->counters[i].calls);
+      dst[i].bytes = dst[i].bytes + load64(&sl->counters[i].bytes);
+    }
+  }
+  unlock();
+}
+
+void
+EverCrypt_Instrumentation_set_hook(EverCrypt_Instrumentation_hook hook, void *ctx)
+{
+  hook_pair *h = NULL;
+  lock();
+  if (hook != NULL)
+  {
+    for (h = hook_pairs; h != NULL; h = h->next)
+    {
+      if (h->hook == hook && h->ctx == ctx)
+      {
+        break;
+      }
+    }
+    if (h == NULL)
+    {
+      h = (hook_pair *)KRML_HOST_MALLOC(sizeof (hook_pair));
+      if (h == NULL)
+      {
+        /* Leave the previous hook in place. */
+        unlock();
+        return;
+      }
+      h->hook = hook;
+      h->ctx = ctx;
+      h->next = hook_pairs;
+      hook_pairs = h;
+    }
+  }
+  store_ptr(&hook_current, h);
+  unlock();
+}
+
+#else
+
+bool EverCrypt_Instrumentation_enabled(void)
+{
+  return false;
+}
+
+void EverCrypt_Instrumentation_snapshot(EverCrypt_Instrumentation_counters *dst)
+{
+  memset(dst, 0U, EVERCRYPT_INSTRUMENTATION_IMPLS * sizeof (EverCrypt_Instrumentation_counters));
+}
+
+void
+EverCrypt_Instrumentation_set_hook(EverCrypt_Instrumentation_hook hook, void *ctx)
+{
+  KRML_HOST_IGNORE(hook);
+  KRML_HOST_IGNORE(ctx);
+}
+
+#endif
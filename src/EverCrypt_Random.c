@@ -0,0 +1,269 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "EverCrypt_Random.h"
+
+#include "lib_memzero0.h"
+
+/* Per-thread DRBG service. Every thread lazily creates its own DRBG and
+ * output buffer, so the fast path only touches thread-local memory. The only
+ * shared state is a fork generation counter, which the child-side `atfork`
+ * handler bumps. A thread compares it with the generation its state was
+ * created in, and rebuilds the state on mismatch so parent and child never
+ * share output. */
+
+#if (defined(_WIN32) || defined(_WIN64))
+
+#include <windows.h>
+
+#if defined(_MSC_VER)
+#define EVERCRYPT_RANDOM_TLS __declspec(thread)
+#else
+#define EVERCRYPT_RANDOM_TLS __thread
+#endif
+
+#else
+
+#include <pthread.h>
+
+#define EVERCRYPT_RANDOM_TLS _Thread_local
+
+#endif
+
+typedef struct thread_state_s
+{
+  EverCrypt_DRBG_state_s *drbg;
+  uint64_t generation;
+  uint32_t avail;
+  uint8_t buf[EVERCRYPT_RANDOM_BUFFER_LEN];
+}
+thread_state;
+
+static EVERCRYPT_RANDOM_TLS thread_state *local_state = NULL;
+
+static void thread_state_free(thread_state *st)
+{
+  if (st->drbg != NULL)
+  {
+    EverCrypt_DRBG_uninstantiate(st->drbg);
+  }
+  Lib_Memzero0_memzero(st, 1U, thread_state);
+  KRML_HOST_FREE(st);
+}
+
+#if (defined(_WIN32) || defined(_WIN64))
+
+static INIT_ONCE random_once = INIT_ONCE_STATIC_INIT;
+
+static DWORD random_fls = FLS_OUT_OF_INDEXES;
+
+static VOID NTAPI on_thread_exit(PVOID p)
+{
+  if (p != NULL)
+  {
+    local_state = NULL;
+    thread_state_free((thread_state *)p);
+  }
+}
+
+static BOOL CALLBACK random_global_init(PINIT_ONCE once, PVOID param, PVOID *ctx)
+{
+  (void)once;
+  (void)param;
+  (void)ctx;
+  random_fls = FlsAlloc(on_thread_exit);
+  return TRUE;
+}
+
+static void register_state(thread_state *st)
+{
+  InitOnceExecuteOnce(&random_once, random_global_init, NULL, NULL);
+  if (random_fls != FLS_OUT_OF_INDEXES)
+  {
+    FlsSetValue(random_fls, st);
+  }
+}
+
+static uint64_t current_generation(void)
+{
+  return 0ULL;
+}
+
+#else
+
+static pthread_once_t random_once = PTHREAD_ONCE_INIT;
+
+static pthread_key_t random_key;
+
+static uint64_t fork_generation = 0ULL;
+
+static void on_fork_child(void)
+{
+  __atomic_add_fetch(&fork_generation, 1ULL, __ATOMIC_RELAXED);
+}
+
+static void on_thread_exit(void *p)
+{
+  if (p != NULL)
+  {
+    local_state = NULL;
+    thread_state_free((thread_state *)p);
+  }
+}
+
+static void random_global_init(void)
+{
+  pthread_key_create(&random_key, on_thread_exit);
+  pthread_atfork(NULL, NULL, on_fork_child);
+}
+
+static void register_state(thread_state *st)
+{
+  pthread_once(&random_once, random_global_init);
+  pthread_setspecific(random_key, st);
+}
+
+static uint64_t current_generation(void)
+{
+  return __atomic_load_n(&fork_generation, __ATOMIC_RELAXED);
+}
+
+#endif
+
+static thread_state *thread_state_new(uint64_t generation)
+{
+  thread_state *st = (thread_state *)KRML_HOST_CALLOC(1U, sizeof (thread_state));
+  if (st == NULL)
+  {
+    return NULL;
+  }
+  /* The personalization string separates instances in different threads and
+   * fork generations; the entropy itself always comes from the OS. */
+  uint8_t personalization[16U];
+  uintptr_t addr = (uintptr_t)st;
+  memset(personalization, 0U, sizeof (personalization));
+  memcpy(personalization, &addr, sizeof (addr));
+  store64_le(personalization + 8U, generation);
+  st->drbg = EverCrypt_DRBG_create_chacha20();
+  if
+  (
+    st->drbg == NULL
+    || !EverCrypt_DRBG_instantiate(st->drbg, personalization, (uint32_t)16U)
+  )
+  {
+    thread_state_free(st);
+    return NULL;
+  }
+  st->generation = generation;
+  st->avail = 0U;
+  return st;
+}
+
+static thread_state *get_state(void)
+{
+  uint64_t generation = current_generation();
+  thread_state *st = local_state;
+  if (st != NULL && st->generation == generation)
+  {
+    return st;
+  }
+  if (st != NULL)
+  {
+    /* We are in a forked child: drop the inherited state and its buffer. */
+    local_state = NULL;
+    thread_state_free(st);
+  }
+  st = thread_state_new(generation);
+  if (st == NULL)
+  {
+    return NULL;
+  }
+  register_state(st);
+  local_state = st;
+  return st;
+}
+
+static void take_buffered(thread_state *st, uint8_t *out, uint32_t len)
+{
+  uint8_t *src = st->buf + EVERCRYPT_RANDOM_BUFFER_LEN - st->avail;
+  memcpy(out, src, len * sizeof (uint8_t));
+  Lib_Memzero0_memzero(src, len, uint8_t);
+  st->avail = st->avail - len;
+}
+
+bool EverCrypt_Random_bytes(uint8_t *buf, uint32_t len)
+{
+  if (len == 0U)
+  {
+    return true;
+  }
+  thread_state *st = get_state();
+  if (st == NULL)
+  {
+    return false;
+  }
+  uint32_t n0 = len < st->avail ? len : st->avail;
+  take_buffered(st, buf, n0);
+  uint8_t *out = buf + n0;
+  uint32_t rem = len - n0;
+  if (rem >= EVERCRYPT_RANDOM_BUFFER_LEN)
+  {
+    /* The ChaCha20 DRBG has no limit on the output length of a call. */
+    return EverCrypt_DRBG_generate(out, st->drbg, rem, NULL, 0U);
+  }
+  if (rem > 0U)
+  {
+    if (!EverCrypt_DRBG_generate(st->buf, st->drbg, EVERCRYPT_RANDOM_BUFFER_LEN, NULL, 0U))
+    {
+      return false;
+    }
+    st->avail = EVERCRYPT_RANDOM_BUFFER_LEN;
+    take_buffered(st, out, rem);
+  }
+  return true;
+}
+
+bool EverCrypt_Random_reseed(void)
+{
+  thread_state *st = get_state();
+  if (st == NULL)
+  {
+    return false;
+  }
+  Lib_Memzero0_memzero(st->buf, EVERCRYPT_RANDOM_BUFFER_LEN, uint8_t);
+  st->avail = 0U;
+  return EverCrypt_DRBG_reseed(st->drbg, NULL, 0U);
+}
+
+void EverCrypt_Random_thread_cleanup(void)
+{
+  thread_state *st = local_state;
+  if (st == NULL)
+  {
+    return;
+  }
+  local_state = NULL;
+  register_state(NULL);
+  thread_state_free(st);
+}
@@ -0,0 +1,213 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "internal/Hacl_AES128.h"
+
+#include "config.h"
+
+/* Portable AES-128. Its only user is FrodoKEM-AES, which keys it with the
+ * public seed_A, so the S-box lookups below do not leak secrets. */
+
+static const
+uint8_t
+sbox[256U] =
+  {
+    (uint8_t)0x63U, (uint8_t)0x7cU, (uint8_t)0x77U, (uint8_t)0x7bU, (uint8_t)0xf2U, (uint8_t)0x6bU, (uint8_t)0x6fU, (uint8_t)0xc5U,
+    (uint8_t)0x30U, (uint8_t)0x01U, (uint8_t)0x67U, (uint8_t)0x2bU, (uint8_t)0xfeU, (uint8_t)0xd7U, (uint8_t)0xabU, (uint8_t)0x76U,
+    (uint8_t)0xcaU, (uint8_t)0x82U, (uint8_t)0xc9U, (uint8_t)0x7dU, (uint8_t)0xfaU, (uint8_t)0x59U, (uint8_t)0x47U, (uint8_t)0xf0U,
+    (uint8_t)0xadU, (uint8_t)0xd4U, (uint8_t)0xa2U, (uint8_t)0xafU, (uint8_t)0x9cU, (uint8_t)0xa4U, (uint8_t)0x72U, (uint8_t)0xc0U,
+    (uint8_t)0xb7U, (uint8_t)0xfdU, (uint8_t)0x93U, (uint8_t)0x26U, (uint8_t)0x36U, (uint8_t)0x3fU, (uint8_t)0xf7U, (uint8_t)0xccU,
+    (uint8_t)0x34U, (uint8_t)0xa5U, (uint8_t)0xe5U, (uint8_t)0xf1U, (uint8_t)0x71U, (uint8_t)0xd8U, (uint8_t)0x31U, (uint8_t)0x15U,
+    (uint8_t)0x04U, (uint8_t)0xc7U, (uint8_t)0x23U, (uint8_t)0xc3U, (uint8_t)0x18U, (uint8_t)0x96U, (uint8_t)0x05U, (uint8_t)0x9aU,
+    (uint8_t)0x07U, (uint8_t)0x12U, (uint8_t)0x80U, (uint8_t)0xe2U, (uint8_t)0xebU, (uint8_t)0x27U, (uint8_t)0xb2U, (uint8_t)0x75U,
+    (uint8_t)0x09U, (uint8_t)0x83U, (uint8_t)0x2cU, (uint8_t)0x1aU, (uint8_t)0x1bU, (uint8_t)0x6eU, (uint8_t)0x5aU, (uint8_t)0xa0U,
+    (uint8_t)0x52U, (uint8_t)0x3bU, (uint8_t)0xd6U, (uint8_t)0xb3U, (uint8_t)0x29U, (uint8_t)0xe3U, (uint8_t)0x2fU, (uint8_t)0x84U,
+    (uint8_t)0x53U, (uint8_t)0xd1U, (uint8_t)0x00U, (uint8_t)0xedU, (uint8_t)0x20U, (uint8_t)0xfcU, (uint8_t)0xb1U, (uint8_t)0x5bU,
+    (uint8_t)0x6aU, (uint8_t)0xcbU, (uint8_t)0xbeU, (uint8_t)0x39U, (uint8_t)0x4aU, (uint8_t)0x4cU, (uint8_t)0x58U, (uint8_t)0xcfU,
+    (uint8_t)0xd0U, (uint8_t)0xefU, (uint8_t)0xaaU, (uint8_t)0xfbU, (uint8_t)0x43U, (uint8_t)0x4dU, (uint8_t)0x33U, (uint8_t)0x85U,
+    (uint8_t)0x45U, (uint8_t)0xf9U, (uint8_t)0x02U, (uint8_t)0x7fU, (uint8_t)0x50U, (uint8_t)0x3cU, (uint8_t)0x9fU, (uint8_t)0xa8U,
+    (uint8_t)0x51U, (uint8_t)0xa3U, (uint8_t)0x40U, (uint8_t)0x8fU, (uint8_t)0x92U, (uint8_t)0x9dU, (uint8_t)0x38U, (uint8_t)0xf5U,
+    (uint8_t)0xbcU, (uint8_t)0xb6U, (uint8_t)0xdaU, (uint8_t)0x21U, (uint8_t)0x10U, (uint8_t)0xffU, (uint8_t)0xf3U, (uint8_t)0xd2U,
+    (uint8_t)0xcdU, (uint8_t)0x0cU, (uint8_t)0x13U, (uint8_t)0xecU, (uint8_t)0x5fU, (uint8_t)0x97U, (uint8_t)0x44U, (uint8_t)0x17U,
+    (uint8_t)0xc4U, (uint8_t)0xa7U, (uint8_t)0x7eU, (uint8_t)0x3dU, (uint8_t)0x64U, (uint8_t)0x5dU, (uint8_t)0x19U, (uint8_t)0x73U,
+    (uint8_t)0x60U, (uint8_t)0x81U, (uint8_t)0x4fU, (uint8_t)0xdcU, (uint8_t)0x22U, (uint8_t)0x2aU, (uint8_t)0x90U, (uint8_t)0x88U,
+    (uint8_t)0x46U, (uint8_t)0xeeU, (uint8_t)0xb8U, (uint8_t)0x14U, (uint8_t)0xdeU, (uint8_t)0x5eU, (uint8_t)0x0bU, (uint8_t)0xdbU,
+    (uint8_t)0xe0U, (uint8_t)0x32U, (uint8_t)0x3aU, (uint8_t)0x0aU, (uint8_t)0x49U, (uint8_t)0x06U, (uint8_t)0x24U, (uint8_t)0x5cU,
+    (uint8_t)0xc2U, (uint8_t)0xd3U, (uint8_t)0xacU, (uint8_t)0x62U, (uint8_t)0x91U, (uint8_t)0x95U, (uint8_t)0xe4U, (uint8_t)0x79U,
+    (uint8_t)0xe7U, (uint8_t)0xc8U, (uint8_t)0x37U, (uint8_t)0x6dU, (uint8_t)0x8dU, (uint8_t)0xd5U, (uint8_t)0x4eU, (uint8_t)0xa9U,
+    (uint8_t)0x6cU, (uint8_t)0x56U, (uint8_t)0xf4U, (uint8_t)0xeaU, (uint8_t)0x65U, (uint8_t)0x7aU, (uint8_t)0xaeU, (uint8_t)0x08U,
+    (uint8_t)0xbaU, (uint8_t)0x78U, (uint8_t)0x25U, (uint8_t)0x2eU, (uint8_t)0x1cU, (uint8_t)0xa6U, (uint8_t)0xb4U, (uint8_t)0xc6U,
+    (uint8_t)0xe8U, (uint8_t)0xddU, (uint8_t)0x74U, (uint8_t)0x1fU, (uint8_t)0x4bU, (uint8_t)0xbdU, (uint8_t)0x8bU, (uint8_t)0x8aU,
+    (uint8_t)0x70U, (uint8_t)0x3eU, (uint8_t)0xb5U, (uint8_t)0x66U, (uint8_t)0x48U, (uint8_t)0x03U, (uint8_t)0xf6U, (uint8_t)0x0eU,
+    (uint8_t)0x61U, (uint8_t)0x35U, (uint8_t)0x57U, (uint8_t)0xb9U, (uint8_t)0x86U, (uint8_t)0xc1U, (uint8_t)0x1dU, (uint8_t)0x9eU,
+    (uint8_t)0xe1U, (uint8_t)0xf8U, (uint8_t)0x98U, (uint8_t)0x11U, (uint8_t)0x69U, (uint8_t)0xd9U, (uint8_t)0x8eU, (uint8_t)0x94U,
+    (uint8_t)0x9bU, (uint8_t)0x1eU, (uint8_t)0x87U, (uint8_t)0xe9U, (uint8_t)0xceU, (uint8_t)0x55U, (uint8_t)0x28U, (uint8_t)0xdfU,
+    (uint8_t)0x8cU, (uint8_t)0xa1U, (uint8_t)0x89U, (uint8_t)0x0dU, (uint8_t)0xbfU, (uint8_t)0xe6U, (uint8_t)0x42U, (uint8_t)0x68U,
+    (uint8_t)0x41U, (uint8_t)0x99U, (uint8_t)0x2dU, (uint8_t)0x0fU, (uint8_t)0xb0U, (uint8_t)0x54U, (uint8_t)0xbbU, (uint8_t)0x16U
+  };
+
+static inline uint8_t xtime(uint8_t x)
+{
+  return
+    (uint8_t)((uint32_t)x << (uint32_t)1U ^ (((uint32_t)0U - ((uint32_t)x >> (uint32_t)7U)) & (uint32_t)0x1bU));
+}
+
+static void key_expansion(uint8_t *key, uint8_t *expanded_key)
+{
+  uint8_t rcon = (uint8_t)1U;
+  memcpy(expanded_key, key, (uint32_t)16U * sizeof (uint8_t));
+  for (uint32_t i = (uint32_t)4U; i < (uint32_t)44U; i++)
+  {
+    uint8_t *prev = expanded_key + (i - (uint32_t)1U) * (uint32_t)4U;
+    uint8_t t[4U] = { 0U };
+    if (i % (uint32_t)4U == (uint32_t)0U)
+    {
+      t[0U] = sbox[prev[1U]] ^ rcon;
+      t[1U] = sbox[prev[2U]];
+      t[2U] = sbox[prev[3U]];
+      t[3U] = sbox[prev[0U]];
+      rcon = xtime(rcon);
+    }
+    else
+    {
+      memcpy(t, prev, (uint32_t)4U * sizeof (uint8_t));
+    }
+    uint8_t *w = expanded_key + i * (uint32_t)4U;
+    uint8_t *w4 = expanded_key + (i - (uint32_t)4U) * (uint32_t)4U;
+    KRML_MAYBE_FOR4(i0, (uint32_t)0U, (uint32_t)4U, (uint32_t)1U, w[i0] = w4[i0] ^ t[i0];);
+  }
+}
+
+static void encrypt_block(uint8_t *out, uint8_t *in, uint8_t *expanded_key)
+{
+  uint8_t st[16U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    st[i] = in[i] ^ expanded_key[i];
+  }
+  for (uint32_t r = (uint32_t)1U; r < (uint32_t)11U; r++)
+  {
+    /* SubBytes and ShiftRows: byte (row j, column c) moves to column c - j. */
+    uint8_t t[16U] = { 0U };
+    for (uint32_t c = (uint32_t)0U; c < (uint32_t)4U; c++)
+    {
+      KRML_MAYBE_FOR4(j,
+        (uint32_t)0U,
+        (uint32_t)4U,
+        (uint32_t)1U,
+        t[c * (uint32_t)4U + j] = sbox[st[(c + j) % (uint32_t)4U * (uint32_t)4U + j]];);
+    }
+    if (r < (uint32_t)10U)
+    {
+      for (uint32_t c = (uint32_t)0U; c < (uint32_t)4U; c++)
+      {
+        uint8_t *col = t + c * (uint32_t)4U;
+        uint8_t a0 = col[0U];
+        uint8_t a1 = col[1U];
+        uint8_t a2 = col[2U];
+        uint8_t a3 = col[3U];
+        uint8_t all = a0 ^ a1 ^ a2 ^ a3;
+        col[0U] = a0 ^ all ^ xtime(a0 ^ a1);
+        col[1U] = a1 ^ all ^ xtime(a1 ^ a2);
+        col[2U] = a2 ^ all ^ xtime(a2 ^ a3);
+        col[3U] = a3 ^ all ^ xtime(a3 ^ a0);
+      }
+    }
+    uint8_t *rk = expanded_key + r * (uint32_t)16U;
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+    {
+      st[i] = t[i] ^ rk[i];
+    }
+  }
+  memcpy(out, st, (uint32_t)16U * sizeof (uint8_t));
+}
+
+/**
+Expand a 16-byte AES-128 key into the 176-byte schedule of eleven round keys.
+*/
+void Hacl_AES128_aes128_key_expansion(bool aesni, uint8_t *key, uint8_t *expanded_key)
+{
+  #if HACL_CAN_COMPILE_VALE
+  if (aesni)
+  {
+    KRML_HOST_IGNORE(aes128_key_expansion(key, expanded_key));
+    return;
+  }
+  #endif
+  KRML_HOST_IGNORE(aesni);
+  key_expansion(key, expanded_key);
+}
+
+/**
+Encrypt one block, given as eight 16-bit words in little-endian order.
+*/
+void
+Hacl_AES128_aes128_encrypt_block(
+  bool aesni,
+  uint16_t *cipher,
+  uint16_t *plain,
+  uint8_t *expanded_key
+)
+{
+  uint8_t b[16U] = { 0U };
+  KRML_MAYBE_FOR8(i,
+    (uint32_t)0U,
+    (uint32_t)8U,
+    (uint32_t)1U,
+    store16_le(b + i * (uint32_t)2U, plain[i]););
+  Hacl_AES128_aes128_encrypt_blocks(aesni, (uint32_t)1U, b, b, expanded_key);
+  KRML_MAYBE_FOR8(i,
+    (uint32_t)0U,
+    (uint32_t)8U,
+    (uint32_t)1U,
+    cipher[i] = load16_le(b + i * (uint32_t)2U););
+}
+
+/**
+Encrypt `len` consecutive 16-byte blocks in ECB mode. `out` may be equal to `in`.
+*/
+void
+Hacl_AES128_aes128_encrypt_blocks(
+  bool aesni,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *in,
+  uint8_t *expanded_key
+)
+{
+  #if HACL_CAN_COMPILE_VEC128 && (TARGET_ARCHITECTURE == TARGET_ARCHITECTURE_ID_X64 || TARGET_ARCHITECTURE == TARGET_ARCHITECTURE_ID_X86)
+  if (aesni)
+  {
+    Hacl_AES128_NI_aes128_encrypt_blocks(len, out, in, expanded_key);
+    return;
+  }
+  #endif
+  KRML_HOST_IGNORE(aesni);
+  for (uint32_t i = (uint32_t)0U; i < len; i++)
+  {
+    encrypt_block(out + i * (uint32_t)16U, in + i * (uint32_t)16U, expanded_key);
+  }
+}
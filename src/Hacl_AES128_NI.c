@@ -0,0 +1,95 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "internal/Hacl_AES128.h"
+
+#include "config.h"
+
+#if TARGET_ARCHITECTURE == TARGET_ARCHITECTURE_ID_X64 || TARGET_ARCHITECTURE == TARGET_ARCHITECTURE_ID_X86
+
+#include "libintvector.h"
+
+#include <wmmintrin.h>
+
+/* Eight independent blocks are kept in flight to hide the latency of aesenc. */
+
+void
+Hacl_AES128_NI_aes128_encrypt_blocks(
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *in,
+  uint8_t *expanded_key
+)
+{
+  Lib_IntVector_Intrinsics_vec128 rk[11U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)11U; i++)
+  {
+    rk[i] = Lib_IntVector_Intrinsics_vec128_load32_le(expanded_key + i * (uint32_t)16U);
+  }
+  uint32_t i0 = (uint32_t)0U;
+  for (; i0 + (uint32_t)8U <= len; i0 = i0 + (uint32_t)8U)
+  {
+    Lib_IntVector_Intrinsics_vec128 st[8U];
+    KRML_MAYBE_FOR8(i,
+      (uint32_t)0U,
+      (uint32_t)8U,
+      (uint32_t)1U,
+      st[i] =
+        Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_load32_le(in
+            + (i0 + i) * (uint32_t)16U),
+          rk[0U]););
+    for (uint32_t r = (uint32_t)1U; r < (uint32_t)10U; r++)
+    {
+      KRML_MAYBE_FOR8(i,
+        (uint32_t)0U,
+        (uint32_t)8U,
+        (uint32_t)1U,
+        st[i] = Lib_IntVector_Intrinsics_ni_aes_enc(st[i], rk[r]););
+    }
+    KRML_MAYBE_FOR8(i,
+      (uint32_t)0U,
+      (uint32_t)8U,
+      (uint32_t)1U,
+      Lib_IntVector_Intrinsics_vec128_store32_le(out + (i0 + i) * (uint32_t)16U,
+        Lib_IntVector_Intrinsics_ni_aes_enc_last(st[i], rk[10U])););
+  }
+  for (uint32_t i = i0; i < len; i++)
+  {
+    Lib_IntVector_Intrinsics_vec128
+    st =
+      Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_load32_le(in
+          + i * (uint32_t)16U),
+        rk[0U]);
+    for (uint32_t r = (uint32_t)1U; r < (uint32_t)10U; r++)
+    {
+      st = Lib_IntVector_Intrinsics_ni_aes_enc(st, rk[r]);
+    }
+    Lib_IntVector_Intrinsics_vec128_store32_le(out + i * (uint32_t)16U,
+      Lib_IntVector_Intrinsics_ni_aes_enc_last(st, rk[10U]));
+  }
+}
+
+#endif
@@ -27,6 +27,10 @@
 
 #include "internal/Hacl_Krmllib.h"
 #include "internal/Hacl_Bignum_Base.h"
+#include "internal/Hacl_Bignum_IFMA.h"
+#include "internal/Hacl_Bignum_ADX.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "config.h"
 
 void
 Hacl_Bignum_Karatsuba_bn_karatsuba_mul_uint32(
@@ -164,6 +168,11 @@ Hacl_Bignum_Karatsuba_bn_karatsuba_mul_uint64(
   uint64_t *res
 )
 {
+  if (Hacl_Bignum_ADX_is_available() && aLen <= (uint32_t)64U)
+  {
+    Hacl_Bignum_ADX_bn_mul_u64(aLen, a, b, res);
+    return;
+  }
   if (aLen < (uint32_t)32U || aLen % (uint32_t)2U == (uint32_t)1U)
   {
     Hacl_Bignum_Multiplication_bn_mul_u64(aLen, a, aLen, b, res);
@@ -392,6 +401,11 @@ Hacl_Bignum_Karatsuba_bn_karatsuba_sqr_uint64(
   uint64_t *res
 )
 {
+  if (Hacl_Bignum_ADX_is_available() && aLen <= (uint32_t)64U)
+  {
+    Hacl_Bignum_ADX_bn_sqr_u64(aLen, a, res);
+    return;
+  }
   if (aLen < (uint32_t)32U || aLen % (uint32_t)2U == (uint32_t)1U)
   {
     Hacl_Bignum_Multiplication_bn_sqr_u64(aLen, a, res);
@@ -1083,37 +1097,44 @@ Hacl_Bignum_Montgomery_bn_mont_reduction_u64(
 )
 {
   uint64_t c0 = (uint64_t)0U;
-  for (uint32_t i0 = (uint32_t)0U; i0 < len; i0++)
+  if (Hacl_Bignum_ADX_is_available())
   {
-    uint64_t qj = nInv * c[i0];
-    uint64_t *res_j0 = c + i0;
-    uint64_t c1 = (uint64_t)0U;
-    for (uint32_t i = (uint32_t)0U; i < len / (uint32_t)4U; i++)
-    {
-      uint64_t a_i = n[(uint32_t)4U * i];
-      uint64_t *res_i0 = res_j0 + (uint32_t)4U * i;
-      c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, qj, c1, res_i0);
-      uint64_t a_i0 = n[(uint32_t)4U * i + (uint32_t)1U];
-      uint64_t *res_i1 = res_j0 + (uint32_t)4U * i + (uint32_t)1U;
-      c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i0, qj, c1, res_i1);
-      uint64_t a_i1 = n[(uint32_t)4U * i + (uint32_t)2U];
-      uint64_t *res_i2 = res_j0 + (uint32_t)4U * i + (uint32_t)2U;
-      c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i1, qj, c1, res_i2);
-      uint64_t a_i2 = n[(uint32_t)4U * i + (uint32_t)3U];
-      uint64_t *res_i = res_j0 + (uint32_t)4U * i + (uint32_t)3U;
-      c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i2, qj, c1, res_i);
-    }
-    for (uint32_t i = len / (uint32_t)4U * (uint32_t)4U; i < len; i++)
+    c0 = Hacl_Bignum_ADX_bn_mont_reduction_loop_u64(len, n, nInv, c);
+  }
+  else
+  {
+    for (uint32_t i0 = (uint32_t)0U; i0 < len; i0++)
     {
-      uint64_t a_i = n[i];
-      uint64_t *res_i = res_j0 + i;
-      c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, qj, c1, res_i);
+      uint64_t qj = nInv * c[i0];
+      uint64_t *res_j0 = c + i0;
+      uint64_t c1 = (uint64_t)0U;
+      for (uint32_t i = (uint32_t)0U; i < len / (uint32_t)4U; i++)
+      {
+        uint64_t a_i = n[(uint32_t)4U * i];
+        uint64_t *res_i0 = res_j0 + (uint32_t)4U * i;
+        c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, qj, c1, res_i0);
+        uint64_t a_i0 = n[(uint32_t)4U * i + (uint32_t)1U];
+        uint64_t *res_i1 = res_j0 + (uint32_t)4U * i + (uint32_t)1U;
+        c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i0, qj, c1, res_i1);
+        uint64_t a_i1 = n[(uint32_t)4U * i + (uint32_t)2U];
+        uint64_t *res_i2 = res_j0 + (uint32_t)4U * i + (uint32_t)2U;
+        c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i1, qj, c1, res_i2);
+        uint64_t a_i2 = n[(uint32_t)4U * i + (uint32_t)3U];
+        uint64_t *res_i = res_j0 + (uint32_t)4U * i + (uint32_t)3U;
+        c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i2, qj, c1, res_i);
+      }
+      for (uint32_t i = len / (uint32_t)4U * (uint32_t)4U; i < len; i++)
+      {
+        uint64_t a_i = n[i];
+        uint64_t *res_i = res_j0 + i;
+        c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, qj, c1, res_i);
+      }
+      uint64_t r = c1;
+      uint64_t c10 = r;
+      uint64_t *resb = c + len + i0;
+      uint64_t res_j = c[len + i0];
+      c0 = Lib_IntTypes_Intrinsics_add_carry_u64((uint8_t)c0, c10, res_j, resb);
     }
-    uint64_t r = c1;
-    uint64_t c10 = r;
-    uint64_t *resb = c + len + i0;
-    uint64_t res_j = c[len + i0];
-    c0 = Lib_IntTypes_Intrinsics_add_carry_u64(c0, c10, res_j, resb);
   }
   memcpy(res, c + len, (len + len - len) * sizeof (uint64_t));
   uint64_t c00 = c0;
@@ -1339,37 +1360,44 @@ bn_almost_mont_reduction_u64(
 )
 {
   uint64_t c0 = (uint64_t)0U;
-  for (uint32_t i0 = (uint32_t)0U; i0 < len; i0++)
+  if (Hacl_Bignum_ADX_is_available())
   {
-    uint64_t qj = nInv * c[i0];
-    uint64_t *res_j0 = c + i0;
-    uint64_t c1 = (uint64_t)0U;
-    for (uint32_t i = (uint32_t)0U; i < len / (uint32_t)4U; i++)
-    {
-      uint64_t a_i = n[(uint32_t)4U * i];
-      uint64_t *res_i0 = res_j0 + (uint32_t)4U * i;
-      c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, qj, c1, res_i0);
-      uint64_t a_i0 = n[(uint32_t)4U * i + (uint32_t)1U];
-      uint64_t *res_i1 = res_j0 + (uint32_t)4U * i + (uint32_t)1U;
-      c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i0, qj, c1, res_i1);
-      uint64_t a_i1 = n[(uint32_t)4U * i + (uint32_t)2U];
-      uint64_t *res_i2 = res_j0 + (uint32_t)4U * i + (uint32_t)2U;
-      c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i1, qj, c1, res_i2);
-      uint64_t a_i2 = n[(uint32_t)4U * i + (uint32_t)3U];
-      uint64_t *res_i = res_j0 + (uint32_t)4U * i + (uint32_t)3U;
-      c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i2, qj, c1, res_i);
-    }
-    for (uint32_t i = len / (uint32_t)4U * (uint32_t)4U; i < len; i++)
+    c0 = Hacl_Bignum_ADX_bn_mont_reduction_loop_u64(len, n, nInv, c);
+  }
+  else
+  {
+    for (uint32_t i0 = (uint32_t)0U; i0 < len; i0++)
     {
-      uint64_t a_i = n[i];
-      uint64_t *res_i = res_j0 + i;
-      c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, qj, c1, res_i);
+      uint64_t qj = nInv * c[i0];
+      uint64_t *res_j0 = c + i0;
+      uint64_t c1 = (uint64_t)0U;
+      for (uint32_t i = (uint32_t)0U; i < len / (uint32_t)4U; i++)
+      {
+        uint64_t a_i = n[(uint32_t)4U * i];
+        uint64_t *res_i0 = res_j0 + (uint32_t)4U * i;
+        c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, qj, c1, res_i0);
+        uint64_t a_i0 = n[(uint32_t)4U * i + (uint32_t)1U];
+        uint64_t *res_i1 = res_j0 + (uint32_t)4U * i + (uint32_t)1U;
+        c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i0, qj, c1, res_i1);
+        uint64_t a_i1 = n[(uint32_t)4U * i + (uint32_t)2U];
+        uint64_t *res_i2 = res_j0 + (uint32_t)4U * i + (uint32_t)2U;
+        c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i1, qj, c1, res_i2);
+        uint64_t a_i2 = n[(uint32_t)4U * i + (uint32_t)3U];
+        uint64_t *res_i = res_j0 + (uint32_t)4U * i + (uint32_t)3U;
+        c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i2, qj, c1, res_i);
+      }
+      for (uint32_t i = len / (uint32_t)4U * (uint32_t)4U; i < len; i++)
+      {
+        uint64_t a_i = n[i];
+        uint64_t *res_i = res_j0 + i;
+        c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, qj, c1, res_i);
+      }
+      uint64_t r = c1;
+      uint64_t c10 = r;
+      uint64_t *resb = c + len + i0;
+      uint64_t res_j = c[len + i0];
+      c0 = Lib_IntTypes_Intrinsics_add_carry_u64((uint8_t)c0, c10, res_j, resb);
     }
-    uint64_t r = c1;
-    uint64_t c10 = r;
-    uint64_t *resb = c + len + i0;
-    uint64_t res_j = c[len + i0];
-    c0 = Lib_IntTypes_Intrinsics_add_carry_u64(c0, c10, res_j, resb);
   }
   memcpy(res, c + len, (len + len - len) * sizeof (uint64_t));
   uint64_t c00 = c0;
@@ -1945,6 +1973,13 @@ Hacl_Bignum_Exponentiation_bn_mod_exp_vartime_precomp_u64(
   uint64_t *res
 )
 {
+  #if HACL_CAN_COMPILE_IFMA
+  if (EverCrypt_AutoConfig2_has_avx512ifma() && Hacl_Bignum_IFMA_bn_len_is_supported(len))
+  {
+    Hacl_Bignum_IFMA_bn_mod_exp_vartime_precomp_u64(len, n, mu, r2, a, bBits, b, res);
+    return;
+  }
+  #endif
   if (bBits < (uint32_t)200U)
   {
     KRML_CHECK_SIZE(sizeof (uint64_t), len);
@@ -2094,6 +2129,13 @@ Hacl_Bignum_Exponentiation_bn_mod_exp_consttime_precomp_u64(
   uint64_t *res
 )
 {
+  #if HACL_CAN_COMPILE_IFMA
+  if (EverCrypt_AutoConfig2_has_avx512ifma() && Hacl_Bignum_IFMA_bn_len_is_supported(len))
+  {
+    Hacl_Bignum_IFMA_bn_mod_exp_consttime_precomp_u64(len, n, mu, r2, a, bBits, b, res);
+    return;
+  }
+  #endif
   if (bBits < (uint32_t)200U)
   {
     KRML_CHECK_SIZE(sizeof (uint64_t), len);
@@ -2302,3 +2344,633 @@ Hacl_Bignum_Exponentiation_bn_mod_exp_consttime_u64(
   Hacl_Bignum_Exponentiation_bn_mod_exp_consttime_precomp_u64(len, n, mu, r2, a, bBits, b, res);
 }
 
+static inline void
+bn_multi_exp_precomp_table_u32(
+  uint32_t len,
+  uint32_t *n,
+  uint32_t mu,
+  uint32_t *oneM,
+  uint32_t *aM,
+  uint32_t *table
+)
+{
+  memcpy(table, oneM, len * sizeof (uint32_t));
+  memcpy(table + len, aM, len * sizeof (uint32_t));
+  KRML_MAYBE_FOR7(i,
+    (uint32_t)0U,
+    (uint32_t)7U,
+    (uint32_t)1U,
+    uint32_t *t11 = table + (i + (uint32_t)1U) * len;
+    uint32_t *t2 = table + ((uint32_t)2U * i + (uint32_t)2U) * len;
+    Hacl_Bignum_Montgomery_bn_mont_sqr_u32(len, n, mu, t11, t2);
+    Hacl_Bignum_Montgomery_bn_mont_mul_u32(len,
+      n,
+      mu,
+      aM,
+      t2,
+      table + ((uint32_t)2U * i + (uint32_t)3U) * len););
+}
+
+static inline void
+bn_table_select_consttime_u32(
+  uint32_t len,
+  uint32_t table_len,
+  const uint32_t *table,
+  uint32_t bits_l,
+  uint32_t *res
+)
+{
+  memcpy(res, (uint32_t *)table, len * sizeof (uint32_t));
+  for (uint32_t i1 = (uint32_t)1U; i1 < table_len; i1++)
+  {
+    uint32_t c = FStar_UInt32_eq_mask(bits_l, (uint32_t)i1);
+    const uint32_t *res_j = table + i1 * len;
+    for (uint32_t i = (uint32_t)0U; i < len; i++)
+    {
+      uint32_t *os = res;
+      uint32_t x = (c & res_j[i]) | (~c & res[i]);
+      os[i] = x;
+    }
+  }
+}
+
+bool
+Hacl_Bignum_MultiExponentiation_bn_multi_exp_vartime_u32(
+  uint32_t len,
+  uint32_t *n,
+  uint32_t mu,
+  uint32_t *r2,
+  uint32_t num,
+  uint32_t *aM,
+  uint32_t bBits,
+  uint32_t *b,
+  uint32_t *resM
+)
+{
+  uint32_t bLen;
+  if (bBits == (uint32_t)0U)
+  {
+    bLen = (uint32_t)1U;
+  }
+  else
+  {
+    bLen = (bBits - (uint32_t)1U) / (uint32_t)32U + (uint32_t)1U;
+  }
+  KRML_CHECK_SIZE(sizeof (uint32_t), len);
+  uint32_t oneM[len];
+  memset(oneM, 0U, len * sizeof (uint32_t));
+  Hacl_Bignum_Montgomery_bn_from_mont_u32(len, n, mu, r2, oneM);
+  if ((uint64_t)num * (uint64_t)16U * (uint64_t)len > (uint64_t)0xffffffffU)
+  {
+    return false;
+  }
+  KRML_CHECK_SIZE(sizeof (uint32_t), num * (uint32_t)16U * len);
+  uint32_t *table = (uint32_t *)KRML_HOST_CALLOC(num * (uint32_t)16U * len, sizeof (uint32_t));
+  if (num > (uint32_t)0U && table == NULL)
+  {
+    return false;
+  }
+  for (uint32_t i = (uint32_t)0U; i < num; i++)
+  {
+    bn_multi_exp_precomp_table_u32(len, n, mu, oneM, aM + i * len, table + i * (uint32_t)16U * len);
+  }
+  memcpy(resM, oneM, len * sizeof (uint32_t));
+  uint32_t nw = (bBits + (uint32_t)3U) / (uint32_t)4U;
+  for (uint32_t i0 = (uint32_t)0U; i0 < nw; i0++)
+  {
+    if (i0 > (uint32_t)0U)
+    {
+      KRML_MAYBE_FOR4(i,
+        (uint32_t)0U,
+        (uint32_t)4U,
+        (uint32_t)1U,
+        Hacl_Bignum_Montgomery_bn_mont_sqr_u32(len, n, mu, resM, resM););
+    }
+    uint32_t k = (nw - i0 - (uint32_t)1U) * (uint32_t)4U;
+    uint32_t l;
+    if (bBits - k < (uint32_t)4U)
+    {
+      l = bBits - k;
+    }
+    else
+    {
+      l = (uint32_t)4U;
+    }
+    for (uint32_t i = (uint32_t)0U; i < num; i++)
+    {
+      uint32_t bits_l = Hacl_Bignum_Lib_bn_get_bits_u32(bLen, b + i * bLen, k, l);
+      if (bits_l != (uint32_t)0U)
+      {
+        uint32_t bits_l32 = (uint32_t)bits_l;
+        const uint32_t *a_bits_l = table + (i * (uint32_t)16U + bits_l32) * len;
+        Hacl_Bignum_Montgomery_bn_mont_mul_u32(len, n, mu, resM, (uint32_t *)a_bits_l, resM);
+      }
+    }
+  }
+  KRML_HOST_FREE(table);
+  return true;
+}
+
+bool
+Hacl_Bignum_MultiExponentiation_bn_multi_exp_consttime_u32(
+  uint32_t len,
+  uint32_t *n,
+  uint32_t mu,
+  uint32_t *r2,
+  uint32_t num,
+  uint32_t *aM,
+  uint32_t bBits,
+  uint32_t *b,
+  uint32_t *resM
+)
+{
+  uint32_t bLen;
+  if (bBits == (uint32_t)0U)
+  {
+    bLen = (uint32_t)1U;
+  }
+  else
+  {
+    bLen = (bBits - (uint32_t)1U) / (uint32_t)32U + (uint32_t)1U;
+  }
+  KRML_CHECK_SIZE(sizeof (uint32_t), len);
+  uint32_t oneM[len];
+  memset(oneM, 0U, len * sizeof (uint32_t));
+  Hacl_Bignum_Montgomery_bn_from_mont_u32(len, n, mu, r2, oneM);
+  if ((uint64_t)num * (uint64_t)16U * (uint64_t)len > (uint64_t)0xffffffffU)
+  {
+    return false;
+  }
+  KRML_CHECK_SIZE(sizeof (uint32_t), num * (uint32_t)16U * len);
+  uint32_t *table = (uint32_t *)KRML_HOST_CALLOC(num * (uint32_t)16U * len, sizeof (uint32_t));
+  if (num > (uint32_t)0U && table == NULL)
+  {
+    return false;
+  }
+  for (uint32_t i = (uint32_t)0U; i < num; i++)
+  {
+    bn_multi_exp_precomp_table_u32(len, n, mu, oneM, aM + i * len, table + i * (uint32_t)16U * len);
+  }
+  KRML_CHECK_SIZE(sizeof (uint32_t), len);
+  uint32_t tmp[len];
+  memset(tmp, 0U, len * sizeof (uint32_t));
+  memcpy(resM, oneM, len * sizeof (uint32_t));
+  uint32_t nw = (bBits + (uint32_t)3U) / (uint32_t)4U;
+  for (uint32_t i0 = (uint32_t)0U; i0 < nw; i0++)
+  {
+    if (i0 > (uint32_t)0U)
+    {
+      KRML_MAYBE_FOR4(i,
+        (uint32_t)0U,
+        (uint32_t)4U,
+        (uint32_t)1U,
+        Hacl_Bignum_Montgomery_bn_mont_sqr_u32(len, n, mu, resM, resM););
+    }
+    uint32_t k = (nw - i0 - (uint32_t)1U) * (uint32_t)4U;
+    uint32_t l;
+    if (bBits - k < (uint32_t)4U)
+    {
+      l = bBits - k;
+    }
+    else
+    {
+      l = (uint32_t)4U;
+    }
+    for (uint32_t i = (uint32_t)0U; i < num; i++)
+    {
+      uint32_t bits_l = Hacl_Bignum_Lib_bn_get_bits_u32(bLen, b + i * bLen, k, l);
+      bn_table_select_consttime_u32(len, (uint32_t)16U, table + i * (uint32_t)16U * len, bits_l, tmp);
+      Hacl_Bignum_Montgomery_bn_mont_mul_u32(len, n, mu, resM, tmp, resM);
+    }
+  }
+  KRML_HOST_FREE(table);
+  return true;
+}
+
+void
+Hacl_Bignum_MultiExponentiation_bn_comb_precomp_u32(
+  uint32_t len,
+  uint32_t *n,
+  uint32_t mu,
+  uint32_t *r2,
+  uint32_t teeth,
+  uint32_t bBits,
+  uint32_t *gM,
+  uint32_t *table
+)
+{
+  uint32_t d = (bBits - (uint32_t)1U) / teeth + (uint32_t)1U;
+  KRML_CHECK_SIZE(sizeof (uint32_t), len);
+  uint32_t gi[len];
+  memset(gi, 0U, len * sizeof (uint32_t));
+  memcpy(gi, gM, len * sizeof (uint32_t));
+  Hacl_Bignum_Montgomery_bn_from_mont_u32(len, n, mu, r2, table);
+  for (uint32_t i0 = (uint32_t)0U; i0 < teeth; i0++)
+  {
+    uint32_t m = (uint32_t)1U << i0;
+    memcpy(table + m * len, gi, len * sizeof (uint32_t));
+    for (uint32_t i = (uint32_t)1U; i < m; i++)
+    {
+      Hacl_Bignum_Montgomery_bn_mont_mul_u32(len, n, mu, table + i * len, gi, table + (m + i) * len);
+    }
+    if (i0 + (uint32_t)1U < teeth)
+    {
+      for (uint32_t i = (uint32_t)0U; i < d; i++)
+      {
+        Hacl_Bignum_Montgomery_bn_mont_sqr_u32(len, n, mu, gi, gi);
+      }
+    }
+  }
+}
+
+static inline uint32_t
+bn_comb_get_bits_u32(uint32_t teeth, uint32_t d, uint32_t bBits, uint32_t *b, uint32_t c)
+{
+  uint32_t bits_l = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < teeth; i++)
+  {
+    uint32_t k = i * d + c;
+    if (k < bBits)
+    {
+      uint32_t bit = b[k / (uint32_t)32U] >> k % (uint32_t)32U & (uint32_t)1U;
+      bits_l = bits_l | bit << i;
+    }
+  }
+  return bits_l;
+}
+
+void
+Hacl_Bignum_MultiExponentiation_bn_comb_exp_vartime_u32(
+  uint32_t len,
+  uint32_t *n,
+  uint32_t mu,
+  uint32_t *r2,
+  uint32_t teeth,
+  uint32_t bBits,
+  uint32_t *table,
+  uint32_t *b,
+  uint32_t *resM
+)
+{
+  uint32_t d = (bBits - (uint32_t)1U) / teeth + (uint32_t)1U;
+  Hacl_Bignum_Montgomery_bn_from_mont_u32(len, n, mu, r2, resM);
+  for (uint32_t i0 = (uint32_t)0U; i0 < d; i0++)
+  {
+    if (i0 > (uint32_t)0U)
+    {
+      Hacl_Bignum_Montgomery_bn_mont_sqr_u32(len, n, mu, resM, resM);
+    }
+    uint32_t bits_l = bn_comb_get_bits_u32(teeth, d, bBits, b, d - i0 - (uint32_t)1U);
+    if (bits_l != (uint32_t)0U)
+    {
+      uint32_t bits_l32 = (uint32_t)bits_l;
+      Hacl_Bignum_Montgomery_bn_mont_mul_u32(len, n, mu, resM, table + bits_l32 * len, resM);
+    }
+  }
+}
+
+void
+Hacl_Bignum_MultiExponentiation_bn_comb_exp_consttime_u32(
+  uint32_t len,
+  uint32_t *n,
+  uint32_t mu,
+  uint32_t *r2,
+  uint32_t teeth,
+  uint32_t bBits,
+  uint32_t *table,
+  uint32_t *b,
+  uint32_t *resM
+)
+{
+  uint32_t d = (bBits - (uint32_t)1U) / teeth + (uint32_t)1U;
+  KRML_CHECK_SIZE(sizeof (uint32_t), len);
+  uint32_t tmp[len];
+  memset(tmp, 0U, len * sizeof (uint32_t));
+  Hacl_Bignum_Montgomery_bn_from_mont_u32(len, n, mu, r2, resM);
+  for (uint32_t i0 = (uint32_t)0U; i0 < d; i0++)
+  {
+    if (i0 > (uint32_t)0U)
+    {
+      Hacl_Bignum_Montgomery_bn_mont_sqr_u32(len, n, mu, resM, resM);
+    }
+    uint32_t bits_l = bn_comb_get_bits_u32(teeth, d, bBits, b, d - i0 - (uint32_t)1U);
+    bn_table_select_consttime_u32(len, (uint32_t)1U << teeth, table, bits_l, tmp);
+    Hacl_Bignum_Montgomery_bn_mont_mul_u32(len, n, mu, resM, tmp, resM);
+  }
+}
+
+static inline void
+bn_multi_exp_precomp_table_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *oneM,
+  uint64_t *aM,
+  uint64_t *table
+)
+{
+  memcpy(table, oneM, len * sizeof (uint64_t));
+  memcpy(table + len, aM, len * sizeof (uint64_t));
+  KRML_MAYBE_FOR7(i,
+    (uint32_t)0U,
+    (uint32_t)7U,
+    (uint32_t)1U,
+    uint64_t *t11 = table + (i + (uint32_t)1U) * len;
+    uint64_t *t2 = table + ((uint32_t)2U * i + (uint32_t)2U) * len;
+    Hacl_Bignum_Montgomery_bn_mont_sqr_u64(len, n, mu, t11, t2);
+    Hacl_Bignum_Montgomery_bn_mont_mul_u64(len,
+      n,
+      mu,
+      aM,
+      t2,
+      table + ((uint32_t)2U * i + (uint32_t)3U) * len););
+}
+
+static inline void
+bn_table_select_consttime_u64(
+  uint32_t len,
+  uint32_t table_len,
+  const uint64_t *table,
+  uint64_t bits_l,
+  uint64_t *res
+)
+{
+  memcpy(res, (uint64_t *)table, len * sizeof (uint64_t));
+  for (uint32_t i1 = (uint32_t)1U; i1 < table_len; i1++)
+  {
+    uint64_t c = FStar_UInt64_eq_mask(bits_l, (uint64_t)i1);
+    const uint64_t *res_j = table + i1 * len;
+    for (uint32_t i = (uint32_t)0U; i < len; i++)
+    {
+      uint64_t *os = res;
+      uint64_t x = (c & res_j[i]) | (~c & res[i]);
+      os[i] = x;
+    }
+  }
+}
+
+bool
+Hacl_Bignum_MultiExponentiation_bn_multi_exp_vartime_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint32_t num,
+  uint64_t *aM,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *resM
+)
+{
+  uint32_t bLen;
+  if (bBits == (uint32_t)0U)
+  {
+    bLen = (uint32_t)1U;
+  }
+  else
+  {
+    bLen = (bBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  }
+  KRML_CHECK_SIZE(sizeof (uint64_t), len);
+  uint64_t oneM[len];
+  memset(oneM, 0U, len * sizeof (uint64_t));
+  Hacl_Bignum_Montgomery_bn_from_mont_u64(len, n, mu, r2, oneM);
+  if ((uint64_t)num * (uint64_t)16U * (uint64_t)len > (uint64_t)0xffffffffU)
+  {
+    return false;
+  }
+  KRML_CHECK_SIZE(sizeof (uint64_t), num * (uint32_t)16U * len);
+  uint64_t *table = (uint64_t *)KRML_HOST_CALLOC(num * (uint32_t)16U * len, sizeof (uint64_t));
+  if (num > (uint32_t)0U && table == NULL)
+  {
+    return false;
+  }
+  for (uint32_t i = (uint32_t)0U; i < num; i++)
+  {
+    bn_multi_exp_precomp_table_u64(len, n, mu, oneM, aM + i * len, table + i * (uint32_t)16U * len);
+  }
+  memcpy(resM, oneM, len * sizeof (uint64_t));
+  uint32_t nw = (bBits + (uint32_t)3U) / (uint32_t)4U;
+  for (uint32_t i0 = (uint32_t)0U; i0 < nw; i0++)
+  {
+    if (i0 > (uint32_t)0U)
+    {
+      KRML_MAYBE_FOR4(i,
+        (uint32_t)0U,
+        (uint32_t)4U,
+        (uint32_t)1U,
+        Hacl_Bignum_Montgomery_bn_mont_sqr_u64(len, n, mu, resM, resM););
+    }
+    uint32_t k = (nw - i0 - (uint32_t)1U) * (uint32_t)4U;
+    uint32_t l;
+    if (bBits - k < (uint32_t)4U)
+    {
+      l = bBits - k;
+    }
+    else
+    {
+      l = (uint32_t)4U;
+    }
+    for (uint32_t i = (uint32_t)0U; i < num; i++)
+    {
+      uint64_t bits_l = Hacl_Bignum_Lib_bn_get_bits_u64(bLen, b + i * bLen, k, l);
+      if (bits_l != (uint64_t)0U)
+      {
+        uint32_t bits_l32 = (uint32_t)bits_l;
+        const uint64_t *a_bits_l = table + (i * (uint32_t)16U + bits_l32) * len;
+        Hacl_Bignum_Montgomery_bn_mont_mul_u64(len, n, mu, resM, (uint64_t *)a_bits_l, resM);
+      }
+    }
+  }
+  KRML_HOST_FREE(table);
+  return true;
+}
+
+bool
+Hacl_Bignum_MultiExponentiation_bn_multi_exp_consttime_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint32_t num,
+  uint64_t *aM,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *resM
+)
+{
+  uint32_t bLen;
+  if (bBits == (uint32_t)0U)
+  {
+    bLen = (uint32_t)1U;
+  }
+  else
+  {
+    bLen = (bBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  }
+  KRML_CHECK_SIZE(sizeof (uint64_t), len);
+  uint64_t oneM[len];
+  memset(oneM, 0U, len * sizeof (uint64_t));
+  Hacl_Bignum_Montgomery_bn_from_mont_u64(len, n, mu, r2, oneM);
+  if ((uint64_t)num * (uint64_t)16U * (uint64_t)len > (uint64_t)0xffffffffU)
+  {
+    return false;
+  }
+  KRML_CHECK_SIZE(sizeof (uint64_t), num * (uint32_t)16U * len);
+  uint64_t *table = (uint64_t *)KRML_HOST_CALLOC(num * (uint32_t)16U * len, sizeof (uint64_t));
+  if (num > (uint32_t)0U && table == NULL)
+  {
+    return false;
+  }
+  for (uint32_t i = (uint32_t)0U; i < num; i++)
+  {
+    bn_multi_exp_precomp_table_u64(len, n, mu, oneM, aM + i * len, table + i * (uint32_t)16U * len);
+  }
+  KRML_CHECK_SIZE(sizeof (uint64_t), len);
+  uint64_t tmp[len];
+  memset(tmp, 0U, len * sizeof (uint64_t));
+  memcpy(resM, oneM, len * sizeof (uint64_t));
+  uint32_t nw = (bBits + (uint32_t)3U) / (uint32_t)4U;
+  for (uint32_t i0 = (uint32_t)0U; i0 < nw; i0++)
+  {
+    if (i0 > (uint32_t)0U)
+    {
+      KRML_MAYBE_FOR4(i,
+        (uint32_t)0U,
+        (uint32_t)4U,
+        (uint32_t)1U,
+        Hacl_Bignum_Montgomery_bn_mont_sqr_u64(len, n, mu, resM, resM););
+    }
+    uint32_t k = (nw - i0 - (uint32_t)1U) * (uint32_t)4U;
+    uint32_t l;
+    if (bBits - k < (uint32_t)4U)
+    {
+      l = bBits - k;
+    }
+    else
+    {
+      l = (uint32_t)4U;
+    }
+    for (uint32_t i = (uint32_t)0U; i < num; i++)
+    {
+      uint64_t bits_l = Hacl_Bignum_Lib_bn_get_bits_u64(bLen, b + i * bLen, k, l);
+      bn_table_select_consttime_u64(len, (uint32_t)16U, table + i * (uint32_t)16U * len, bits_l, tmp);
+      Hacl_Bignum_Montgomery_bn_mont_mul_u64(len, n, mu, resM, tmp, resM);
+    }
+  }
+  KRML_HOST_FREE(table);
+  return true;
+}
+
+void
+Hacl_Bignum_MultiExponentiation_bn_comb_precomp_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint32_t teeth,
+  uint32_t bBits,
+  uint64_t *gM,
+  uint64_t *table
+)
+{
+  uint32_t d = (bBits - (uint32_t)1U) / teeth + (uint32_t)1U;
+  KRML_CHECK_SIZE(sizeof (uint64_t), len);
+  uint64_t gi[len];
+  memset(gi, 0U, len * sizeof (uint64_t));
+  memcpy(gi, gM, len * sizeof (uint64_t));
+  Hacl_Bignum_Montgomery_bn_from_mont_u64(len, n, mu, r2, table);
+  for (uint32_t i0 = (uint32_t)0U; i0 < teeth; i0++)
+  {
+    uint32_t m = (uint32_t)1U << i0;
+    memcpy(table + m * len, gi, len * sizeof (uint64_t));
+    for (uint32_t i = (uint32_t)1U; i < m; i++)
+    {
+      Hacl_Bignum_Montgomery_bn_mont_mul_u64(len, n, mu, table + i * len, gi, table + (m + i) * len);
+    }
+    if (i0 + (uint32_t)1U < teeth)
+    {
+      for (uint32_t i = (uint32_t)0U; i < d; i++)
+      {
+        Hacl_Bignum_Montgomery_bn_mont_sqr_u64(len, n, mu, gi, gi);
+      }
+    }
+  }
+}
+
+static inline uint64_t
+bn_comb_get_bits_u64(uint32_t teeth, uint32_t d, uint32_t bBits, uint64_t *b, uint32_t c)
+{
+  uint64_t bits_l = (uint64_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < teeth; i++)
+  {
+    uint32_t k = i * d + c;
+    if (k < bBits)
+    {
+      uint64_t bit = b[k / (uint32_t)64U] >> k % (uint32_t)64U & (uint64_t)1U;
+      bits_l = bits_l | bit << i;
+    }
+  }
+  return bits_l;
+}
+
+void
+Hacl_Bignum_MultiExponentiation_bn_comb_exp_vartime_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint32_t teeth,
+  uint32_t bBits,
+  uint64_t *table,
+  uint64_t *b,
+  uint64_t *resM
+)
+{
+  uint32_t d = (bBits - (uint32_t)1U) / teeth + (uint32_t)1U;
+  Hacl_Bignum_Montgomery_bn_from_mont_u64(len, n, mu, r2, resM);
+  for (uint32_t i0 = (uint32_t)0U; i0 < d; i0++)
+  {
+    if (i0 > (uint32_t)0U)
+    {
+      Hacl_Bignum_Montgomery_bn_mont_sqr_u64(len, n, mu, resM, resM);
+    }
+    uint64_t bits_l = bn_comb_get_bits_u64(teeth, d, bBits, b, d - i0 - (uint32_t)1U);
+    if (bits_l != (uint64_t)0U)
+    {
+      uint32_t bits_l32 = (uint32_t)bits_l;
+      Hacl_Bignum_Montgomery_bn_mont_mul_u64(len, n, mu, resM, table + bits_l32 * len, resM);
+    }
+  }
+}
+
+void
+Hacl_Bignum_MultiExponentiation_bn_comb_exp_consttime_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint32_t teeth,
+  uint32_t bBits,
+  uint64_t *table,
+  uint64_t *b,
+  uint64_t *resM
+)
+{
+  uint32_t d = (bBits - (uint32_t)1U) / teeth + (uint32_t)1U;
+  KRML_CHECK_SIZE(sizeof (uint64_t), len);
+  uint64_t tmp[len];
+  memset(tmp, 0U, len * sizeof (uint64_t));
+  Hacl_Bignum_Montgomery_bn_from_mont_u64(len, n, mu, r2, resM);
+  for (uint32_t i0 = (uint32_t)0U; i0 < d; i0++)
+  {
+    if (i0 > (uint32_t)0U)
+    {
+      Hacl_Bignum_Montgomery_bn_mont_sqr_u64(len, n, mu, resM, resM);
+    }
+    uint64_t bits_l = bn_comb_get_bits_u64(teeth, d, bBits, b, d - i0 - (uint32_t)1U);
+    bn_table_select_consttime_u64(len, (uint32_t)1U << teeth, table, bits_l, tmp);
+    Hacl_Bignum_Montgomery_bn_mont_mul_u64(len, n, mu, resM, tmp, resM);
+  }
+}
+
@@ -606,6 +606,342 @@ Hacl_Bignum64_mod_exp_consttime_precomp(
     res);
 }
 
+/**
+Write `a[0] ^ b[0] * a[1] ^ b[1] * ... * a[num - 1] ^ b[num - 1] mod n` in `res`.
+
+  The argument a is meant to be `num * len` limbs in size, i.e. uint64_t[num * len],
+  and holds the `num` bases one after another. The outparam res is meant to be
+  `len` limbs in size, i.e. uint64_t[len].
+  The argument k is a montgomery context obtained through Hacl_Bignum64_mont_ctx_init.
+
+  The argument b is meant to be `num * bLen` limbs in size, where bLen is the
+  number of limbs needed to hold bBits bits, and holds the `num` exponents one
+  after another. All the exponents share the squarings of a single pass over
+  bBits bits, which makes this function faster than `num` calls to
+  mod_exp_vartime_precomp.
+
+  The function is *NOT* constant-time on the argument b. See the
+  mod_multi_exp_consttime_precomp function for constant-time variant.
+
+  The precomputed tables for the `num` bases are heap-allocated. The function
+  returns false if they cannot be allocated, and true otherwise.
+
+  Before calling this function, the caller will need to ensure that the following
+  preconditions are observed.
+  • b[i] < pow2 bBits for every i
+  • a[i] < n for every i
+*/
+bool
+Hacl_Bignum64_mod_multi_exp_vartime_precomp(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint32_t num,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k10 = *k;
+  uint32_t len1 = k10.len;
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  if ((uint64_t)num * (uint64_t)len1 > (uint64_t)0xffffffffU)
+  {
+    return false;
+  }
+  KRML_CHECK_SIZE(sizeof (uint64_t), num * len1);
+  uint64_t *aM = (uint64_t *)KRML_HOST_CALLOC(num * len1, sizeof (uint64_t));
+  if (num > (uint32_t)0U && aM == NULL)
+  {
+    return false;
+  }
+  for (uint32_t i = (uint32_t)0U; i < num; i++)
+  {
+    Hacl_Bignum_Montgomery_bn_to_mont_u64(len1, k1.n, k1.mu, k1.r2, a + i * len1, aM + i * len1);
+  }
+  KRML_CHECK_SIZE(sizeof (uint64_t), len1);
+  uint64_t resM[len1];
+  memset(resM, 0U, len1 * sizeof (uint64_t));
+  bool
+  r =
+    Hacl_Bignum_MultiExponentiation_bn_multi_exp_vartime_u64(len1,
+      k1.n,
+      k1.mu,
+      k1.r2,
+      num,
+      aM,
+      bBits,
+      b,
+      resM);
+  KRML_HOST_FREE(aM);
+  if (r)
+  {
+    Hacl_Bignum_Montgomery_bn_from_mont_u64(len1, k1.n, k1.mu, resM, res);
+  }
+  return r;
+}
+
+/**
+Write `a[0] ^ b[0] * a[1] ^ b[1] * ... * a[num - 1] ^ b[num - 1] mod n` in `res`.
+
+  The argument a is meant to be `num * len` limbs in size, i.e. uint64_t[num * len],
+  and holds the `num` bases one after another. The outparam res is meant to be
+  `len` limbs in size, i.e. uint64_t[len].
+  The argument k is a montgomery context obtained through Hacl_Bignum64_mont_ctx_init.
+
+  The argument b is meant to be `num * bLen` limbs in size, where bLen is the
+  number of limbs needed to hold bBits bits, and holds the `num` exponents one
+  after another.
+
+  This function is constant-time over its argument b, at the cost of a slower
+  execution time than mod_multi_exp_vartime_precomp.
+
+  The precomputed tables for the `num` bases are heap-allocated. The function
+  returns false if they cannot be allocated, and true otherwise.
+
+  Before calling this function, the caller will need to ensure that the following
+  preconditions are observed.
+  • b[i] < pow2 bBits for every i
+  • a[i] < n for every i
+*/
+bool
+Hacl_Bignum64_mod_multi_exp_consttime_precomp(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint32_t num,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k10 = *k;
+  uint32_t len1 = k10.len;
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  if ((uint64_t)num * (uint64_t)len1 > (uint64_t)0xffffffffU)
+  {
+    return false;
+  }
+  KRML_CHECK_SIZE(sizeof (uint64_t), num * len1);
+  uint64_t *aM = (uint64_t *)KRML_HOST_CALLOC(num * len1, sizeof (uint64_t));
+  if (num > (uint32_t)0U && aM == NULL)
+  {
+    return false;
+  }
+  for (uint32_t i = (uint32_t)0U; i < num; i++)
+  {
+    Hacl_Bignum_Montgomery_bn_to_mont_u64(len1, k1.n, k1.mu, k1.r2, a + i * len1, aM + i * len1);
+  }
+  KRML_CHECK_SIZE(sizeof (uint64_t), len1);
+  uint64_t resM[len1];
+  memset(resM, 0U, len1 * sizeof (uint64_t));
+  bool
+  r =
+    Hacl_Bignum_MultiExponentiation_bn_multi_exp_consttime_u64(len1,
+      k1.n,
+      k1.mu,
+      k1.r2,
+      num,
+      aM,
+      bBits,
+      b,
+      resM);
+  KRML_HOST_FREE(aM);
+  if (r)
+  {
+    Hacl_Bignum_Montgomery_bn_from_mont_u64(len1, k1.n, k1.mu, resM, res);
+  }
+  return r;
+}
+
+/**
+Heap-allocate and initialize a comb table for the fixed base `g`.
+
+  The argument g is meant to be `len` limbs in size, i.e. uint64_t[len].
+  The argument k is a montgomery context obtained through Hacl_Bignum64_mont_ctx_init.
+
+  The table holds 2 ^ 5 precomputed powers of g, so that any exponent of at most
+  bBits bits can then be applied with about bBits / 5 squarings instead of bBits.
+  It is meant to be reused across many calls to mod_exp_comb_vartime_precomp or
+  mod_exp_comb_consttime_precomp with the same base and context, e.g. for a
+  fixed generator in Diffie-Hellman or ElGamal.
+
+  The caller will need to call Hacl_Bignum64_comb_table_free on the return value
+  to avoid memory leaks.
+
+  The function returns NULL if bBits is 0 or if the allocation fails.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • g < n
+*/
+Hacl_Bignum_MontArithmetic_bn_comb_table_u64
+*Hacl_Bignum64_comb_table_init(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *g,
+  uint32_t bBits
+)
+{
+  if (bBits == (uint32_t)0U)
+  {
+    return NULL;
+  }
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k10 = *k;
+  uint32_t len1 = k10.len;
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  uint32_t teeth = (uint32_t)5U;
+  KRML_CHECK_SIZE(sizeof (uint64_t), len1);
+  uint64_t gM[len1];
+  memset(gM, 0U, len1 * sizeof (uint64_t));
+  Hacl_Bignum_Montgomery_bn_to_mont_u64(len1, k1.n, k1.mu, k1.r2, g, gM);
+  KRML_CHECK_SIZE(sizeof (uint64_t), ((uint32_t)1U << teeth) * len1);
+  uint64_t
+  *table = (uint64_t *)KRML_HOST_CALLOC(((uint32_t)1U << teeth) * len1, sizeof (uint64_t));
+  if (table == NULL)
+  {
+    return NULL;
+  }
+  Hacl_Bignum_MultiExponentiation_bn_comb_precomp_u64(len1,
+    k1.n,
+    k1.mu,
+    k1.r2,
+    teeth,
+    bBits,
+    gM,
+    table);
+  Hacl_Bignum_MontArithmetic_bn_comb_table_u64
+  res = { .len = len1, .bBits = bBits, .teeth = teeth, .table = table };
+  Hacl_Bignum_MontArithmetic_bn_comb_table_u64
+  *buf =
+    (Hacl_Bignum_MontArithmetic_bn_comb_table_u64 *)KRML_HOST_MALLOC(sizeof (
+        Hacl_Bignum_MontArithmetic_bn_comb_table_u64
+      ));
+  if (buf == NULL)
+  {
+    KRML_HOST_FREE(table);
+    return NULL;
+  }
+  buf[0U] = res;
+  return buf;
+}
+
+/**
+Deallocate the memory previously allocated by Hacl_Bignum64_comb_table_init.
+
+  The argument t is a comb table obtained through Hacl_Bignum64_comb_table_init.
+*/
+void Hacl_Bignum64_comb_table_free(Hacl_Bignum_MontArithmetic_bn_comb_table_u64 *t)
+{
+  Hacl_Bignum_MontArithmetic_bn_comb_table_u64 t1 = *t;
+  uint64_t *table = t1.table;
+  KRML_HOST_FREE(table);
+  KRML_HOST_FREE(t);
+}
+
+/**
+Write `g ^ b mod n` in `res`, where g is the base of the comb table t.
+
+  The outparam res is meant to be `len` limbs in size, i.e. uint64_t[len].
+  The argument k is a montgomery context obtained through Hacl_Bignum64_mont_ctx_init.
+  The argument t is a comb table obtained through Hacl_Bignum64_comb_table_init
+  with the same context k.
+
+  The argument b is meant to hold bBits bits, where bBits is the bound the table t
+  was initialized with, i.e. uint64_t[(bBits - 1) / 64 + 1].
+
+  The function returns false if t was initialized with a context of a different
+  length than k, and true otherwise.
+
+  The function is *NOT* constant-time on the argument b. See the
+  mod_exp_comb_consttime_precomp function for constant-time variant.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • b < pow2 bBits
+*/
+bool
+Hacl_Bignum64_mod_exp_comb_vartime_precomp(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  Hacl_Bignum_MontArithmetic_bn_comb_table_u64 *t,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k10 = *k;
+  uint32_t len1 = k10.len;
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  Hacl_Bignum_MontArithmetic_bn_comb_table_u64 t1 = *t;
+  if (t1.len != len1)
+  {
+    return false;
+  }
+  KRML_CHECK_SIZE(sizeof (uint64_t), len1);
+  uint64_t resM[len1];
+  memset(resM, 0U, len1 * sizeof (uint64_t));
+  Hacl_Bignum_MultiExponentiation_bn_comb_exp_vartime_u64(len1,
+    k1.n,
+    k1.mu,
+    k1.r2,
+    t1.teeth,
+    t1.bBits,
+    t1.table,
+    b,
+    resM);
+  Hacl_Bignum_Montgomery_bn_from_mont_u64(len1, k1.n, k1.mu, resM, res);
+  return true;
+}
+
+/**
+Write `g ^ b mod n` in `res`, where g is the base of the comb table t.
+
+  The outparam res is meant to be `len` limbs in size, i.e. uint64_t[len].
+  The argument k is a montgomery context obtained through Hacl_Bignum64_mont_ctx_init.
+  The argument t is a comb table obtained through Hacl_Bignum64_comb_table_init
+  with the same context k.
+
+  The argument b is meant to hold bBits bits, where bBits is the bound the table t
+  was initialized with, i.e. uint64_t[(bBits - 1) / 64 + 1].
+
+  The function returns false if t was initialized with a context of a different
+  length than k, and true otherwise.
+
+  This function is constant-time over its argument b, at the cost of a slower
+  execution time than mod_exp_comb_vartime_precomp.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • b < pow2 bBits
+*/
+bool
+Hacl_Bignum64_mod_exp_comb_consttime_precomp(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  Hacl_Bignum_MontArithmetic_bn_comb_table_u64 *t,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k10 = *k;
+  uint32_t len1 = k10.len;
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  Hacl_Bignum_MontArithmetic_bn_comb_table_u64 t1 = *t;
+  if (t1.len != len1)
+  {
+    return false;
+  }
+  KRML_CHECK_SIZE(sizeof (uint64_t), len1);
+  uint64_t resM[len1];
+  memset(resM, 0U, len1 * sizeof (uint64_t));
+  Hacl_Bignum_MultiExponentiation_bn_comb_exp_consttime_u64(len1,
+    k1.n,
+    k1.mu,
+    k1.r2,
+    t1.teeth,
+    t1.bBits,
+    t1.table,
+    b,
+    resM);
+  Hacl_Bignum_Montgomery_bn_from_mont_u64(len1, k1.n, k1.mu, resM, res);
+  return true;
+}
+
 /**
 Write `a ^ (-1) mod n` in `res`.
 
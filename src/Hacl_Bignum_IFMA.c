@@ -0,0 +1,431 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "internal/Hacl_Bignum_IFMA.h"
+
+#include "internal/Hacl_Bignum_Base.h"
+#include "internal/Hacl_Bignum.h"
+
+#include <immintrin.h>
+
+/* Radix 2^52 values are stored in ten zmm vectors of eight limbs. */
+#define IFMA_MAX_LIMBS 80U
+
+static const uint64_t mask52 = (uint64_t)0xfffffffffffffU;
+
+uint32_t Hacl_Bignum_IFMA_bn_radix52_len(uint32_t len)
+{
+  switch (len)
+  {
+    case 32U:
+      {
+        return (uint32_t)40U;
+      }
+    case 48U:
+      {
+        return (uint32_t)60U;
+      }
+    default:
+      {
+        return (uint32_t)79U;
+      }
+  }
+}
+
+static inline void load_radix52(uint32_t len, uint32_t k, uint64_t *a, uint64_t *res)
+{
+  memset(res, 0U, IFMA_MAX_LIMBS * sizeof (uint64_t));
+  for (uint32_t j = (uint32_t)0U; j < k; j++)
+  {
+    uint32_t off = (uint32_t)52U * j;
+    uint32_t w = off / (uint32_t)64U;
+    uint32_t s = off % (uint32_t)64U;
+    uint64_t lo = a[w] >> s;
+    uint64_t hi = (uint64_t)0U;
+    if (s > (uint32_t)12U && w + (uint32_t)1U < len)
+    {
+      hi = a[w + (uint32_t)1U] << ((uint32_t)64U - s);
+    }
+    res[j] = (lo | hi) & mask52;
+  }
+}
+
+static inline void store_radix52(uint32_t len, uint32_t k, uint64_t *a, uint64_t *res)
+{
+  uint64_t acc = (uint64_t)0U;
+  uint32_t accBits = (uint32_t)0U;
+  uint32_t i = (uint32_t)0U;
+  for (uint32_t j = (uint32_t)0U; j < k && i < len; j++)
+  {
+    acc = acc | a[j] << accBits;
+    accBits = accBits + (uint32_t)52U;
+    if (accBits >= (uint32_t)64U)
+    {
+      res[i] = acc;
+      i++;
+      accBits = accBits - (uint32_t)64U;
+      acc = a[j] >> ((uint32_t)52U - accBits);
+    }
+  }
+  if (i < len)
+  {
+    res[i] = acc;
+    i++;
+  }
+  for (uint32_t i0 = i; i0 < len; i0++)
+  {
+    res[i0] = (uint64_t)0U;
+  }
+}
+
+/*
+  Word-by-word Montgomery multiplication with one zmm accumulator per eight
+  limbs. The accumulator lanes are 64 bits wide and are only normalized at the
+  end: each of the k rounds adds at most 4 * 2^52 to a lane, which stays below
+  2^64 for k <= 79.
+*/
+static inline void
+amont_mul52(uint32_t k, uint64_t *n, uint64_t mu, uint64_t *a, uint64_t *b, uint64_t *res)
+{
+  uint32_t nv = (k + (uint32_t)7U) / (uint32_t)8U;
+  __m512i zero = _mm512_setzero_si512();
+  __m512i acc[10U];
+  __m512i av[10U];
+  __m512i nv0[10U];
+  for (uint32_t i = (uint32_t)0U; i < nv; i++)
+  {
+    acc[i] = zero;
+    av[i] = _mm512_loadu_si512((void *)(a + (uint32_t)8U * i));
+    nv0[i] = _mm512_loadu_si512((void *)(n + (uint32_t)8U * i));
+  }
+  uint64_t n0 = n[0U];
+  for (uint32_t j = (uint32_t)0U; j < k; j++)
+  {
+    __m512i bj = _mm512_set1_epi64((long long)b[j]);
+    for (uint32_t i = (uint32_t)0U; i < nv; i++)
+    {
+      acc[i] = _mm512_madd52lo_epu64(acc[i], av[i], bj);
+    }
+    uint64_t t0 = (uint64_t)_mm_cvtsi128_si64(_mm512_castsi512_si128(acc[0U]));
+    uint64_t y = t0 * mu & mask52;
+    __m512i yj = _mm512_set1_epi64((long long)y);
+    for (uint32_t i = (uint32_t)0U; i < nv; i++)
+    {
+      acc[i] = _mm512_madd52lo_epu64(acc[i], nv0[i], yj);
+    }
+    /* The lowest limb is now a multiple of 2^52: drop it and carry its top bits. */
+    uint64_t c = (t0 + (n0 * y & mask52)) >> (uint32_t)52U;
+    for (uint32_t i = (uint32_t)0U; i < nv - (uint32_t)1U; i++)
+    {
+      acc[i] = _mm512_alignr_epi64(acc[i + (uint32_t)1U], acc[i], 1);
+    }
+    acc[nv - (uint32_t)1U] = _mm512_alignr_epi64(zero, acc[nv - (uint32_t)1U], 1);
+    acc[0U] = _mm512_mask_add_epi64(acc[0U], (__mmask8)1U, acc[0U], _mm512_set1_epi64((long long)c));
+    for (uint32_t i = (uint32_t)0U; i < nv; i++)
+    {
+      acc[i] = _mm512_madd52hi_epu64(acc[i], av[i], bj);
+      acc[i] = _mm512_madd52hi_epu64(acc[i], nv0[i], yj);
+    }
+  }
+  KRML_PRE_ALIGN(64) uint64_t tmp[IFMA_MAX_LIMBS] KRML_POST_ALIGN(64) = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < nv; i++)
+  {
+    _mm512_store_si512((void *)(tmp + (uint32_t)8U * i), acc[i]);
+  }
+  uint64_t c = (uint64_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < k; i++)
+  {
+    uint64_t t = tmp[i] + c;
+    res[i] = t & mask52;
+    c = t >> (uint32_t)52U;
+  }
+  for (uint32_t i = k; i < IFMA_MAX_LIMBS; i++)
+  {
+    res[i] = (uint64_t)0U;
+  }
+}
+
+void
+Hacl_Bignum_IFMA_bn_almost_mont_mul_u52(
+  uint32_t k,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *a,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  switch (k)
+  {
+    case 40U:
+      {
+        amont_mul52((uint32_t)40U, n, mu, a, b, res);
+        break;
+      }
+    case 60U:
+      {
+        amont_mul52((uint32_t)60U, n, mu, a, b, res);
+        break;
+      }
+    default:
+      {
+        amont_mul52((uint32_t)79U, n, mu, a, b, res);
+      }
+  }
+}
+
+void
+Hacl_Bignum_IFMA_bn_almost_mont_sqr_u52(
+  uint32_t k,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *a,
+  uint64_t *res
+)
+{
+  Hacl_Bignum_IFMA_bn_almost_mont_mul_u52(k, n, mu, a, a, res);
+}
+
+/*
+  Radix 2^52 modulus, mu and R'^2 mod n, where R' = 2^(52 * k). The caller's
+  r2 is R^2 mod n for R = 2^(64 * len); R'^2 = R^2 * 2^(2 * (52 * k - 64 * len))
+  is obtained from it with a few modular doublings.
+*/
+static inline void
+precomp52(
+  uint32_t len,
+  uint32_t k,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint64_t *n52,
+  uint64_t *mu52,
+  uint64_t *r252
+)
+{
+  uint64_t r2x[64U] = { 0U };
+  memcpy(r2x, r2, len * sizeof (uint64_t));
+  uint32_t d = (uint32_t)2U * ((uint32_t)52U * k - (uint32_t)64U * len);
+  for (uint32_t i = (uint32_t)0U; i < d; i++)
+  {
+    Hacl_Bignum_bn_add_mod_n_u64(len, n, r2x, r2x, r2x);
+  }
+  load_radix52(len, k, n, n52);
+  load_radix52(len, k, r2x, r252);
+  mu52[0U] = mu & mask52;
+}
+
+/* Convert back to radix 2^64 and reduce the almost reduced result res52 <= n. */
+static inline void finish52(uint32_t len, uint32_t k, uint64_t *n, uint64_t *res52, uint64_t *res)
+{
+  uint64_t tmp[64U] = { 0U };
+  store_radix52(len, k, res52, res);
+  uint64_t c = Hacl_Bignum_Addition_bn_sub_eq_len_u64(len, res, n, tmp);
+  uint64_t m = (uint64_t)0U - c;
+  for (uint32_t i = (uint32_t)0U; i < len; i++)
+  {
+    res[i] = (m & res[i]) | (~m & tmp[i]);
+  }
+}
+
+void
+Hacl_Bignum_IFMA_bn_precomp_u52(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint64_t *n52,
+  uint64_t *mu52,
+  uint64_t *r252
+)
+{
+  precomp52(len, Hacl_Bignum_IFMA_bn_radix52_len(len), n, mu, r2, n52, mu52, r252);
+}
+
+void
+Hacl_Bignum_IFMA_bn_to_mont_u52(
+  uint32_t len,
+  uint64_t *n52,
+  uint64_t mu52,
+  uint64_t *r252,
+  uint64_t *a,
+  uint64_t *aM
+)
+{
+  uint32_t k = Hacl_Bignum_IFMA_bn_radix52_len(len);
+  KRML_PRE_ALIGN(64) uint64_t tmp[IFMA_MAX_LIMBS] KRML_POST_ALIGN(64) = { 0U };
+  load_radix52(len, k, a, tmp);
+  Hacl_Bignum_IFMA_bn_almost_mont_mul_u52(k, n52, mu52, tmp, r252, aM);
+}
+
+void
+Hacl_Bignum_IFMA_bn_from_mont_u52(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t *n52,
+  uint64_t mu52,
+  uint64_t *aM,
+  uint64_t *a
+)
+{
+  uint32_t k = Hacl_Bignum_IFMA_bn_radix52_len(len);
+  KRML_PRE_ALIGN(64) uint64_t one[IFMA_MAX_LIMBS] KRML_POST_ALIGN(64) = { 0U };
+  KRML_PRE_ALIGN(64) uint64_t tmp[IFMA_MAX_LIMBS] KRML_POST_ALIGN(64) = { 0U };
+  one[0U] = (uint64_t)1U;
+  Hacl_Bignum_IFMA_bn_almost_mont_mul_u52(k, n52, mu52, aM, one, tmp);
+  finish52(len, k, n, tmp, a);
+}
+
+void Hacl_Bignum_IFMA_bn_select_u52(uint32_t len, uint64_t *table, uint64_t i, uint64_t *res)
+{
+  __m512i sel[10U];
+  for (uint32_t l = (uint32_t)0U; l < (uint32_t)10U; l++)
+  {
+    sel[l] = _mm512_setzero_si512();
+  }
+  for (uint32_t j = (uint32_t)0U; j < len; j++)
+  {
+    uint64_t c = FStar_UInt64_eq_mask(i, (uint64_t)j);
+    __m512i m = _mm512_set1_epi64((long long)c);
+    uint64_t *tj = table + j * IFMA_MAX_LIMBS;
+    for (uint32_t l = (uint32_t)0U; l < (uint32_t)10U; l++)
+    {
+      __m512i x = _mm512_loadu_si512((void *)(tj + (uint32_t)8U * l));
+      sel[l] = _mm512_or_si512(sel[l], _mm512_and_si512(x, m));
+    }
+  }
+  for (uint32_t l = (uint32_t)0U; l < (uint32_t)10U; l++)
+  {
+    _mm512_storeu_si512((void *)(res + (uint32_t)8U * l), sel[l]);
+  }
+}
+
+static inline void
+mod_exp52(
+  bool consttime,
+  uint32_t len,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  uint32_t k = Hacl_Bignum_IFMA_bn_radix52_len(len);
+  KRML_PRE_ALIGN(64) uint64_t n52[IFMA_MAX_LIMBS] KRML_POST_ALIGN(64) = { 0U };
+  KRML_PRE_ALIGN(64) uint64_t r252[IFMA_MAX_LIMBS] KRML_POST_ALIGN(64) = { 0U };
+  uint64_t mu52 = (uint64_t)0U;
+  precomp52(len, k, n, mu, r2, n52, &mu52, r252);
+  KRML_PRE_ALIGN(64) uint64_t tmp[IFMA_MAX_LIMBS] KRML_POST_ALIGN(64) = { 0U };
+  KRML_PRE_ALIGN(64) uint64_t table[(uint32_t)16U * IFMA_MAX_LIMBS] KRML_POST_ALIGN(64) = { 0U };
+  uint64_t *t0 = table;
+  uint64_t *t1 = table + IFMA_MAX_LIMBS;
+  load_radix52(len, k, a, tmp);
+  Hacl_Bignum_IFMA_bn_almost_mont_mul_u52(k, n52, mu52, tmp, r252, t1);
+  memset(tmp, 0U, IFMA_MAX_LIMBS * sizeof (uint64_t));
+  tmp[0U] = (uint64_t)1U;
+  Hacl_Bignum_IFMA_bn_almost_mont_mul_u52(k, n52, mu52, tmp, r252, t0);
+  KRML_MAYBE_FOR7(i,
+    (uint32_t)0U,
+    (uint32_t)7U,
+    (uint32_t)1U,
+    uint64_t *t11 = table + (i + (uint32_t)1U) * IFMA_MAX_LIMBS;
+    uint64_t *t2 = table + ((uint32_t)2U * i + (uint32_t)2U) * IFMA_MAX_LIMBS;
+    uint64_t *t3 = table + ((uint32_t)2U * i + (uint32_t)3U) * IFMA_MAX_LIMBS;
+    Hacl_Bignum_IFMA_bn_almost_mont_sqr_u52(k, n52, mu52, t11, t2);
+    Hacl_Bignum_IFMA_bn_almost_mont_mul_u52(k, n52, mu52, t1, t2, t3););
+  uint32_t bLen;
+  if (bBits == (uint32_t)0U)
+  {
+    bLen = (uint32_t)1U;
+  }
+  else
+  {
+    bLen = (bBits - (uint32_t)1U) / (uint32_t)64U + (uint32_t)1U;
+  }
+  KRML_PRE_ALIGN(64) uint64_t resM[IFMA_MAX_LIMBS] KRML_POST_ALIGN(64) = { 0U };
+  uint32_t nw = (bBits + (uint32_t)3U) / (uint32_t)4U;
+  memcpy(resM, t0, IFMA_MAX_LIMBS * sizeof (uint64_t));
+  for (uint32_t i0 = (uint32_t)0U; i0 < nw; i0++)
+  {
+    if (i0 > (uint32_t)0U)
+    {
+      KRML_MAYBE_FOR4(i,
+        (uint32_t)0U,
+        (uint32_t)4U,
+        (uint32_t)1U,
+        Hacl_Bignum_IFMA_bn_almost_mont_sqr_u52(k, n52, mu52, resM, resM););
+    }
+    uint32_t i1 = (nw - i0 - (uint32_t)1U) * (uint32_t)4U;
+    uint32_t l = bBits - i1 < (uint32_t)4U ? bBits - i1 : (uint32_t)4U;
+    uint64_t bits = Hacl_Bignum_Lib_bn_get_bits_u64(bLen, b, i1, l);
+    if (consttime)
+    {
+      Hacl_Bignum_IFMA_bn_select_u52((uint32_t)16U, table, bits, tmp);
+    }
+    else
+    {
+      memcpy(tmp, table + (uint32_t)bits * IFMA_MAX_LIMBS, IFMA_MAX_LIMBS * sizeof (uint64_t));
+    }
+    Hacl_Bignum_IFMA_bn_almost_mont_mul_u52(k, n52, mu52, resM, tmp, resM);
+  }
+  memset(tmp, 0U, IFMA_MAX_LIMBS * sizeof (uint64_t));
+  tmp[0U] = (uint64_t)1U;
+  Hacl_Bignum_IFMA_bn_almost_mont_mul_u52(k, n52, mu52, resM, tmp, resM);
+  finish52(len, k, n, resM, res);
+}
+
+void
+Hacl_Bignum_IFMA_bn_mod_exp_vartime_precomp_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  mod_exp52(false, len, n, mu, r2, a, bBits, b, res);
+}
+
+void
+Hacl_Bignum_IFMA_bn_mod_exp_consttime_precomp_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  mod_exp52(true, len, n, mu, r2, a, bBits, b, res);
+}
@@ -1476,8 +1476,36 @@ static inline void point_mul_g(uint64_t *out, uint8_t *scalar)
   KRML_HOST_IGNORE(q4);
 }
 
+static inline void precomp_table_w5(uint64_t *table, uint64_t *q)
+{
+  uint64_t tmp[20U] = { 0U };
+  uint64_t *t0 = table;
+  uint64_t *t1 = table + (uint32_t)20U;
+  Hacl_Impl_Ed25519_PointConstants_make_point_inf(t0);
+  memcpy(t1, q, (uint32_t)20U * sizeof (uint64_t));
+  KRML_MAYBE_FOR15(i,
+    (uint32_t)0U,
+    (uint32_t)15U,
+    (uint32_t)1U,
+    uint64_t *t11 = table + (i + (uint32_t)1U) * (uint32_t)20U;
+    Hacl_Impl_Ed25519_PointDouble_point_double(tmp, t11);
+    memcpy(table + ((uint32_t)2U * i + (uint32_t)2U) * (uint32_t)20U,
+      tmp,
+      (uint32_t)20U * sizeof (uint64_t));
+    uint64_t *t2 = table + ((uint32_t)2U * i + (uint32_t)2U) * (uint32_t)20U;
+    Hacl_Impl_Ed25519_PointAdd_point_add(tmp, q, t2);
+    memcpy(table + ((uint32_t)2U * i + (uint32_t)3U) * (uint32_t)20U,
+      tmp,
+      (uint32_t)20U * sizeof (uint64_t)););
+}
+
 static inline void
-point_mul_g_double_vartime(uint64_t *out, uint8_t *scalar1, uint8_t *scalar2, uint64_t *q2)
+point_mul_g_double_vartime_table(
+  uint64_t *out,
+  uint8_t *scalar1,
+  uint8_t *scalar2,
+  const uint64_t *table2
+)
 {
   uint64_t tmp[28U] = { 0U };
   uint64_t *g = tmp;
@@ -1527,26 +1555,6 @@ point_mul_g_double_vartime(uint64_t *out, uint8_t *scalar1, uint8_t *scalar2, ui
     uint64_t r = u;
     uint64_t x = r;
     os[i] = x;);
-  uint64_t table2[640U] = { 0U };
-  uint64_t tmp1[20U] = { 0U };
-  uint64_t *t0 = table2;
-  uint64_t *t1 = table2 + (uint32_t)20U;
-  Hacl_Impl_Ed25519_PointConstants_make_point_inf(t0);
-  memcpy(t1, q2, (uint32_t)20U * sizeof (uint64_t));
-  KRML_MAYBE_FOR15(i,
-    (uint32_t)0U,
-    (uint32_t)15U,
-    (uint32_t)1U,
-    uint64_t *t11 = table2 + (i + (uint32_t)1U) * (uint32_t)20U;
-    Hacl_Impl_Ed25519_PointDouble_point_double(tmp1, t11);
-    memcpy(table2 + ((uint32_t)2U * i + (uint32_t)2U) * (uint32_t)20U,
-      tmp1,
-      (uint32_t)20U * sizeof (uint64_t));
-    uint64_t *t2 = table2 + ((uint32_t)2U * i + (uint32_t)2U) * (uint32_t)20U;
-    Hacl_Impl_Ed25519_PointAdd_point_add(tmp1, q2, t2);
-    memcpy(table2 + ((uint32_t)2U * i + (uint32_t)3U) * (uint32_t)20U,
-      tmp1,
-      (uint32_t)20U * sizeof (uint64_t)););
   uint64_t tmp10[20U] = { 0U };
   uint32_t i0 = (uint32_t)255U;
   uint64_t bits_c = Hacl_Bignum_Lib_bn_get_bits_u64((uint32_t)4U, bscalar1, i0, (uint32_t)5U);
@@ -1586,19 +1594,6 @@ point_mul_g_double_vartime(uint64_t *out, uint8_t *scalar1, uint8_t *scalar2, ui
   }
 }
 
-static inline void
-point_negate_mul_double_g_vartime(
-  uint64_t *out,
-  uint8_t *scalar1,
-  uint8_t *scalar2,
-  uint64_t *q2
-)
-{
-  uint64_t q2_neg[20U] = { 0U };
-  Hacl_Impl_Ed25519_PointNegate_point_negate(q2, q2_neg);
-  point_mul_g_double_vartime(out, scalar1, scalar2, q2_neg);
-}
-
 static inline void store_56(uint8_t *out, uint64_t *b)
 {
   uint64_t b0 = b[0U];
@@ -1881,6 +1876,42 @@ Hacl_Ed25519_sign(uint8_t *signature, uint8_t *private_key, uint32_t msg_len, ui
   Hacl_Ed25519_sign_expanded(signature, expanded_keys, msg_len, msg);
 }
 
+static inline bool
+verify_table(
+  uint8_t *public_key,
+  const uint64_t *table,
+  uint32_t msg_len,
+  uint8_t *msg,
+  uint8_t *signature
+)
+{
+  uint64_t r_[20U] = { 0U };
+  uint8_t *rs = signature;
+  bool b_ = Hacl_Impl_Ed25519_PointDecompress_point_decompress(r_, rs);
+  if (b_)
+  {
+    uint8_t hb[32U] = { 0U };
+    uint8_t *rs1 = signature;
+    uint8_t *sb = signature + (uint32_t)32U;
+    uint64_t tmp[5U] = { 0U };
+    load_32_bytes(tmp, sb);
+    bool b1 = gte_q(tmp);
+    bool b10 = b1;
+    if (b10)
+    {
+      return false;
+    }
+    uint64_t tmp0[5U] = { 0U };
+    sha512_modq_pre_pre2(tmp0, rs1, public_key, msg_len, msg);
+    store_56(hb, tmp0);
+    uint64_t exp_d[20U] = { 0U };
+    point_mul_g_double_vartime_table(exp_d, sb, hb, table);
+    bool b2 = Hacl_Impl_Ed25519_PointEqual_point_equal(exp_d, r_);
+    return b2;
+  }
+  return false;
+}
+
 /**
 Verify an Ed25519 signature.
 
@@ -1897,32 +1928,89 @@ Hacl_Ed25519_verify(uint8_t *public_key, uint32_t msg_len, uint8_t *msg, uint8_t
   bool b = Hacl_Impl_Ed25519_PointDecompress_point_decompress(a_, public_key);
   if (b)
   {
-    uint64_t r_[20U] = { 0U };
-    uint8_t *rs = signature;
-    bool b_ = Hacl_Impl_Ed25519_PointDecompress_point_decompress(r_, rs);
-    if (b_)
-    {
-      uint8_t hb[32U] = { 0U };
-      uint8_t *rs1 = signature;
-      uint8_t *sb = signature + (uint32_t)32U;
-      uint64_t tmp[5U] = { 0U };
-      load_32_bytes(tmp, sb);
-      bool b1 = gte_q(tmp);
-      bool b10 = b1;
-      if (b10)
-      {
-        return false;
-      }
-      uint64_t tmp0[5U] = { 0U };
-      sha512_modq_pre_pre2(tmp0, rs1, public_key, msg_len, msg);
-      store_56(hb, tmp0);
-      uint64_t exp_d[20U] = { 0U };
-      point_negate_mul_double_g_vartime(exp_d, sb, hb, a_);
-      bool b2 = Hacl_Impl_Ed25519_PointEqual_point_equal(exp_d, r_);
-      return b2;
-    }
-    return false;
+    uint64_t a_neg[20U] = { 0U };
+    Hacl_Impl_Ed25519_PointNegate_point_negate(a_, a_neg);
+    uint64_t table[640U] = { 0U };
+    precomp_table_w5(table, a_neg);
+    return verify_table(public_key, table, msg_len, msg, signature);
   }
   return false;
 }
 
+/**
+Compute the expanded public key for Ed25519 signature verification.
+
+  The function returns `true` if `public_key` is a valid encoding of a point and `false`
+  otherwise. If `false` is returned, the contents of `expanded_public_key` are unspecified
+  and must not be passed to `verify_expanded`.
+
+  The outparam `expanded_public_key` points to 644 limbs of valid memory, i.e., uint64_t[644].
+  The argument `public_key`          points to 32 bytes of valid memory, i.e., uint8_t[32].
+
+  The expanded public key holds the public key itself, followed by a table of multiples of
+  the negated, decompressed public key point.
+
+  If one needs to verify several signatures under the same public key, it is more efficient
+  to call `expand_public_key` only once and `verify_expanded` multiple times, for each
+  signature.
+*/
+bool Hacl_Ed25519_expand_public_key(uint64_t *expanded_public_key, uint8_t *public_key)
+{
+  uint64_t *pk = expanded_public_key;
+  uint64_t *table = expanded_public_key + (uint32_t)4U;
+  uint64_t a_[20U] = { 0U };
+  bool b = Hacl_Impl_Ed25519_PointDecompress_point_decompress(a_, public_key);
+  if (b)
+  {
+    KRML_MAYBE_FOR4(i,
+      (uint32_t)0U,
+      (uint32_t)4U,
+      (uint32_t)1U,
+      uint64_t *os = pk;
+      uint8_t *bj = public_key + i * (uint32_t)8U;
+      uint64_t u = load64_le(bj);
+      uint64_t r = u;
+      uint64_t x = r;
+      os[i] = x;);
+    uint64_t a_neg[20U] = { 0U };
+    Hacl_Impl_Ed25519_PointNegate_point_negate(a_, a_neg);
+    precomp_table_w5(table, a_neg);
+    return true;
+  }
+  return false;
+}
+
+/**
+Verify an Ed25519 signature with the (precomputed) expanded public key.
+
+  The function returns `true` if the signature is valid and `false` otherwise.
+
+  The argument `expanded_public_key` points to 644 limbs of valid memory, i.e., uint64_t[644].
+  The argument `msg` points to `msg_len` bytes of valid memory, i.e., uint8_t[msg_len].
+  The argument `signature`           points to 64 bytes of valid memory, i.e., uint8_t[64].
+
+  The argument `expanded_public_key` is obtained through `expand_public_key`.
+
+  If one needs to verify several signatures under the same public key, it is more efficient
+  to call `expand_public_key` only once and `verify_expanded` multiple times, for each
+  signature.
+*/
+bool
+Hacl_Ed25519_verify_expanded(
+  uint64_t *expanded_public_key,
+  uint32_t msg_len,
+  uint8_t *msg,
+  uint8_t *signature
+)
+{
+  uint64_t *pk = expanded_public_key;
+  uint64_t *table = expanded_public_key + (uint32_t)4U;
+  uint8_t public_key[32U] = { 0U };
+  KRML_MAYBE_FOR4(i,
+    (uint32_t)0U,
+    (uint32_t)4U,
+    (uint32_t)1U,
+    store64_le(public_key + i * (uint32_t)8U, pk[i]););
+  return verify_table(public_key, table, msg_len, msg, signature);
+}
+
@@ -23,11 +23,18 @@
  */
 
 
-#include "Hacl_FFDHE.h"
+#include "internal/Hacl_FFDHE.h"
 
 #include "internal/Hacl_Impl_FFDHE_Constants.h"
 #include "internal/Hacl_Bignum_Base.h"
 #include "internal/Hacl_Bignum.h"
+#include "internal/Hacl_Bignum_IFMA.h"
+#include "lib_memzero0.h"
+#include "config.h"
+
+#if defined(_MSC_VER)
+#include <windows.h>
+#endif
 
 static inline uint32_t ffdhe_len(Spec_FFDHE_ffdhe_alg a)
 {
@@ -220,6 +227,382 @@ ffdhe_compute_exp(
   Hacl_Bignum_Convert_bn_to_bytes_be_uint64(ffdhe_len(a), res_n, res);
 }
 
+/* Fixed-base exponentiation of g = 2 with a Lim-Lee comb.
+
+   The bBits-bit exponent is cut into FFDHE_COMB_TEETH rows of comb_a bits, and each
+   row into FFDHE_COMB_SUB columns of comb_b bits. Table s holds, for every m of
+   FFDHE_COMB_TEETH bits, the product over the set bits k of m of
+   g^(2^(k * comb_a + s * comb_b)). An exponentiation then costs comb_b squarings and
+   comb_a multiplications, against bBits squarings and bBits / 4 multiplications for
+   the generic 4-bit window. Table entries are selected with a constant-time scan,
+   since the index is made of secret exponent bits.
+
+   The caller picks the representation of the table: radix 2^52 for the AVX-512 IFMA
+   backend (2048- to 4096-bit groups only), radix 2^64 otherwise. Each group has one
+   context per representation. */
+
+#define FFDHE_COMB_TEETH ((uint32_t)5U)
+
+#define FFDHE_COMB_SUB ((uint32_t)4U)
+
+#define FFDHE_COMB_ENTRIES ((uint32_t)1U << FFDHE_COMB_TEETH)
+
+#define FFDHE_NUM_GROUPS ((uint32_t)5U)
+
+typedef struct ffdhe_ctx_s
+{
+  uint32_t nLen;
+  bool ifma;
+  uint32_t width;
+  uint64_t *p_r2_n;
+  uint64_t mu;
+  uint64_t *p52;
+  uint64_t mu52;
+  uint64_t *comb;
+}
+ffdhe_ctx;
+
+static inline uint32_t ffdhe_group_index(Spec_FFDHE_ffdhe_alg a)
+{
+  switch (a)
+  {
+    case Spec_FFDHE_FFDHE2048:
+      {
+        return (uint32_t)0U;
+      }
+    case Spec_FFDHE_FFDHE3072:
+      {
+        return (uint32_t)1U;
+      }
+    case Spec_FFDHE_FFDHE4096:
+      {
+        return (uint32_t)2U;
+      }
+    case Spec_FFDHE_FFDHE6144:
+      {
+        return (uint32_t)3U;
+      }
+    case Spec_FFDHE_FFDHE8192:
+      {
+        return (uint32_t)4U;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+static inline uint32_t comb_a(uint32_t bBits)
+{
+  return (bBits + FFDHE_COMB_TEETH - (uint32_t)1U) / FFDHE_COMB_TEETH;
+}
+
+static inline uint32_t comb_b(uint32_t bBits)
+{
+  return (comb_a(bBits) + FFDHE_COMB_SUB - (uint32_t)1U) / FFDHE_COMB_SUB;
+}
+
+static void comb_mul(ffdhe_ctx *ctx, uint64_t *aM, uint64_t *bM, uint64_t *resM)
+{
+  #if HACL_CAN_COMPILE_IFMA
+  if (ctx->ifma)
+  {
+    Hacl_Bignum_IFMA_bn_almost_mont_mul_u52(Hacl_Bignum_IFMA_bn_radix52_len(ctx->nLen),
+      ctx->p52,
+      ctx->mu52,
+      aM,
+      bM,
+      resM);
+    return;
+  }
+  #endif
+  Hacl_Bignum_Montgomery_bn_mont_mul_u64(ctx->nLen, ctx->p_r2_n, ctx->mu, aM, bM, resM);
+}
+
+static void comb_sqr(ffdhe_ctx *ctx, uint64_t *aM, uint64_t *resM)
+{
+  #if HACL_CAN_COMPILE_IFMA
+  if (ctx->ifma)
+  {
+    Hacl_Bignum_IFMA_bn_almost_mont_sqr_u52(Hacl_Bignum_IFMA_bn_radix52_len(ctx->nLen),
+      ctx->p52,
+      ctx->mu52,
+      aM,
+      resM);
+    return;
+  }
+  #endif
+  Hacl_Bignum_Montgomery_bn_mont_sqr_u64(ctx->nLen, ctx->p_r2_n, ctx->mu, aM, resM);
+}
+
+static void comb_select(ffdhe_ctx *ctx, uint64_t *table, uint64_t m, uint64_t *res)
+{
+  #if HACL_CAN_COMPILE_IFMA
+  if (ctx->ifma)
+  {
+    Hacl_Bignum_IFMA_bn_select_u52(FFDHE_COMB_ENTRIES, table, m, res);
+    return;
+  }
+  #endif
+  uint32_t width = ctx->width;
+  memcpy(res, table, width * sizeof (uint64_t));
+  for (uint32_t e = (uint32_t)1U; e < FFDHE_COMB_ENTRIES; e++)
+  {
+    uint64_t c = FStar_UInt64_eq_mask(m, (uint64_t)e);
+    uint64_t *te = table + e * width;
+    for (uint32_t l = (uint32_t)0U; l < width; l++)
+    {
+      res[l] = (c & te[l]) | (~c & res[l]);
+    }
+  }
+}
+
+/* Writes the Montgomery form of g and 1 in gM and oneM, which have ctx->width limbs. */
+static void comb_to_mont(ffdhe_ctx *ctx, uint64_t *gM, uint64_t *oneM)
+{
+  uint32_t nLen = ctx->nLen;
+  uint64_t *p_n = ctx->p_r2_n;
+  uint64_t *r2_n = ctx->p_r2_n + nLen;
+  KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+  uint64_t x[nLen];
+  memset(x, 0U, nLen * sizeof (uint64_t));
+  #if HACL_CAN_COMPILE_IFMA
+  if (ctx->ifma)
+  {
+    uint64_t r252[Hacl_Bignum_IFMA_MAX_LIMBS] = { 0U };
+    Hacl_Bignum_IFMA_bn_precomp_u52(nLen, p_n, ctx->mu, r2_n, ctx->p52, &ctx->mu52, r252);
+    x[0U] = (uint64_t)Hacl_Impl_FFDHE_Constants_ffdhe_g2[0U];
+    Hacl_Bignum_IFMA_bn_to_mont_u52(nLen, ctx->p52, ctx->mu52, r252, x, gM);
+    x[0U] = (uint64_t)1U;
+    Hacl_Bignum_IFMA_bn_to_mont_u52(nLen, ctx->p52, ctx->mu52, r252, x, oneM);
+    return;
+  }
+  #endif
+  x[0U] = (uint64_t)Hacl_Impl_FFDHE_Constants_ffdhe_g2[0U];
+  Hacl_Bignum_Montgomery_bn_to_mont_u64(nLen, p_n, ctx->mu, r2_n, x, gM);
+  x[0U] = (uint64_t)1U;
+  Hacl_Bignum_Montgomery_bn_to_mont_u64(nLen, p_n, ctx->mu, r2_n, x, oneM);
+}
+
+static void comb_from_mont(ffdhe_ctx *ctx, uint64_t *aM, uint64_t *res)
+{
+  #if HACL_CAN_COMPILE_IFMA
+  if (ctx->ifma)
+  {
+    Hacl_Bignum_IFMA_bn_from_mont_u52(ctx->nLen, ctx->p_r2_n, ctx->p52, ctx->mu52, aM, res);
+    return;
+  }
+  #endif
+  Hacl_Bignum_Montgomery_bn_from_mont_u64(ctx->nLen, ctx->p_r2_n, ctx->mu, aM, res);
+}
+
+static void comb_precomp(ffdhe_ctx *ctx)
+{
+  uint32_t width = ctx->width;
+  uint32_t bBits = (uint32_t)64U * ctx->nLen;
+  uint32_t a = comb_a(bBits);
+  uint32_t b = comb_b(bBits);
+  uint64_t *table = ctx->comb;
+  KRML_CHECK_SIZE(sizeof (uint64_t), width);
+  uint64_t gM[width];
+  memset(gM, 0U, width * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), width);
+  uint64_t oneM[width];
+  memset(oneM, 0U, width * sizeof (uint64_t));
+  comb_to_mont(ctx, gM, oneM);
+  /* Walk g^(2^pos) upwards and keep the powers that sit at the start of a row or
+     column: they are the single-bit entries of each table. */
+  uint32_t pos = (uint32_t)0U;
+  for (uint32_t k = (uint32_t)0U; k < FFDHE_COMB_TEETH; k++)
+  {
+    for (uint32_t s = (uint32_t)0U; s < FFDHE_COMB_SUB; s++)
+    {
+      uint32_t target = k * a + s * b;
+      for (; pos < target; pos++)
+      {
+        comb_sqr(ctx, gM, gM);
+      }
+      uint64_t *t = table + (s * FFDHE_COMB_ENTRIES + ((uint32_t)1U << k)) * width;
+      memcpy(t, gM, width * sizeof (uint64_t));
+    }
+  }
+  for (uint32_t s = (uint32_t)0U; s < FFDHE_COMB_SUB; s++)
+  {
+    uint64_t *ts = table + s * FFDHE_COMB_ENTRIES * width;
+    memcpy(ts, oneM, width * sizeof (uint64_t));
+    for (uint32_t m = (uint32_t)3U; m < FFDHE_COMB_ENTRIES; m++)
+    {
+      uint32_t low = m & ((uint32_t)0U - m);
+      if (low != m)
+      {
+        comb_mul(ctx, ts + (m - low) * width, ts + low * width, ts + m * width);
+      }
+    }
+  }
+}
+
+static void comb_exp(ffdhe_ctx *ctx, uint64_t *sk_n, uint64_t *res)
+{
+  uint32_t width = ctx->width;
+  uint32_t bBits = (uint32_t)64U * ctx->nLen;
+  uint32_t a = comb_a(bBits);
+  uint32_t b = comb_b(bBits);
+  KRML_CHECK_SIZE(sizeof (uint64_t), width);
+  uint64_t resM[width];
+  memset(resM, 0U, width * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), width);
+  uint64_t tmp[width];
+  memset(tmp, 0U, width * sizeof (uint64_t));
+  memcpy(resM, ctx->comb, width * sizeof (uint64_t));
+  for (uint32_t i = (uint32_t)0U; i < b; i++)
+  {
+    uint32_t j = b - i - (uint32_t)1U;
+    if (i > (uint32_t)0U)
+    {
+      comb_sqr(ctx, resM, resM);
+    }
+    for (uint32_t s = (uint32_t)0U; s < FFDHE_COMB_SUB; s++)
+    {
+      if (s * b + j < a)
+      {
+        uint64_t m = (uint64_t)0U;
+        for (uint32_t k = (uint32_t)0U; k < FFDHE_COMB_TEETH; k++)
+        {
+          uint32_t pos = k * a + s * b + j;
+          if (pos < bBits)
+          {
+            m = m | (sk_n[pos / (uint32_t)64U] >> pos % (uint32_t)64U & (uint64_t)1U) << k;
+          }
+        }
+        comb_select(ctx, ctx->comb + s * FFDHE_COMB_ENTRIES * width, m, tmp);
+        comb_mul(ctx, resM, tmp, resM);
+      }
+    }
+  }
+  comb_from_mont(ctx, resM, res);
+  Lib_Memzero0_memzero(resM, width, uint64_t);
+  Lib_Memzero0_memzero(tmp, width, uint64_t);
+}
+
+/* Whether the IFMA table is used for group a when the caller asks for it. */
+static bool ffdhe_use_ifma(Spec_FFDHE_ffdhe_alg a, bool ifma)
+{
+  #if HACL_CAN_COMPILE_IFMA
+  uint32_t nLen = (ffdhe_len(a) - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  return ifma && Hacl_Bignum_IFMA_bn_len_is_supported(nLen);
+  #else
+  KRML_HOST_IGNORE(a);
+  KRML_HOST_IGNORE(ifma);
+  return false;
+  #endif
+}
+
+static ffdhe_ctx *ffdhe_ctx_new(Spec_FFDHE_ffdhe_alg a, bool ifma)
+{
+  uint32_t nLen = (ffdhe_len(a) - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
+  uint32_t width = nLen;
+  uint32_t p52Len = (uint32_t)0U;
+  #if HACL_CAN_COMPILE_IFMA
+  if (ifma)
+  {
+    width = Hacl_Bignum_IFMA_MAX_LIMBS;
+    p52Len = Hacl_Bignum_IFMA_MAX_LIMBS;
+  }
+  #endif
+  ffdhe_ctx *ctx = (ffdhe_ctx *)KRML_HOST_CALLOC((uint32_t)1U, sizeof (ffdhe_ctx));
+  if (ctx == NULL)
+  {
+    return NULL;
+  }
+  uint32_t bufLen = nLen + nLen + p52Len + FFDHE_COMB_SUB * FFDHE_COMB_ENTRIES * width;
+  uint64_t *buf = (uint64_t *)KRML_HOST_CALLOC(bufLen, sizeof (uint64_t));
+  if (buf == NULL)
+  {
+    KRML_HOST_FREE(ctx);
+    return NULL;
+  }
+  ctx->nLen = nLen;
+  ctx->ifma = ifma;
+  ctx->width = width;
+  ctx->p_r2_n = buf;
+  ctx->p52 = buf + nLen + nLen;
+  ctx->comb = buf + nLen + nLen + p52Len;
+  ffdhe_precomp_p(a, ctx->p_r2_n);
+  ctx->mu = Hacl_Bignum_ModInvLimb_mod_inv_uint64(ctx->p_r2_n[0U]);
+  comb_precomp(ctx);
+  return ctx;
+}
+
+static void ffdhe_ctx_free(ffdhe_ctx *ctx)
+{
+  KRML_HOST_FREE(ctx->p_r2_n);
+  KRML_HOST_FREE(ctx);
+}
+
+/* One context per group and representation, built on first use and shared by all
+   threads for the lifetime of the process. Concurrent first calls may each build a
+   context; the loser of the compare-and-swap frees its copy. */
+
+static ffdhe_ctx *ffdhe_cache[(uint32_t)2U * FFDHE_NUM_GROUPS] = { NULL };
+
+#if defined(_MSC_VER)
+
+static ffdhe_ctx *cache_load(ffdhe_ctx **slot)
+{
+  return (ffdhe_ctx *)InterlockedCompareExchangePointer((PVOID volatile *)slot, NULL, NULL);
+}
+
+static bool cache_publish(ffdhe_ctx **slot, ffdhe_ctx *ctx)
+{
+  return InterlockedCompareExchangePointer((PVOID volatile *)slot, ctx, NULL) == NULL;
+}
+
+#else
+
+static ffdhe_ctx *cache_load(ffdhe_ctx **slot)
+{
+  return __atomic_load_n(slot, __ATOMIC_ACQUIRE);
+}
+
+static bool cache_publish(ffdhe_ctx **slot, ffdhe_ctx *ctx)
+{
+  ffdhe_ctx *expected = NULL;
+  return
+    __atomic_compare_exchange_n(slot,
+      &expected,
+      ctx,
+      false,
+      __ATOMIC_ACQ_REL,
+      __ATOMIC_ACQUIRE);
+}
+
+#endif
+
+static ffdhe_ctx *ffdhe_get_ctx(Spec_FFDHE_ffdhe_alg a, bool ifma)
+{
+  bool use_ifma = ffdhe_use_ifma(a, ifma);
+  uint32_t i = ffdhe_group_index(a) + (use_ifma ? FFDHE_NUM_GROUPS : (uint32_t)0U);
+  ffdhe_ctx **slot = &ffdhe_cache[i];
+  ffdhe_ctx *ctx = cache_load(slot);
+  if (ctx != NULL)
+  {
+    return ctx;
+  }
+  ctx = ffdhe_ctx_new(a, use_ifma);
+  if (ctx == NULL)
+  {
+    return NULL;
+  }
+  if (!cache_publish(slot, ctx))
+  {
+    ffdhe_ctx_free(ctx);
+    return cache_load(slot);
+  }
+  return ctx;
+}
+
 uint32_t Hacl_FFDHE_ffdhe_len(Spec_FFDHE_ffdhe_alg a)
 {
   return ffdhe_len(a);
@@ -240,9 +623,10 @@ uint64_t *Hacl_FFDHE_new_ffdhe_precomp_p(Spec_FFDHE_ffdhe_alg a)
   return res2;
 }
 
-void
-Hacl_FFDHE_ffdhe_secret_to_public_precomp(
+static void
+secret_to_public_precomp(
   Spec_FFDHE_ffdhe_alg a,
+  bool ifma,
   uint64_t *p_r2_n,
   uint8_t *sk,
   uint8_t *pk
@@ -251,6 +635,21 @@ Hacl_FFDHE_ffdhe_secret_to_public_precomp(
   uint32_t len = ffdhe_len(a);
   uint32_t nLen = (len - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
   KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+  uint64_t sk_n[nLen];
+  memset(sk_n, 0U, nLen * sizeof (uint64_t));
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(len, sk, sk_n);
+  ffdhe_ctx *ctx = ffdhe_get_ctx(a, ifma);
+  if (ctx != NULL)
+  {
+    KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+    uint64_t res_n[nLen];
+    memset(res_n, 0U, nLen * sizeof (uint64_t));
+    comb_exp(ctx, sk_n, res_n);
+    Hacl_Bignum_Convert_bn_to_bytes_be_uint64(len, res_n, pk);
+    Lib_Memzero0_memzero(sk_n, nLen, uint64_t);
+    return;
+  }
+  KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
   uint64_t g_n[nLen];
   memset(g_n, 0U, nLen * sizeof (uint64_t));
   uint8_t g = (uint8_t)0U;
@@ -260,22 +659,52 @@ Hacl_FFDHE_ffdhe_secret_to_public_precomp(
     os[0U] = x;
   }
   Hacl_Bignum_Convert_bn_from_bytes_be_uint64((uint32_t)1U, &g, g_n);
-  KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
-  uint64_t sk_n[nLen];
-  memset(sk_n, 0U, nLen * sizeof (uint64_t));
-  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(len, sk, sk_n);
   ffdhe_compute_exp(a, p_r2_n, sk_n, g_n, pk);
+  Lib_Memzero0_memzero(sk_n, nLen, uint64_t);
 }
 
-void Hacl_FFDHE_ffdhe_secret_to_public(Spec_FFDHE_ffdhe_alg a, uint8_t *sk, uint8_t *pk)
+static void secret_to_public(Spec_FFDHE_ffdhe_alg a, bool ifma, uint8_t *sk, uint8_t *pk)
 {
+  ffdhe_ctx *ctx = ffdhe_get_ctx(a, ifma);
+  if (ctx != NULL)
+  {
+    secret_to_public_precomp(a, ifma, ctx->p_r2_n, sk, pk);
+    return;
+  }
   uint32_t len = ffdhe_len(a);
   uint32_t nLen = (len - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
   KRML_CHECK_SIZE(sizeof (uint64_t), nLen + nLen);
   uint64_t p_r2_n[nLen + nLen];
   memset(p_r2_n, 0U, (nLen + nLen) * sizeof (uint64_t));
   ffdhe_precomp_p(a, p_r2_n);
-  Hacl_FFDHE_ffdhe_secret_to_public_precomp(a, p_r2_n, sk, pk);
+  secret_to_public_precomp(a, ifma, p_r2_n, sk, pk);
+}
+
+void
+Hacl_FFDHE_ffdhe_secret_to_public_precomp(
+  Spec_FFDHE_ffdhe_alg a,
+  uint64_t *p_r2_n,
+  uint8_t *sk,
+  uint8_t *pk
+)
+{
+  secret_to_public_precomp(a, false, p_r2_n, sk, pk);
+}
+
+void Hacl_FFDHE_ffdhe_secret_to_public(Spec_FFDHE_ffdhe_alg a, uint8_t *sk, uint8_t *pk)
+{
+  secret_to_public(a, false, sk, pk);
+}
+
+void
+Hacl_FFDHE_ffdhe_secret_to_public_impl(
+  Spec_FFDHE_ffdhe_alg a,
+  bool ifma,
+  uint8_t *sk,
+  uint8_t *pk
+)
+{
+  secret_to_public(a, ifma, sk, pk);
 }
 
 uint64_t
@@ -309,6 +738,11 @@ Hacl_FFDHE_ffdhe_shared_secret_precomp(
 uint64_t
 Hacl_FFDHE_ffdhe_shared_secret(Spec_FFDHE_ffdhe_alg a, uint8_t *sk, uint8_t *pk, uint8_t *ss)
 {
+  ffdhe_ctx *ctx = ffdhe_get_ctx(a, false);
+  if (ctx != NULL)
+  {
+    return Hacl_FFDHE_ffdhe_shared_secret_precomp(a, ctx->p_r2_n, sk, pk, ss);
+  }
   uint32_t len = ffdhe_len(a);
   uint32_t nLen = (len - (uint32_t)1U) / (uint32_t)8U + (uint32_t)1U;
   KRML_CHECK_SIZE(sizeof (uint64_t), nLen + nLen);
@@ -23,7 +23,7 @@
  */
 
 
-#include "Hacl_Frodo1344.h"
+#include "internal/Hacl_Frodo1344.h"
 
 #include "internal/Hacl_Spec.h"
 #include "internal/Hacl_Frodo_KEM.h"
@@ -37,7 +37,8 @@ uint32_t Hacl_Frodo1344_crypto_secretkeybytes = (uint32_t)43088U;
 
 uint32_t Hacl_Frodo1344_crypto_ciphertextbytes = (uint32_t)21632U;
 
-uint32_t Hacl_Frodo1344_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
+uint32_t
+Hacl_Frodo1344_crypto_kem_keypair_impl(Hacl_Impl_Frodo_Params_impl impl, uint8_t *pk, uint8_t *sk)
 {
   uint8_t coins[80U] = { 0U };
   randombytes_((uint32_t)80U, coins);
@@ -62,19 +63,13 @@ uint32_t Hacl_Frodo1344_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
     r + (uint32_t)21504U,
     e_matrix);
   uint16_t b_matrix[10752U] = { 0U };
-  KRML_CHECK_SIZE(sizeof (uint16_t), (uint32_t)1806336U);
-  uint16_t a_matrix[1806336U] = { 0U };
-  Hacl_Impl_Frodo_Params_frodo_gen_matrix(Spec_Frodo_Params_SHAKE128,
+  Hacl_Impl_Frodo_Params_frodo_mul_add_as_plus_e(impl,
+    Spec_Frodo_Params_SHAKE128,
     (uint32_t)1344U,
     seed_a,
-    a_matrix);
-  Hacl_Impl_Matrix_matrix_mul_s((uint32_t)1344U,
-    (uint32_t)1344U,
-    (uint32_t)8U,
-    a_matrix,
     s_matrix,
+    e_matrix,
     b_matrix);
-  Hacl_Impl_Matrix_matrix_add((uint32_t)1344U, (uint32_t)8U, b_matrix, e_matrix);
   Hacl_Impl_Frodo_Pack_frodo_pack((uint32_t)1344U,
     (uint32_t)8U,
     (uint32_t)16U,
@@ -92,7 +87,18 @@ uint32_t Hacl_Frodo1344_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
   return (uint32_t)0U;
 }
 
-uint32_t Hacl_Frodo1344_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
+uint32_t Hacl_Frodo1344_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
+{
+  return Hacl_Frodo1344_crypto_kem_keypair_impl(Hacl_Impl_Frodo_Params_portable, pk, sk);
+}
+
+uint32_t
+Hacl_Frodo1344_crypto_kem_enc_impl(
+  Hacl_Impl_Frodo_Params_impl impl,
+  uint8_t *ct,
+  uint8_t *ss,
+  uint8_t *pk
+)
 {
   uint8_t coins[32U] = { 0U };
   randombytes_((uint32_t)32U, coins);
@@ -126,19 +132,13 @@ uint32_t Hacl_Frodo1344_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
   uint8_t *c1 = ct;
   uint8_t *c2 = ct + (uint32_t)21504U;
   uint16_t bp_matrix[10752U] = { 0U };
-  KRML_CHECK_SIZE(sizeof (uint16_t), (uint32_t)1806336U);
-  uint16_t a_matrix[1806336U] = { 0U };
-  Hacl_Impl_Frodo_Params_frodo_gen_matrix(Spec_Frodo_Params_SHAKE128,
+  Hacl_Impl_Frodo_Params_frodo_mul_add_sa_plus_e(impl,
+    Spec_Frodo_Params_SHAKE128,
     (uint32_t)1344U,
     seed_a,
-    a_matrix);
-  Hacl_Impl_Matrix_matrix_mul((uint32_t)8U,
-    (uint32_t)1344U,
-    (uint32_t)1344U,
     sp_matrix,
-    a_matrix,
+    ep_matrix,
     bp_matrix);
-  Hacl_Impl_Matrix_matrix_add((uint32_t)8U, (uint32_t)1344U, bp_matrix, ep_matrix);
   Hacl_Impl_Frodo_Pack_frodo_pack((uint32_t)8U, (uint32_t)1344U, (uint32_t)16U, bp_matrix, c1);
   uint16_t v_matrix[64U] = { 0U };
   uint16_t b_matrix[10752U] = { 0U };
@@ -176,7 +176,18 @@ uint32_t Hacl_Frodo1344_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
   return (uint32_t)0U;
 }
 
-uint32_t Hacl_Frodo1344_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
+uint32_t Hacl_Frodo1344_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
+{
+  return Hacl_Frodo1344_crypto_kem_enc_impl(Hacl_Impl_Frodo_Params_portable, ct, ss, pk);
+}
+
+uint32_t
+Hacl_Frodo1344_crypto_kem_dec_impl(
+  Hacl_Impl_Frodo_Params_impl impl,
+  uint8_t *ss,
+  uint8_t *ct,
+  uint8_t *sk
+)
 {
   uint16_t bp_matrix[10752U] = { 0U };
   uint16_t c_matrix[64U] = { 0U };
@@ -238,19 +249,13 @@ uint32_t Hacl_Frodo1344_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
   uint8_t *pk = sk + (uint32_t)32U;
   uint8_t *seed_a = pk;
   uint8_t *b = pk + (uint32_t)16U;
-  KRML_CHECK_SIZE(sizeof (uint16_t), (uint32_t)1806336U);
-  uint16_t a_matrix[1806336U] = { 0U };
-  Hacl_Impl_Frodo_Params_frodo_gen_matrix(Spec_Frodo_Params_SHAKE128,
+  Hacl_Impl_Frodo_Params_frodo_mul_add_sa_plus_e(impl,
+    Spec_Frodo_Params_SHAKE128,
     (uint32_t)1344U,
     seed_a,
-    a_matrix);
-  Hacl_Impl_Matrix_matrix_mul((uint32_t)8U,
-    (uint32_t)1344U,
-    (uint32_t)1344U,
     sp_matrix,
-    a_matrix,
+    ep_matrix,
     bpp_matrix);
-  Hacl_Impl_Matrix_matrix_add((uint32_t)8U, (uint32_t)1344U, bpp_matrix, ep_matrix);
   uint16_t b_matrix[10752U] = { 0U };
   Hacl_Impl_Frodo_Pack_frodo_unpack((uint32_t)1344U, (uint32_t)8U, (uint32_t)16U, b, b_matrix);
   Hacl_Impl_Matrix_matrix_mul((uint32_t)8U,
@@ -299,3 +304,8 @@ uint32_t Hacl_Frodo1344_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
   return (uint32_t)0U;
 }
 
+uint32_t Hacl_Frodo1344_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
+{
+  return Hacl_Frodo1344_crypto_kem_dec_impl(Hacl_Impl_Frodo_Params_portable, ss, ct, sk);
+}
+
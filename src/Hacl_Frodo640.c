@@ -23,7 +23,7 @@
  */
 
 
-#include "Hacl_Frodo640.h"
+#include "internal/Hacl_Frodo640.h"
 
 #include "internal/Hacl_Spec.h"
 #include "internal/Hacl_Frodo_KEM.h"
@@ -37,7 +37,8 @@ uint32_t Hacl_Frodo640_crypto_secretkeybytes = (uint32_t)19888U;
 
 uint32_t Hacl_Frodo640_crypto_ciphertextbytes = (uint32_t)9720U;
 
-uint32_t Hacl_Frodo640_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
+uint32_t
+Hacl_Frodo640_crypto_kem_keypair_impl(Hacl_Impl_Frodo_Params_impl impl, uint8_t *pk, uint8_t *sk)
 {
   uint8_t coins[48U] = { 0U };
   randombytes_((uint32_t)48U, coins);
@@ -62,19 +63,13 @@ uint32_t Hacl_Frodo640_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
     r + (uint32_t)10240U,
     e_matrix);
   uint16_t b_matrix[5120U] = { 0U };
-  KRML_CHECK_SIZE(sizeof (uint16_t), (uint32_t)409600U);
-  uint16_t a_matrix[409600U] = { 0U };
-  Hacl_Impl_Frodo_Params_frodo_gen_matrix(Spec_Frodo_Params_SHAKE128,
+  Hacl_Impl_Frodo_Params_frodo_mul_add_as_plus_e(impl,
+    Spec_Frodo_Params_SHAKE128,
     (uint32_t)640U,
     seed_a,
-    a_matrix);
-  Hacl_Impl_Matrix_matrix_mul_s((uint32_t)640U,
-    (uint32_t)640U,
-    (uint32_t)8U,
-    a_matrix,
     s_matrix,
+    e_matrix,
     b_matrix);
-  Hacl_Impl_Matrix_matrix_add((uint32_t)640U, (uint32_t)8U, b_matrix, e_matrix);
   Hacl_Impl_Frodo_Pack_frodo_pack((uint32_t)640U,
     (uint32_t)8U,
     (uint32_t)15U,
@@ -92,7 +87,18 @@ uint32_t Hacl_Frodo640_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
   return (uint32_t)0U;
 }
 
-uint32_t Hacl_Frodo640_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
+uint32_t Hacl_Frodo640_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
+{
+  return Hacl_Frodo640_crypto_kem_keypair_impl(Hacl_Impl_Frodo_Params_portable, pk, sk);
+}
+
+uint32_t
+Hacl_Frodo640_crypto_kem_enc_impl(
+  Hacl_Impl_Frodo_Params_impl impl,
+  uint8_t *ct,
+  uint8_t *ss,
+  uint8_t *pk
+)
 {
   uint8_t coins[16U] = { 0U };
   randombytes_((uint32_t)16U, coins);
@@ -126,19 +132,13 @@ uint32_t Hacl_Frodo640_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
   uint8_t *c1 = ct;
   uint8_t *c2 = ct + (uint32_t)9600U;
   uint16_t bp_matrix[5120U] = { 0U };
-  KRML_CHECK_SIZE(sizeof (uint16_t), (uint32_t)409600U);
-  uint16_t a_matrix[409600U] = { 0U };
-  Hacl_Impl_Frodo_Params_frodo_gen_matrix(Spec_Frodo_Params_SHAKE128,
+  Hacl_Impl_Frodo_Params_frodo_mul_add_sa_plus_e(impl,
+    Spec_Frodo_Params_SHAKE128,
     (uint32_t)640U,
     seed_a,
-    a_matrix);
-  Hacl_Impl_Matrix_matrix_mul((uint32_t)8U,
-    (uint32_t)640U,
-    (uint32_t)640U,
     sp_matrix,
-    a_matrix,
+    ep_matrix,
     bp_matrix);
-  Hacl_Impl_Matrix_matrix_add((uint32_t)8U, (uint32_t)640U, bp_matrix, ep_matrix);
   Hacl_Impl_Frodo_Pack_frodo_pack((uint32_t)8U, (uint32_t)640U, (uint32_t)15U, bp_matrix, c1);
   uint16_t v_matrix[64U] = { 0U };
   uint16_t b_matrix[5120U] = { 0U };
@@ -176,7 +176,18 @@ uint32_t Hacl_Frodo640_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
   return (uint32_t)0U;
 }
 
-uint32_t Hacl_Frodo640_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
+uint32_t Hacl_Frodo640_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
+{
+  return Hacl_Frodo640_crypto_kem_enc_impl(Hacl_Impl_Frodo_Params_portable, ct, ss, pk);
+}
+
+uint32_t
+Hacl_Frodo640_crypto_kem_dec_impl(
+  Hacl_Impl_Frodo_Params_impl impl,
+  uint8_t *ss,
+  uint8_t *ct,
+  uint8_t *sk
+)
 {
   uint16_t bp_matrix[5120U] = { 0U };
   uint16_t c_matrix[64U] = { 0U };
@@ -238,19 +249,13 @@ uint32_t Hacl_Frodo640_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
   uint8_t *pk = sk + (uint32_t)16U;
   uint8_t *seed_a = pk;
   uint8_t *b = pk + (uint32_t)16U;
-  KRML_CHECK_SIZE(sizeof (uint16_t), (uint32_t)409600U);
-  uint16_t a_matrix[409600U] = { 0U };
-  Hacl_Impl_Frodo_Params_frodo_gen_matrix(Spec_Frodo_Params_SHAKE128,
+  Hacl_Impl_Frodo_Params_frodo_mul_add_sa_plus_e(impl,
+    Spec_Frodo_Params_SHAKE128,
     (uint32_t)640U,
     seed_a,
-    a_matrix);
-  Hacl_Impl_Matrix_matrix_mul((uint32_t)8U,
-    (uint32_t)640U,
-    (uint32_t)640U,
     sp_matrix,
-    a_matrix,
+    ep_matrix,
     bpp_matrix);
-  Hacl_Impl_Matrix_matrix_add((uint32_t)8U, (uint32_t)640U, bpp_matrix, ep_matrix);
   uint16_t b_matrix[5120U] = { 0U };
   Hacl_Impl_Frodo_Pack_frodo_unpack((uint32_t)640U, (uint32_t)8U, (uint32_t)15U, b, b_matrix);
   Hacl_Impl_Matrix_matrix_mul((uint32_t)8U,
@@ -300,3 +305,8 @@ uint32_t Hacl_Frodo640_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
   return (uint32_t)0U;
 }
 
+uint32_t Hacl_Frodo640_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
+{
+  return Hacl_Frodo640_crypto_kem_dec_impl(Hacl_Impl_Frodo_Params_portable, ss, ct, sk);
+}
+
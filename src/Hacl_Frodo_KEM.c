@@ -27,9 +27,180 @@
 
 #include "internal/Hacl_Spec.h"
 #include "internal/Hacl_Krmllib.h"
+#include "config.h"
 
 void randombytes_(uint32_t len, uint8_t *res)
 {
   KRML_HOST_IGNORE(Lib_RandomBuffer_System_randombytes(res, len));
 }
 
+
+/* Rows of A generated per step of the streaming products. A multiple of 4 for the
+ * 4-way SHAKE128 generator; every Frodo n is a multiple of 8. */
+#define FRODO_ROW_BLOCK ((uint32_t)8U)
+
+static void
+mul_as_rows(
+  Hacl_Impl_Frodo_Params_matrix matrix,
+  uint32_t n,
+  uint32_t nrows,
+  uint16_t *a,
+  uint16_t *s,
+  uint16_t *b
+)
+{
+  #if HACL_CAN_COMPILE_VEC256 && (TARGET_ARCHITECTURE == TARGET_ARCHITECTURE_ID_X64 || TARGET_ARCHITECTURE == TARGET_ARCHITECTURE_ID_X86)
+  if (matrix == Hacl_Impl_Frodo_Params_Vec256)
+  {
+    Hacl_Impl_Frodo_Matrix_Vec256_mul_as_rows(n, nrows, a, s, b);
+    return;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC128 && (TARGET_ARCHITECTURE == TARGET_ARCHITECTURE_ID_X64 || TARGET_ARCHITECTURE == TARGET_ARCHITECTURE_ID_X86 || TARGET_ARCHITECTURE == TARGET_ARCHITECTURE_ID_ARM64)
+  if (matrix == Hacl_Impl_Frodo_Params_Vec128)
+  {
+    Hacl_Impl_Frodo_Matrix_Vec128_mul_as_rows(n, nrows, a, s, b);
+    return;
+  }
+  #endif
+  KRML_HOST_IGNORE(matrix);
+  for (uint32_t r = (uint32_t)0U; r < nrows; r++)
+  {
+    for (uint32_t k = (uint32_t)0U; k < (uint32_t)8U; k++)
+    {
+      uint32_t res = (uint32_t)b[r * (uint32_t)8U + k];
+      for (uint32_t j = (uint32_t)0U; j < n; j++)
+      {
+        res = res + (uint32_t)a[r * n + j] * (uint32_t)s[k * n + j];
+      }
+      b[r * (uint32_t)8U + k] = (uint16_t)res;
+    }
+  }
+}
+
+static void
+mul_sa_rows(
+  Hacl_Impl_Frodo_Params_matrix matrix,
+  uint32_t n,
+  uint32_t nrows,
+  uint16_t *a,
+  uint16_t *sp,
+  uint16_t *bp
+)
+{
+  #if HACL_CAN_COMPILE_VEC256 && (TARGET_ARCHITECTURE == TARGET_ARCHITECTURE_ID_X64 || TARGET_ARCHITECTURE == TARGET_ARCHITECTURE_ID_X86)
+  if (matrix == Hacl_Impl_Frodo_Params_Vec256)
+  {
+    Hacl_Impl_Frodo_Matrix_Vec256_mul_sa_rows(n, nrows, a, sp, bp);
+    return;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC128 && (TARGET_ARCHITECTURE == TARGET_ARCHITECTURE_ID_X64 || TARGET_ARCHITECTURE == TARGET_ARCHITECTURE_ID_X86 || TARGET_ARCHITECTURE == TARGET_ARCHITECTURE_ID_ARM64)
+  if (matrix == Hacl_Impl_Frodo_Params_Vec128)
+  {
+    Hacl_Impl_Frodo_Matrix_Vec128_mul_sa_rows(n, nrows, a, sp, bp);
+    return;
+  }
+  #endif
+  KRML_HOST_IGNORE(matrix);
+  for (uint32_t k = (uint32_t)0U; k < (uint32_t)8U; k++)
+  {
+    for (uint32_t r = (uint32_t)0U; r < nrows; r++)
+    {
+      uint16_t c = sp[k * n + r];
+      for (uint32_t j = (uint32_t)0U; j < n; j++)
+      {
+        bp[k * n + j] = (uint16_t)((uint32_t)bp[k * n + j] + (uint32_t)c * (uint32_t)a[r * n + j]);
+      }
+    }
+  }
+}
+
+static void
+gen_rows(
+  Hacl_Impl_Frodo_Params_impl impl,
+  Spec_Frodo_Params_frodo_gen_a a,
+  uint32_t n,
+  uint8_t *seed,
+  uint8_t *key,
+  uint32_t i,
+  uint16_t *res
+)
+{
+  switch (a)
+  {
+    case Spec_Frodo_Params_SHAKE128:
+      {
+        for (uint32_t i0 = (uint32_t)0U; i0 < FRODO_ROW_BLOCK / (uint32_t)4U; i0++)
+        {
+          Hacl_Impl_Frodo_Gen_frodo_gen_rows_shake_4x(n,
+            seed,
+            i / (uint32_t)4U + i0,
+            res + (uint32_t)4U * i0 * n);
+        }
+        break;
+      }
+    case Spec_Frodo_Params_AES128:
+      {
+        Hacl_Impl_Frodo_Gen_frodo_gen_rows_aes(impl.aesni, n, key, i, FRODO_ROW_BLOCK, res);
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+void
+Hacl_Impl_Frodo_Params_frodo_mul_add_as_plus_e(
+  Hacl_Impl_Frodo_Params_impl impl,
+  Spec_Frodo_Params_frodo_gen_a a,
+  uint32_t n,
+  uint8_t *seed,
+  uint16_t *s,
+  uint16_t *e,
+  uint16_t *b
+)
+{
+  uint8_t key[176U] = { 0U };
+  if (a == Spec_Frodo_Params_AES128)
+  {
+    Hacl_AES128_aes128_key_expansion(impl.aesni, seed, key);
+  }
+  KRML_CHECK_SIZE(sizeof (uint16_t), FRODO_ROW_BLOCK * n);
+  uint16_t a_rows[FRODO_ROW_BLOCK * n];
+  memcpy(b, e, n * (uint32_t)8U * sizeof (uint16_t));
+  for (uint32_t i = (uint32_t)0U; i < n; i = i + FRODO_ROW_BLOCK)
+  {
+    gen_rows(impl, a, n, seed, key, i, a_rows);
+    mul_as_rows(impl.matrix, n, FRODO_ROW_BLOCK, a_rows, s, b + i * (uint32_t)8U);
+  }
+}
+
+void
+Hacl_Impl_Frodo_Params_frodo_mul_add_sa_plus_e(
+  Hacl_Impl_Frodo_Params_impl impl,
+  Spec_Frodo_Params_frodo_gen_a a,
+  uint32_t n,
+  uint8_t *seed,
+  uint16_t *sp,
+  uint16_t *ep,
+  uint16_t *bp
+)
+{
+  uint8_t key[176U] = { 0U };
+  if (a == Spec_Frodo_Params_AES128)
+  {
+    Hacl_AES128_aes128_key_expansion(impl.aesni, seed, key);
+  }
+  KRML_CHECK_SIZE(sizeof (uint16_t), FRODO_ROW_BLOCK * n);
+  uint16_t a_rows[FRODO_ROW_BLOCK * n];
+  memcpy(bp, ep, (uint32_t)8U * n * sizeof (uint16_t));
+  for (uint32_t i = (uint32_t)0U; i < n; i = i + FRODO_ROW_BLOCK)
+  {
+    gen_rows(impl, a, n, seed, key, i, a_rows);
+    mul_sa_rows(impl.matrix, n, FRODO_ROW_BLOCK, a_rows, sp + i, bp);
+  }
+}
@@ -26,6 +26,7 @@
 #include "Hacl_HPKE_Curve51_CP128_SHA256.h"
 
 #include "internal/Hacl_Krmllib.h"
+#include "lib_memzero0.h"
 
 uint32_t
 Hacl_HPKE_Curve51_CP128_SHA256_setupBaseS(
@@ -712,3 +713,834 @@ Hacl_HPKE_Curve51_CP128_SHA256_openBase(
   return (uint32_t)1U;
 }
 
+Hacl_Impl_HPKE_context_s Hacl_HPKE_Curve51_CP128_SHA256_context_malloc(void)
+{
+  uint8_t *ctx_key = (uint8_t *)KRML_HOST_CALLOC((uint32_t)32U, sizeof (uint8_t));
+  uint8_t *ctx_nonce = (uint8_t *)KRML_HOST_CALLOC((uint32_t)12U, sizeof (uint8_t));
+  uint64_t *ctx_seq = (uint64_t *)KRML_HOST_CALLOC((uint32_t)1U, sizeof (uint64_t));
+  uint8_t *ctx_exporter = (uint8_t *)KRML_HOST_CALLOC((uint32_t)32U, sizeof (uint8_t));
+  return
+    (
+      (Hacl_Impl_HPKE_context_s){
+        .ctx_key = ctx_key,
+        .ctx_nonce = ctx_nonce,
+        .ctx_seq = ctx_seq,
+        .ctx_exporter = ctx_exporter
+      }
+    );
+}
+
+void Hacl_HPKE_Curve51_CP128_SHA256_context_free(Hacl_Impl_HPKE_context_s ctx)
+{
+  Lib_Memzero0_memzero(ctx.ctx_key, (uint32_t)32U, uint8_t);
+  Lib_Memzero0_memzero(ctx.ctx_nonce, (uint32_t)12U, uint8_t);
+  Lib_Memzero0_memzero(ctx.ctx_exporter, (uint32_t)32U, uint8_t);
+  ctx.ctx_seq[0U] = (uint64_t)0U;
+  KRML_HOST_FREE(ctx.ctx_key);
+  KRML_HOST_FREE(ctx.ctx_nonce);
+  KRML_HOST_FREE(ctx.ctx_seq);
+  KRML_HOST_FREE(ctx.ctx_exporter);
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA256_seal(
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t plainlen,
+  uint8_t *plain,
+  uint8_t *o_ct
+)
+{
+  uint64_t s = ctx.ctx_seq[0U];
+  if (s == (uint64_t)18446744073709551615U)
+  {
+    return (uint32_t)1U;
+  }
+  uint8_t nonce[12U] = { 0U };
+  uint8_t enc[12U] = { 0U };
+  store64_be(enc + (uint32_t)4U, s);
+  KRML_MAYBE_FOR12(i,
+    (uint32_t)0U,
+    (uint32_t)12U,
+    (uint32_t)1U,
+    uint8_t xi = enc[i];
+    uint8_t yi = ctx.ctx_nonce[i];
+    nonce[i] = xi ^ yi;);
+  Hacl_Chacha20Poly1305_128_aead_encrypt(ctx.ctx_key,
+    nonce,
+    aadlen,
+    aad,
+    plainlen,
+    plain,
+    o_ct,
+    o_ct + plainlen);
+  ctx.ctx_seq[0U] = s + (uint64_t)1U;
+  return (uint32_t)0U;
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA256_open(
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t ctlen,
+  uint8_t *ct,
+  uint8_t *o_pt
+)
+{
+  uint64_t s = ctx.ctx_seq[0U];
+  if (s == (uint64_t)18446744073709551615U || ctlen < (uint32_t)16U)
+  {
+    return (uint32_t)1U;
+  }
+  uint8_t nonce[12U] = { 0U };
+  uint8_t enc[12U] = { 0U };
+  store64_be(enc + (uint32_t)4U, s);
+  KRML_MAYBE_FOR12(i,
+    (uint32_t)0U,
+    (uint32_t)12U,
+    (uint32_t)1U,
+    uint8_t xi = enc[i];
+    uint8_t yi = ctx.ctx_nonce[i];
+    nonce[i] = xi ^ yi;);
+  uint32_t
+  res =
+    Hacl_Chacha20Poly1305_128_aead_decrypt(ctx.ctx_key,
+      nonce,
+      aadlen,
+      aad,
+      ctlen - (uint32_t)16U,
+      o_pt,
+      ct,
+      ct + ctlen - (uint32_t)16U);
+  if (res == (uint32_t)0U)
+  {
+    ctx.ctx_seq[0U] = s + (uint64_t)1U;
+    return (uint32_t)0U;
+  }
+  return (uint32_t)1U;
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA256_export(
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t exp_ctxlen,
+  uint8_t *exp_ctx,
+  uint32_t l,
+  uint8_t *o_secret
+)
+{
+  if (l > (uint32_t)255U * (uint32_t)32U || exp_ctxlen > (uint32_t)0xffffffe9U)
+  {
+    return (uint32_t)1U;
+  }
+  uint8_t suite_id[10U] = { 0U };
+  uint8_t *uu____0 = suite_id;
+  uu____0[0U] = (uint8_t)0x48U;
+  uu____0[1U] = (uint8_t)0x50U;
+  uu____0[2U] = (uint8_t)0x4bU;
+  uu____0[3U] = (uint8_t)0x45U;
+  uint8_t *uu____1 = suite_id + (uint32_t)4U;
+  uu____1[0U] = (uint8_t)0U;
+  uu____1[1U] = (uint8_t)32U;
+  uint8_t *uu____2 = suite_id + (uint32_t)6U;
+  uu____2[0U] = (uint8_t)0U;
+  uu____2[1U] = (uint8_t)1U;
+  uint8_t *uu____3 = suite_id + (uint32_t)8U;
+  uu____3[0U] = (uint8_t)0U;
+  uu____3[1U] = (uint8_t)3U;
+  uint8_t label_sec[3U] = { (uint8_t)0x73U, (uint8_t)0x65U, (uint8_t)0x63U };
+  uint32_t len = (uint32_t)22U + exp_ctxlen;
+  KRML_CHECK_SIZE(sizeof (uint8_t), len);
+  uint8_t tmp[len];
+  memset(tmp, 0U, len * sizeof (uint8_t));
+  store16_be(tmp, (uint16_t)l);
+  uint8_t *uu____4 = tmp + (uint32_t)2U;
+  uu____4[0U] = (uint8_t)0x48U;
+  uu____4[1U] = (uint8_t)0x50U;
+  uu____4[2U] = (uint8_t)0x4bU;
+  uu____4[3U] = (uint8_t)0x45U;
+  uu____4[4U] = (uint8_t)0x2dU;
+  uu____4[5U] = (uint8_t)0x76U;
+  uu____4[6U] = (uint8_t)0x31U;
+  memcpy(tmp + (uint32_t)9U, suite_id, (uint32_t)10U * sizeof (uint8_t));
+  memcpy(tmp + (uint32_t)19U, label_sec, (uint32_t)3U * sizeof (uint8_t));
+  memcpy(tmp + (uint32_t)22U, exp_ctx, exp_ctxlen * sizeof (uint8_t));
+  Hacl_HKDF_expand_sha2_256(o_secret, ctx.ctx_exporter, (uint32_t)32U, tmp, len, l);
+  return (uint32_t)0U;
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA256_sealBaseMulti(
+  uint32_t n,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t plainlen,
+  uint8_t *plain,
+  uint8_t *dek,
+  uint8_t *o_enc,
+  uint8_t *o_wrapped,
+  uint8_t *o_ct
+)
+{
+  uint8_t nonce[12U] = { 0U };
+  Hacl_Chacha20Poly1305_128_aead_encrypt(dek,
+    nonce,
+    aadlen,
+    aad,
+    plainlen,
+    plain,
+    o_ct,
+    o_ct + plainlen);
+  uint8_t ctx_key[32U] = { 0U };
+  uint8_t ctx_nonce[12U] = { 0U };
+  uint64_t ctx_seq = (uint64_t)0U;
+  uint8_t ctx_exporter[32U] = { 0U };
+  Hacl_Impl_HPKE_context_s
+  o_ctx =
+    {
+      .ctx_key = ctx_key,
+      .ctx_nonce = ctx_nonce,
+      .ctx_seq = &ctx_seq,
+      .ctx_exporter = ctx_exporter
+    };
+  uint32_t res = (uint32_t)0U;
+  for (uint32_t j = (uint32_t)0U; j < n; j++)
+  {
+    o_ctx.ctx_seq[0U] = (uint64_t)0U;
+    uint32_t
+    r =
+      Hacl_HPKE_Curve51_CP128_SHA256_setupBaseS(o_enc + j * (uint32_t)32U,
+        o_ctx,
+        skE + j * (uint32_t)32U,
+        pkR + j * (uint32_t)32U,
+        infolen,
+        info);
+    if (r == (uint32_t)0U)
+    {
+      r = Hacl_HPKE_Curve51_CP128_SHA256_seal(o_ctx, (uint32_t)0U, NULL, (uint32_t)32U, dek, o_wrapped + j * (uint32_t)48U);
+    }
+    res = res | r;
+  }
+  Lib_Memzero0_memzero(ctx_key, (uint32_t)32U, uint8_t);
+  Lib_Memzero0_memzero(ctx_nonce, (uint32_t)12U, uint8_t);
+  Lib_Memzero0_memzero(ctx_exporter, (uint32_t)32U, uint8_t);
+  return res;
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA256_openBaseMulti(
+  uint8_t *pkE,
+  uint8_t *skR,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint8_t *wrapped,
+  uint32_t ctlen,
+  uint8_t *ct,
+  uint8_t *o_pt
+)
+{
+  if (ctlen < (uint32_t)16U)
+  {
+    return (uint32_t)1U;
+  }
+  uint8_t dek[32U] = { 0U };
+  uint32_t res = Hacl_HPKE_Curve51_CP128_SHA256_openBase(pkE, skR, infolen, info, (uint32_t)0U, NULL, (uint32_t)48U, wrapped, dek);
+  if (res == (uint32_t)0U)
+  {
+    uint8_t nonce[12U] = { 0U };
+    res =
+      Hacl_Chacha20Poly1305_128_aead_decrypt(dek,
+        nonce,
+        aadlen,
+        aad,
+        ctlen - (uint32_t)16U,
+        o_pt,
+        ct,
+        ct + ctlen - (uint32_t)16U);
+  }
+  Lib_Memzero0_memzero(dek, (uint32_t)32U, uint8_t);
+  return res;
+}
+
+static void
+kem_labeled_extract(
+  uint8_t *o_prk,
+  uint32_t saltlen,
+  uint8_t *salt,
+  uint32_t labellen,
+  uint8_t *label,
+  uint32_t ikmlen,
+  uint8_t *ikm
+)
+{
+  uint8_t
+  label_version[7U] =
+    {
+      (uint8_t)0x48U, (uint8_t)0x50U, (uint8_t)0x4bU, (uint8_t)0x45U, (uint8_t)0x2dU,
+      (uint8_t)0x76U, (uint8_t)0x31U
+    };
+  uint8_t
+  suite_id[5U] =
+    {
+      (uint8_t)0x4bU, (uint8_t)0x45U, (uint8_t)0x4dU, (uint8_t)0x00U, (uint8_t)0x20U
+    };
+  uint32_t len = (uint32_t)12U + labellen + ikmlen;
+  KRML_CHECK_SIZE(sizeof (uint8_t), len);
+  uint8_t tmp[len];
+  memset(tmp, 0U, len * sizeof (uint8_t));
+  memcpy(tmp, label_version, (uint32_t)7U * sizeof (uint8_t));
+  memcpy(tmp + (uint32_t)7U, suite_id, (uint32_t)5U * sizeof (uint8_t));
+  memcpy(tmp + (uint32_t)12U, label, labellen * sizeof (uint8_t));
+  memcpy(tmp + (uint32_t)12U + labellen, ikm, ikmlen * sizeof (uint8_t));
+  Hacl_HKDF_extract_sha2_256(o_prk, salt, saltlen, tmp, len);
+  Lib_Memzero0_memzero(tmp, len, uint8_t);
+}
+
+static void
+kem_labeled_expand(
+  uint8_t *o_okm,
+  uint8_t *prk,
+  uint32_t labellen,
+  uint8_t *label,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t l
+)
+{
+  uint8_t
+  label_version[7U] =
+    {
+      (uint8_t)0x48U, (uint8_t)0x50U, (uint8_t)0x4bU, (uint8_t)0x45U, (uint8_t)0x2dU,
+      (uint8_t)0x76U, (uint8_t)0x31U
+    };
+  uint8_t
+  suite_id[5U] =
+    {
+      (uint8_t)0x4bU, (uint8_t)0x45U, (uint8_t)0x4dU, (uint8_t)0x00U, (uint8_t)0x20U
+    };
+  uint32_t len = (uint32_t)14U + labellen + infolen;
+  KRML_CHECK_SIZE(sizeof (uint8_t), len);
+  uint8_t tmp[len];
+  memset(tmp, 0U, len * sizeof (uint8_t));
+  store16_be(tmp, (uint16_t)l);
+  memcpy(tmp + (uint32_t)2U, label_version, (uint32_t)7U * sizeof (uint8_t));
+  memcpy(tmp + (uint32_t)9U, suite_id, (uint32_t)5U * sizeof (uint8_t));
+  memcpy(tmp + (uint32_t)14U, label, labellen * sizeof (uint8_t));
+  memcpy(tmp + (uint32_t)14U + labellen, info, infolen * sizeof (uint8_t));
+  Hacl_HKDF_expand_sha2_256(o_okm, prk, (uint32_t)32U, tmp, len, l);
+}
+
+static void
+labeled_extract(
+  uint8_t *o_prk,
+  uint32_t saltlen,
+  uint8_t *salt,
+  uint32_t labellen,
+  uint8_t *label,
+  uint32_t ikmlen,
+  uint8_t *ikm
+)
+{
+  uint8_t
+  label_version[7U] =
+    {
+      (uint8_t)0x48U, (uint8_t)0x50U, (uint8_t)0x4bU, (uint8_t)0x45U, (uint8_t)0x2dU,
+      (uint8_t)0x76U, (uint8_t)0x31U
+    };
+  uint8_t
+  suite_id[10U] =
+    {
+      (uint8_t)0x48U, (uint8_t)0x50U, (uint8_t)0x4bU, (uint8_t)0x45U, (uint8_t)0x00U,
+      (uint8_t)0x20U, (uint8_t)0x00U, (uint8_t)0x01U, (uint8_t)0x00U, (uint8_t)0x03U
+    };
+  uint32_t len = (uint32_t)17U + labellen + ikmlen;
+  KRML_CHECK_SIZE(sizeof (uint8_t), len);
+  uint8_t tmp[len];
+  memset(tmp, 0U, len * sizeof (uint8_t));
+  memcpy(tmp, label_version, (uint32_t)7U * sizeof (uint8_t));
+  memcpy(tmp + (uint32_t)7U, suite_id, (uint32_t)10U * sizeof (uint8_t));
+  memcpy(tmp + (uint32_t)17U, label, labellen * sizeof (uint8_t));
+  memcpy(tmp + (uint32_t)17U + labellen, ikm, ikmlen * sizeof (uint8_t));
+  Hacl_HKDF_extract_sha2_256(o_prk, salt, saltlen, tmp, len);
+  Lib_Memzero0_memzero(tmp, len, uint8_t);
+}
+
+static void
+labeled_expand(
+  uint8_t *o_okm,
+  uint8_t *prk,
+  uint32_t labellen,
+  uint8_t *label,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t l
+)
+{
+  uint8_t
+  label_version[7U] =
+    {
+      (uint8_t)0x48U, (uint8_t)0x50U, (uint8_t)0x4bU, (uint8_t)0x45U, (uint8_t)0x2dU,
+      (uint8_t)0x76U, (uint8_t)0x31U
+    };
+  uint8_t
+  suite_id[10U] =
+    {
+      (uint8_t)0x48U, (uint8_t)0x50U, (uint8_t)0x4bU, (uint8_t)0x45U, (uint8_t)0x00U,
+      (uint8_t)0x20U, (uint8_t)0x00U, (uint8_t)0x01U, (uint8_t)0x00U, (uint8_t)0x03U
+    };
+  uint32_t len = (uint32_t)19U + labellen + infolen;
+  KRML_CHECK_SIZE(sizeof (uint8_t), len);
+  uint8_t tmp[len];
+  memset(tmp, 0U, len * sizeof (uint8_t));
+  store16_be(tmp, (uint16_t)l);
+  memcpy(tmp + (uint32_t)2U, label_version, (uint32_t)7U * sizeof (uint8_t));
+  memcpy(tmp + (uint32_t)9U, suite_id, (uint32_t)10U * sizeof (uint8_t));
+  memcpy(tmp + (uint32_t)19U, label, labellen * sizeof (uint8_t));
+  memcpy(tmp + (uint32_t)19U + labellen, info, infolen * sizeof (uint8_t));
+  Hacl_HKDF_expand_sha2_256(o_okm, prk, (uint32_t)32U, tmp, len, l);
+}
+
+static uint32_t dh(uint8_t *o_dh, uint8_t *sk, uint8_t *pk)
+{
+  bool res = Hacl_Curve25519_51_ecdh(o_dh, sk, pk);
+  if (res)
+  {
+    return (uint32_t)0U;
+  }
+  return (uint32_t)1U;
+}
+
+static uint32_t secret_to_public(uint8_t *o_pkm, uint8_t *sk)
+{
+  Hacl_Curve25519_51_secret_to_public(o_pkm, sk);
+  return (uint32_t)0U;
+}
+
+static void serialize_public(uint8_t *o_pkm, uint8_t *pk)
+{
+  memcpy(o_pkm, pk, (uint32_t)32U * sizeof (uint8_t));
+}
+
+static uint8_t *deserialize_public(uint8_t *pkm)
+{
+  return pkm;
+}
+
+static void extract_and_expand(uint8_t *o_shared, uint32_t dhlen, uint8_t *dh1, uint8_t *kem_context, uint32_t kem_contextlen)
+{
+  uint8_t eae_prk[32U] = { 0U };
+  uint8_t
+  label_eae_prk[7U] =
+    {
+      (uint8_t)0x65U, (uint8_t)0x61U, (uint8_t)0x65U, (uint8_t)0x5fU, (uint8_t)0x70U,
+      (uint8_t)0x72U, (uint8_t)0x6bU
+    };
+  uint8_t
+  label_shared_secret[13U] =
+    {
+      (uint8_t)0x73U, (uint8_t)0x68U, (uint8_t)0x61U, (uint8_t)0x72U, (uint8_t)0x65U,
+      (uint8_t)0x64U, (uint8_t)0x5fU, (uint8_t)0x73U, (uint8_t)0x65U, (uint8_t)0x63U,
+      (uint8_t)0x72U, (uint8_t)0x65U, (uint8_t)0x74U
+    };
+  kem_labeled_extract(eae_prk, (uint32_t)0U, NULL, (uint32_t)7U, label_eae_prk, dhlen, dh1);
+  kem_labeled_expand(o_shared,
+    eae_prk,
+    (uint32_t)13U,
+    label_shared_secret,
+    kem_contextlen,
+    kem_context,
+    (uint32_t)32U);
+  Lib_Memzero0_memzero(eae_prk, (uint32_t)32U, uint8_t);
+}
+
+static uint32_t
+key_schedule(
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t mode,
+  uint8_t *shared,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
+  bool with_psk = mode == (uint8_t)1U || mode == (uint8_t)3U;
+  if (with_psk != (psklen != (uint32_t)0U) || with_psk != (psk_idlen != (uint32_t)0U))
+  {
+    return (uint32_t)1U;
+  }
+  uint8_t context[65U] = { 0U };
+  uint8_t
+  label_psk_id_hash[11U] =
+    {
+      (uint8_t)0x70U, (uint8_t)0x73U, (uint8_t)0x6bU, (uint8_t)0x5fU, (uint8_t)0x69U,
+      (uint8_t)0x64U, (uint8_t)0x5fU, (uint8_t)0x68U, (uint8_t)0x61U, (uint8_t)0x73U,
+      (uint8_t)0x68U
+    };
+  uint8_t
+  label_info_hash[9U] =
+    {
+      (uint8_t)0x69U, (uint8_t)0x6eU, (uint8_t)0x66U, (uint8_t)0x6fU, (uint8_t)0x5fU,
+      (uint8_t)0x68U, (uint8_t)0x61U, (uint8_t)0x73U, (uint8_t)0x68U
+    };
+  uint8_t
+  label_secret[6U] =
+    {
+      (uint8_t)0x73U, (uint8_t)0x65U, (uint8_t)0x63U, (uint8_t)0x72U, (uint8_t)0x65U,
+      (uint8_t)0x74U
+    };
+  uint8_t
+  label_key[3U] =
+    {
+      (uint8_t)0x6bU, (uint8_t)0x65U, (uint8_t)0x79U
+    };
+  uint8_t
+  label_base_nonce[10U] =
+    {
+      (uint8_t)0x62U, (uint8_t)0x61U, (uint8_t)0x73U, (uint8_t)0x65U, (uint8_t)0x5fU,
+      (uint8_t)0x6eU, (uint8_t)0x6fU, (uint8_t)0x6eU, (uint8_t)0x63U, (uint8_t)0x65U
+    };
+  uint8_t
+  label_exp[3U] =
+    {
+      (uint8_t)0x65U, (uint8_t)0x78U, (uint8_t)0x70U
+    };
+  context[0U] = mode;
+  labeled_extract(context + (uint32_t)1U,
+    (uint32_t)0U,
+    NULL,
+    (uint32_t)11U,
+    label_psk_id_hash,
+    psk_idlen,
+    psk_id);
+  labeled_extract(context + (uint32_t)33U,
+    (uint32_t)0U,
+    NULL,
+    (uint32_t)9U,
+    label_info_hash,
+    infolen,
+    info);
+  uint8_t secret[32U] = { 0U };
+  labeled_extract(secret, (uint32_t)32U, shared, (uint32_t)6U, label_secret, psklen, psk);
+  labeled_expand(o_ctx.ctx_key,
+    secret,
+    (uint32_t)3U,
+    label_key,
+    (uint32_t)65U,
+    context,
+    (uint32_t)32U);
+  labeled_expand(o_ctx.ctx_nonce,
+    secret,
+    (uint32_t)10U,
+    label_base_nonce,
+    (uint32_t)65U,
+    context,
+    (uint32_t)12U);
+  labeled_expand(o_ctx.ctx_exporter,
+    secret,
+    (uint32_t)3U,
+    label_exp,
+    (uint32_t)65U,
+    context,
+    (uint32_t)32U);
+  o_ctx.ctx_seq[0U] = (uint64_t)0U;
+  Lib_Memzero0_memzero(secret, (uint32_t)32U, uint8_t);
+  return (uint32_t)0U;
+}
+
+static uint32_t
+setupS(
+  uint8_t mode,
+  uint8_t *o_pkE,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint8_t *skS,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
+  bool with_auth = mode == (uint8_t)2U || mode == (uint8_t)3U;
+  uint8_t dh1[64U] = { 0U };
+  uint8_t kem_context[96U] = { 0U };
+  uint32_t dhlen = (uint32_t)32U;
+  uint32_t kem_contextlen = (uint32_t)64U;
+  uint32_t res = secret_to_public(o_pkE, skE);
+  if (res == (uint32_t)0U)
+  {
+    res = dh(dh1, skE, pkR);
+  }
+  if (res == (uint32_t)0U && with_auth)
+  {
+    res = dh(dh1 + (uint32_t)32U, skS, pkR);
+    if (res == (uint32_t)0U)
+    {
+      res = secret_to_public(kem_context + (uint32_t)64U, skS);
+    }
+    dhlen = (uint32_t)64U;
+    kem_contextlen = (uint32_t)96U;
+  }
+  if (res == (uint32_t)0U)
+  {
+    uint8_t shared[32U] = { 0U };
+    memcpy(kem_context, o_pkE, (uint32_t)32U * sizeof (uint8_t));
+    serialize_public(kem_context + (uint32_t)32U, pkR);
+    extract_and_expand(shared, dhlen, dh1, kem_context, kem_contextlen);
+    res = key_schedule(o_ctx, mode, shared, psklen, psk, psk_idlen, psk_id, infolen, info);
+    Lib_Memzero0_memzero(shared, (uint32_t)32U, uint8_t);
+  }
+  Lib_Memzero0_memzero(dh1, (uint32_t)64U, uint8_t);
+  return res;
+}
+
+static uint32_t
+setupR(
+  uint8_t mode,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  Hacl_Impl_HPKE_receiver_key_s key,
+  uint8_t *enc,
+  uint8_t *pkS,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
+  bool with_auth = mode == (uint8_t)2U || mode == (uint8_t)3U;
+  uint8_t *pkE = deserialize_public(enc);
+  if (pkE == NULL)
+  {
+    return (uint32_t)1U;
+  }
+  uint8_t dh1[64U] = { 0U };
+  uint8_t kem_context[96U] = { 0U };
+  uint32_t dhlen = (uint32_t)32U;
+  uint32_t kem_contextlen = (uint32_t)64U;
+  uint32_t res = dh(dh1, key.rk_skR, pkE);
+  if (res == (uint32_t)0U && with_auth)
+  {
+    res = dh(dh1 + (uint32_t)32U, key.rk_skR, pkS);
+    serialize_public(kem_context + (uint32_t)64U, pkS);
+    dhlen = (uint32_t)64U;
+    kem_contextlen = (uint32_t)96U;
+  }
+  if (res == (uint32_t)0U)
+  {
+    uint8_t shared[32U] = { 0U };
+    memcpy(kem_context, enc, (uint32_t)32U * sizeof (uint8_t));
+    memcpy(kem_context + (uint32_t)32U, key.rk_pkRm, (uint32_t)32U * sizeof (uint8_t));
+    extract_and_expand(shared, dhlen, dh1, kem_context, kem_contextlen);
+    res = key_schedule(o_ctx, mode, shared, psklen, psk, psk_idlen, psk_id, infolen, info);
+    Lib_Memzero0_memzero(shared, (uint32_t)32U, uint8_t);
+  }
+  Lib_Memzero0_memzero(dh1, (uint32_t)64U, uint8_t);
+  return res;
+}
+
+Hacl_Impl_HPKE_receiver_key_s Hacl_HPKE_Curve51_CP128_SHA256_receiver_key_malloc(void)
+{
+  uint8_t *rk_skR = (uint8_t *)KRML_HOST_CALLOC((uint32_t)32U, sizeof (uint8_t));
+  uint8_t *rk_pkRm = (uint8_t *)KRML_HOST_CALLOC((uint32_t)32U, sizeof (uint8_t));
+  return ((Hacl_Impl_HPKE_receiver_key_s){ .rk_skR = rk_skR, .rk_pkRm = rk_pkRm });
+}
+
+uint32_t Hacl_HPKE_Curve51_CP128_SHA256_receiver_key_init(Hacl_Impl_HPKE_receiver_key_s key, uint8_t *skR)
+{
+  memcpy(key.rk_skR, skR, (uint32_t)32U * sizeof (uint8_t));
+  return secret_to_public(key.rk_pkRm, skR);
+}
+
+void Hacl_HPKE_Curve51_CP128_SHA256_receiver_key_free(Hacl_Impl_HPKE_receiver_key_s key)
+{
+  Lib_Memzero0_memzero(key.rk_skR, (uint32_t)32U, uint8_t);
+  KRML_HOST_FREE(key.rk_skR);
+  KRML_HOST_FREE(key.rk_pkRm);
+}
+
+uint8_t *Hacl_HPKE_Curve51_CP128_SHA256_receiver_key_public(Hacl_Impl_HPKE_receiver_key_s key)
+{
+  return key.rk_pkRm;
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA256_setupBaseR_key(
+  Hacl_Impl_HPKE_context_s o_ctx,
+  Hacl_Impl_HPKE_receiver_key_s key,
+  uint8_t *enc,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
+  return
+    setupR((uint8_t)0U,
+      o_ctx,
+      key,
+      enc,
+      NULL,
+      (uint32_t)0U, NULL, (uint32_t)0U, NULL,
+      infolen,
+      info);
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA256_setupPSKS(
+  uint8_t *o_pkE,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
+  return
+    setupS((uint8_t)1U,
+      o_pkE,
+      o_ctx,
+      skE,
+      pkR,
+      NULL,
+      psklen, psk, psk_idlen, psk_id,
+      infolen,
+      info);
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA256_setupPSKR(
+  Hacl_Impl_HPKE_context_s o_ctx,
+  Hacl_Impl_HPKE_receiver_key_s key,
+  uint8_t *enc,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
+  return
+    setupR((uint8_t)1U,
+      o_ctx,
+      key,
+      enc,
+      NULL,
+      psklen, psk, psk_idlen, psk_id,
+      infolen,
+      info);
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA256_setupAuthS(
+  uint8_t *o_pkE,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint8_t *skS,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
+  return
+    setupS((uint8_t)2U,
+      o_pkE,
+      o_ctx,
+      skE,
+      pkR,
+      skS,
+      (uint32_t)0U, NULL, (uint32_t)0U, NULL,
+      infolen,
+      info);
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA256_setupAuthR(
+  Hacl_Impl_HPKE_context_s o_ctx,
+  Hacl_Impl_HPKE_receiver_key_s key,
+  uint8_t *enc,
+  uint8_t *pkS,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
+  return
+    setupR((uint8_t)2U,
+      o_ctx,
+      key,
+      enc,
+      pkS,
+      (uint32_t)0U, NULL, (uint32_t)0U, NULL,
+      infolen,
+      info);
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA256_setupAuthPSKS(
+  uint8_t *o_pkE,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint8_t *skS,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
+  return
+    setupS((uint8_t)3U,
+      o_pkE,
+      o_ctx,
+      skE,
+      pkR,
+      skS,
+      psklen, psk, psk_idlen, psk_id,
+      infolen,
+      info);
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA256_setupAuthPSKR(
+  Hacl_Impl_HPKE_context_s o_ctx,
+  Hacl_Impl_HPKE_receiver_key_s key,
+  uint8_t *enc,
+  uint8_t *pkS,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
+  return
+    setupR((uint8_t)3U,
+      o_ctx,
+      key,
+      enc,
+      pkS,
+      psklen, psk, psk_idlen, psk_id,
+      infolen,
+      info);
+}
+
@@ -505,6 +505,34 @@ Hacl_Streaming_MD_state_32 *Hacl_Streaming_SHA2_create_in_256(void)
   return p;
 }
 
+/**
+Size in bytes of the memory that `init_in_place_256` needs for a SHA2_256
+state. The memory must be aligned on `HACL_STREAMING_SHA2_STATE_ALIGN` bytes.
+*/
+uint32_t Hacl_Streaming_SHA2_state_size_256(void)
+{
+  return (uint32_t)sizeof (Hacl_Streaming_MD_state_32) + (uint32_t)32U + (uint32_t)64U;
+}
+
+/**
+Initialize a SHA2_256 state in caller-provided memory `mem`, of
+`state_size_256()` bytes, and return it. The state lives entirely in `mem`: it
+must not be passed to `free_256`, and `mem` may be reused once the state is no
+longer needed. No allocation takes place.
+*/
+Hacl_Streaming_MD_state_32 *Hacl_Streaming_SHA2_init_in_place_256(uint8_t *mem)
+{
+  Hacl_Streaming_MD_state_32 *p = (Hacl_Streaming_MD_state_32 *)mem;
+  uint32_t *block_state = (uint32_t *)(mem + sizeof (Hacl_Streaming_MD_state_32));
+  uint8_t *buf = (uint8_t *)(block_state + (uint32_t)8U);
+  memset(buf, 0U, (uint32_t)64U * sizeof (uint8_t));
+  Hacl_SHA2_Scalar32_sha256_init(block_state);
+  Hacl_Streaming_MD_state_32
+  s = { .block_state = block_state, .buf = buf, .total_len = (uint64_t)(uint32_t)0U };
+  p[0U] = s;
+  return p;
+}
+
 /**
 Copies the state passed as argument into a newly allocated state (deep copy).
 The state is to be freed by calling `free_256`. Cloning the state this way is
@@ -830,6 +858,24 @@ Hacl_Streaming_MD_state_32 *Hacl_Streaming_SHA2_create_in_224(void)
   return p;
 }
 
+uint32_t Hacl_Streaming_SHA2_state_size_224(void)
+{
+  return (uint32_t)sizeof (Hacl_Streaming_MD_state_32) + (uint32_t)32U + (uint32_t)64U;
+}
+
+Hacl_Streaming_MD_state_32 *Hacl_Streaming_SHA2_init_in_place_224(uint8_t *mem)
+{
+  Hacl_Streaming_MD_state_32 *p = (Hacl_Streaming_MD_state_32 *)mem;
+  uint32_t *block_state = (uint32_t *)(mem + sizeof (Hacl_Streaming_MD_state_32));
+  uint8_t *buf = (uint8_t *)(block_state + (uint32_t)8U);
+  memset(buf, 0U, (uint32_t)64U * sizeof (uint8_t));
+  Hacl_SHA2_Scalar32_sha224_init(block_state);
+  Hacl_Streaming_MD_state_32
+  s = { .block_state = block_state, .buf = buf, .total_len = (uint64_t)(uint32_t)0U };
+  p[0U] = s;
+  return p;
+}
+
 void Hacl_Streaming_SHA2_init_224(Hacl_Streaming_MD_state_32 *s)
 {
   Hacl_Streaming_MD_state_32 scrut = *s;
@@ -931,6 +977,33 @@ Hacl_Streaming_MD_state_64 *Hacl_Streaming_SHA2_create_in_512(void)
   return p;
 }
 
+/**
+Size in bytes of the memory that `init_in_place_512` needs for a SHA2_512
+state. The memory must be aligned on `HACL_STREAMING_SHA2_STATE_ALIGN` bytes.
+*/
+uint32_t Hacl_Streaming_SHA2_state_size_512(void)
+{
+  return (uint32_t)sizeof (Hacl_Streaming_MD_state_64) + (uint32_t)64U + (uint32_t)128U;
+}
+
+/**
+Initialize a SHA2_512 state in caller-provided memory `mem`, of
+`state_size_512()` bytes, and return it. As for `init_in_place_256`, the state
+must not be passed to `free_512`.
+*/
+Hacl_Streaming_MD_state_64 *Hacl_Streaming_SHA2_init_in_place_512(uint8_t *mem)
+{
+  Hacl_Streaming_MD_state_64 *p = (Hacl_Streaming_MD_state_64 *)mem;
+  uint64_t *block_state = (uint64_t *)(mem + sizeof (Hacl_Streaming_MD_state_64));
+  uint8_t *buf = (uint8_t *)(block_state + (uint32_t)8U);
+  memset(buf, 0U, (uint32_t)128U * sizeof (uint8_t));
+  Hacl_SHA2_Scalar32_sha512_init(block_state);
+  Hacl_Streaming_MD_state_64
+  s = { .block_state = block_state, .buf = buf, .total_len = (uint64_t)(uint32_t)0U };
+  p[0U] = s;
+  return p;
+}
+
 /**
 Copies the state passed as argument into a newly allocated state (deep copy).
 The state is to be freed by calling `free_512`. Cloning the state this way is
@@ -1254,6 +1327,24 @@ Hacl_Streaming_MD_state_64 *Hacl_Streaming_SHA2_create_in_384(void)
   return p;
 }
 
+uint32_t Hacl_Streaming_SHA2_state_size_384(void)
+{
+  return (uint32_t)sizeof (Hacl_Streaming_MD_state_64) + (uint32_t)64U + (uint32_t)128U;
+}
+
+Hacl_Streaming_MD_state_64 *Hacl_Streaming_SHA2_init_in_place_384(uint8_t *mem)
+{
+  Hacl_Streaming_MD_state_64 *p = (Hacl_Streaming_MD_state_64 *)mem;
+  uint64_t *block_state = (uint64_t *)(mem + sizeof (Hacl_Streaming_MD_state_64));
+  uint8_t *buf = (uint8_t *)(block_state + (uint32_t)8U);
+  memset(buf, 0U, (uint32_t)128U * sizeof (uint8_t));
+  Hacl_SHA2_Scalar32_sha384_init(block_state);
+  Hacl_Streaming_MD_state_64
+  s = { .block_state = block_state, .buf = buf, .total_len = (uint64_t)(uint32_t)0U };
+  p[0U] = s;
+  return p;
+}
+
 void Hacl_Streaming_SHA2_init_384(Hacl_Streaming_MD_state_64 *s)
 {
   Hacl_Streaming_MD_state_64 scrut = *s;
@@ -26,6 +26,12 @@
 #include "Hacl_NaCl.h"
 
 #include "internal/Hacl_Krmllib.h"
+#include "Hacl_Salsa20_Vec256.h"
+#include "Hacl_Salsa20_Vec128.h"
+#include "Hacl_Poly1305_256.h"
+#include "Hacl_Poly1305_128.h"
+#include "lib_memzero0.h"
+#include "config.h"
 
 static void secretbox_init(uint8_t *xkeys, uint8_t *k, uint8_t *n)
 {
@@ -258,6 +264,259 @@ box_open_easy(uint32_t mlen, uint8_t *m, uint8_t *pk, uint8_t *sk, uint8_t *n, u
   return box_open_detached(mlen, m, pk, sk, n, cip, tag);
 }
 
+/* crypto_box sessions.
+
+   A session holds the crypto_box_beforenm key and a Poly1305 state for the
+   Salsa20/Poly1305 implementation given by the caller, both chosen and allocated
+   once. Sealing encrypts and authenticates the message in chunks of
+   NACL_SESSION_CHUNK bytes, so the MAC reads ciphertext that is still in L1. */
+
+#define NACL_SESSION_CHUNK ((uint32_t)4096U)
+
+#define NACL_SESSION_SCALAR ((uint32_t)0U)
+
+#define NACL_SESSION_VEC128 ((uint32_t)1U)
+
+#define NACL_SESSION_VEC256 ((uint32_t)2U)
+
+/* Below this length, the vector key setup and partial blocks cost more than
+   they save, and the portable code is used. */
+#define NACL_SESSION_MIN_VEC ((uint32_t)256U)
+
+/* Large enough for the 25-word state of every Poly1305 implementation. */
+#define NACL_SESSION_POLY_LEN ((uint32_t)800U)
+
+static uint32_t session_select_impl(Hacl_NaCl_impl impl)
+{
+  #if HACL_CAN_COMPILE_VEC256
+  if (impl == Hacl_NaCl_Vec256)
+  {
+    return NACL_SESSION_VEC256;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC128
+  if (impl == Hacl_NaCl_Vec128)
+  {
+    return NACL_SESSION_VEC128;
+  }
+  #endif
+  KRML_HOST_IGNORE(impl);
+  return NACL_SESSION_SCALAR;
+}
+
+static uint32_t session_impl(Hacl_NaCl_crypto_box_session_s *s, uint32_t mlen)
+{
+  if (mlen < NACL_SESSION_MIN_VEC)
+  {
+    return NACL_SESSION_SCALAR;
+  }
+  return s->impl;
+}
+
+static void
+session_salsa20(
+  uint32_t impl,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *text,
+  uint8_t *key,
+  uint8_t *n,
+  uint32_t ctr
+)
+{
+  #if HACL_CAN_COMPILE_VEC256
+  if (impl == NACL_SESSION_VEC256)
+  {
+    Hacl_Salsa20_Vec256_salsa20_encrypt_256(len, out, text, key, n, ctr);
+    return;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC128
+  if (impl == NACL_SESSION_VEC128)
+  {
+    Hacl_Salsa20_Vec128_salsa20_encrypt_128(len, out, text, key, n, ctr);
+    return;
+  }
+  #endif
+  KRML_HOST_IGNORE(impl);
+  Hacl_Salsa20_salsa20_encrypt(len, out, text, key, n, ctr);
+}
+
+static void session_poly1305_init(uint32_t impl, uint8_t *st, uint8_t *key)
+{
+  #if HACL_CAN_COMPILE_VEC256
+  if (impl == NACL_SESSION_VEC256)
+  {
+    Hacl_Poly1305_256_poly1305_init((Lib_IntVector_Intrinsics_vec256 *)st, key);
+    return;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC128
+  if (impl == NACL_SESSION_VEC128)
+  {
+    Hacl_Poly1305_128_poly1305_init((Lib_IntVector_Intrinsics_vec128 *)st, key);
+    return;
+  }
+  #endif
+  KRML_HOST_IGNORE(impl);
+  Hacl_Poly1305_32_poly1305_init((uint64_t *)st, key);
+}
+
+/* All calls but the last for a given message must have a length multiple of 16. */
+static void session_poly1305_update(uint32_t impl, uint8_t *st, uint32_t len, uint8_t *text)
+{
+  #if HACL_CAN_COMPILE_VEC256
+  if (impl == NACL_SESSION_VEC256)
+  {
+    Hacl_Poly1305_256_poly1305_update((Lib_IntVector_Intrinsics_vec256 *)st, len, text);
+    return;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC128
+  if (impl == NACL_SESSION_VEC128)
+  {
+    Hacl_Poly1305_128_poly1305_update((Lib_IntVector_Intrinsics_vec128 *)st, len, text);
+    return;
+  }
+  #endif
+  KRML_HOST_IGNORE(impl);
+  Hacl_Poly1305_32_poly1305_update((uint64_t *)st, len, text);
+}
+
+static void session_poly1305_finish(uint32_t impl, uint8_t *st, uint8_t *tag, uint8_t *key)
+{
+  #if HACL_CAN_COMPILE_VEC256
+  if (impl == NACL_SESSION_VEC256)
+  {
+    Hacl_Poly1305_256_poly1305_finish(tag, key, (Lib_IntVector_Intrinsics_vec256 *)st);
+    return;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC128
+  if (impl == NACL_SESSION_VEC128)
+  {
+    Hacl_Poly1305_128_poly1305_finish(tag, key, (Lib_IntVector_Intrinsics_vec128 *)st);
+    return;
+  }
+  #endif
+  KRML_HOST_IGNORE(impl);
+  Hacl_Poly1305_32_poly1305_finish(tag, key, (uint64_t *)st);
+}
+
+static void
+session_detached(
+  Hacl_NaCl_crypto_box_session_s *s,
+  uint32_t mlen,
+  uint8_t *c,
+  uint8_t *tag,
+  uint8_t *n,
+  uint8_t *m
+)
+{
+  uint8_t xkeys[96U] = { 0U };
+  secretbox_init(xkeys, s->k, n);
+  uint8_t *subkey = xkeys;
+  uint8_t *mkey = xkeys + (uint32_t)32U;
+  uint8_t *ekey0 = xkeys + (uint32_t)64U;
+  uint8_t *n1 = n + (uint32_t)16U;
+  uint32_t impl = session_impl(s, mlen);
+  uint32_t mlen0;
+  if (mlen <= (uint32_t)32U)
+  {
+    mlen0 = mlen;
+  }
+  else
+  {
+    mlen0 = (uint32_t)32U;
+  }
+  uint8_t block0[32U] = { 0U };
+  memcpy(block0, m, mlen0 * sizeof (uint8_t));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)32U; i++)
+  {
+    block0[i] = block0[i] ^ ekey0[i];
+  }
+  memcpy(c, block0, mlen0 * sizeof (uint8_t));
+  session_poly1305_init(impl, s->poly, mkey);
+  session_poly1305_update(impl, s->poly, mlen0, c);
+  /* The rest of the message starts at block 1 of the XSalsa20 keystream; every
+     chunk but the last is a whole number of blocks. */
+  uint32_t mlen1 = mlen - mlen0;
+  uint8_t *c1 = c + mlen0;
+  uint8_t *m1 = m + mlen0;
+  for (uint32_t off = (uint32_t)0U; off < mlen1; off = off + NACL_SESSION_CHUNK)
+  {
+    uint32_t len = mlen1 - off;
+    if (len > NACL_SESSION_CHUNK)
+    {
+      len = NACL_SESSION_CHUNK;
+    }
+    uint32_t ctr = (uint32_t)1U + off / (uint32_t)64U;
+    session_salsa20(impl, len, c1 + off, m1 + off, subkey, n1, ctr);
+    session_poly1305_update(impl, s->poly, len, c1 + off);
+  }
+  session_poly1305_finish(impl, s->poly, tag, mkey);
+  Lib_Memzero0_memzero(xkeys, (uint32_t)96U, uint8_t);
+  Lib_Memzero0_memzero(block0, (uint32_t)32U, uint8_t);
+  Lib_Memzero0_memzero(s->poly, NACL_SESSION_POLY_LEN, uint8_t);
+}
+
+static uint32_t
+session_open_detached(
+  Hacl_NaCl_crypto_box_session_s *s,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *n,
+  uint8_t *c,
+  uint8_t *tag
+)
+{
+  uint8_t xkeys[96U] = { 0U };
+  secretbox_init(xkeys, s->k, n);
+  uint8_t *subkey = xkeys;
+  uint8_t *mkey = xkeys + (uint32_t)32U;
+  uint8_t *ekey0 = xkeys + (uint32_t)64U;
+  uint8_t *n1 = n + (uint32_t)16U;
+  uint32_t impl = session_impl(s, mlen);
+  uint8_t tag_[16U] = { 0U };
+  session_poly1305_init(impl, s->poly, mkey);
+  session_poly1305_update(impl, s->poly, mlen, c);
+  session_poly1305_finish(impl, s->poly, tag_, mkey);
+  Lib_Memzero0_memzero(s->poly, NACL_SESSION_POLY_LEN, uint8_t);
+  uint8_t res = (uint8_t)255U;
+  KRML_MAYBE_FOR16(i,
+    (uint32_t)0U,
+    (uint32_t)16U,
+    (uint32_t)1U,
+    uint8_t uu____0 = FStar_UInt8_eq_mask(tag[i], tag_[i]);
+    res = uu____0 & res;);
+  uint8_t z = res;
+  if (z != (uint8_t)255U)
+  {
+    Lib_Memzero0_memzero(xkeys, (uint32_t)96U, uint8_t);
+    return (uint32_t)0xffffffffU;
+  }
+  uint32_t mlen0;
+  if (mlen <= (uint32_t)32U)
+  {
+    mlen0 = mlen;
+  }
+  else
+  {
+    mlen0 = (uint32_t)32U;
+  }
+  uint8_t block0[32U] = { 0U };
+  memcpy(block0, c, mlen0 * sizeof (uint8_t));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)32U; i++)
+  {
+    block0[i] = block0[i] ^ ekey0[i];
+  }
+  memcpy(m, block0, mlen0 * sizeof (uint8_t));
+  session_salsa20(impl, mlen - mlen0, m + mlen0, c + mlen0, subkey, n1, (uint32_t)1U);
+  Lib_Memzero0_memzero(xkeys, (uint32_t)96U, uint8_t);
+  Lib_Memzero0_memzero(block0, (uint32_t)32U, uint8_t);
+  return (uint32_t)0U;
+}
+
 /**
 Encrypt a message with a key and nonce.
 
@@ -516,3 +775,150 @@ Hacl_NaCl_crypto_box_open_easy(
   return box_open_easy(clen - (uint32_t)16U, m, pk, sk, n, c);
 }
 
+/**
+Allocate a crypto_box session. Returns NULL if the allocation fails.
+
+The session must be initialized with `Hacl_NaCl_crypto_box_session_init` or
+`Hacl_NaCl_crypto_box_session_init_afternm` and freed with
+`Hacl_NaCl_crypto_box_session_free`.
+
+@param impl The Salsa20 and Poly1305 implementation used for messages of 256 bytes
+or more. The caller must check that the CPU supports it, e.g. with
+`EverCrypt_AutoConfig2_has_vec256` for `Hacl_NaCl_Vec256`. A vectorized
+implementation that is not compiled in falls back to the portable code.
+*/
+Hacl_NaCl_crypto_box_session_s *Hacl_NaCl_crypto_box_session_malloc(Hacl_NaCl_impl impl)
+{
+  Hacl_NaCl_crypto_box_session_s
+  *s =
+    (Hacl_NaCl_crypto_box_session_s *)KRML_HOST_CALLOC((uint32_t)1U,
+      sizeof (Hacl_NaCl_crypto_box_session_s));
+  if (s == NULL)
+  {
+    return NULL;
+  }
+  uint8_t *k = (uint8_t *)KRML_HOST_CALLOC((uint32_t)32U, sizeof (uint8_t));
+  uint8_t *poly = (uint8_t *)KRML_ALIGNED_MALLOC(32, NACL_SESSION_POLY_LEN);
+  if (k == NULL || poly == NULL)
+  {
+    KRML_HOST_FREE(k);
+    if (poly != NULL)
+    {
+      KRML_ALIGNED_FREE(poly);
+    }
+    KRML_HOST_FREE(s);
+    return NULL;
+  }
+  memset(poly, 0U, NACL_SESSION_POLY_LEN * sizeof (uint8_t));
+  s->k = k;
+  s->poly = poly;
+  s->impl = session_select_impl(impl);
+  return s;
+}
+
+/**
+Initialize a session with the shared key of `Hacl_NaCl_crypto_box_beforenm`.
+
+@param s Session allocated with `Hacl_NaCl_crypto_box_session_malloc`.
+@param pk Pointer to 32 bytes of memory where **their** public key is read from.
+@param sk Pointer to 32 bytes of memory where **my** secret key is read from.
+*/
+uint32_t
+Hacl_NaCl_crypto_box_session_init(Hacl_NaCl_crypto_box_session_s *s, uint8_t *pk, uint8_t *sk)
+{
+  return box_beforenm(s->k, pk, sk);
+}
+
+/**
+Initialize a session with a key computed earlier by `Hacl_NaCl_crypto_box_beforenm`.
+
+@param s Session allocated with `Hacl_NaCl_crypto_box_session_malloc`.
+@param k Pointer to 32 (`crypto_box_BEFORENMBYTES`) bytes of memory where the shared key is read from.
+*/
+void Hacl_NaCl_crypto_box_session_init_afternm(Hacl_NaCl_crypto_box_session_s *s, uint8_t *k)
+{
+  memcpy(s->k, k, (uint32_t)32U * sizeof (uint8_t));
+}
+
+/**
+Wipe and free a session allocated with `Hacl_NaCl_crypto_box_session_malloc`.
+*/
+void Hacl_NaCl_crypto_box_session_free(Hacl_NaCl_crypto_box_session_s *s)
+{
+  Lib_Memzero0_memzero(s->k, (uint32_t)32U, uint8_t);
+  KRML_HOST_FREE(s->k);
+  KRML_ALIGNED_FREE(s->poly);
+  KRML_HOST_FREE(s);
+}
+
+/**
+Same as `Hacl_NaCl_crypto_box_detached_afternm`, with the key of the session.
+
+The session holds mutable scratch state: it must not be used by several threads at once.
+*/
+uint32_t
+Hacl_NaCl_crypto_box_session_detached(
+  Hacl_NaCl_crypto_box_session_s *s,
+  uint8_t *c,
+  uint8_t *tag,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *n
+)
+{
+  session_detached(s, mlen, c, tag, n, m);
+  return (uint32_t)0U;
+}
+
+/**
+Same as `Hacl_NaCl_crypto_box_open_detached_afternm`, with the key of the session.
+*/
+uint32_t
+Hacl_NaCl_crypto_box_session_open_detached(
+  Hacl_NaCl_crypto_box_session_s *s,
+  uint8_t *m,
+  uint8_t *c,
+  uint8_t *tag,
+  uint32_t mlen,
+  uint8_t *n
+)
+{
+  return session_open_detached(s, mlen, m, n, c, tag);
+}
+
+/**
+Same as `Hacl_NaCl_crypto_box_easy_afternm`, with the key of the session.
+*/
+uint32_t
+Hacl_NaCl_crypto_box_session_easy(
+  Hacl_NaCl_crypto_box_session_s *s,
+  uint8_t *c,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *n
+)
+{
+  session_detached(s, mlen, c + (uint32_t)16U, c, n, m);
+  return (uint32_t)0U;
+}
+
+/**
+Same as `Hacl_NaCl_crypto_box_open_easy_afternm`, with the key of the session.
+
+Fails if `clen` is smaller than the 16-byte tag.
+*/
+uint32_t
+Hacl_NaCl_crypto_box_session_open_easy(
+  Hacl_NaCl_crypto_box_session_s *s,
+  uint8_t *m,
+  uint8_t *c,
+  uint32_t clen,
+  uint8_t *n
+)
+{
+  if (clen < (uint32_t)16U)
+  {
+    return (uint32_t)0xffffffffU;
+  }
+  return session_open_detached(s, clen - (uint32_t)16U, m, n, c + (uint32_t)16U, c);
+}
@@ -50,6 +50,8 @@ static bool cpu_has_rdrand[1U] = { false };
 
 static bool cpu_has_avx512[1U] = { false };
 
+static bool cpu_has_avx512ifma[1U] = { false };
+
 bool EverCrypt_AutoConfig2_has_shaext(void)
 {
   return cpu_has_shaext[0U];
@@ -105,6 +107,11 @@ bool EverCrypt_AutoConfig2_has_avx512(void)
   return cpu_has_avx512[0U];
 }
 
+bool EverCrypt_AutoConfig2_has_avx512ifma(void)
+{
+  return cpu_has_avx512ifma[0U];
+}
+
 void EverCrypt_AutoConfig2_recall(void)
 {
 
@@ -168,6 +175,10 @@ void EverCrypt_AutoConfig2_init(void)
         if (check_avx512_xcr0() != (uint64_t)0U)
         {
           cpu_has_avx512[0U] = true;
+          if (check_avx512ifma() != (uint64_t)0U)
+          {
+            cpu_has_avx512ifma[0U] = true;
+          }
           return;
         }
         return;
@@ -232,6 +243,12 @@ void EverCrypt_AutoConfig2_disable_rdrand(void)
 void EverCrypt_AutoConfig2_disable_avx512(void)
 {
   cpu_has_avx512[0U] = false;
+  cpu_has_avx512ifma[0U] = false;
+}
+
+void EverCrypt_AutoConfig2_disable_avx512ifma(void)
+{
+  cpu_has_avx512ifma[0U] = false;
 }
 
 bool EverCrypt_AutoConfig2_has_vec128(void)
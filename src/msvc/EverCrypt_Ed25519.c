@@ -68,3 +68,20 @@ EverCrypt_Ed25519_verify(
   return Hacl_Ed25519_verify(public_key, msg_len, msg, signature);
 }
 
+bool
+EverCrypt_Ed25519_expand_public_key(uint64_t *expanded_public_key, uint8_t *public_key)
+{
+  return Hacl_Ed25519_expand_public_key(expanded_public_key, public_key);
+}
+
+bool
+EverCrypt_Ed25519_verify_expanded(
+  uint64_t *expanded_public_key,
+  uint32_t msg_len,
+  uint8_t *msg,
+  uint8_t *signature
+)
+{
+  return Hacl_Ed25519_verify_expanded(expanded_public_key, msg_len, msg, signature);
+}
+
@@ -0,0 +1,174 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "EverCrypt_Frodo.h"
+
+#include "internal/Hacl_Frodo64.h"
+#include "internal/Hacl_Frodo640.h"
+#include "internal/Hacl_Frodo976.h"
+#include "internal/Hacl_Frodo1344.h"
+#include "internal/Hacl_Frodo640_AES.h"
+#include "internal/Hacl_Frodo976_AES.h"
+#include "internal/Hacl_Frodo1344_AES.h"
+#include "internal/Hacl_Frodo_KEM.h"
+#include "config.h"
+
+static Hacl_Impl_Frodo_Params_impl frodo_impl(void)
+{
+  Hacl_Impl_Frodo_Params_impl impl = Hacl_Impl_Frodo_Params_portable;
+  if (EverCrypt_AutoConfig2_has_vec256())
+  {
+    impl.matrix = Hacl_Impl_Frodo_Params_Vec256;
+  }
+  else if (EverCrypt_AutoConfig2_has_vec128())
+  {
+    impl.matrix = Hacl_Impl_Frodo_Params_Vec128;
+  }
+  impl.aesni = EverCrypt_AutoConfig2_has_aesni() && EverCrypt_AutoConfig2_has_sse();
+  return impl;
+}
+
+uint32_t EverCrypt_Frodo_crypto_kem_keypair(EverCrypt_Frodo_alg a, uint8_t *pk, uint8_t *sk)
+{
+  switch (a)
+  {
+    case EverCrypt_Frodo_Frodo64:
+      {
+        return Hacl_Frodo64_crypto_kem_keypair_impl(frodo_impl(), pk, sk);
+      }
+    case EverCrypt_Frodo_Frodo640:
+      {
+        return Hacl_Frodo640_crypto_kem_keypair_impl(frodo_impl(), pk, sk);
+      }
+    case EverCrypt_Frodo_Frodo976:
+      {
+        return Hacl_Frodo976_crypto_kem_keypair_impl(frodo_impl(), pk, sk);
+      }
+    case EverCrypt_Frodo_Frodo1344:
+      {
+        return Hacl_Frodo1344_crypto_kem_keypair_impl(frodo_impl(), pk, sk);
+      }
+    case EverCrypt_Frodo_Frodo640_AES:
+      {
+        return Hacl_Frodo640_AES_crypto_kem_keypair_impl(frodo_impl(), pk, sk);
+      }
+    case EverCrypt_Frodo_Frodo976_AES:
+      {
+        return Hacl_Frodo976_AES_crypto_kem_keypair_impl(frodo_impl(), pk, sk);
+      }
+    case EverCrypt_Frodo_Frodo1344_AES:
+      {
+        return Hacl_Frodo1344_AES_crypto_kem_keypair_impl(frodo_impl(), pk, sk);
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+uint32_t
+EverCrypt_Frodo_crypto_kem_enc(EverCrypt_Frodo_alg a, uint8_t *ct, uint8_t *ss, uint8_t *pk)
+{
+  switch (a)
+  {
+    case EverCrypt_Frodo_Frodo64:
+      {
+        return Hacl_Frodo64_crypto_kem_enc_impl(frodo_impl(), ct, ss, pk);
+      }
+    case EverCrypt_Frodo_Frodo640:
+      {
+        return Hacl_Frodo640_crypto_kem_enc_impl(frodo_impl(), ct, ss, pk);
+      }
+    case EverCrypt_Frodo_Frodo976:
+      {
+        return Hacl_Frodo976_crypto_kem_enc_impl(frodo_impl(), ct, ss, pk);
+      }
+    case EverCrypt_Frodo_Frodo1344:
+      {
+        return Hacl_Frodo1344_crypto_kem_enc_impl(frodo_impl(), ct, ss, pk);
+      }
+    case EverCrypt_Frodo_Frodo640_AES:
+      {
+        return Hacl_Frodo640_AES_crypto_kem_enc_impl(frodo_impl(), ct, ss, pk);
+      }
+    case EverCrypt_Frodo_Frodo976_AES:
+      {
+        return Hacl_Frodo976_AES_crypto_kem_enc_impl(frodo_impl(), ct, ss, pk);
+      }
+    case EverCrypt_Frodo_Frodo1344_AES:
+      {
+        return Hacl_Frodo1344_AES_crypto_kem_enc_impl(frodo_impl(), ct, ss, pk);
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+uint32_t
+EverCrypt_Frodo_crypto_kem_dec(EverCrypt_Frodo_alg a, uint8_t *ss, uint8_t *ct, uint8_t *sk)
+{
+  switch (a)
+  {
+    case EverCrypt_Frodo_Frodo64:
+      {
+        return Hacl_Frodo64_crypto_kem_dec_impl(frodo_impl(), ss, ct, sk);
+      }
+    case EverCrypt_Frodo_Frodo640:
+      {
+        return Hacl_Frodo640_crypto_kem_dec_impl(frodo_impl(), ss, ct, sk);
+      }
+    case EverCrypt_Frodo_Frodo976:
+      {
+        return Hacl_Frodo976_crypto_kem_dec_impl(frodo_impl(), ss, ct, sk);
+      }
+    case EverCrypt_Frodo_Frodo1344:
+      {
+        return Hacl_Frodo1344_crypto_kem_dec_impl(frodo_impl(), ss, ct, sk);
+      }
+    case EverCrypt_Frodo_Frodo640_AES:
+      {
+        return Hacl_Frodo640_AES_crypto_kem_dec_impl(frodo_impl(), ss, ct, sk);
+      }
+    case EverCrypt_Frodo_Frodo976_AES:
+      {
+        return Hacl_Frodo976_AES_crypto_kem_dec_impl(frodo_impl(), ss, ct, sk);
+      }
+    case EverCrypt_Frodo_Frodo1344_AES:
+      {
+        return Hacl_Frodo1344_AES_crypto_kem_dec_impl(frodo_impl(), ss, ct, sk);
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
@@ -31,6 +31,7 @@
 #include "internal/Hacl_Hash_SHA2.h"
 #include "internal/Hacl_Hash_SHA1.h"
 #include "internal/Hacl_Hash_MD5.h"
+#include "internal/EverCrypt_Instrumentation.h"
 #include "config.h"
 
 #define MD5_s 0
@@ -409,6 +410,177 @@ void EverCrypt_Hash_update_multi_256(uint32_t *s, uint8_t *blocks, uint32_t n)
   #endif
 }
 
+#if HACL_INSTRUMENTATION
+
+/* The implementation that `EverCrypt_Hash_update_multi_256` dispatches to. */
+static bool sha256_vale(void)
+{
+  #if HACL_CAN_COMPILE_VALE
+  return EverCrypt_AutoConfig2_has_shaext() && EverCrypt_AutoConfig2_has_sse();
+  #else
+  return false;
+  #endif
+}
+
+static EverCrypt_Instrumentation_impl impl_of_state(EverCrypt_Hash_state_s *s)
+{
+  switch ((*s).tag)
+  {
+    case MD5_s:
+      {
+        return EverCrypt_Instrumentation_MD5;
+      }
+    case SHA1_s:
+      {
+        return EverCrypt_Instrumentation_SHA1;
+      }
+    case SHA2_224_s:
+      {
+        if (sha256_vale())
+        {
+          return EverCrypt_Instrumentation_SHA2_224_Vale;
+        }
+        return EverCrypt_Instrumentation_SHA2_224;
+      }
+    case SHA2_256_s:
+      {
+        if (sha256_vale())
+        {
+          return EverCrypt_Instrumentation_SHA2_256_Vale;
+        }
+        return EverCrypt_Instrumentation_SHA2_256;
+      }
+    case SHA2_384_s:
+      {
+        return EverCrypt_Instrumentation_SHA2_384;
+      }
+    case SHA2_512_s:
+      {
+        return EverCrypt_Instrumentation_SHA2_512;
+      }
+    case SHA3_224_s:
+      {
+        return EverCrypt_Instrumentation_SHA3_224;
+      }
+    case SHA3_256_s:
+      {
+        return EverCrypt_Instrumentation_SHA3_256;
+      }
+    case SHA3_384_s:
+      {
+        return EverCrypt_Instrumentation_SHA3_384;
+      }
+    case SHA3_512_s:
+      {
+        return EverCrypt_Instrumentation_SHA3_512;
+      }
+    case Blake2S_s:
+      {
+        return EverCrypt_Instrumentation_Blake2S_32;
+      }
+    case Blake2S_128_s:
+      {
+        return EverCrypt_Instrumentation_Blake2S_128;
+      }
+    case Blake2B_s:
+      {
+        return EverCrypt_Instrumentation_Blake2B_32;
+      }
+    case Blake2B_256_s:
+      {
+        return EverCrypt_Instrumentation_Blake2B_256;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+/* The implementation that `EverCrypt_Hash_Incremental_hash` dispatches to. */
+static EverCrypt_Instrumentation_impl impl_of_alg(Spec_Hash_Definitions_hash_alg a)
+{
+  switch (a)
+  {
+    case Spec_Hash_Definitions_MD5:
+      {
+        return EverCrypt_Instrumentation_MD5;
+      }
+    case Spec_Hash_Definitions_SHA1:
+      {
+        return EverCrypt_Instrumentation_SHA1;
+      }
+    case Spec_Hash_Definitions_SHA2_224:
+      {
+        if (sha256_vale())
+        {
+          return EverCrypt_Instrumentation_SHA2_224_Vale;
+        }
+        return EverCrypt_Instrumentation_SHA2_224;
+      }
+    case Spec_Hash_Definitions_SHA2_256:
+      {
+        if (sha256_vale())
+        {
+          return EverCrypt_Instrumentation_SHA2_256_Vale;
+        }
+        return EverCrypt_Instrumentation_SHA2_256;
+      }
+    case Spec_Hash_Definitions_SHA2_384:
+      {
+        return EverCrypt_Instrumentation_SHA2_384;
+      }
+    case Spec_Hash_Definitions_SHA2_512:
+      {
+        return EverCrypt_Instrumentation_SHA2_512;
+      }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        return EverCrypt_Instrumentation_SHA3_224;
+      }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        return EverCrypt_Instrumentation_SHA3_256;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        return EverCrypt_Instrumentation_SHA3_384;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        return EverCrypt_Instrumentation_SHA3_512;
+      }
+    case Spec_Hash_Definitions_Blake2S:
+      {
+        #if HACL_CAN_COMPILE_VEC128
+        if (EverCrypt_AutoConfig2_has_vec128())
+        {
+          return EverCrypt_Instrumentation_Blake2S_128;
+        }
+        #endif
+        return EverCrypt_Instrumentation_Blake2S_32;
+      }
+    case Spec_Hash_Definitions_Blake2B:
+      {
+        #if HACL_CAN_COMPILE_VEC256
+        if (EverCrypt_AutoConfig2_has_vec256())
+        {
+          return EverCrypt_Instrumentation_Blake2B_256;
+        }
+        #endif
+        return EverCrypt_Instrumentation_Blake2B_32;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+#endif
+
 static void
 update_multi(EverCrypt_Hash_state_s *s, uint64_t prevlen, uint8_t *blocks, uint32_t len)
 {
@@ -1267,7 +1439,8 @@ static uint32_t block_len(Spec_Hash_Definitions_hash_alg a)
 Allocate initial state for the agile hash. The argument `a` stands for the
 choice of algorithm (see Hacl_Spec.h). This API will automatically pick the most
 efficient implementation, provided you have called EverCrypt_AutoConfig2_init()
-before. The state is to be freed by calling `free`.
+before. The state is to be freed by calling `free`. See `init_in_place` for
+an allocation-free variant.
 */
 EverCrypt_Hash_Incremental_hash_state
 *EverCrypt_Hash_Incremental_create_in(Spec_Hash_Definitions_hash_alg a)
@@ -1287,6 +1460,202 @@ EverCrypt_Hash_Incremental_hash_state
   return p;
 }
 
+/* The in-place layout is the incremental state, the block state, the words of
+   the algorithm state (aligned on EVERCRYPT_HASH_INCREMENTAL_STATE_ALIGN bytes),
+   then the block buffer. The vectorized Blake2 states have the same size as
+   the portable ones, so the size does not depend on the CPU. */
+
+static uint32_t state_len(Spec_Hash_Definitions_hash_alg a)
+{
+  switch (a)
+  {
+    case Spec_Hash_Definitions_MD5:
+      {
+        return (uint32_t)16U;
+      }
+    case Spec_Hash_Definitions_SHA1:
+      {
+        return (uint32_t)20U;
+      }
+    case Spec_Hash_Definitions_SHA2_224:
+      {
+        return (uint32_t)32U;
+      }
+    case Spec_Hash_Definitions_SHA2_256:
+      {
+        return (uint32_t)32U;
+      }
+    case Spec_Hash_Definitions_SHA2_384:
+      {
+        return (uint32_t)64U;
+      }
+    case Spec_Hash_Definitions_SHA2_512:
+      {
+        return (uint32_t)64U;
+      }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        return (uint32_t)200U;
+      }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        return (uint32_t)200U;
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        return (uint32_t)200U;
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        return (uint32_t)200U;
+      }
+    case Spec_Hash_Definitions_Blake2S:
+      {
+        return (uint32_t)64U;
+      }
+    case Spec_Hash_Definitions_Blake2B:
+      {
+        return (uint32_t)128U;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+static uint32_t in_place_header_len(void)
+{
+  uint32_t
+  len =
+    (uint32_t)(sizeof (EverCrypt_Hash_Incremental_hash_state) + sizeof (EverCrypt_Hash_state_s));
+  return
+    (len + EVERCRYPT_HASH_INCREMENTAL_STATE_ALIGN - (uint32_t)1U)
+    & ~(EVERCRYPT_HASH_INCREMENTAL_STATE_ALIGN - (uint32_t)1U);
+}
+
+static EverCrypt_Hash_state_s state_in_place(Spec_Hash_Definitions_hash_alg a, uint8_t *mem)
+{
+  switch (a)
+  {
+    case Spec_Hash_Definitions_MD5:
+      {
+        return ((EverCrypt_Hash_state_s){ .tag = MD5_s, { .case_MD5_s = (uint32_t *)mem } });
+      }
+    case Spec_Hash_Definitions_SHA1:
+      {
+        return ((EverCrypt_Hash_state_s){ .tag = SHA1_s, { .case_SHA1_s = (uint32_t *)mem } });
+      }
+    case Spec_Hash_Definitions_SHA2_224:
+      {
+        return ((EverCrypt_Hash_state_s){ .tag = SHA2_224_s, { .case_SHA2_224_s = (uint32_t *)mem } });
+      }
+    case Spec_Hash_Definitions_SHA2_256:
+      {
+        return ((EverCrypt_Hash_state_s){ .tag = SHA2_256_s, { .case_SHA2_256_s = (uint32_t *)mem } });
+      }
+    case Spec_Hash_Definitions_SHA2_384:
+      {
+        return ((EverCrypt_Hash_state_s){ .tag = SHA2_384_s, { .case_SHA2_384_s = (uint64_t *)mem } });
+      }
+    case Spec_Hash_Definitions_SHA2_512:
+      {
+        return ((EverCrypt_Hash_state_s){ .tag = SHA2_512_s, { .case_SHA2_512_s = (uint64_t *)mem } });
+      }
+    case Spec_Hash_Definitions_SHA3_224:
+      {
+        return ((EverCrypt_Hash_state_s){ .tag = SHA3_224_s, { .case_SHA3_224_s = (uint64_t *)mem } });
+      }
+    case Spec_Hash_Definitions_SHA3_256:
+      {
+        return ((EverCrypt_Hash_state_s){ .tag = SHA3_256_s, { .case_SHA3_256_s = (uint64_t *)mem } });
+      }
+    case Spec_Hash_Definitions_SHA3_384:
+      {
+        return ((EverCrypt_Hash_state_s){ .tag = SHA3_384_s, { .case_SHA3_384_s = (uint64_t *)mem } });
+      }
+    case Spec_Hash_Definitions_SHA3_512:
+      {
+        return ((EverCrypt_Hash_state_s){ .tag = SHA3_512_s, { .case_SHA3_512_s = (uint64_t *)mem } });
+      }
+    case Spec_Hash_Definitions_Blake2S:
+      {
+        #if HACL_CAN_COMPILE_VEC128
+        bool vec128 = EverCrypt_AutoConfig2_has_vec128();
+        if (vec128)
+        {
+          return
+            (
+              (EverCrypt_Hash_state_s){
+                .tag = Blake2S_128_s,
+                { .case_Blake2S_128_s = (Lib_IntVector_Intrinsics_vec128 *)mem }
+              }
+            );
+        }
+        #endif
+        return ((EverCrypt_Hash_state_s){ .tag = Blake2S_s, { .case_Blake2S_s = (uint32_t *)mem } });
+      }
+    case Spec_Hash_Definitions_Blake2B:
+      {
+        #if HACL_CAN_COMPILE_VEC256
+        bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+        if (vec256)
+        {
+          return
+            (
+              (EverCrypt_Hash_state_s){
+                .tag = Blake2B_256_s,
+                { .case_Blake2B_256_s = (Lib_IntVector_Intrinsics_vec256 *)mem }
+              }
+            );
+        }
+        #endif
+        return ((EverCrypt_Hash_state_s){ .tag = Blake2B_s, { .case_Blake2B_s = (uint64_t *)mem } });
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+/**
+Size in bytes of the memory that `init_in_place` needs for a state of algorithm
+`a`. The memory must be aligned on `EVERCRYPT_HASH_INCREMENTAL_STATE_ALIGN` bytes.
+*/
+uint32_t EverCrypt_Hash_Incremental_state_size(Spec_Hash_Definitions_hash_alg a)
+{
+  return in_place_header_len() + state_len(a) + block_len(a);
+}
+
+/**
+Initialize a state for algorithm `a` in caller-provided memory `mem`, of
+`state_size(a)` bytes, and return it. The implementation is picked as in
+`create_in`. The state lives entirely in `mem`, so it can be embedded in a larger
+structure or taken from an arena or a pool: it must not be passed to `free`, and
+`mem` may be reused once the state is no longer needed.
+*/
+EverCrypt_Hash_Incremental_hash_state
+*EverCrypt_Hash_Incremental_init_in_place(Spec_Hash_Definitions_hash_alg a, uint8_t *mem)
+{
+  uint32_t hlen = in_place_header_len();
+  uint32_t slen = state_len(a);
+  EverCrypt_Hash_Incremental_hash_state *p = (EverCrypt_Hash_Incremental_hash_state *)mem;
+  EverCrypt_Hash_state_s
+  *block_state = (EverCrypt_Hash_state_s *)(mem + sizeof (EverCrypt_Hash_Incremental_hash_state));
+  uint8_t *words = mem + hlen;
+  uint8_t *buf = words + slen;
+  memset(words, 0U, (slen + block_len(a)) * sizeof (uint8_t));
+  block_state[0U] = state_in_place(a, words);
+  EverCrypt_Hash_Incremental_hash_state
+  s = { .block_state = block_state, .buf = buf, .total_len = (uint64_t)(uint32_t)0U };
+  p[0U] = s;
+  init(block_state);
+  return p;
+}
+
 /**
 Reset an existing state to the initial hash state with empty data.
 */
@@ -1303,19 +1672,8 @@ void EverCrypt_Hash_Incremental_init(EverCrypt_Hash_Incremental_hash_state *s)
   s[0U] = tmp;
 }
 
-/**
-Feed an arbitrary amount of data into the hash. This function returns
-EverCrypt_Error_Success for success, or EverCrypt_Error_MaximumLengthExceeded if
-the combined length of all of the data passed to `update` (since the last call
-to `init`) exceeds 2^61-1 bytes or 2^64-1 bytes, depending on the choice of
-algorithm. Both limits are unlikely to be attained in practice.
-*/
-EverCrypt_Error_error_code
-EverCrypt_Hash_Incremental_update(
-  EverCrypt_Hash_Incremental_hash_state *s,
-  uint8_t *data,
-  uint32_t len
-)
+static EverCrypt_Error_error_code
+update_incremental(EverCrypt_Hash_Incremental_hash_state *s, uint8_t *data, uint32_t len)
 {
   EverCrypt_Hash_Incremental_hash_state s1 = *s;
   EverCrypt_Hash_state_s *block_state = s1.block_state;
@@ -1592,6 +1950,26 @@ EverCrypt_Hash_Incremental_update(
   }
 }
 
+/**
+Feed an arbitrary amount of data into the hash. This function returns
+EverCrypt_Error_Success for success, or EverCrypt_Error_MaximumLengthExceeded if
+the combined length of all of the data passed to `update` (since the last call
+to `init`) exceeds 2^61-1 bytes or 2^64-1 bytes, depending on the choice of
+algorithm. Both limits are unlikely to be attained in practice.
+*/
+EverCrypt_Error_error_code
+EverCrypt_Hash_Incremental_update(
+  EverCrypt_Hash_Incremental_hash_state *s,
+  uint8_t *data,
+  uint32_t len
+)
+{
+  EVERCRYPT_INSTRUMENTATION_ENTER(impl_of_state((*s).block_state), len);
+  EverCrypt_Error_error_code r = update_incremental(s, data, len);
+  EVERCRYPT_INSTRUMENTATION_EXIT(impl_of_state((*s).block_state), len);
+  return r;
+}
+
 static void finish_md5(EverCrypt_Hash_Incremental_hash_state *p, uint8_t *dst)
 {
   EverCrypt_Hash_Incremental_hash_state scrut = *p;
@@ -2330,20 +2708,8 @@ static void hash_224(uint8_t *input, uint32_t input_len, uint8_t *dst)
   Hacl_SHA2_Scalar32_sha224_finish(s, dst);
 }
 
-/**
-Hash `input`, of len `len`, into `dst`, an array whose length is determined by
-your choice of algorithm `a` (see Hacl_Spec.h). You can use the macros defined
-earlier in this file to allocate a destination buffer of the right length. This
-API will automatically pick the most efficient implementation, provided you have
-called EverCrypt_AutoConfig2_init() before. 
-*/
-void
-EverCrypt_Hash_Incremental_hash(
-  Spec_Hash_Definitions_hash_alg a,
-  uint8_t *dst,
-  uint8_t *input,
-  uint32_t len
-)
+static void
+hash_(Spec_Hash_Definitions_hash_alg a, uint8_t *dst, uint8_t *input, uint32_t len)
 {
   switch (a)
   {
@@ -2435,3 +2801,47 @@ EverCrypt_Hash_Incremental_hash(
   }
 }
 
+/**
+Hash `input`, of len `len`, into `dst`, an array whose length is determined by
+your choice of algorithm `a` (see Hacl_Spec.h). You can use the macros defined
+earlier in this file to allocate a destination buffer of the right length. This
+API will automatically pick the most efficient implementation, provided you have
+called EverCrypt_AutoConfig2_init() before. 
+*/
+void
+EverCrypt_Hash_Incremental_hash(
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t *dst,
+  uint8_t *input,
+  uint32_t len
+)
+{
+  EVERCRYPT_INSTRUMENTATION_ENTER(impl_of_alg(a), len);
+  hash_(a, dst, input, len);
+  EVERCRYPT_INSTRUMENTATION_EXIT(impl_of_alg(a), len);
+}
+
+/**
+Hash a batch of `n` messages with one call.
+
+The messages are read back to back from `input`, the `i`-th one taking
+`input_len[i]` bytes, and the digests are written back to back to `dst`, each
+taking `EverCrypt_Hash_Incremental_hash_len(a)` bytes.
+*/
+void
+EverCrypt_Hash_Incremental_hash_batch(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t n,
+  uint8_t *dst,
+  uint8_t *input,
+  uint32_t *input_len
+)
+{
+  uint32_t hash_len = EverCrypt_Hash_Incremental_hash_len(a);
+  uint8_t *msg = input;
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    EverCrypt_Hash_Incremental_hash(a, dst + i * hash_len, msg, input_len[i]);
+    msg = msg + input_len[i];
+  }
+}
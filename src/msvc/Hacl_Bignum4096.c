@@ -27,6 +27,10 @@
 
 #include "internal/Hacl_Bignum_Base.h"
 #include "internal/Hacl_Bignum.h"
+#include "internal/Hacl_Bignum_ADX.h"
+#include "internal/Hacl_Bignum_IFMA.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "config.h"
 
 /*******************************************************************************
 
@@ -292,32 +296,39 @@ static inline void precompr2(uint32_t nBits, uint64_t *n, uint64_t *res)
 static inline void reduction(uint64_t *n, uint64_t nInv, uint64_t *c, uint64_t *res)
 {
   uint64_t c0 = (uint64_t)0U;
-  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)64U; i0++)
+  if (Hacl_Bignum_ADX_is_available())
   {
-    uint64_t qj = nInv * c[i0];
-    uint64_t *res_j0 = c + i0;
-    uint64_t c1 = (uint64_t)0U;
-    KRML_MAYBE_FOR16(i,
-      (uint32_t)0U,
-      (uint32_t)16U,
-      (uint32_t)1U,
-      uint64_t a_i = n[(uint32_t)4U * i];
-      uint64_t *res_i0 = res_j0 + (uint32_t)4U * i;
-      c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, qj, c1, res_i0);
-      uint64_t a_i0 = n[(uint32_t)4U * i + (uint32_t)1U];
-      uint64_t *res_i1 = res_j0 + (uint32_t)4U * i + (uint32_t)1U;
-      c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i0, qj, c1, res_i1);
-      uint64_t a_i1 = n[(uint32_t)4U * i + (uint32_t)2U];
-      uint64_t *res_i2 = res_j0 + (uint32_t)4U * i + (uint32_t)2U;
-      c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i1, qj, c1, res_i2);
-      uint64_t a_i2 = n[(uint32_t)4U * i + (uint32_t)3U];
-      uint64_t *res_i = res_j0 + (uint32_t)4U * i + (uint32_t)3U;
-      c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i2, qj, c1, res_i););
-    uint64_t r = c1;
-    uint64_t c10 = r;
-    uint64_t *resb = c + (uint32_t)64U + i0;
-    uint64_t res_j = c[(uint32_t)64U + i0];
-    c0 = Lib_IntTypes_Intrinsics_add_carry_u64(c0, c10, res_j, resb);
+    c0 = Hacl_Bignum_ADX_bn_mont_reduction_loop_u64((uint32_t)64U, n, nInv, c);
+  }
+  else
+  {
+    for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)64U; i0++)
+    {
+      uint64_t qj = nInv * c[i0];
+      uint64_t *res_j0 = c + i0;
+      uint64_t c1 = (uint64_t)0U;
+      KRML_MAYBE_FOR16(i,
+        (uint32_t)0U,
+        (uint32_t)16U,
+        (uint32_t)1U,
+        uint64_t a_i = n[(uint32_t)4U * i];
+        uint64_t *res_i0 = res_j0 + (uint32_t)4U * i;
+        c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, qj, c1, res_i0);
+        uint64_t a_i0 = n[(uint32_t)4U * i + (uint32_t)1U];
+        uint64_t *res_i1 = res_j0 + (uint32_t)4U * i + (uint32_t)1U;
+        c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i0, qj, c1, res_i1);
+        uint64_t a_i1 = n[(uint32_t)4U * i + (uint32_t)2U];
+        uint64_t *res_i2 = res_j0 + (uint32_t)4U * i + (uint32_t)2U;
+        c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i1, qj, c1, res_i2);
+        uint64_t a_i2 = n[(uint32_t)4U * i + (uint32_t)3U];
+        uint64_t *res_i = res_j0 + (uint32_t)4U * i + (uint32_t)3U;
+        c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i2, qj, c1, res_i););
+      uint64_t r = c1;
+      uint64_t c10 = r;
+      uint64_t *resb = c + (uint32_t)64U + i0;
+      uint64_t res_j = c[(uint32_t)64U + i0];
+      c0 = Lib_IntTypes_Intrinsics_add_carry_u64(c0, c10, res_j, resb);
+    }
   }
   memcpy(res, c + (uint32_t)64U, (uint32_t)64U * sizeof (uint64_t));
   uint64_t c00 = c0;
@@ -363,32 +374,39 @@ static inline void from(uint64_t *n, uint64_t nInv_u64, uint64_t *aM, uint64_t *
 static inline void areduction(uint64_t *n, uint64_t nInv, uint64_t *c, uint64_t *res)
 {
   uint64_t c0 = (uint64_t)0U;
-  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)64U; i0++)
+  if (Hacl_Bignum_ADX_is_available())
   {
-    uint64_t qj = nInv * c[i0];
-    uint64_t *res_j0 = c + i0;
-    uint64_t c1 = (uint64_t)0U;
-    KRML_MAYBE_FOR16(i,
-      (uint32_t)0U,
-      (uint32_t)16U,
-      (uint32_t)1U,
-      uint64_t a_i = n[(uint32_t)4U * i];
-      uint64_t *res_i0 = res_j0 + (uint32_t)4U * i;
-      c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, qj, c1, res_i0);
-      uint64_t a_i0 = n[(uint32_t)4U * i + (uint32_t)1U];
-      uint64_t *res_i1 = res_j0 + (uint32_t)4U * i + (uint32_t)1U;
-      c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i0, qj, c1, res_i1);
-      uint64_t a_i1 = n[(uint32_t)4U * i + (uint32_t)2U];
-      uint64_t *res_i2 = res_j0 + (uint32_t)4U * i + (uint32_t)2U;
-      c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i1, qj, c1, res_i2);
-      uint64_t a_i2 = n[(uint32_t)4U * i + (uint32_t)3U];
-      uint64_t *res_i = res_j0 + (uint32_t)4U * i + (uint32_t)3U;
-      c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i2, qj, c1, res_i););
-    uint64_t r = c1;
-    uint64_t c10 = r;
-    uint64_t *resb = c + (uint32_t)64U + i0;
-    uint64_t res_j = c[(uint32_t)64U + i0];
-    c0 = Lib_IntTypes_Intrinsics_add_carry_u64(c0, c10, res_j, resb);
+    c0 = Hacl_Bignum_ADX_bn_mont_reduction_loop_u64((uint32_t)64U, n, nInv, c);
+  }
+  else
+  {
+    for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)64U; i0++)
+    {
+      uint64_t qj = nInv * c[i0];
+      uint64_t *res_j0 = c + i0;
+      uint64_t c1 = (uint64_t)0U;
+      KRML_MAYBE_FOR16(i,
+        (uint32_t)0U,
+        (uint32_t)16U,
+        (uint32_t)1U,
+        uint64_t a_i = n[(uint32_t)4U * i];
+        uint64_t *res_i0 = res_j0 + (uint32_t)4U * i;
+        c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, qj, c1, res_i0);
+        uint64_t a_i0 = n[(uint32_t)4U * i + (uint32_t)1U];
+        uint64_t *res_i1 = res_j0 + (uint32_t)4U * i + (uint32_t)1U;
+        c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i0, qj, c1, res_i1);
+        uint64_t a_i1 = n[(uint32_t)4U * i + (uint32_t)2U];
+        uint64_t *res_i2 = res_j0 + (uint32_t)4U * i + (uint32_t)2U;
+        c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i1, qj, c1, res_i2);
+        uint64_t a_i2 = n[(uint32_t)4U * i + (uint32_t)3U];
+        uint64_t *res_i = res_j0 + (uint32_t)4U * i + (uint32_t)3U;
+        c1 = Hacl_Bignum_Base_mul_wide_add2_u64(a_i2, qj, c1, res_i););
+      uint64_t r = c1;
+      uint64_t c10 = r;
+      uint64_t *resb = c + (uint32_t)64U + i0;
+      uint64_t res_j = c[(uint32_t)64U + i0];
+      c0 = Lib_IntTypes_Intrinsics_add_carry_u64(c0, c10, res_j, resb);
+    }
   }
   memcpy(res, c + (uint32_t)64U, (uint32_t)64U * sizeof (uint64_t));
   uint64_t c00 = c0;
@@ -428,32 +446,39 @@ bn_slow_precomp(uint64_t *n, uint64_t mu, uint64_t *r2, uint64_t *a, uint64_t *r
   uint64_t a1[128U] = { 0U };
   memcpy(a1, a, (uint32_t)128U * sizeof (uint64_t));
   uint64_t c0 = (uint64_t)0U;
-  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)64U; i0++)
+  if (Hacl_Bignum_ADX_is_available())
   {
-    uint64_t qj = mu * a1[i0];
-    uint64_t *res_j0 = a1 + i0;
-    uint64_t c = (uint64_t)0U;
-    KRML_MAYBE_FOR16(i,
-      (uint32_t)0U,
-      (uint32_t)16U,
-      (uint32_t)1U,
-      uint64_t a_i = n[(uint32_t)4U * i];
-      uint64_t *res_i0 = res_j0 + (uint32_t)4U * i;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, qj, c, res_i0);
-      uint64_t a_i0 = n[(uint32_t)4U * i + (uint32_t)1U];
-      uint64_t *res_i1 = res_j0 + (uint32_t)4U * i + (uint32_t)1U;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i0, qj, c, res_i1);
-      uint64_t a_i1 = n[(uint32_t)4U * i + (uint32_t)2U];
-      uint64_t *res_i2 = res_j0 + (uint32_t)4U * i + (uint32_t)2U;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i1, qj, c, res_i2);
-      uint64_t a_i2 = n[(uint32_t)4U * i + (uint32_t)3U];
-      uint64_t *res_i = res_j0 + (uint32_t)4U * i + (uint32_t)3U;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i2, qj, c, res_i););
-    uint64_t r = c;
-    uint64_t c1 = r;
-    uint64_t *resb = a1 + (uint32_t)64U + i0;
-    uint64_t res_j = a1[(uint32_t)64U + i0];
-    c0 = Lib_IntTypes_Intrinsics_add_carry_u64(c0, c1, res_j, resb);
+    c0 = Hacl_Bignum_ADX_bn_mont_reduction_loop_u64((uint32_t)64U, n, mu, a1);
+  }
+  else
+  {
+    for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)64U; i0++)
+    {
+      uint64_t qj = mu * a1[i0];
+      uint64_t *res_j0 = a1 + i0;
+      uint64_t c = (uint64_t)0U;
+      KRML_MAYBE_FOR16(i,
+        (uint32_t)0U,
+        (uint32_t)16U,
+        (uint32_t)1U,
+        uint64_t a_i = n[(uint32_t)4U * i];
+        uint64_t *res_i0 = res_j0 + (uint32_t)4U * i;
+        c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, qj, c, res_i0);
+        uint64_t a_i0 = n[(uint32_t)4U * i + (uint32_t)1U];
+        uint64_t *res_i1 = res_j0 + (uint32_t)4U * i + (uint32_t)1U;
+        c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i0, qj, c, res_i1);
+        uint64_t a_i1 = n[(uint32_t)4U * i + (uint32_t)2U];
+        uint64_t *res_i2 = res_j0 + (uint32_t)4U * i + (uint32_t)2U;
+        c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i1, qj, c, res_i2);
+        uint64_t a_i2 = n[(uint32_t)4U * i + (uint32_t)3U];
+        uint64_t *res_i = res_j0 + (uint32_t)4U * i + (uint32_t)3U;
+        c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i2, qj, c, res_i););
+      uint64_t r = c;
+      uint64_t c1 = r;
+      uint64_t *resb = a1 + (uint32_t)64U + i0;
+      uint64_t res_j = a1[(uint32_t)64U + i0];
+      c0 = Lib_IntTypes_Intrinsics_add_carry_u64(c0, c1, res_j, resb);
+    }
   }
   memcpy(a_mod, a1 + (uint32_t)64U, (uint32_t)64U * sizeof (uint64_t));
   uint64_t c00 = c0;
@@ -586,6 +611,13 @@ exp_vartime_precomp(
   uint64_t *res
 )
 {
+  #if HACL_CAN_COMPILE_IFMA
+  if (EverCrypt_AutoConfig2_has_avx512ifma())
+  {
+    Hacl_Bignum_IFMA_bn_mod_exp_vartime_precomp_u64((uint32_t)64U, n, mu, r2, a, bBits, b, res);
+    return;
+  }
+  #endif
   if (bBits < (uint32_t)200U)
   {
     uint64_t aM[64U] = { 0U };
@@ -706,6 +738,13 @@ exp_consttime_precomp(
   uint64_t *res
 )
 {
+  #if HACL_CAN_COMPILE_IFMA
+  if (EverCrypt_AutoConfig2_has_avx512ifma())
+  {
+    Hacl_Bignum_IFMA_bn_mod_exp_consttime_precomp_u64((uint32_t)64U, n, mu, r2, a, bBits, b, res);
+    return;
+  }
+  #endif
   if (bBits < (uint32_t)200U)
   {
     uint64_t aM[64U] = { 0U };
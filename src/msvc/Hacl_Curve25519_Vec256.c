@@ -0,0 +1,1056 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_Curve25519_Vec256.h"
+
+#include "internal/Hacl_Krmllib.h"
+#include "internal/Hacl_Bignum25519_51.h"
+#include "libintvector.h"
+
+static const uint8_t g25519[32U] = { (uint8_t)9U };
+
+static inline void
+carry_wide(Lib_IntVector_Intrinsics_vec256 *out, Lib_IntVector_Intrinsics_vec256 *inp)
+{
+  Lib_IntVector_Intrinsics_vec256
+  mask26 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3ffffffU);
+  Lib_IntVector_Intrinsics_vec256
+  mask25 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x1ffffffU);
+  Lib_IntVector_Intrinsics_vec256 h0 = inp[0U];
+  Lib_IntVector_Intrinsics_vec256 h1 = inp[1U];
+  Lib_IntVector_Intrinsics_vec256 h2 = inp[2U];
+  Lib_IntVector_Intrinsics_vec256 h3 = inp[3U];
+  Lib_IntVector_Intrinsics_vec256 h4 = inp[4U];
+  Lib_IntVector_Intrinsics_vec256 h5 = inp[5U];
+  Lib_IntVector_Intrinsics_vec256 h6 = inp[6U];
+  Lib_IntVector_Intrinsics_vec256 h7 = inp[7U];
+  Lib_IntVector_Intrinsics_vec256 h8 = inp[8U];
+  Lib_IntVector_Intrinsics_vec256 h9 = inp[9U];
+  Lib_IntVector_Intrinsics_vec256
+  c00 = Lib_IntVector_Intrinsics_vec256_shift_right64(h0, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec256 h01 = Lib_IntVector_Intrinsics_vec256_and(h0, mask26);
+  Lib_IntVector_Intrinsics_vec256 h11 = Lib_IntVector_Intrinsics_vec256_add64(h1, c00);
+  Lib_IntVector_Intrinsics_vec256
+  c40 = Lib_IntVector_Intrinsics_vec256_shift_right64(h4, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec256 h41 = Lib_IntVector_Intrinsics_vec256_and(h4, mask26);
+  Lib_IntVector_Intrinsics_vec256 h51 = Lib_IntVector_Intrinsics_vec256_add64(h5, c40);
+  Lib_IntVector_Intrinsics_vec256
+  c11 = Lib_IntVector_Intrinsics_vec256_shift_right64(h11, (uint32_t)25U);
+  Lib_IntVector_Intrinsics_vec256 h12 = Lib_IntVector_Intrinsics_vec256_and(h11, mask25);
+  Lib_IntVector_Intrinsics_vec256 h21 = Lib_IntVector_Intrinsics_vec256_add64(h2, c11);
+  Lib_IntVector_Intrinsics_vec256
+  c51 = Lib_IntVector_Intrinsics_vec256_shift_right64(h51, (uint32_t)25U);
+  Lib_IntVector_Intrinsics_vec256 h52 = Lib_IntVector_Intrinsics_vec256_and(h51, mask25);
+  Lib_IntVector_Intrinsics_vec256 h61 = Lib_IntVector_Intrinsics_vec256_add64(h6, c51);
+  Lib_IntVector_Intrinsics_vec256
+  c21 = Lib_IntVector_Intrinsics_vec256_shift_right64(h21, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec256 h22 = Lib_IntVector_Intrinsics_vec256_and(h21, mask26);
+  Lib_IntVector_Intrinsics_vec256 h31 = Lib_IntVector_Intrinsics_vec256_add64(h3, c21);
+  Lib_IntVector_Intrinsics_vec256
+  c61 = Lib_IntVector_Intrinsics_vec256_shift_right64(h61, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec256 h62 = Lib_IntVector_Intrinsics_vec256_and(h61, mask26);
+  Lib_IntVector_Intrinsics_vec256 h71 = Lib_IntVector_Intrinsics_vec256_add64(h7, c61);
+  Lib_IntVector_Intrinsics_vec256
+  c31 = Lib_IntVector_Intrinsics_vec256_shift_right64(h31, (uint32_t)25U);
+  Lib_IntVector_Intrinsics_vec256 h32 = Lib_IntVector_Intrinsics_vec256_and(h31, mask25);
+  Lib_IntVector_Intrinsics_vec256 h42 = Lib_IntVector_Intrinsics_vec256_add64(h41, c31);
+  Lib_IntVector_Intrinsics_vec256
+  c71 = Lib_IntVector_Intrinsics_vec256_shift_right64(h71, (uint32_t)25U);
+  Lib_IntVector_Intrinsics_vec256 h72 = Lib_IntVector_Intrinsics_vec256_and(h71, mask25);
+  Lib_IntVector_Intrinsics_vec256 h81 = Lib_IntVector_Intrinsics_vec256_add64(h8, c71);
+  Lib_IntVector_Intrinsics_vec256
+  c42 = Lib_IntVector_Intrinsics_vec256_shift_right64(h42, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec256 h43 = Lib_IntVector_Intrinsics_vec256_and(h42, mask26);
+  Lib_IntVector_Intrinsics_vec256 h53 = Lib_IntVector_Intrinsics_vec256_add64(h52, c42);
+  Lib_IntVector_Intrinsics_vec256
+  c81 = Lib_IntVector_Intrinsics_vec256_shift_right64(h81, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec256 h82 = Lib_IntVector_Intrinsics_vec256_and(h81, mask26);
+  Lib_IntVector_Intrinsics_vec256 h91 = Lib_IntVector_Intrinsics_vec256_add64(h9, c81);
+  Lib_IntVector_Intrinsics_vec256
+  c91 = Lib_IntVector_Intrinsics_vec256_shift_right64(h91, (uint32_t)25U);
+  Lib_IntVector_Intrinsics_vec256 h92 = Lib_IntVector_Intrinsics_vec256_and(h91, mask25);
+  Lib_IntVector_Intrinsics_vec256
+  c91_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(c91, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  c91_16 = Lib_IntVector_Intrinsics_vec256_shift_left64(c91, (uint32_t)4U);
+  Lib_IntVector_Intrinsics_vec256
+  c91_19 =
+    Lib_IntVector_Intrinsics_vec256_add64(c91,
+      Lib_IntVector_Intrinsics_vec256_add64(c91_2, c91_16));
+  Lib_IntVector_Intrinsics_vec256 h02 = Lib_IntVector_Intrinsics_vec256_add64(h01, c91_19);
+  Lib_IntVector_Intrinsics_vec256
+  c02 = Lib_IntVector_Intrinsics_vec256_shift_right64(h02, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec256 h03 = Lib_IntVector_Intrinsics_vec256_and(h02, mask26);
+  Lib_IntVector_Intrinsics_vec256 h13 = Lib_IntVector_Intrinsics_vec256_add64(h12, c02);
+  out[0U] = h03;
+  out[1U] = h13;
+  out[2U] = h22;
+  out[3U] = h32;
+  out[4U] = h43;
+  out[5U] = h53;
+  out[6U] = h62;
+  out[7U] = h72;
+  out[8U] = h82;
+  out[9U] = h92;
+}
+
+static inline void
+fmul(
+  Lib_IntVector_Intrinsics_vec256 *out,
+  Lib_IntVector_Intrinsics_vec256 *f1,
+  Lib_IntVector_Intrinsics_vec256 *f2
+)
+{
+  Lib_IntVector_Intrinsics_vec256 r19 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)19U);
+  Lib_IntVector_Intrinsics_vec256 f10 = f1[0U];
+  Lib_IntVector_Intrinsics_vec256 f11 = f1[1U];
+  Lib_IntVector_Intrinsics_vec256 f12 = f1[2U];
+  Lib_IntVector_Intrinsics_vec256 f13 = f1[3U];
+  Lib_IntVector_Intrinsics_vec256 f14 = f1[4U];
+  Lib_IntVector_Intrinsics_vec256 f15 = f1[5U];
+  Lib_IntVector_Intrinsics_vec256 f16 = f1[6U];
+  Lib_IntVector_Intrinsics_vec256 f17 = f1[7U];
+  Lib_IntVector_Intrinsics_vec256 f18 = f1[8U];
+  Lib_IntVector_Intrinsics_vec256 f19 = f1[9U];
+  Lib_IntVector_Intrinsics_vec256 f20 = f2[0U];
+  Lib_IntVector_Intrinsics_vec256 f21 = f2[1U];
+  Lib_IntVector_Intrinsics_vec256 f22 = f2[2U];
+  Lib_IntVector_Intrinsics_vec256 f23 = f2[3U];
+  Lib_IntVector_Intrinsics_vec256 f24 = f2[4U];
+  Lib_IntVector_Intrinsics_vec256 f25 = f2[5U];
+  Lib_IntVector_Intrinsics_vec256 f26 = f2[6U];
+  Lib_IntVector_Intrinsics_vec256 f27 = f2[7U];
+  Lib_IntVector_Intrinsics_vec256 f28 = f2[8U];
+  Lib_IntVector_Intrinsics_vec256 f29 = f2[9U];
+  Lib_IntVector_Intrinsics_vec256
+  f11_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f11, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  f13_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f13, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  f15_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f15, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  f17_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f17, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  f19_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f19, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256 f21_19 = Lib_IntVector_Intrinsics_vec256_mul64(f21, r19);
+  Lib_IntVector_Intrinsics_vec256 f22_19 = Lib_IntVector_Intrinsics_vec256_mul64(f22, r19);
+  Lib_IntVector_Intrinsics_vec256 f23_19 = Lib_IntVector_Intrinsics_vec256_mul64(f23, r19);
+  Lib_IntVector_Intrinsics_vec256 f24_19 = Lib_IntVector_Intrinsics_vec256_mul64(f24, r19);
+  Lib_IntVector_Intrinsics_vec256 f25_19 = Lib_IntVector_Intrinsics_vec256_mul64(f25, r19);
+  Lib_IntVector_Intrinsics_vec256 f26_19 = Lib_IntVector_Intrinsics_vec256_mul64(f26, r19);
+  Lib_IntVector_Intrinsics_vec256 f27_19 = Lib_IntVector_Intrinsics_vec256_mul64(f27, r19);
+  Lib_IntVector_Intrinsics_vec256 f28_19 = Lib_IntVector_Intrinsics_vec256_mul64(f28, r19);
+  Lib_IntVector_Intrinsics_vec256 f29_19 = Lib_IntVector_Intrinsics_vec256_mul64(f29, r19);
+  Lib_IntVector_Intrinsics_vec256 a00 = Lib_IntVector_Intrinsics_vec256_mul64(f10, f20);
+  Lib_IntVector_Intrinsics_vec256
+  a01 =
+    Lib_IntVector_Intrinsics_vec256_add64(a00,
+      Lib_IntVector_Intrinsics_vec256_mul64(f11_2, f29_19));
+  Lib_IntVector_Intrinsics_vec256
+  a02 =
+    Lib_IntVector_Intrinsics_vec256_add64(a01,
+      Lib_IntVector_Intrinsics_vec256_mul64(f12, f28_19));
+  Lib_IntVector_Intrinsics_vec256
+  a03 =
+    Lib_IntVector_Intrinsics_vec256_add64(a02,
+      Lib_IntVector_Intrinsics_vec256_mul64(f13_2, f27_19));
+  Lib_IntVector_Intrinsics_vec256
+  a04 =
+    Lib_IntVector_Intrinsics_vec256_add64(a03,
+      Lib_IntVector_Intrinsics_vec256_mul64(f14, f26_19));
+  Lib_IntVector_Intrinsics_vec256
+  a05 =
+    Lib_IntVector_Intrinsics_vec256_add64(a04,
+      Lib_IntVector_Intrinsics_vec256_mul64(f15_2, f25_19));
+  Lib_IntVector_Intrinsics_vec256
+  a06 =
+    Lib_IntVector_Intrinsics_vec256_add64(a05,
+      Lib_IntVector_Intrinsics_vec256_mul64(f16, f24_19));
+  Lib_IntVector_Intrinsics_vec256
+  a07 =
+    Lib_IntVector_Intrinsics_vec256_add64(a06,
+      Lib_IntVector_Intrinsics_vec256_mul64(f17_2, f23_19));
+  Lib_IntVector_Intrinsics_vec256
+  a08 =
+    Lib_IntVector_Intrinsics_vec256_add64(a07,
+      Lib_IntVector_Intrinsics_vec256_mul64(f18, f22_19));
+  Lib_IntVector_Intrinsics_vec256
+  a09 =
+    Lib_IntVector_Intrinsics_vec256_add64(a08,
+      Lib_IntVector_Intrinsics_vec256_mul64(f19_2, f21_19));
+  Lib_IntVector_Intrinsics_vec256 a10 = Lib_IntVector_Intrinsics_vec256_mul64(f10, f21);
+  Lib_IntVector_Intrinsics_vec256
+  a11 = Lib_IntVector_Intrinsics_vec256_add64(a10, Lib_IntVector_Intrinsics_vec256_mul64(f11, f20));
+  Lib_IntVector_Intrinsics_vec256
+  a12 =
+    Lib_IntVector_Intrinsics_vec256_add64(a11,
+      Lib_IntVector_Intrinsics_vec256_mul64(f12, f29_19));
+  Lib_IntVector_Intrinsics_vec256
+  a13 =
+    Lib_IntVector_Intrinsics_vec256_add64(a12,
+      Lib_IntVector_Intrinsics_vec256_mul64(f13, f28_19));
+  Lib_IntVector_Intrinsics_vec256
+  a14 =
+    Lib_IntVector_Intrinsics_vec256_add64(a13,
+      Lib_IntVector_Intrinsics_vec256_mul64(f14, f27_19));
+  Lib_IntVector_Intrinsics_vec256
+  a15 =
+    Lib_IntVector_Intrinsics_vec256_add64(a14,
+      Lib_IntVector_Intrinsics_vec256_mul64(f15, f26_19));
+  Lib_IntVector_Intrinsics_vec256
+  a16 =
+    Lib_IntVector_Intrinsics_vec256_add64(a15,
+      Lib_IntVector_Intrinsics_vec256_mul64(f16, f25_19));
+  Lib_IntVector_Intrinsics_vec256
+  a17 =
+    Lib_IntVector_Intrinsics_vec256_add64(a16,
+      Lib_IntVector_Intrinsics_vec256_mul64(f17, f24_19));
+  Lib_IntVector_Intrinsics_vec256
+  a18 =
+    Lib_IntVector_Intrinsics_vec256_add64(a17,
+      Lib_IntVector_Intrinsics_vec256_mul64(f18, f23_19));
+  Lib_IntVector_Intrinsics_vec256
+  a19 =
+    Lib_IntVector_Intrinsics_vec256_add64(a18,
+      Lib_IntVector_Intrinsics_vec256_mul64(f19, f22_19));
+  Lib_IntVector_Intrinsics_vec256 a20 = Lib_IntVector_Intrinsics_vec256_mul64(f10, f22);
+  Lib_IntVector_Intrinsics_vec256
+  a21 =
+    Lib_IntVector_Intrinsics_vec256_add64(a20,
+      Lib_IntVector_Intrinsics_vec256_mul64(f11_2, f21));
+  Lib_IntVector_Intrinsics_vec256
+  a22 = Lib_IntVector_Intrinsics_vec256_add64(a21, Lib_IntVector_Intrinsics_vec256_mul64(f12, f20));
+  Lib_IntVector_Intrinsics_vec256
+  a23 =
+    Lib_IntVector_Intrinsics_vec256_add64(a22,
+      Lib_IntVector_Intrinsics_vec256_mul64(f13_2, f29_19));
+  Lib_IntVector_Intrinsics_vec256
+  a24 =
+    Lib_IntVector_Intrinsics_vec256_add64(a23,
+      Lib_IntVector_Intrinsics_vec256_mul64(f14, f28_19));
+  Lib_IntVector_Intrinsics_vec256
+  a25 =
+    Lib_IntVector_Intrinsics_vec256_add64(a24,
+      Lib_IntVector_Intrinsics_vec256_mul64(f15_2, f27_19));
+  Lib_IntVector_Intrinsics_vec256
+  a26 =
+    Lib_IntVector_Intrinsics_vec256_add64(a25,
+      Lib_IntVector_Intrinsics_vec256_mul64(f16, f26_19));
+  Lib_IntVector_Intrinsics_vec256
+  a27 =
+    Lib_IntVector_Intrinsics_vec256_add64(a26,
+      Lib_IntVector_Intrinsics_vec256_mul64(f17_2, f25_19));
+  Lib_IntVector_Intrinsics_vec256
+  a28 =
+    Lib_IntVector_Intrinsics_vec256_add64(a27,
+      Lib_IntVector_Intrinsics_vec256_mul64(f18, f24_19));
+  Lib_IntVector_Intrinsics_vec256
+  a29 =
+    Lib_IntVector_Intrinsics_vec256_add64(a28,
+      Lib_IntVector_Intrinsics_vec256_mul64(f19_2, f23_19));
+  Lib_IntVector_Intrinsics_vec256 a30 = Lib_IntVector_Intrinsics_vec256_mul64(f10, f23);
+  Lib_IntVector_Intrinsics_vec256
+  a31 = Lib_IntVector_Intrinsics_vec256_add64(a30, Lib_IntVector_Intrinsics_vec256_mul64(f11, f22));
+  Lib_IntVector_Intrinsics_vec256
+  a32 = Lib_IntVector_Intrinsics_vec256_add64(a31, Lib_IntVector_Intrinsics_vec256_mul64(f12, f21));
+  Lib_IntVector_Intrinsics_vec256
+  a33 = Lib_IntVector_Intrinsics_vec256_add64(a32, Lib_IntVector_Intrinsics_vec256_mul64(f13, f20));
+  Lib_IntVector_Intrinsics_vec256
+  a34 =
+    Lib_IntVector_Intrinsics_vec256_add64(a33,
+      Lib_IntVector_Intrinsics_vec256_mul64(f14, f29_19));
+  Lib_IntVector_Intrinsics_vec256
+  a35 =
+    Lib_IntVector_Intrinsics_vec256_add64(a34,
+      Lib_IntVector_Intrinsics_vec256_mul64(f15, f28_19));
+  Lib_IntVector_Intrinsics_vec256
+  a36 =
+    Lib_IntVector_Intrinsics_vec256_add64(a35,
+      Lib_IntVector_Intrinsics_vec256_mul64(f16, f27_19));
+  Lib_IntVector_Intrinsics_vec256
+  a37 =
+    Lib_IntVector_Intrinsics_vec256_add64(a36,
+      Lib_IntVector_Intrinsics_vec256_mul64(f17, f26_19));
+  Lib_IntVector_Intrinsics_vec256
+  a38 =
+    Lib_IntVector_Intrinsics_vec256_add64(a37,
+      Lib_IntVector_Intrinsics_vec256_mul64(f18, f25_19));
+  Lib_IntVector_Intrinsics_vec256
+  a39 =
+    Lib_IntVector_Intrinsics_vec256_add64(a38,
+      Lib_IntVector_Intrinsics_vec256_mul64(f19, f24_19));
+  Lib_IntVector_Intrinsics_vec256 a40 = Lib_IntVector_Intrinsics_vec256_mul64(f10, f24);
+  Lib_IntVector_Intrinsics_vec256
+  a41 =
+    Lib_IntVector_Intrinsics_vec256_add64(a40,
+      Lib_IntVector_Intrinsics_vec256_mul64(f11_2, f23));
+  Lib_IntVector_Intrinsics_vec256
+  a42 = Lib_IntVector_Intrinsics_vec256_add64(a41, Lib_IntVector_Intrinsics_vec256_mul64(f12, f22));
+  Lib_IntVector_Intrinsics_vec256
+  a43 =
+    Lib_IntVector_Intrinsics_vec256_add64(a42,
+      Lib_IntVector_Intrinsics_vec256_mul64(f13_2, f21));
+  Lib_IntVector_Intrinsics_vec256
+  a44 = Lib_IntVector_Intrinsics_vec256_add64(a43, Lib_IntVector_Intrinsics_vec256_mul64(f14, f20));
+  Lib_IntVector_Intrinsics_vec256
+  a45 =
+    Lib_IntVector_Intrinsics_vec256_add64(a44,
+      Lib_IntVector_Intrinsics_vec256_mul64(f15_2, f29_19));
+  Lib_IntVector_Intrinsics_vec256
+  a46 =
+    Lib_IntVector_Intrinsics_vec256_add64(a45,
+      Lib_IntVector_Intrinsics_vec256_mul64(f16, f28_19));
+  Lib_IntVector_Intrinsics_vec256
+  a47 =
+    Lib_IntVector_Intrinsics_vec256_add64(a46,
+      Lib_IntVector_Intrinsics_vec256_mul64(f17_2, f27_19));
+  Lib_IntVector_Intrinsics_vec256
+  a48 =
+    Lib_IntVector_Intrinsics_vec256_add64(a47,
+      Lib_IntVector_Intrinsics_vec256_mul64(f18, f26_19));
+  Lib_IntVector_Intrinsics_vec256
+  a49 =
+    Lib_IntVector_Intrinsics_vec256_add64(a48,
+      Lib_IntVector_Intrinsics_vec256_mul64(f19_2, f25_19));
+  Lib_IntVector_Intrinsics_vec256 a50 = Lib_IntVector_Intrinsics_vec256_mul64(f10, f25);
+  Lib_IntVector_Intrinsics_vec256
+  a51 = Lib_IntVector_Intrinsics_vec256_add64(a50, Lib_IntVector_Intrinsics_vec256_mul64(f11, f24));
+  Lib_IntVector_Intrinsics_vec256
+  a52 = Lib_IntVector_Intrinsics_vec256_add64(a51, Lib_IntVector_Intrinsics_vec256_mul64(f12, f23));
+  Lib_IntVector_Intrinsics_vec256
+  a53 = Lib_IntVector_Intrinsics_vec256_add64(a52, Lib_IntVector_Intrinsics_vec256_mul64(f13, f22));
+  Lib_IntVector_Intrinsics_vec256
+  a54 = Lib_IntVector_Intrinsics_vec256_add64(a53, Lib_IntVector_Intrinsics_vec256_mul64(f14, f21));
+  Lib_IntVector_Intrinsics_vec256
+  a55 = Lib_IntVector_Intrinsics_vec256_add64(a54, Lib_IntVector_Intrinsics_vec256_mul64(f15, f20));
+  Lib_IntVector_Intrinsics_vec256
+  a56 =
+    Lib_IntVector_Intrinsics_vec256_add64(a55,
+      Lib_IntVector_Intrinsics_vec256_mul64(f16, f29_19));
+  Lib_IntVector_Intrinsics_vec256
+  a57 =
+    Lib_IntVector_Intrinsics_vec256_add64(a56,
+      Lib_IntVector_Intrinsics_vec256_mul64(f17, f28_19));
+  Lib_IntVector_Intrinsics_vec256
+  a58 =
+    Lib_IntVector_Intrinsics_vec256_add64(a57,
+      Lib_IntVector_Intrinsics_vec256_mul64(f18, f27_19));
+  Lib_IntVector_Intrinsics_vec256
+  a59 =
+    Lib_IntVector_Intrinsics_vec256_add64(a58,
+      Lib_IntVector_Intrinsics_vec256_mul64(f19, f26_19));
+  Lib_IntVector_Intrinsics_vec256 a60 = Lib_IntVector_Intrinsics_vec256_mul64(f10, f26);
+  Lib_IntVector_Intrinsics_vec256
+  a61 =
+    Lib_IntVector_Intrinsics_vec256_add64(a60,
+      Lib_IntVector_Intrinsics_vec256_mul64(f11_2, f25));
+  Lib_IntVector_Intrinsics_vec256
+  a62 = Lib_IntVector_Intrinsics_vec256_add64(a61, Lib_IntVector_Intrinsics_vec256_mul64(f12, f24));
+  Lib_IntVector_Intrinsics_vec256
+  a63 =
+    Lib_IntVector_Intrinsics_vec256_add64(a62,
+      Lib_IntVector_Intrinsics_vec256_mul64(f13_2, f23));
+  Lib_IntVector_Intrinsics_vec256
+  a64 = Lib_IntVector_Intrinsics_vec256_add64(a63, Lib_IntVector_Intrinsics_vec256_mul64(f14, f22));
+  Lib_IntVector_Intrinsics_vec256
+  a65 =
+    Lib_IntVector_Intrinsics_vec256_add64(a64,
+      Lib_IntVector_Intrinsics_vec256_mul64(f15_2, f21));
+  Lib_IntVector_Intrinsics_vec256
+  a66 = Lib_IntVector_Intrinsics_vec256_add64(a65, Lib_IntVector_Intrinsics_vec256_mul64(f16, f20));
+  Lib_IntVector_Intrinsics_vec256
+  a67 =
+    Lib_IntVector_Intrinsics_vec256_add64(a66,
+      Lib_IntVector_Intrinsics_vec256_mul64(f17_2, f29_19));
+  Lib_IntVector_Intrinsics_vec256
+  a68 =
+    Lib_IntVector_Intrinsics_vec256_add64(a67,
+      Lib_IntVector_Intrinsics_vec256_mul64(f18, f28_19));
+  Lib_IntVector_Intrinsics_vec256
+  a69 =
+    Lib_IntVector_Intrinsics_vec256_add64(a68,
+      Lib_IntVector_Intrinsics_vec256_mul64(f19_2, f27_19));
+  Lib_IntVector_Intrinsics_vec256 a70 = Lib_IntVector_Intrinsics_vec256_mul64(f10, f27);
+  Lib_IntVector_Intrinsics_vec256
+  a71 = Lib_IntVector_Intrinsics_vec256_add64(a70, Lib_IntVector_Intrinsics_vec256_mul64(f11, f26));
+  Lib_IntVector_Intrinsics_vec256
+  a72 = Lib_IntVector_Intrinsics_vec256_add64(a71, Lib_IntVector_Intrinsics_vec256_mul64(f12, f25));
+  Lib_IntVector_Intrinsics_vec256
+  a73 = Lib_IntVector_Intrinsics_vec256_add64(a72, Lib_IntVector_Intrinsics_vec256_mul64(f13, f24));
+  Lib_IntVector_Intrinsics_vec256
+  a74 = Lib_IntVector_Intrinsics_vec256_add64(a73, Lib_IntVector_Intrinsics_vec256_mul64(f14, f23));
+  Lib_IntVector_Intrinsics_vec256
+  a75 = Lib_IntVector_Intrinsics_vec256_add64(a74, Lib_IntVector_Intrinsics_vec256_mul64(f15, f22));
+  Lib_IntVector_Intrinsics_vec256
+  a76 = Lib_IntVector_Intrinsics_vec256_add64(a75, Lib_IntVector_Intrinsics_vec256_mul64(f16, f21));
+  Lib_IntVector_Intrinsics_vec256
+  a77 = Lib_IntVector_Intrinsics_vec256_add64(a76, Lib_IntVector_Intrinsics_vec256_mul64(f17, f20));
+  Lib_IntVector_Intrinsics_vec256
+  a78 =
+    Lib_IntVector_Intrinsics_vec256_add64(a77,
+      Lib_IntVector_Intrinsics_vec256_mul64(f18, f29_19));
+  Lib_IntVector_Intrinsics_vec256
+  a79 =
+    Lib_IntVector_Intrinsics_vec256_add64(a78,
+      Lib_IntVector_Intrinsics_vec256_mul64(f19, f28_19));
+  Lib_IntVector_Intrinsics_vec256 a80 = Lib_IntVector_Intrinsics_vec256_mul64(f10, f28);
+  Lib_IntVector_Intrinsics_vec256
+  a81 =
+    Lib_IntVector_Intrinsics_vec256_add64(a80,
+      Lib_IntVector_Intrinsics_vec256_mul64(f11_2, f27));
+  Lib_IntVector_Intrinsics_vec256
+  a82 = Lib_IntVector_Intrinsics_vec256_add64(a81, Lib_IntVector_Intrinsics_vec256_mul64(f12, f26));
+  Lib_IntVector_Intrinsics_vec256
+  a83 =
+    Lib_IntVector_Intrinsics_vec256_add64(a82,
+      Lib_IntVector_Intrinsics_vec256_mul64(f13_2, f25));
+  Lib_IntVector_Intrinsics_vec256
+  a84 = Lib_IntVector_Intrinsics_vec256_add64(a83, Lib_IntVector_Intrinsics_vec256_mul64(f14, f24));
+  Lib_IntVector_Intrinsics_vec256
+  a85 =
+    Lib_IntVector_Intrinsics_vec256_add64(a84,
+      Lib_IntVector_Intrinsics_vec256_mul64(f15_2, f23));
+  Lib_IntVector_Intrinsics_vec256
+  a86 = Lib_IntVector_Intrinsics_vec256_add64(a85, Lib_IntVector_Intrinsics_vec256_mul64(f16, f22));
+  Lib_IntVector_Intrinsics_vec256
+  a87 =
+    Lib_IntVector_Intrinsics_vec256_add64(a86,
+      Lib_IntVector_Intrinsics_vec256_mul64(f17_2, f21));
+  Lib_IntVector_Intrinsics_vec256
+  a88 = Lib_IntVector_Intrinsics_vec256_add64(a87, Lib_IntVector_Intrinsics_vec256_mul64(f18, f20));
+  Lib_IntVector_Intrinsics_vec256
+  a89 =
+    Lib_IntVector_Intrinsics_vec256_add64(a88,
+      Lib_IntVector_Intrinsics_vec256_mul64(f19_2, f29_19));
+  Lib_IntVector_Intrinsics_vec256 a90 = Lib_IntVector_Intrinsics_vec256_mul64(f10, f29);
+  Lib_IntVector_Intrinsics_vec256
+  a91 = Lib_IntVector_Intrinsics_vec256_add64(a90, Lib_IntVector_Intrinsics_vec256_mul64(f11, f28));
+  Lib_IntVector_Intrinsics_vec256
+  a92 = Lib_IntVector_Intrinsics_vec256_add64(a91, Lib_IntVector_Intrinsics_vec256_mul64(f12, f27));
+  Lib_IntVector_Intrinsics_vec256
+  a93 = Lib_IntVector_Intrinsics_vec256_add64(a92, Lib_IntVector_Intrinsics_vec256_mul64(f13, f26));
+  Lib_IntVector_Intrinsics_vec256
+  a94 = Lib_IntVector_Intrinsics_vec256_add64(a93, Lib_IntVector_Intrinsics_vec256_mul64(f14, f25));
+  Lib_IntVector_Intrinsics_vec256
+  a95 = Lib_IntVector_Intrinsics_vec256_add64(a94, Lib_IntVector_Intrinsics_vec256_mul64(f15, f24));
+  Lib_IntVector_Intrinsics_vec256
+  a96 = Lib_IntVector_Intrinsics_vec256_add64(a95, Lib_IntVector_Intrinsics_vec256_mul64(f16, f23));
+  Lib_IntVector_Intrinsics_vec256
+  a97 = Lib_IntVector_Intrinsics_vec256_add64(a96, Lib_IntVector_Intrinsics_vec256_mul64(f17, f22));
+  Lib_IntVector_Intrinsics_vec256
+  a98 = Lib_IntVector_Intrinsics_vec256_add64(a97, Lib_IntVector_Intrinsics_vec256_mul64(f18, f21));
+  Lib_IntVector_Intrinsics_vec256
+  a99 = Lib_IntVector_Intrinsics_vec256_add64(a98, Lib_IntVector_Intrinsics_vec256_mul64(f19, f20));
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 tmp[10U] KRML_POST_ALIGN(32) = { 0U };
+  tmp[0U] = a09;
+  tmp[1U] = a19;
+  tmp[2U] = a29;
+  tmp[3U] = a39;
+  tmp[4U] = a49;
+  tmp[5U] = a59;
+  tmp[6U] = a69;
+  tmp[7U] = a79;
+  tmp[8U] = a89;
+  tmp[9U] = a99;
+  carry_wide(out, tmp);
+}
+
+static inline void fsqr(Lib_IntVector_Intrinsics_vec256 *out, Lib_IntVector_Intrinsics_vec256 *f)
+{
+  Lib_IntVector_Intrinsics_vec256 r19 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)19U);
+  Lib_IntVector_Intrinsics_vec256 f0 = f[0U];
+  Lib_IntVector_Intrinsics_vec256 f1 = f[1U];
+  Lib_IntVector_Intrinsics_vec256 f2 = f[2U];
+  Lib_IntVector_Intrinsics_vec256 f3 = f[3U];
+  Lib_IntVector_Intrinsics_vec256 f4 = f[4U];
+  Lib_IntVector_Intrinsics_vec256 f5 = f[5U];
+  Lib_IntVector_Intrinsics_vec256 f6 = f[6U];
+  Lib_IntVector_Intrinsics_vec256 f7 = f[7U];
+  Lib_IntVector_Intrinsics_vec256 f8 = f[8U];
+  Lib_IntVector_Intrinsics_vec256 f9 = f[9U];
+  Lib_IntVector_Intrinsics_vec256
+  f0_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f0, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  f1_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f1, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  f2_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f2, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  f3_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f3, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  f4_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f4, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  f5_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f5, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  f6_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f6, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  f7_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f7, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  f8_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f8, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  f9_2 = Lib_IntVector_Intrinsics_vec256_shift_left64(f9, (uint32_t)1U);
+  Lib_IntVector_Intrinsics_vec256
+  f1_4 = Lib_IntVector_Intrinsics_vec256_shift_left64(f1, (uint32_t)2U);
+  Lib_IntVector_Intrinsics_vec256
+  f3_4 = Lib_IntVector_Intrinsics_vec256_shift_left64(f3, (uint32_t)2U);
+  Lib_IntVector_Intrinsics_vec256
+  f5_4 = Lib_IntVector_Intrinsics_vec256_shift_left64(f5, (uint32_t)2U);
+  Lib_IntVector_Intrinsics_vec256
+  f7_4 = Lib_IntVector_Intrinsics_vec256_shift_left64(f7, (uint32_t)2U);
+  Lib_IntVector_Intrinsics_vec256 f5_19 = Lib_IntVector_Intrinsics_vec256_mul64(f5, r19);
+  Lib_IntVector_Intrinsics_vec256 f6_19 = Lib_IntVector_Intrinsics_vec256_mul64(f6, r19);
+  Lib_IntVector_Intrinsics_vec256 f7_19 = Lib_IntVector_Intrinsics_vec256_mul64(f7, r19);
+  Lib_IntVector_Intrinsics_vec256 f8_19 = Lib_IntVector_Intrinsics_vec256_mul64(f8, r19);
+  Lib_IntVector_Intrinsics_vec256 f9_19 = Lib_IntVector_Intrinsics_vec256_mul64(f9, r19);
+  Lib_IntVector_Intrinsics_vec256 a00 = Lib_IntVector_Intrinsics_vec256_mul64(f0, f0);
+  Lib_IntVector_Intrinsics_vec256
+  a01 =
+    Lib_IntVector_Intrinsics_vec256_add64(a00,
+      Lib_IntVector_Intrinsics_vec256_mul64(f1_4, f9_19));
+  Lib_IntVector_Intrinsics_vec256
+  a02 =
+    Lib_IntVector_Intrinsics_vec256_add64(a01,
+      Lib_IntVector_Intrinsics_vec256_mul64(f2_2, f8_19));
+  Lib_IntVector_Intrinsics_vec256
+  a03 =
+    Lib_IntVector_Intrinsics_vec256_add64(a02,
+      Lib_IntVector_Intrinsics_vec256_mul64(f3_4, f7_19));
+  Lib_IntVector_Intrinsics_vec256
+  a04 =
+    Lib_IntVector_Intrinsics_vec256_add64(a03,
+      Lib_IntVector_Intrinsics_vec256_mul64(f4_2, f6_19));
+  Lib_IntVector_Intrinsics_vec256
+  a05 =
+    Lib_IntVector_Intrinsics_vec256_add64(a04,
+      Lib_IntVector_Intrinsics_vec256_mul64(f5_2, f5_19));
+  Lib_IntVector_Intrinsics_vec256 a10 = Lib_IntVector_Intrinsics_vec256_mul64(f0_2, f1);
+  Lib_IntVector_Intrinsics_vec256
+  a11 =
+    Lib_IntVector_Intrinsics_vec256_add64(a10,
+      Lib_IntVector_Intrinsics_vec256_mul64(f2_2, f9_19));
+  Lib_IntVector_Intrinsics_vec256
+  a12 =
+    Lib_IntVector_Intrinsics_vec256_add64(a11,
+      Lib_IntVector_Intrinsics_vec256_mul64(f3_2, f8_19));
+  Lib_IntVector_Intrinsics_vec256
+  a13 =
+    Lib_IntVector_Intrinsics_vec256_add64(a12,
+      Lib_IntVector_Intrinsics_vec256_mul64(f4_2, f7_19));
+  Lib_IntVector_Intrinsics_vec256
+  a14 =
+    Lib_IntVector_Intrinsics_vec256_add64(a13,
+      Lib_IntVector_Intrinsics_vec256_mul64(f5_2, f6_19));
+  Lib_IntVector_Intrinsics_vec256 a20 = Lib_IntVector_Intrinsics_vec256_mul64(f0_2, f2);
+  Lib_IntVector_Intrinsics_vec256
+  a21 = Lib_IntVector_Intrinsics_vec256_add64(a20, Lib_IntVector_Intrinsics_vec256_mul64(f1_2, f1));
+  Lib_IntVector_Intrinsics_vec256
+  a22 =
+    Lib_IntVector_Intrinsics_vec256_add64(a21,
+      Lib_IntVector_Intrinsics_vec256_mul64(f3_4, f9_19));
+  Lib_IntVector_Intrinsics_vec256
+  a23 =
+    Lib_IntVector_Intrinsics_vec256_add64(a22,
+      Lib_IntVector_Intrinsics_vec256_mul64(f4_2, f8_19));
+  Lib_IntVector_Intrinsics_vec256
+  a24 =
+    Lib_IntVector_Intrinsics_vec256_add64(a23,
+      Lib_IntVector_Intrinsics_vec256_mul64(f5_4, f7_19));
+  Lib_IntVector_Intrinsics_vec256
+  a25 =
+    Lib_IntVector_Intrinsics_vec256_add64(a24,
+      Lib_IntVector_Intrinsics_vec256_mul64(f6, f6_19));
+  Lib_IntVector_Intrinsics_vec256 a30 = Lib_IntVector_Intrinsics_vec256_mul64(f0_2, f3);
+  Lib_IntVector_Intrinsics_vec256
+  a31 = Lib_IntVector_Intrinsics_vec256_add64(a30, Lib_IntVector_Intrinsics_vec256_mul64(f1_2, f2));
+  Lib_IntVector_Intrinsics_vec256
+  a32 =
+    Lib_IntVector_Intrinsics_vec256_add64(a31,
+      Lib_IntVector_Intrinsics_vec256_mul64(f4_2, f9_19));
+  Lib_IntVector_Intrinsics_vec256
+  a33 =
+    Lib_IntVector_Intrinsics_vec256_add64(a32,
+      Lib_IntVector_Intrinsics_vec256_mul64(f5_2, f8_19));
+  Lib_IntVector_Intrinsics_vec256
+  a34 =
+    Lib_IntVector_Intrinsics_vec256_add64(a33,
+      Lib_IntVector_Intrinsics_vec256_mul64(f6_2, f7_19));
+  Lib_IntVector_Intrinsics_vec256 a40 = Lib_IntVector_Intrinsics_vec256_mul64(f0_2, f4);
+  Lib_IntVector_Intrinsics_vec256
+  a41 = Lib_IntVector_Intrinsics_vec256_add64(a40, Lib_IntVector_Intrinsics_vec256_mul64(f1_4, f3));
+  Lib_IntVector_Intrinsics_vec256
+  a42 = Lib_IntVector_Intrinsics_vec256_add64(a41, Lib_IntVector_Intrinsics_vec256_mul64(f2, f2));
+  Lib_IntVector_Intrinsics_vec256
+  a43 =
+    Lib_IntVector_Intrinsics_vec256_add64(a42,
+      Lib_IntVector_Intrinsics_vec256_mul64(f5_4, f9_19));
+  Lib_IntVector_Intrinsics_vec256
+  a44 =
+    Lib_IntVector_Intrinsics_vec256_add64(a43,
+      Lib_IntVector_Intrinsics_vec256_mul64(f6_2, f8_19));
+  Lib_IntVector_Intrinsics_vec256
+  a45 =
+    Lib_IntVector_Intrinsics_vec256_add64(a44,
+      Lib_IntVector_Intrinsics_vec256_mul64(f7_2, f7_19));
+  Lib_IntVector_Intrinsics_vec256 a50 = Lib_IntVector_Intrinsics_vec256_mul64(f0_2, f5);
+  Lib_IntVector_Intrinsics_vec256
+  a51 = Lib_IntVector_Intrinsics_vec256_add64(a50, Lib_IntVector_Intrinsics_vec256_mul64(f1_2, f4));
+  Lib_IntVector_Intrinsics_vec256
+  a52 = Lib_IntVector_Intrinsics_vec256_add64(a51, Lib_IntVector_Intrinsics_vec256_mul64(f2_2, f3));
+  Lib_IntVector_Intrinsics_vec256
+  a53 =
+    Lib_IntVector_Intrinsics_vec256_add64(a52,
+      Lib_IntVector_Intrinsics_vec256_mul64(f6_2, f9_19));
+  Lib_IntVector_Intrinsics_vec256
+  a54 =
+    Lib_IntVector_Intrinsics_vec256_add64(a53,
+      Lib_IntVector_Intrinsics_vec256_mul64(f7_2, f8_19));
+  Lib_IntVector_Intrinsics_vec256 a60 = Lib_IntVector_Intrinsics_vec256_mul64(f0_2, f6);
+  Lib_IntVector_Intrinsics_vec256
+  a61 = Lib_IntVector_Intrinsics_vec256_add64(a60, Lib_IntVector_Intrinsics_vec256_mul64(f1_4, f5));
+  Lib_IntVector_Intrinsics_vec256
+  a62 = Lib_IntVector_Intrinsics_vec256_add64(a61, Lib_IntVector_Intrinsics_vec256_mul64(f2_2, f4));
+  Lib_IntVector_Intrinsics_vec256
+  a63 = Lib_IntVector_Intrinsics_vec256_add64(a62, Lib_IntVector_Intrinsics_vec256_mul64(f3_2, f3));
+  Lib_IntVector_Intrinsics_vec256
+  a64 =
+    Lib_IntVector_Intrinsics_vec256_add64(a63,
+      Lib_IntVector_Intrinsics_vec256_mul64(f7_4, f9_19));
+  Lib_IntVector_Intrinsics_vec256
+  a65 =
+    Lib_IntVector_Intrinsics_vec256_add64(a64,
+      Lib_IntVector_Intrinsics_vec256_mul64(f8, f8_19));
+  Lib_IntVector_Intrinsics_vec256 a70 = Lib_IntVector_Intrinsics_vec256_mul64(f0_2, f7);
+  Lib_IntVector_Intrinsics_vec256
+  a71 = Lib_IntVector_Intrinsics_vec256_add64(a70, Lib_IntVector_Intrinsics_vec256_mul64(f1_2, f6));
+  Lib_IntVector_Intrinsics_vec256
+  a72 = Lib_IntVector_Intrinsics_vec256_add64(a71, Lib_IntVector_Intrinsics_vec256_mul64(f2_2, f5));
+  Lib_IntVector_Intrinsics_vec256
+  a73 = Lib_IntVector_Intrinsics_vec256_add64(a72, Lib_IntVector_Intrinsics_vec256_mul64(f3_2, f4));
+  Lib_IntVector_Intrinsics_vec256
+  a74 =
+    Lib_IntVector_Intrinsics_vec256_add64(a73,
+      Lib_IntVector_Intrinsics_vec256_mul64(f8_2, f9_19));
+  Lib_IntVector_Intrinsics_vec256 a80 = Lib_IntVector_Intrinsics_vec256_mul64(f0_2, f8);
+  Lib_IntVector_Intrinsics_vec256
+  a81 = Lib_IntVector_Intrinsics_vec256_add64(a80, Lib_IntVector_Intrinsics_vec256_mul64(f1_4, f7));
+  Lib_IntVector_Intrinsics_vec256
+  a82 = Lib_IntVector_Intrinsics_vec256_add64(a81, Lib_IntVector_Intrinsics_vec256_mul64(f2_2, f6));
+  Lib_IntVector_Intrinsics_vec256
+  a83 = Lib_IntVector_Intrinsics_vec256_add64(a82, Lib_IntVector_Intrinsics_vec256_mul64(f3_4, f5));
+  Lib_IntVector_Intrinsics_vec256
+  a84 = Lib_IntVector_Intrinsics_vec256_add64(a83, Lib_IntVector_Intrinsics_vec256_mul64(f4, f4));
+  Lib_IntVector_Intrinsics_vec256
+  a85 =
+    Lib_IntVector_Intrinsics_vec256_add64(a84,
+      Lib_IntVector_Intrinsics_vec256_mul64(f9_2, f9_19));
+  Lib_IntVector_Intrinsics_vec256 a90 = Lib_IntVector_Intrinsics_vec256_mul64(f0_2, f9);
+  Lib_IntVector_Intrinsics_vec256
+  a91 = Lib_IntVector_Intrinsics_vec256_add64(a90, Lib_IntVector_Intrinsics_vec256_mul64(f1_2, f8));
+  Lib_IntVector_Intrinsics_vec256
+  a92 = Lib_IntVector_Intrinsics_vec256_add64(a91, Lib_IntVector_Intrinsics_vec256_mul64(f2_2, f7));
+  Lib_IntVector_Intrinsics_vec256
+  a93 = Lib_IntVector_Intrinsics_vec256_add64(a92, Lib_IntVector_Intrinsics_vec256_mul64(f3_2, f6));
+  Lib_IntVector_Intrinsics_vec256
+  a94 = Lib_IntVector_Intrinsics_vec256_add64(a93, Lib_IntVector_Intrinsics_vec256_mul64(f4_2, f5));
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 tmp[10U] KRML_POST_ALIGN(32) = { 0U };
+  tmp[0U] = a05;
+  tmp[1U] = a14;
+  tmp[2U] = a25;
+  tmp[3U] = a34;
+  tmp[4U] = a45;
+  tmp[5U] = a54;
+  tmp[6U] = a65;
+  tmp[7U] = a74;
+  tmp[8U] = a85;
+  tmp[9U] = a94;
+  carry_wide(out, tmp);
+}
+
+static inline void
+fadd(
+  Lib_IntVector_Intrinsics_vec256 *out,
+  Lib_IntVector_Intrinsics_vec256 *f1,
+  Lib_IntVector_Intrinsics_vec256 *f2
+)
+{
+  KRML_MAYBE_FOR10(i,
+    (uint32_t)0U,
+    (uint32_t)10U,
+    (uint32_t)1U,
+    out[i] = Lib_IntVector_Intrinsics_vec256_add64(f1[i], f2[i]););
+}
+
+static inline void
+fsub(
+  Lib_IntVector_Intrinsics_vec256 *out,
+  Lib_IntVector_Intrinsics_vec256 *f1,
+  Lib_IntVector_Intrinsics_vec256 *f2
+)
+{
+  Lib_IntVector_Intrinsics_vec256
+  p0 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x7ffffdaU);
+  Lib_IntVector_Intrinsics_vec256
+  p26 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x7fffffeU);
+  Lib_IntVector_Intrinsics_vec256
+  p25 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3fffffeU);
+  out[0U] =
+    Lib_IntVector_Intrinsics_vec256_sub64(Lib_IntVector_Intrinsics_vec256_add64(f1[0U], p0),
+      f2[0U]);
+  for (uint32_t i = (uint32_t)1U; i < (uint32_t)10U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 p = p26;
+    if (i % (uint32_t)2U == (uint32_t)1U)
+    {
+      p = p25;
+    }
+    out[i] =
+      Lib_IntVector_Intrinsics_vec256_sub64(Lib_IntVector_Intrinsics_vec256_add64(f1[i], p),
+        f2[i]);
+  }
+}
+
+static inline void
+fmul1(Lib_IntVector_Intrinsics_vec256 *out, Lib_IntVector_Intrinsics_vec256 *f1, uint64_t f2)
+{
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 tmp[10U] KRML_POST_ALIGN(32) = { 0U };
+  Lib_IntVector_Intrinsics_vec256 c = Lib_IntVector_Intrinsics_vec256_load64(f2);
+  KRML_MAYBE_FOR10(i,
+    (uint32_t)0U,
+    (uint32_t)10U,
+    (uint32_t)1U,
+    tmp[i] = Lib_IntVector_Intrinsics_vec256_mul64(f1[i], c););
+  carry_wide(out, tmp);
+}
+
+static inline void
+cswap2(
+  Lib_IntVector_Intrinsics_vec256 bit,
+  Lib_IntVector_Intrinsics_vec256 *p1,
+  Lib_IntVector_Intrinsics_vec256 *p2
+)
+{
+  Lib_IntVector_Intrinsics_vec256
+  mask = Lib_IntVector_Intrinsics_vec256_sub64(Lib_IntVector_Intrinsics_vec256_zero, bit);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)20U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256
+    dummy =
+      Lib_IntVector_Intrinsics_vec256_and(mask,
+        Lib_IntVector_Intrinsics_vec256_xor(p1[i], p2[i]));
+    p1[i] = Lib_IntVector_Intrinsics_vec256_xor(p1[i], dummy);
+    p2[i] = Lib_IntVector_Intrinsics_vec256_xor(p2[i], dummy);
+  }
+}
+
+static inline void load_felem(uint64_t *out, uint64_t *u64s)
+{
+  out[0U] = u64s[0U] & (uint64_t)0x3ffffffU;
+  out[1U] = u64s[0U] >> (uint32_t)26U & (uint64_t)0x1ffffffU;
+  out[2U] = (u64s[0U] >> (uint32_t)51U | u64s[1U] << (uint32_t)13U) & (uint64_t)0x3ffffffU;
+  out[3U] = u64s[1U] >> (uint32_t)13U & (uint64_t)0x1ffffffU;
+  out[4U] = u64s[1U] >> (uint32_t)38U & (uint64_t)0x3ffffffU;
+  out[5U] = u64s[2U] & (uint64_t)0x1ffffffU;
+  out[6U] = u64s[2U] >> (uint32_t)25U & (uint64_t)0x3ffffffU;
+  out[7U] = (u64s[2U] >> (uint32_t)51U | u64s[3U] << (uint32_t)13U) & (uint64_t)0x1ffffffU;
+  out[8U] = u64s[3U] >> (uint32_t)12U & (uint64_t)0x3ffffffU;
+  out[9U] = u64s[3U] >> (uint32_t)38U & (uint64_t)0x1ffffffU;
+}
+
+static void
+point_add_and_double(Lib_IntVector_Intrinsics_vec256 *q, Lib_IntVector_Intrinsics_vec256 *p01_tmp1)
+{
+  Lib_IntVector_Intrinsics_vec256 *nq = p01_tmp1;
+  Lib_IntVector_Intrinsics_vec256 *nq_p1 = p01_tmp1 + (uint32_t)20U;
+  Lib_IntVector_Intrinsics_vec256 *tmp1 = p01_tmp1 + (uint32_t)40U;
+  Lib_IntVector_Intrinsics_vec256 *x1 = q;
+  Lib_IntVector_Intrinsics_vec256 *x2 = nq;
+  Lib_IntVector_Intrinsics_vec256 *z2 = nq + (uint32_t)10U;
+  Lib_IntVector_Intrinsics_vec256 *z3 = nq_p1 + (uint32_t)10U;
+  Lib_IntVector_Intrinsics_vec256 *a = tmp1;
+  Lib_IntVector_Intrinsics_vec256 *b = tmp1 + (uint32_t)10U;
+  Lib_IntVector_Intrinsics_vec256 *d = tmp1 + (uint32_t)20U;
+  Lib_IntVector_Intrinsics_vec256 *c = tmp1 + (uint32_t)30U;
+  fadd(a, x2, z2);
+  fsub(b, x2, z2);
+  Lib_IntVector_Intrinsics_vec256 *x3 = nq_p1;
+  fadd(c, x3, z3);
+  fsub(d, x3, z3);
+  fmul(d, d, a);
+  fmul(c, c, b);
+  fadd(x3, d, c);
+  fsub(z3, d, c);
+  fsqr(d, a);
+  fsqr(c, b);
+  fsqr(x3, x3);
+  fsqr(z3, z3);
+  memcpy(a, c, (uint32_t)10U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  fsub(c, d, c);
+  fmul1(b, c, (uint64_t)121665U);
+  fadd(b, b, d);
+  fmul(x2, d, a);
+  fmul(z2, c, b);
+  fmul(z3, z3, x1);
+}
+
+static void point_double(Lib_IntVector_Intrinsics_vec256 *nq, Lib_IntVector_Intrinsics_vec256 *tmp1)
+{
+  Lib_IntVector_Intrinsics_vec256 *x2 = nq;
+  Lib_IntVector_Intrinsics_vec256 *z2 = nq + (uint32_t)10U;
+  Lib_IntVector_Intrinsics_vec256 *a = tmp1;
+  Lib_IntVector_Intrinsics_vec256 *b = tmp1 + (uint32_t)10U;
+  Lib_IntVector_Intrinsics_vec256 *d = tmp1 + (uint32_t)20U;
+  Lib_IntVector_Intrinsics_vec256 *c = tmp1 + (uint32_t)30U;
+  fadd(a, x2, z2);
+  fsub(b, x2, z2);
+  fsqr(d, a);
+  fsqr(c, b);
+  memcpy(a, c, (uint32_t)10U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  fsub(c, d, c);
+  fmul1(b, c, (uint64_t)121665U);
+  fadd(b, b, d);
+  fmul(x2, d, a);
+  fmul(z2, c, b);
+}
+
+static inline Lib_IntVector_Intrinsics_vec256 scalar_bit4(uint8_t *key, uint32_t n)
+{
+  uint64_t
+  b0 = (uint64_t)(key[n / (uint32_t)8U] >> n % (uint32_t)8U & (uint8_t)1U);
+  uint64_t
+  b1 = (uint64_t)(key[(uint32_t)32U + n / (uint32_t)8U] >> n % (uint32_t)8U & (uint8_t)1U);
+  uint64_t
+  b2 = (uint64_t)(key[(uint32_t)64U + n / (uint32_t)8U] >> n % (uint32_t)8U & (uint8_t)1U);
+  uint64_t
+  b3 = (uint64_t)(key[(uint32_t)96U + n / (uint32_t)8U] >> n % (uint32_t)8U & (uint8_t)1U);
+  return Lib_IntVector_Intrinsics_vec256_load64s(b0, b1, b2, b3);
+}
+
+static void
+montgomery_ladder(
+  Lib_IntVector_Intrinsics_vec256 *out,
+  uint8_t *key,
+  Lib_IntVector_Intrinsics_vec256 *init
+)
+{
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 p01_tmp1[80U] KRML_POST_ALIGN(32) = { 0U };
+  Lib_IntVector_Intrinsics_vec256 *nq = p01_tmp1;
+  Lib_IntVector_Intrinsics_vec256 *nq_p1 = p01_tmp1 + (uint32_t)20U;
+  Lib_IntVector_Intrinsics_vec256 *tmp1 = p01_tmp1 + (uint32_t)40U;
+  memcpy(nq_p1, init, (uint32_t)20U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  nq[0U] = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)1U);
+  Lib_IntVector_Intrinsics_vec256 one = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)1U);
+  cswap2(one, nq, nq_p1);
+  point_add_and_double(init, p01_tmp1);
+  Lib_IntVector_Intrinsics_vec256 swap = one;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)251U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 bit = scalar_bit4(key, (uint32_t)253U - i);
+    Lib_IntVector_Intrinsics_vec256 sw = Lib_IntVector_Intrinsics_vec256_xor(swap, bit);
+    cswap2(sw, nq, nq_p1);
+    point_add_and_double(init, p01_tmp1);
+    swap = bit;
+  }
+  cswap2(swap, nq, nq_p1);
+  point_double(nq, tmp1);
+  point_double(nq, tmp1);
+  point_double(nq, tmp1);
+  memcpy(out, nq, (uint32_t)20U * sizeof (Lib_IntVector_Intrinsics_vec256));
+}
+
+static inline void
+fsquare_times(
+  Lib_IntVector_Intrinsics_vec256 *o,
+  Lib_IntVector_Intrinsics_vec256 *inp,
+  uint32_t n
+)
+{
+  fsqr(o, inp);
+  for (uint32_t i = (uint32_t)0U; i < n - (uint32_t)1U; i++)
+  {
+    fsqr(o, o);
+  }
+}
+
+static void finv(Lib_IntVector_Intrinsics_vec256 *o, Lib_IntVector_Intrinsics_vec256 *i)
+{
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 t1[40U] KRML_POST_ALIGN(32) = { 0U };
+  Lib_IntVector_Intrinsics_vec256 *a = t1;
+  Lib_IntVector_Intrinsics_vec256 *b = t1 + (uint32_t)10U;
+  Lib_IntVector_Intrinsics_vec256 *c = t1 + (uint32_t)20U;
+  Lib_IntVector_Intrinsics_vec256 *t0 = t1 + (uint32_t)30U;
+  fsquare_times(a, i, (uint32_t)1U);
+  fsquare_times(t0, a, (uint32_t)2U);
+  fmul(b, t0, i);
+  fmul(a, b, a);
+  fsquare_times(t0, a, (uint32_t)1U);
+  fmul(b, t0, b);
+  fsquare_times(t0, b, (uint32_t)5U);
+  fmul(b, t0, b);
+  fsquare_times(t0, b, (uint32_t)10U);
+  fmul(c, t0, b);
+  fsquare_times(t0, c, (uint32_t)20U);
+  fmul(t0, t0, c);
+  fsquare_times(t0, t0, (uint32_t)10U);
+  fmul(b, t0, b);
+  fsquare_times(t0, b, (uint32_t)50U);
+  fmul(c, t0, b);
+  fsquare_times(t0, c, (uint32_t)100U);
+  fmul(t0, t0, c);
+  fsquare_times(t0, t0, (uint32_t)50U);
+  fmul(t0, t0, b);
+  fsquare_times(t0, t0, (uint32_t)5U);
+  fmul(o, t0, a);
+}
+
+static void encode_point4(uint8_t *o, Lib_IntVector_Intrinsics_vec256 *i)
+{
+  Lib_IntVector_Intrinsics_vec256 *x = i;
+  Lib_IntVector_Intrinsics_vec256 *z = i + (uint32_t)10U;
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 tmp[10U] KRML_POST_ALIGN(32) = { 0U };
+  finv(tmp, z);
+  fmul(tmp, tmp, x);
+  uint8_t limbs[320U] = { 0U };
+  KRML_MAYBE_FOR10(i0,
+    (uint32_t)0U,
+    (uint32_t)10U,
+    (uint32_t)1U,
+    Lib_IntVector_Intrinsics_vec256_store64_le(limbs + i0 * (uint32_t)32U, tmp[i0]););
+  KRML_MAYBE_FOR4(i0,
+    (uint32_t)0U,
+    (uint32_t)4U,
+    (uint32_t)1U,
+    uint64_t f[5U] = { 0U };
+    uint64_t u64s[4U] = { 0U };
+    KRML_MAYBE_FOR5(i1,
+      (uint32_t)0U,
+      (uint32_t)5U,
+      (uint32_t)1U,
+      uint64_t lo = load64_le(limbs + (uint32_t)2U * i1 * (uint32_t)32U + i0 * (uint32_t)8U);
+      uint64_t
+      hi =
+        load64_le(limbs
+          + ((uint32_t)2U * i1 + (uint32_t)1U) * (uint32_t)32U
+          + i0 * (uint32_t)8U);
+      f[i1] = lo + (hi << (uint32_t)26U););
+    Hacl_Impl_Curve25519_Field51_store_felem(u64s, f);
+    KRML_MAYBE_FOR4(i1,
+      (uint32_t)0U,
+      (uint32_t)4U,
+      (uint32_t)1U,
+      store64_le(o + i0 * (uint32_t)32U + i1 * (uint32_t)8U, u64s[i1]);););
+}
+
+/**
+Compute four scalar multiples of points in parallel.
+
+@param out Pointer to 128 bytes of memory, allocated by the caller, where the four resulting points are written to, each taking 32 bytes.
+@param priv Pointer to 128 bytes of memory where the four secret/private keys are read from, each taking 32 bytes.
+@param pub Pointer to 128 bytes of memory where the four public points are read from, each taking 32 bytes.
+*/
+void Hacl_Curve25519_Vec256_scalarmult4(uint8_t *out, uint8_t *priv, uint8_t *pub)
+{
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 init[20U] KRML_POST_ALIGN(32) = { 0U };
+  uint64_t limbs[40U] = { 0U };
+  KRML_MAYBE_FOR4(i,
+    (uint32_t)0U,
+    (uint32_t)4U,
+    (uint32_t)1U,
+    uint64_t tmp[4U] = { 0U };
+    KRML_MAYBE_FOR4(i0,
+      (uint32_t)0U,
+      (uint32_t)4U,
+      (uint32_t)1U,
+      uint64_t *os = tmp;
+      uint8_t *bj = pub + i * (uint32_t)32U + i0 * (uint32_t)8U;
+      uint64_t u = load64_le(bj);
+      uint64_t r = u;
+      uint64_t x = r;
+      os[i0] = x;);
+    load_felem(limbs + i * (uint32_t)10U, tmp););
+  Lib_IntVector_Intrinsics_vec256 *x = init;
+  Lib_IntVector_Intrinsics_vec256 *z = init + (uint32_t)10U;
+  KRML_MAYBE_FOR10(i,
+    (uint32_t)0U,
+    (uint32_t)10U,
+    (uint32_t)1U,
+    x[i] =
+      Lib_IntVector_Intrinsics_vec256_load64s(limbs[i],
+        limbs[(uint32_t)10U + i],
+        limbs[(uint32_t)20U + i],
+        limbs[(uint32_t)30U + i]););
+  z[0U] = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)1U);
+  montgomery_ladder(init, priv, init);
+  encode_point4(out, init);
+}
+
+/**
+Calculate four public points from secret/private keys in parallel.
+
+This computes a scalar multiplication of each secret/private key with the curve's basepoint.
+
+@param pub Pointer to 128 bytes of memory, allocated by the caller, where the four resulting points are written to, each taking 32 bytes.
+@param priv Pointer to 128 bytes of memory where the four secret/private keys are read from, each taking 32 bytes.
+*/
+void Hacl_Curve25519_Vec256_secret_to_public4(uint8_t *pub, uint8_t *priv)
+{
+  uint8_t basepoint[128U] = { 0U };
+  KRML_MAYBE_FOR4(i,
+    (uint32_t)0U,
+    (uint32_t)4U,
+    (uint32_t)1U,
+    memcpy(basepoint + i * (uint32_t)32U, g25519, (uint32_t)32U * sizeof (uint8_t)););
+  Hacl_Curve25519_Vec256_scalarmult4(pub, priv, basepoint);
+}
+
+/**
+Execute four diffie-hellmann key exchanges in parallel.
+
+The function returns `true` if all four shared secrets are non-zero, and `false` otherwise.
+The outparam `valid` records the result of each individual key exchange.
+
+@param out Pointer to 128 bytes of memory, allocated by the caller, where the four resulting points are written to, each taking 32 bytes.
+@param priv Pointer to 128 bytes of memory where **our** four secret/private keys are read from, each taking 32 bytes.
+@param pub Pointer to 128 bytes of memory where **their** four public points are read from, each taking 32 bytes.
+@param valid Pointer to 4 booleans, allocated by the caller, where the result of each key exchange is written to.
+*/
+bool Hacl_Curve25519_Vec256_ecdh4(uint8_t *out, uint8_t *priv, uint8_t *pub, bool *valid)
+{
+  Hacl_Curve25519_Vec256_scalarmult4(out, priv, pub);
+  bool res = true;
+  KRML_MAYBE_FOR4(i,
+    (uint32_t)0U,
+    (uint32_t)4U,
+    (uint32_t)1U,
+    uint8_t r = (uint8_t)255U;
+    for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)32U; i0++)
+    {
+      uint8_t uu____0 = FStar_UInt8_eq_mask(out[i * (uint32_t)32U + i0], (uint8_t)0U);
+      r = uu____0 & r;
+    }
+    bool ok = r != (uint8_t)255U;
+    valid[i] = ok;
+    res = res && ok;);
+  return res;
+}
+
@@ -0,0 +1,143 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "internal/Hacl_Frodo_KEM.h"
+
+#include "config.h"
+
+#if TARGET_ARCHITECTURE == TARGET_ARCHITECTURE_ID_X64 || TARGET_ARCHITECTURE == TARGET_ARCHITECTURE_ID_X86 || TARGET_ARCHITECTURE == TARGET_ARCHITECTURE_ID_ARM64
+
+/* All arithmetic is modulo 2^16, so 16-bit lane multiplies and adds are exact.
+ * Both kernels handle the n % 8 trailing columns with scalar code. */
+
+#if TARGET_ARCHITECTURE == TARGET_ARCHITECTURE_ID_ARM64
+
+#include <arm_neon.h>
+
+typedef uint16x8_t vec16x8;
+
+#define vec16x8_zero() (vdupq_n_u16((uint16_t)0U))
+#define vec16x8_load(p) (vld1q_u16(p))
+#define vec16x8_store(p, x) (vst1q_u16(p, x))
+#define vec16x8_splat(x) (vdupq_n_u16(x))
+#define vec16x8_mul_add(acc, x, y) (vmlaq_u16(acc, x, y))
+#define vec16x8_hsum(x) (vaddvq_u16(x))
+
+#else
+
+#include <emmintrin.h>
+
+typedef __m128i vec16x8;
+
+static inline uint16_t vec16x8_hsum(__m128i x)
+{
+  x = _mm_add_epi16(x, _mm_srli_si128(x, 8));
+  x = _mm_add_epi16(x, _mm_srli_si128(x, 4));
+  x = _mm_add_epi16(x, _mm_srli_si128(x, 2));
+  return (uint16_t)_mm_cvtsi128_si32(x);
+}
+
+#define vec16x8_zero() (_mm_setzero_si128())
+#define vec16x8_load(p) (_mm_loadu_si128((__m128i *)(p)))
+#define vec16x8_store(p, x) (_mm_storeu_si128((__m128i *)(p), x))
+#define vec16x8_splat(x) (_mm_set1_epi16((short)(x)))
+#define vec16x8_mul_add(acc, x, y) (_mm_add_epi16(acc, _mm_mullo_epi16(x, y)))
+
+#endif
+
+void
+Hacl_Impl_Frodo_Matrix_Vec128_mul_as_rows(
+  uint32_t n,
+  uint32_t nrows,
+  uint16_t *a,
+  uint16_t *s,
+  uint16_t *b
+)
+{
+  uint32_t n8 = n / (uint32_t)8U * (uint32_t)8U;
+  for (uint32_t r = (uint32_t)0U; r < nrows; r++)
+  {
+    uint16_t *ar = a + r * n;
+    vec16x8 acc[8U];
+    KRML_MAYBE_FOR8(k, (uint32_t)0U, (uint32_t)8U, (uint32_t)1U, acc[k] = vec16x8_zero(););
+    for (uint32_t j = (uint32_t)0U; j < n8; j = j + (uint32_t)8U)
+    {
+      vec16x8 x = vec16x8_load(ar + j);
+      KRML_MAYBE_FOR8(k,
+        (uint32_t)0U,
+        (uint32_t)8U,
+        (uint32_t)1U,
+        acc[k] = vec16x8_mul_add(acc[k], x, vec16x8_load(s + k * n + j)););
+    }
+    KRML_MAYBE_FOR8(k,
+      (uint32_t)0U,
+      (uint32_t)8U,
+      (uint32_t)1U,
+      uint16_t res = vec16x8_hsum(acc[k]);
+      for (uint32_t j = n8; j < n; j++)
+      {
+        res = (uint16_t)((uint32_t)res + (uint32_t)ar[j] * (uint32_t)s[k * n + j]);
+      }
+      b[r * (uint32_t)8U + k] = (uint16_t)((uint32_t)b[r * (uint32_t)8U + k] + (uint32_t)res););
+  }
+}
+
+void
+Hacl_Impl_Frodo_Matrix_Vec128_mul_sa_rows(
+  uint32_t n,
+  uint32_t nrows,
+  uint16_t *a,
+  uint16_t *sp,
+  uint16_t *bp
+)
+{
+  uint32_t n8 = n / (uint32_t)8U * (uint32_t)8U;
+  for (uint32_t k = (uint32_t)0U; k < (uint32_t)8U; k++)
+  {
+    uint16_t *spk = sp + k * n;
+    uint16_t *bpk = bp + k * n;
+    for (uint32_t j = (uint32_t)0U; j < n8; j = j + (uint32_t)8U)
+    {
+      vec16x8 acc = vec16x8_load(bpk + j);
+      for (uint32_t r = (uint32_t)0U; r < nrows; r++)
+      {
+        acc = vec16x8_mul_add(acc, vec16x8_load(a + r * n + j), vec16x8_splat(spk[r]));
+      }
+      vec16x8_store(bpk + j, acc);
+    }
+    for (uint32_t j = n8; j < n; j++)
+    {
+      uint32_t res = (uint32_t)bpk[j];
+      for (uint32_t r = (uint32_t)0U; r < nrows; r++)
+      {
+        res = res + (uint32_t)spk[r] * (uint32_t)a[r * n + j];
+      }
+      bpk[j] = (uint16_t)res;
+    }
+  }
+}
+
+#endif
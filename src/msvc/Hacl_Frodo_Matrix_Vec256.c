@@ -0,0 +1,122 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "internal/Hacl_Frodo_KEM.h"
+
+#include "config.h"
+
+#if TARGET_ARCHITECTURE == TARGET_ARCHITECTURE_ID_X64 || TARGET_ARCHITECTURE == TARGET_ARCHITECTURE_ID_X86
+
+#include <immintrin.h>
+
+/* All arithmetic is modulo 2^16, so 16-bit lane multiplies and adds are exact.
+ * Both kernels handle the n % 16 trailing columns with scalar code. */
+
+static inline uint16_t hsum(__m256i x)
+{
+  __m128i y = _mm_add_epi16(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1));
+  y = _mm_add_epi16(y, _mm_srli_si128(y, 8));
+  y = _mm_add_epi16(y, _mm_srli_si128(y, 4));
+  y = _mm_add_epi16(y, _mm_srli_si128(y, 2));
+  return (uint16_t)_mm_cvtsi128_si32(y);
+}
+
+void
+Hacl_Impl_Frodo_Matrix_Vec256_mul_as_rows(
+  uint32_t n,
+  uint32_t nrows,
+  uint16_t *a,
+  uint16_t *s,
+  uint16_t *b
+)
+{
+  uint32_t n16 = n / (uint32_t)16U * (uint32_t)16U;
+  for (uint32_t r = (uint32_t)0U; r < nrows; r++)
+  {
+    uint16_t *ar = a + r * n;
+    __m256i acc[8U];
+    KRML_MAYBE_FOR8(k, (uint32_t)0U, (uint32_t)8U, (uint32_t)1U, acc[k] = _mm256_setzero_si256(););
+    for (uint32_t j = (uint32_t)0U; j < n16; j = j + (uint32_t)16U)
+    {
+      __m256i x = _mm256_loadu_si256((__m256i *)(ar + j));
+      KRML_MAYBE_FOR8(k,
+        (uint32_t)0U,
+        (uint32_t)8U,
+        (uint32_t)1U,
+        acc[k] =
+          _mm256_add_epi16(acc[k],
+            _mm256_mullo_epi16(x, _mm256_loadu_si256((__m256i *)(s + k * n + j)))););
+    }
+    KRML_MAYBE_FOR8(k,
+      (uint32_t)0U,
+      (uint32_t)8U,
+      (uint32_t)1U,
+      uint16_t res = hsum(acc[k]);
+      for (uint32_t j = n16; j < n; j++)
+      {
+        res = (uint16_t)((uint32_t)res + (uint32_t)ar[j] * (uint32_t)s[k * n + j]);
+      }
+      b[r * (uint32_t)8U + k] = (uint16_t)((uint32_t)b[r * (uint32_t)8U + k] + (uint32_t)res););
+  }
+}
+
+void
+Hacl_Impl_Frodo_Matrix_Vec256_mul_sa_rows(
+  uint32_t n,
+  uint32_t nrows,
+  uint16_t *a,
+  uint16_t *sp,
+  uint16_t *bp
+)
+{
+  uint32_t n16 = n / (uint32_t)16U * (uint32_t)16U;
+  for (uint32_t k = (uint32_t)0U; k < (uint32_t)8U; k++)
+  {
+    uint16_t *spk = sp + k * n;
+    uint16_t *bpk = bp + k * n;
+    for (uint32_t j = (uint32_t)0U; j < n16; j = j + (uint32_t)16U)
+    {
+      __m256i acc = _mm256_loadu_si256((__m256i *)(bpk + j));
+      for (uint32_t r = (uint32_t)0U; r < nrows; r++)
+      {
+        __m256i x = _mm256_loadu_si256((__m256i *)(a + r * n + j));
+        acc = _mm256_add_epi16(acc, _mm256_mullo_epi16(x, _mm256_set1_epi16((short)spk[r])));
+      }
+      _mm256_storeu_si256((__m256i *)(bpk + j), acc);
+    }
+    for (uint32_t j = n16; j < n; j++)
+    {
+      uint32_t res = (uint32_t)bpk[j];
+      for (uint32_t r = (uint32_t)0U; r < nrows; r++)
+      {
+        res = res + (uint32_t)spk[r] * (uint32_t)a[r * n + j];
+      }
+      bpk[j] = (uint16_t)res;
+    }
+  }
+}
+
+#endif
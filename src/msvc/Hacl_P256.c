@@ -28,6 +28,7 @@
 #include "internal/Hacl_P256_PrecompTable.h"
 #include "internal/Hacl_Krmllib.h"
 #include "internal/Hacl_Bignum_Base.h"
+#include "internal/Hacl_Bignum_ADX.h"
 #include "lib_intrinsics.h"
 
 static inline uint64_t bn_is_zero_mask4(uint64_t *f)
@@ -218,79 +219,93 @@ static inline void bn_sub_mod4(uint64_t *res, uint64_t *n, uint64_t *x, uint64_t
 static inline void bn_mul4(uint64_t *res, uint64_t *x, uint64_t *y)
 {
   memset(res, 0U, (uint32_t)8U * sizeof (uint64_t));
-  KRML_MAYBE_FOR4(i0,
-    (uint32_t)0U,
-    (uint32_t)4U,
-    (uint32_t)1U,
-    uint64_t bj = y[i0];
-    uint64_t *res_j = res + i0;
-    uint64_t c = (uint64_t)0U;
-    {
-      uint64_t a_i = x[(uint32_t)4U * (uint32_t)0U];
-      uint64_t *res_i0 = res_j + (uint32_t)4U * (uint32_t)0U;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, bj, c, res_i0);
-      uint64_t a_i0 = x[(uint32_t)4U * (uint32_t)0U + (uint32_t)1U];
-      uint64_t *res_i1 = res_j + (uint32_t)4U * (uint32_t)0U + (uint32_t)1U;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i0, bj, c, res_i1);
-      uint64_t a_i1 = x[(uint32_t)4U * (uint32_t)0U + (uint32_t)2U];
-      uint64_t *res_i2 = res_j + (uint32_t)4U * (uint32_t)0U + (uint32_t)2U;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i1, bj, c, res_i2);
-      uint64_t a_i2 = x[(uint32_t)4U * (uint32_t)0U + (uint32_t)3U];
-      uint64_t *res_i = res_j + (uint32_t)4U * (uint32_t)0U + (uint32_t)3U;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i2, bj, c, res_i);
-    }
-    uint64_t r = c;
-    res[(uint32_t)4U + i0] = r;);
+  if (Hacl_Bignum_ADX_is_available())
+  {
+    Hacl_Bignum_ADX_bn_mul_u64((uint32_t)4U, x, y, res);
+  }
+  else
+  {
+    KRML_MAYBE_FOR4(i0,
+      (uint32_t)0U,
+      (uint32_t)4U,
+      (uint32_t)1U,
+      uint64_t bj = y[i0];
+      uint64_t *res_j = res + i0;
+      uint64_t c = (uint64_t)0U;
+      {
+        uint64_t a_i = x[(uint32_t)4U * (uint32_t)0U];
+        uint64_t *res_i0 = res_j + (uint32_t)4U * (uint32_t)0U;
+        c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, bj, c, res_i0);
+        uint64_t a_i0 = x[(uint32_t)4U * (uint32_t)0U + (uint32_t)1U];
+        uint64_t *res_i1 = res_j + (uint32_t)4U * (uint32_t)0U + (uint32_t)1U;
+        c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i0, bj, c, res_i1);
+        uint64_t a_i1 = x[(uint32_t)4U * (uint32_t)0U + (uint32_t)2U];
+        uint64_t *res_i2 = res_j + (uint32_t)4U * (uint32_t)0U + (uint32_t)2U;
+        c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i1, bj, c, res_i2);
+        uint64_t a_i2 = x[(uint32_t)4U * (uint32_t)0U + (uint32_t)3U];
+        uint64_t *res_i = res_j + (uint32_t)4U * (uint32_t)0U + (uint32_t)3U;
+        c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i2, bj, c, res_i);
+      }
+      uint64_t r = c;
+      res[(uint32_t)4U + i0] = r;);
+  }
 }
 
 static inline void bn_sqr4(uint64_t *res, uint64_t *x)
 {
   memset(res, 0U, (uint32_t)8U * sizeof (uint64_t));
-  KRML_MAYBE_FOR4(i0,
-    (uint32_t)0U,
-    (uint32_t)4U,
-    (uint32_t)1U,
-    uint64_t *ab = x;
-    uint64_t a_j = x[i0];
-    uint64_t *res_j = res + i0;
-    uint64_t c = (uint64_t)0U;
-    for (uint32_t i = (uint32_t)0U; i < i0 / (uint32_t)4U; i++)
-    {
-      uint64_t a_i = ab[(uint32_t)4U * i];
-      uint64_t *res_i0 = res_j + (uint32_t)4U * i;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, a_j, c, res_i0);
-      uint64_t a_i0 = ab[(uint32_t)4U * i + (uint32_t)1U];
-      uint64_t *res_i1 = res_j + (uint32_t)4U * i + (uint32_t)1U;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i0, a_j, c, res_i1);
-      uint64_t a_i1 = ab[(uint32_t)4U * i + (uint32_t)2U];
-      uint64_t *res_i2 = res_j + (uint32_t)4U * i + (uint32_t)2U;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i1, a_j, c, res_i2);
-      uint64_t a_i2 = ab[(uint32_t)4U * i + (uint32_t)3U];
-      uint64_t *res_i = res_j + (uint32_t)4U * i + (uint32_t)3U;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i2, a_j, c, res_i);
-    }
-    for (uint32_t i = i0 / (uint32_t)4U * (uint32_t)4U; i < i0; i++)
-    {
-      uint64_t a_i = ab[i];
-      uint64_t *res_i = res_j + i;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, a_j, c, res_i);
-    }
-    uint64_t r = c;
-    res[i0 + i0] = r;);
-  uint64_t c0 = Hacl_Bignum_Addition_bn_add_eq_len_u64((uint32_t)8U, res, res, res);
-  KRML_HOST_IGNORE(c0);
-  uint64_t tmp[8U] = { 0U };
-  KRML_MAYBE_FOR4(i,
-    (uint32_t)0U,
-    (uint32_t)4U,
-    (uint32_t)1U,
-    FStar_UInt128_uint128 res1 = FStar_UInt128_mul_wide(x[i], x[i]);
-    uint64_t hi = FStar_UInt128_uint128_to_uint64(FStar_UInt128_shift_right(res1, (uint32_t)64U));
-    uint64_t lo = FStar_UInt128_uint128_to_uint64(res1);
-    tmp[(uint32_t)2U * i] = lo;
-    tmp[(uint32_t)2U * i + (uint32_t)1U] = hi;);
-  uint64_t c1 = Hacl_Bignum_Addition_bn_add_eq_len_u64((uint32_t)8U, res, tmp, res);
-  KRML_HOST_IGNORE(c1);
+  if (Hacl_Bignum_ADX_is_available())
+  {
+    Hacl_Bignum_ADX_bn_sqr_u64((uint32_t)4U, x, res);
+  }
+  else
+  {
+    KRML_MAYBE_FOR4(i0,
+      (uint32_t)0U,
+      (uint32_t)4U,
+      (uint32_t)1U,
+      uint64_t *ab = x;
+      uint64_t a_j = x[i0];
+      uint64_t *res_j = res + i0;
+      uint64_t c = (uint64_t)0U;
+      for (uint32_t i = (uint32_t)0U; i < i0 / (uint32_t)4U; i++)
+      {
+        uint64_t a_i = ab[(uint32_t)4U * i];
+        uint64_t *res_i0 = res_j + (uint32_t)4U * i;
+        c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, a_j, c, res_i0);
+        uint64_t a_i0 = ab[(uint32_t)4U * i + (uint32_t)1U];
+        uint64_t *res_i1 = res_j + (uint32_t)4U * i + (uint32_t)1U;
+        c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i0, a_j, c, res_i1);
+        uint64_t a_i1 = ab[(uint32_t)4U * i + (uint32_t)2U];
+        uint64_t *res_i2 = res_j + (uint32_t)4U * i + (uint32_t)2U;
+        c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i1, a_j, c, res_i2);
+        uint64_t a_i2 = ab[(uint32_t)4U * i + (uint32_t)3U];
+        uint64_t *res_i = res_j + (uint32_t)4U * i + (uint32_t)3U;
+        c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i2, a_j, c, res_i);
+      }
+      for (uint32_t i = i0 / (uint32_t)4U * (uint32_t)4U; i < i0; i++)
+      {
+        uint64_t a_i = ab[i];
+        uint64_t *res_i = res_j + i;
+        c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, a_j, c, res_i);
+      }
+      uint64_t r = c;
+      res[i0 + i0] = r;);
+    uint64_t c0 = Hacl_Bignum_Addition_bn_add_eq_len_u64((uint32_t)8U, res, res, res);
+    KRML_HOST_IGNORE(c0);
+    uint64_t tmp[8U] = { 0U };
+    KRML_MAYBE_FOR4(i,
+      (uint32_t)0U,
+      (uint32_t)4U,
+      (uint32_t)1U,
+      FStar_UInt128_uint128 res1 = FStar_UInt128_mul_wide(x[i], x[i]);
+      uint64_t hi = FStar_UInt128_uint128_to_uint64(FStar_UInt128_shift_right(res1, (uint32_t)64U));
+      uint64_t lo = FStar_UInt128_uint128_to_uint64(res1);
+      tmp[(uint32_t)2U * i] = lo;
+      tmp[(uint32_t)2U * i + (uint32_t)1U] = hi;);
+    uint64_t c1 = Hacl_Bignum_Addition_bn_add_eq_len_u64((uint32_t)8U, res, tmp, res);
+    KRML_HOST_IGNORE(c1);
+  }
 }
 
 static inline void bn_to_bytes_be4(uint8_t *res, uint64_t *f)
@@ -436,32 +451,39 @@ static inline void mont_reduction(uint64_t *res, uint64_t *x)
   uint64_t n[4U] = { 0U };
   make_prime(n);
   uint64_t c0 = (uint64_t)0U;
-  KRML_MAYBE_FOR4(i0,
-    (uint32_t)0U,
-    (uint32_t)4U,
-    (uint32_t)1U,
-    uint64_t qj = (uint64_t)1U * x[i0];
-    uint64_t *res_j0 = x + i0;
-    uint64_t c = (uint64_t)0U;
-    {
-      uint64_t a_i = n[(uint32_t)4U * (uint32_t)0U];
-      uint64_t *res_i0 = res_j0 + (uint32_t)4U * (uint32_t)0U;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, qj, c, res_i0);
-      uint64_t a_i0 = n[(uint32_t)4U * (uint32_t)0U + (uint32_t)1U];
-      uint64_t *res_i1 = res_j0 + (uint32_t)4U * (uint32_t)0U + (uint32_t)1U;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i0, qj, c, res_i1);
-      uint64_t a_i1 = n[(uint32_t)4U * (uint32_t)0U + (uint32_t)2U];
-      uint64_t *res_i2 = res_j0 + (uint32_t)4U * (uint32_t)0U + (uint32_t)2U;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i1, qj, c, res_i2);
-      uint64_t a_i2 = n[(uint32_t)4U * (uint32_t)0U + (uint32_t)3U];
-      uint64_t *res_i = res_j0 + (uint32_t)4U * (uint32_t)0U + (uint32_t)3U;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i2, qj, c, res_i);
-    }
-    uint64_t r = c;
-    uint64_t c1 = r;
-    uint64_t *resb = x + (uint32_t)4U + i0;
-    uint64_t res_j = x[(uint32_t)4U + i0];
-    c0 = Lib_IntTypes_Intrinsics_add_carry_u64(c0, c1, res_j, resb););
+  if (Hacl_Bignum_ADX_is_available())
+  {
+    c0 = Hacl_Bignum_ADX_bn_mont_reduction_loop_u64((uint32_t)4U, n, (uint64_t)1U, x);
+  }
+  else
+  {
+    KRML_MAYBE_FOR4(i0,
+      (uint32_t)0U,
+      (uint32_t)4U,
+      (uint32_t)1U,
+      uint64_t qj = (uint64_t)1U * x[i0];
+      uint64_t *res_j0 = x + i0;
+      uint64_t c = (uint64_t)0U;
+      {
+        uint64_t a_i = n[(uint32_t)4U * (uint32_t)0U];
+        uint64_t *res_i0 = res_j0 + (uint32_t)4U * (uint32_t)0U;
+        c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, qj, c, res_i0);
+        uint64_t a_i0 = n[(uint32_t)4U * (uint32_t)0U + (uint32_t)1U];
+        uint64_t *res_i1 = res_j0 + (uint32_t)4U * (uint32_t)0U + (uint32_t)1U;
+        c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i0, qj, c, res_i1);
+        uint64_t a_i1 = n[(uint32_t)4U * (uint32_t)0U + (uint32_t)2U];
+        uint64_t *res_i2 = res_j0 + (uint32_t)4U * (uint32_t)0U + (uint32_t)2U;
+        c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i1, qj, c, res_i2);
+        uint64_t a_i2 = n[(uint32_t)4U * (uint32_t)0U + (uint32_t)3U];
+        uint64_t *res_i = res_j0 + (uint32_t)4U * (uint32_t)0U + (uint32_t)3U;
+        c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i2, qj, c, res_i);
+      }
+      uint64_t r = c;
+      uint64_t c1 = r;
+      uint64_t *resb = x + (uint32_t)4U + i0;
+      uint64_t res_j = x[(uint32_t)4U + i0];
+      c0 = Lib_IntTypes_Intrinsics_add_carry_u64((uint8_t)c0, c1, res_j, resb););
+  }
   memcpy(res, x + (uint32_t)4U, (uint32_t)4U * sizeof (uint64_t));
   uint64_t c00 = c0;
   uint64_t tmp[4U] = { 0U };
@@ -1162,32 +1184,43 @@ static inline void qmont_reduction(uint64_t *res, uint64_t *x)
   uint64_t n[4U] = { 0U };
   make_order(n);
   uint64_t c0 = (uint64_t)0U;
-  KRML_MAYBE_FOR4(i0,
-    (uint32_t)0U,
-    (uint32_t)4U,
-    (uint32_t)1U,
-    uint64_t qj = (uint64_t)0xccd1c8aaee00bc4fU * x[i0];
-    uint64_t *res_j0 = x + i0;
-    uint64_t c = (uint64_t)0U;
-    {
-      uint64_t a_i = n[(uint32_t)4U * (uint32_t)0U];
-      uint64_t *res_i0 = res_j0 + (uint32_t)4U * (uint32_t)0U;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, qj, c, res_i0);
-      uint64_t a_i0 = n[(uint32_t)4U * (uint32_t)0U + (uint32_t)1U];
-      uint64_t *res_i1 = res_j0 + (uint32_t)4U * (uint32_t)0U + (uint32_t)1U;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i0, qj, c, res_i1);
-      uint64_t a_i1 = n[(uint32_t)4U * (uint32_t)0U + (uint32_t)2U];
-      uint64_t *res_i2 = res_j0 + (uint32_t)4U * (uint32_t)0U + (uint32_t)2U;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i1, qj, c, res_i2);
-      uint64_t a_i2 = n[(uint32_t)4U * (uint32_t)0U + (uint32_t)3U];
-      uint64_t *res_i = res_j0 + (uint32_t)4U * (uint32_t)0U + (uint32_t)3U;
-      c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i2, qj, c, res_i);
-    }
-    uint64_t r = c;
-    uint64_t c1 = r;
-    uint64_t *resb = x + (uint32_t)4U + i0;
-    uint64_t res_j = x[(uint32_t)4U + i0];
-    c0 = Lib_IntTypes_Intrinsics_add_carry_u64(c0, c1, res_j, resb););
+  if (Hacl_Bignum_ADX_is_available())
+  {
+    c0 =
+      Hacl_Bignum_ADX_bn_mont_reduction_loop_u64((uint32_t)4U,
+        n,
+        (uint64_t)0xccd1c8aaee00bc4fU,
+        x);
+  }
+  else
+  {
+    KRML_MAYBE_FOR4(i0,
+      (uint32_t)0U,
+      (uint32_t)4U,
+      (uint32_t)1U,
+      uint64_t qj = (uint64_t)0xccd1c8aaee00bc4fU * x[i0];
+      uint64_t *res_j0 = x + i0;
+      uint64_t c = (uint64_t)0U;
+      {
+        uint64_t a_i = n[(uint32_t)4U * (uint32_t)0U];
+        uint64_t *res_i0 = res_j0 + (uint32_t)4U * (uint32_t)0U;
+        c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, qj, c, res_i0);
+        uint64_t a_i0 = n[(uint32_t)4U * (uint32_t)0U + (uint32_t)1U];
+        uint64_t *res_i1 = res_j0 + (uint32_t)4U * (uint32_t)0U + (uint32_t)1U;
+        c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i0, qj, c, res_i1);
+        uint64_t a_i1 = n[(uint32_t)4U * (uint32_t)0U + (uint32_t)2U];
+        uint64_t *res_i2 = res_j0 + (uint32_t)4U * (uint32_t)0U + (uint32_t)2U;
+        c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i1, qj, c, res_i2);
+        uint64_t a_i2 = n[(uint32_t)4U * (uint32_t)0U + (uint32_t)3U];
+        uint64_t *res_i = res_j0 + (uint32_t)4U * (uint32_t)0U + (uint32_t)3U;
+        c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i2, qj, c, res_i);
+      }
+      uint64_t r = c;
+      uint64_t c1 = r;
+      uint64_t *resb = x + (uint32_t)4U + i0;
+      uint64_t res_j = x[(uint32_t)4U + i0];
+      c0 = Lib_IntTypes_Intrinsics_add_carry_u64((uint8_t)c0, c1, res_j, resb););
+  }
   memcpy(res, x + (uint32_t)4U, (uint32_t)4U * sizeof (uint64_t));
   uint64_t c00 = c0;
   uint64_t tmp[4U] = { 0U };
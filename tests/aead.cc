@@ -90,6 +90,19 @@ TEST_P(ChaCha20Suite, KAT)
     state, test.iv, test.aad, test.msg, test.ct, test.tag, test.valid);
 
   EverCrypt_AEAD_free(state);
+
+  // Same, with the state in caller-provided memory.
+  uint32_t size = EverCrypt_AEAD_state_size(Spec_Agile_AEAD_CHACHA20_POLY1305);
+  uint8_t* mem = (uint8_t*)KRML_ALIGNED_MALLOC(EVERCRYPT_AEAD_STATE_ALIGN, size);
+  res = EverCrypt_AEAD_init_in_place(
+    Spec_Agile_AEAD_CHACHA20_POLY1305, mem, &state, test.key.data());
+  ASSERT_EQ(res, EverCrypt_Error_Success);
+  ASSERT_EQ((uint8_t*)state, mem);
+
+  encrypt_decrypt(
+    state, test.iv, test.aad, test.msg, test.ct, test.tag, test.valid);
+
+  KRML_ALIGNED_FREE(mem);
 }
 
 // ----- AES GCM -------------------------------------------------------------
@@ -138,6 +151,105 @@ TEST_P(AesGcmSuite, KAT)
     state, test.iv, test.aad, test.msg, test.ct, test.tag, test.valid);
 
   EverCrypt_AEAD_free(state);
+
+  // Same, with the state in caller-provided memory.
+  Spec_Agile_AEAD_alg alg = test.keySize == 128 ? Spec_Agile_AEAD_AES128_GCM
+                                                : Spec_Agile_AEAD_AES256_GCM;
+  uint32_t size = EverCrypt_AEAD_state_size(alg);
+  uint8_t* mem = (uint8_t*)KRML_ALIGNED_MALLOC(EVERCRYPT_AEAD_STATE_ALIGN, size);
+  res = EverCrypt_AEAD_init_in_place(alg, mem, &state, test.key.data());
+  ASSERT_EQ(res, EverCrypt_Error_Success);
+  EXPECT_EQ(EverCrypt_AEAD_alg_of_state(state), alg);
+
+  encrypt_decrypt(
+    state, test.iv, test.aad, test.msg, test.ct, test.tag, test.valid);
+
+  KRML_ALIGNED_FREE(mem);
+}
+
+// ----- Batches ---------------------------------------------------------------
+
+// A batch gives the same ciphertexts as encrypting its messages one by one,
+// and a forged tag only invalidates its own message.
+TEST(AeadBatch, ChaCha20Poly1305)
+{
+  bytes key(32);
+  generate_random(key.data(), key.size());
+  EverCrypt_AEAD_state_s* state;
+  ASSERT_EQ(EverCrypt_AEAD_create_in(
+              Spec_Agile_AEAD_CHACHA20_POLY1305, &state, key.data()),
+            EverCrypt_Error_Success);
+
+  vector<uint32_t> ad_lens = { 0, 13, 7, 0 };
+  vector<uint32_t> lens = { 0, 1, 1000, 64 };
+  size_t n = lens.size();
+  uint32_t ad_total = 0, total = 0;
+  for (size_t i = 0; i < n; i++) {
+    ad_total += ad_lens[i];
+    total += lens[i];
+  }
+  bytes iv(12 * n), ad(ad_total), msg(total);
+  generate_random(iv.data(), iv.size());
+  generate_random(ad.data(), ad.size());
+  generate_random(msg.data(), msg.size());
+
+  bytes cipher(total), tag(16 * n);
+  ASSERT_EQ(EverCrypt_AEAD_encrypt_batch(state,
+                                         n,
+                                         iv.data(),
+                                         12,
+                                         ad.data(),
+                                         ad_lens.data(),
+                                         msg.data(),
+                                         lens.data(),
+                                         cipher.data(),
+                                         tag.data()),
+            EverCrypt_Error_Success);
+
+  uint8_t *a = ad.data(), *m = msg.data(), *c = cipher.data();
+  for (size_t i = 0; i < n; i++) {
+    bytes expected_cipher(lens[i]), expected_tag(16);
+    EverCrypt_AEAD_encrypt(state,
+                           iv.data() + 12 * i,
+                           12,
+                           a,
+                           ad_lens[i],
+                           m,
+                           lens[i],
+                           expected_cipher.data(),
+                           expected_tag.data());
+    EXPECT_EQ(bytes(c, c + lens[i]), expected_cipher);
+    EXPECT_EQ(bytes(tag.begin() + 16 * i, tag.begin() + 16 * (i + 1)),
+              expected_tag);
+    a += ad_lens[i];
+    m += lens[i];
+    c += lens[i];
+  }
+
+  tag[16 * 2] ^= 1;
+  bytes got(total);
+  bool valid[4];
+  EXPECT_EQ(EverCrypt_AEAD_decrypt_batch(state,
+                                         n,
+                                         iv.data(),
+                                         12,
+                                         ad.data(),
+                                         ad_lens.data(),
+                                         cipher.data(),
+                                         lens.data(),
+                                         tag.data(),
+                                         got.data(),
+                                         valid),
+            EverCrypt_Error_AuthenticationFailure);
+  EXPECT_TRUE(valid[0]);
+  EXPECT_TRUE(valid[1]);
+  EXPECT_FALSE(valid[2]);
+  EXPECT_TRUE(valid[3]);
+  EXPECT_EQ(bytes(got.begin() + 1001, got.end()),
+            bytes(msg.begin() + 1001, msg.end()));
+  EXPECT_EQ(got[0], msg[0]);
+
+  EverCrypt_AEAD_free(state);
 }
 
 // ----- EverCrypt -------------------------------------------------------------
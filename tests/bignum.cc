@@ -798,6 +798,309 @@ read_bignum_json(string path)
   return tests;
 }
 
+#if defined(HACL_CAN_COMPILE_VEC128) && defined(HACL_CAN_COMPILE_IFMA)
+// Modular exponentiation on the AVX-512 IFMA backend must agree with the
+// portable 64-bit code for every modulus size it handles.
+TEST(BignumIfma, ModExp)
+{
+  EverCrypt_AutoConfig2_init();
+  if (!EverCrypt_AutoConfig2_has_avx512ifma()) {
+    printf(" ! IFMA was compiled but it is not available on this CPU.\n");
+    return;
+  }
+
+  for (uint32_t bits : { 2048, 3072, 4096 }) {
+    uint32_t len = bits / 64;
+    for (size_t i = 0; i < 8; i++) {
+      bytes n_bytes(bits / 8), a_bytes(bits / 8), b_bytes(bits / 8);
+      generate_random(n_bytes.data(), n_bytes.size());
+      generate_random(a_bytes.data(), a_bytes.size());
+      generate_random(b_bytes.data(), b_bytes.size());
+      // n is odd and has its top bit set, a < n.
+      n_bytes[0] |= 0x80;
+      n_bytes[n_bytes.size() - 1] |= 1;
+      a_bytes[0] &= 0x7f;
+
+      uint64_t* n = Hacl_Bignum64_new_bn_from_bytes_be(len * 8, n_bytes.data());
+      uint64_t* a = Hacl_Bignum64_new_bn_from_bytes_be(len * 8, a_bytes.data());
+      uint64_t* b = Hacl_Bignum64_new_bn_from_bytes_be(len * 8, b_bytes.data());
+      ASSERT_NE(n, nullptr);
+      ASSERT_NE(a, nullptr);
+      ASSERT_NE(b, nullptr);
+      // Short exponents take the binary method in the portable code.
+      uint32_t bBits = i % 2 == 0 ? bits : 17;
+      if (bBits < bits) {
+        memset(b + 1, 0, (len - 1) * sizeof(uint64_t));
+        b[0] &= (1 << bBits) - 1;
+      }
+
+      vector<uint64_t> ifma_ct(len), ifma_vt(len), ref_ct(len), ref_vt(len);
+      EverCrypt_AutoConfig2_init();
+      ASSERT_TRUE(Hacl_Bignum64_mod_exp_consttime(
+        len, n, a, bBits, b, ifma_ct.data()));
+      ASSERT_TRUE(
+        Hacl_Bignum64_mod_exp_vartime(len, n, a, bBits, b, ifma_vt.data()));
+      EverCrypt_AutoConfig2_disable_avx512ifma();
+      ASSERT_TRUE(
+        Hacl_Bignum64_mod_exp_consttime(len, n, a, bBits, b, ref_ct.data()));
+      ASSERT_TRUE(
+        Hacl_Bignum64_mod_exp_vartime(len, n, a, bBits, b, ref_vt.data()));
+      EXPECT_EQ(ifma_ct, ref_ct);
+      EXPECT_EQ(ifma_vt, ref_vt);
+      EXPECT_EQ(ifma_ct, ref_vt);
+
+      if (bits == 4096) {
+        vector<uint64_t> res(len);
+        EverCrypt_AutoConfig2_init();
+        ASSERT_TRUE(
+          Hacl_Bignum4096_mod_exp_consttime(n, a, bBits, b, res.data()));
+        EXPECT_EQ(res, ref_ct);
+        ASSERT_TRUE(Hacl_Bignum4096_mod_exp_vartime(n, a, bBits, b, res.data()));
+        EXPECT_EQ(res, ref_ct);
+      }
+
+      free(n);
+      free(a);
+      free(b);
+    }
+  }
+  EverCrypt_AutoConfig2_init();
+}
+#endif
+
+#ifdef HACL_CAN_COMPILE_VEC128
+// Multiplication, squaring, reduction and exponentiation on the ADX/BMI2
+// kernels must agree with the portable code for the sizes used by P-256, RSA
+// and FFDHE.
+TEST(BignumAdx, MatchesPortable)
+{
+  for (uint32_t len : { 4, 32, 48, 64 }) {
+    for (size_t i = 0; i < 2; i++) {
+      bytes n_bytes(len * 8), a_bytes(2 * len * 8), b_bytes(len * 8);
+      generate_random(n_bytes.data(), n_bytes.size());
+      generate_random(a_bytes.data(), a_bytes.size());
+      generate_random(b_bytes.data(), b_bytes.size());
+      n_bytes[0] |= 0x80;
+      n_bytes[n_bytes.size() - 1] |= 1;
+      uint64_t* n = Hacl_Bignum64_new_bn_from_bytes_be(len * 8, n_bytes.data());
+      uint64_t* a =
+        Hacl_Bignum64_new_bn_from_bytes_be(2 * len * 8, a_bytes.data());
+      uint64_t* b = Hacl_Bignum64_new_bn_from_bytes_be(len * 8, b_bytes.data());
+
+      vector<uint64_t> res[2][5];
+      for (int adx = 1; adx >= 0; adx--) {
+        EverCrypt_AutoConfig2_init();
+        // Keep modular exponentiation off the IFMA backend.
+        EverCrypt_AutoConfig2_disable_avx512ifma();
+        if (!adx) {
+          EverCrypt_AutoConfig2_disable_adx();
+        }
+        vector<uint64_t>* r = res[adx];
+        for (size_t j = 0; j < 5; j++) {
+          r[j].resize(2 * len);
+        }
+        Hacl_Bignum64_mul(len, a, b, r[0].data());
+        Hacl_Bignum64_sqr(len, b, r[1].data());
+        ASSERT_TRUE(Hacl_Bignum64_mod(len, n, a, r[2].data()));
+        uint64_t* a_lo = a;
+        if (Hacl_Bignum64_lt_mask(len, a_lo, n) == 0) {
+          a_lo = r[2].data();
+        }
+        ASSERT_TRUE(Hacl_Bignum64_mod_exp_consttime(
+          len, n, a_lo, 64 * len, b, r[3].data()));
+        ASSERT_TRUE(
+          Hacl_Bignum64_mod_exp_vartime(len, n, a_lo, 64 * len, b, r[4].data()));
+        if (len == 4) {
+          vector<uint64_t> r256(8);
+          Hacl_Bignum256_mul(a, b, r256.data());
+          EXPECT_EQ(r256, r[0]);
+          Hacl_Bignum256_sqr(b, r256.data());
+          EXPECT_EQ(r256, r[1]);
+          ASSERT_TRUE(Hacl_Bignum256_mod_exp_consttime(
+            n, a_lo, 256, b, r256.data()));
+          EXPECT_TRUE(equal(r256.begin(), r256.begin() + 4, r[3].begin()));
+        }
+        if (len == 64) {
+          vector<uint64_t> r4096(64);
+          ASSERT_TRUE(Hacl_Bignum4096_mod_exp_consttime(
+            n, a_lo, 4096, b, r4096.data()));
+          EXPECT_TRUE(equal(r4096.begin(), r4096.end(), r[3].begin()));
+        }
+      }
+      for (size_t j = 0; j < 5; j++) {
+        EXPECT_EQ(res[1][j], res[0][j]) << "len " << len << " op " << j;
+      }
+      EXPECT_EQ(res[1][3], res[1][4]);
+
+      free(n);
+      free(a);
+      free(b);
+    }
+  }
+  EverCrypt_AutoConfig2_init();
+}
+#endif
+
+// Multi-exponentiation and fixed-base comb exponentiation must agree with the
+// product of single exponentiations, in both the vartime and consttime flavors.
+TEST(BignumMultiExp, Bignum32)
+{
+  const uint32_t len = 2048 / 32;
+  const uint32_t num = 3;
+  for (uint32_t bBits : { 1, 31, 256, 2048 }) {
+    uint32_t bLen = (bBits - 1) / 32 + 1;
+    bytes n_bytes(len * 4), a_bytes(num * len * 4);
+    generate_random(n_bytes.data(), n_bytes.size());
+    generate_random(a_bytes.data(), a_bytes.size());
+    n_bytes[0] |= 0x80;
+    n_bytes[n_bytes.size() - 1] |= 1;
+    uint32_t* n = Hacl_Bignum32_new_bn_from_bytes_be(len * 4, n_bytes.data());
+    ASSERT_NE(n, nullptr);
+    Hacl_Bignum_MontArithmetic_bn_mont_ctx_u32* k =
+      Hacl_Bignum32_mont_ctx_init(len, n);
+
+    vector<uint32_t> a(num * len), b(num * bLen);
+    for (uint32_t i = 0; i < num; i++) {
+      uint32_t* ai =
+        Hacl_Bignum32_new_bn_from_bytes_be(len * 4, &a_bytes[i * len * 4]);
+      vector<uint32_t> wide(2 * len);
+      memcpy(wide.data(), ai, len * 4);
+      Hacl_Bignum32_mod_precomp(k, wide.data(), &a[i * len]);
+      free(ai);
+    }
+    generate_random((uint8_t*)b.data(), b.size() * 4);
+    if (bBits % 32 != 0) {
+      for (uint32_t i = 0; i < num; i++) {
+        b[i * bLen + bLen - 1] &= (1U << (bBits % 32)) - 1;
+      }
+    }
+
+    // Reference: a[0]^b[0] * a[1]^b[1] * a[2]^b[2] mod n.
+    vector<uint32_t> expected(len), tmp(len), wide(2 * len);
+    expected[0] = 1;
+    for (uint32_t i = 0; i < num; i++) {
+      Hacl_Bignum32_mod_exp_vartime_precomp(
+        k, &a[i * len], bBits, &b[i * bLen], tmp.data());
+      Hacl_Bignum32_mul(len, expected.data(), tmp.data(), wide.data());
+      Hacl_Bignum32_mod_precomp(k, wide.data(), expected.data());
+    }
+
+    vector<uint32_t> res(len);
+    EXPECT_TRUE(Hacl_Bignum32_mod_multi_exp_vartime_precomp(
+      k, num, a.data(), bBits, b.data(), res.data()));
+    EXPECT_EQ(res, expected);
+    EXPECT_TRUE(Hacl_Bignum32_mod_multi_exp_consttime_precomp(
+      k, num, a.data(), bBits, b.data(), res.data()));
+    EXPECT_EQ(res, expected);
+
+    Hacl_Bignum_MontArithmetic_bn_comb_table_u32* t =
+      Hacl_Bignum32_comb_table_init(k, a.data(), bBits);
+    ASSERT_NE(t, nullptr);
+    EXPECT_EQ(Hacl_Bignum32_comb_table_init(k, a.data(), 0), nullptr);
+    Hacl_Bignum32_mod_exp_vartime_precomp(
+      k, a.data(), bBits, b.data(), expected.data());
+    for (uint32_t i = 0; i < 2; i++) {
+      EXPECT_TRUE(
+        Hacl_Bignum32_mod_exp_comb_vartime_precomp(k, t, b.data(), res.data()));
+      EXPECT_EQ(res, expected);
+      EXPECT_TRUE(Hacl_Bignum32_mod_exp_comb_consttime_precomp(
+        k, t, b.data(), res.data()));
+      EXPECT_EQ(res, expected);
+    }
+
+    // A table built for another modulus length is rejected.
+    Hacl_Bignum_MontArithmetic_bn_mont_ctx_u32* k_half =
+      Hacl_Bignum32_mont_ctx_init(len / 2, n);
+    EXPECT_FALSE(Hacl_Bignum32_mod_exp_comb_vartime_precomp(
+      k_half, t, b.data(), res.data()));
+    EXPECT_FALSE(Hacl_Bignum32_mod_exp_comb_consttime_precomp(
+      k_half, t, b.data(), res.data()));
+    Hacl_Bignum32_mont_ctx_free(k_half);
+    Hacl_Bignum32_comb_table_free(t);
+
+    Hacl_Bignum32_mont_ctx_free(k);
+    free(n);
+  }
+}
+
+#ifdef HACL_CAN_COMPILE_VEC128
+TEST(BignumMultiExp, Bignum64)
+{
+  const uint32_t len = 3072 / 64;
+  const uint32_t num = 2;
+  for (uint32_t bBits : { 1, 63, 255, 3072 }) {
+    uint32_t bLen = (bBits - 1) / 64 + 1;
+    bytes n_bytes(len * 8), a_bytes(num * len * 8);
+    generate_random(n_bytes.data(), n_bytes.size());
+    generate_random(a_bytes.data(), a_bytes.size());
+    n_bytes[0] |= 0x80;
+    n_bytes[n_bytes.size() - 1] |= 1;
+    uint64_t* n = Hacl_Bignum64_new_bn_from_bytes_be(len * 8, n_bytes.data());
+    ASSERT_NE(n, nullptr);
+    Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64* k =
+      Hacl_Bignum64_mont_ctx_init(len, n);
+
+    vector<uint64_t> a(num * len), b(num * bLen);
+    for (uint32_t i = 0; i < num; i++) {
+      uint64_t* ai =
+        Hacl_Bignum64_new_bn_from_bytes_be(len * 8, &a_bytes[i * len * 8]);
+      vector<uint64_t> wide(2 * len);
+      memcpy(wide.data(), ai, len * 8);
+      Hacl_Bignum64_mod_precomp(k, wide.data(), &a[i * len]);
+      free(ai);
+    }
+    generate_random((uint8_t*)b.data(), b.size() * 8);
+    if (bBits % 64 != 0) {
+      for (uint32_t i = 0; i < num; i++) {
+        b[i * bLen + bLen - 1] &= (1ULL << (bBits % 64)) - 1;
+      }
+    }
+
+    vector<uint64_t> expected(len), tmp(len), wide(2 * len);
+    expected[0] = 1;
+    for (uint32_t i = 0; i < num; i++) {
+      Hacl_Bignum64_mod_exp_vartime_precomp(
+        k, &a[i * len], bBits, &b[i * bLen], tmp.data());
+      Hacl_Bignum64_mul(len, expected.data(), tmp.data(), wide.data());
+      Hacl_Bignum64_mod_precomp(k, wide.data(), expected.data());
+    }
+
+    vector<uint64_t> res(len);
+    EXPECT_TRUE(Hacl_Bignum64_mod_multi_exp_vartime_precomp(
+      k, num, a.data(), bBits, b.data(), res.data()));
+    EXPECT_EQ(res, expected);
+    EXPECT_TRUE(Hacl_Bignum64_mod_multi_exp_consttime_precomp(
+      k, num, a.data(), bBits, b.data(), res.data()));
+    EXPECT_EQ(res, expected);
+
+    Hacl_Bignum_MontArithmetic_bn_comb_table_u64* t =
+      Hacl_Bignum64_comb_table_init(k, a.data(), bBits);
+    ASSERT_NE(t, nullptr);
+    EXPECT_EQ(Hacl_Bignum64_comb_table_init(k, a.data(), 0), nullptr);
+    Hacl_Bignum64_mod_exp_vartime_precomp(
+      k, a.data(), bBits, b.data(), expected.data());
+    EXPECT_TRUE(
+      Hacl_Bignum64_mod_exp_comb_vartime_precomp(k, t, b.data(), res.data()));
+    EXPECT_EQ(res, expected);
+    EXPECT_TRUE(
+      Hacl_Bignum64_mod_exp_comb_consttime_precomp(k, t, b.data(), res.data()));
+    EXPECT_EQ(res, expected);
+
+    Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64* k_half =
+      Hacl_Bignum64_mont_ctx_init(len / 2, n);
+    EXPECT_FALSE(Hacl_Bignum64_mod_exp_comb_vartime_precomp(
+      k_half, t, b.data(), res.data()));
+    EXPECT_FALSE(Hacl_Bignum64_mod_exp_comb_consttime_precomp(
+      k_half, t, b.data(), res.data()));
+    Hacl_Bignum64_mont_ctx_free(k_half);
+    Hacl_Bignum64_comb_table_free(t);
+
+    Hacl_Bignum64_mont_ctx_free(k);
+    free(n);
+  }
+}
+#endif
+
 INSTANTIATE_TEST_SUITE_P(Cryspen,
                          Bignum,
                          ::testing::ValuesIn(read_bignum_json("bignum.json")));
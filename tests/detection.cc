@@ -52,6 +52,7 @@ TEST(DetectionSuite, PrintFeatures)
     cout << "avx: " << EverCrypt_AutoConfig2_has_avx() << endl;
     cout << "avx2: " << EverCrypt_AutoConfig2_has_avx2() << endl;
     cout << "avx512: " << EverCrypt_AutoConfig2_has_avx512() << endl;
+    cout << "avx512ifma: " << EverCrypt_AutoConfig2_has_avx512ifma() << endl;
     cout << "bmi2: " << EverCrypt_AutoConfig2_has_bmi2() << endl;
     cout << "movbe: " << EverCrypt_AutoConfig2_has_movbe() << endl;
     cout << "pclmulqdq: " << EverCrypt_AutoConfig2_has_pclmulqdq() << endl;
@@ -7,14 +7,24 @@
  */
 
 #include <fstream>
+#include <set>
+#include <thread>
 #include <tuple>
 
+#if !(defined(_WIN32) || defined(_WIN64))
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 #include <gtest/gtest.h>
 #include <nlohmann/json.hpp>
 
 #include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_DRBG.h"
+#include "EverCrypt_Random.h"
 #include "Hacl_HMAC_DRBG.h"
 #include "Hacl_Spec.h"
+#include "internal/EverCrypt_DRBG.h"
 #include "hacl-cpu-features.h"
 
 #include "util.h"
@@ -204,6 +214,218 @@ TEST(DrbgSuite, MinLengthKAT)
   }
 }
 
+TEST(DrbgChacha20, Generate)
+{
+  EverCrypt_AutoConfig2_init();
+
+  bytes personalization = from_hex("AF65C375F0850AF29CC3FE6C0C1D31F4");
+  bytes additional = from_hex("1CA8F61C");
+
+  EverCrypt_DRBG_state_s* st = EverCrypt_DRBG_create_chacha20();
+  ASSERT_NE(st, nullptr);
+  ASSERT_TRUE(EverCrypt_DRBG_instantiate(
+    st, personalization.data(), personalization.size()));
+
+  // Around the single-batch threshold and beyond the HMAC-DRBG limit.
+  vector<uint32_t> lengths = { 0,   1,    32,   63,    64,    447,
+                               448, 449,  512,  4096,  65536, 1 << 20 };
+  for (auto len : lengths) {
+    bytes a(len), b(len);
+    EXPECT_TRUE(EverCrypt_DRBG_generate(a.data(), st, len, NULL, 0));
+    EXPECT_TRUE(EverCrypt_DRBG_generate(
+      b.data(), st, len, additional.data(), additional.size()));
+    if (len >= 16) {
+      EXPECT_NE(a, b);
+      EXPECT_NE(a, bytes(len, 0));
+    }
+  }
+
+  // Crossing the reseed interval reseeds from the OS transparently.
+  bytes out(32);
+  for (uint32_t i = 0; i < EverCrypt_DRBG_reseed_interval + 2; i++) {
+    ASSERT_TRUE(EverCrypt_DRBG_generate(out.data(), st, out.size(), NULL, 0));
+  }
+  EXPECT_TRUE(EverCrypt_DRBG_reseed(st, additional.data(), additional.size()));
+  EXPECT_TRUE(EverCrypt_DRBG_generate(out.data(), st, out.size(), NULL, 0));
+
+  EverCrypt_DRBG_uninstantiate(st);
+}
+
+// The ChaCha20 generator has no published test vectors. These were computed
+// with an independent Python model of the construction (HMAC-SHA2-256 key
+// derivation and RFC 8439 ChaCha20 with a zero nonce): entropy is the bytes
+// 0x00..0x2f, and the calls are 32 bytes, 40 bytes with additional input,
+// 500 bytes (last 32 checked) and 32 bytes.
+TEST(DrbgChacha20, KAT)
+{
+  EverCrypt_AutoConfig2_init();
+
+  bytes entropy(48);
+  for (size_t i = 0; i < entropy.size(); i++) {
+    entropy[i] = (uint8_t)i;
+  }
+  bytes personalization = from_hex("AF65C375F0850AF29CC3FE6C0C1D31F4");
+  bytes additional = from_hex("1CA8F61C");
+
+  EverCrypt_DRBG_state_s* st = EverCrypt_DRBG_create_chacha20();
+  ASSERT_NE(st, nullptr);
+  ASSERT_TRUE(EverCrypt_DRBG_instantiate_chacha20_derand(
+    st, entropy.data(), personalization.data(), personalization.size()));
+
+  bytes out1(32), out2(40), out3(500), out4(32);
+  ASSERT_TRUE(EverCrypt_DRBG_generate(out1.data(), st, out1.size(), NULL, 0));
+  ASSERT_TRUE(EverCrypt_DRBG_generate(
+    out2.data(), st, out2.size(), additional.data(), additional.size()));
+  ASSERT_TRUE(EverCrypt_DRBG_generate(out3.data(), st, out3.size(), NULL, 0));
+  ASSERT_TRUE(EverCrypt_DRBG_generate(out4.data(), st, out4.size(), NULL, 0));
+
+  EXPECT_EQ(out1,
+            from_hex("f90339b10f91bc4ac10fa8000ab012f2"
+                     "fe9ea4620be35ee8d951c452b74cdf7a"));
+  EXPECT_EQ(out2,
+            from_hex("e373cf8dcb873764ddedadd9c4542ff8"
+                     "d80406f69b03157557d67b5565f8c939"
+                     "031bcabe0c9f1243"));
+  EXPECT_EQ(bytes(out3.end() - 32, out3.end()),
+            from_hex("aaa97883efbcb791f38888ecff7b20c1"
+                     "a6f635f301e6d356bbd06afda6ab9633"));
+  EXPECT_EQ(out4,
+            from_hex("8a6509bb09d76653ae9e552706b4dc72"
+                     "84ed46e0e49e5f29cb82b5b1397f1f80"));
+
+  EverCrypt_DRBG_uninstantiate(st);
+}
+
+TEST(DrbgChacha20, Backends)
+{
+  // The vectorized backends must produce the same stream as the portable
+  // one, which is used when they are disabled. The lengths cover the
+  // single-batch path, the multi-block path and partial vector blocks.
+  bytes entropy(48, 0x5a);
+  vector<uint32_t> lengths = { 1, 63, 448, 449, 511, 1000, 4096 + 17 };
+  vector<vector<bytes>> outputs;
+  for (int backend = 0; backend < 3; backend++) {
+    EverCrypt_AutoConfig2_init();
+    if (backend > 0) {
+      EverCrypt_AutoConfig2_disable_avx2();
+    }
+    if (backend > 1) {
+      EverCrypt_AutoConfig2_disable_avx();
+      EverCrypt_AutoConfig2_disable_sse();
+    }
+    EverCrypt_DRBG_state_s* st = EverCrypt_DRBG_create_chacha20();
+    ASSERT_NE(st, nullptr);
+    ASSERT_TRUE(
+      EverCrypt_DRBG_instantiate_chacha20_derand(st, entropy.data(), NULL, 0));
+    vector<bytes> out;
+    for (auto len : lengths) {
+      bytes b(len);
+      EXPECT_TRUE(EverCrypt_DRBG_generate(b.data(), st, len, NULL, 0));
+      out.push_back(b);
+    }
+    EXPECT_NE(out[5], bytes(lengths[5], 0));
+    outputs.push_back(out);
+    EverCrypt_DRBG_uninstantiate(st);
+  }
+  EverCrypt_AutoConfig2_init();
+
+  for (int backend = 0; backend < 2; backend++) {
+    for (size_t i = 0; i < lengths.size(); i++) {
+      EXPECT_EQ(outputs[backend][i], outputs[2][i])
+        << "backend " << backend << " length " << lengths[i];
+    }
+  }
+}
+
+TEST(RandomBytes, Lengths)
+{
+  EXPECT_TRUE(hacl_random_bytes(NULL, 0));
+
+  // Around the per-thread buffer and the DRBG output limit.
+  vector<uint32_t> lengths = {
+    1,     31,    32,    33,     EVERCRYPT_RANDOM_BUFFER_LEN - 1,
+    EVERCRYPT_RANDOM_BUFFER_LEN,  EVERCRYPT_RANDOM_BUFFER_LEN + 1,
+    65535, 65536, 65537, 200000,
+  };
+
+  for (auto len : lengths) {
+    bytes a(len), b(len);
+    EXPECT_TRUE(hacl_random_bytes(a.data(), len));
+    EXPECT_TRUE(EverCrypt_Random_bytes(b.data(), len));
+    if (len >= 16) {
+      EXPECT_NE(a, b);
+      EXPECT_NE(a, bytes(len, 0));
+    }
+  }
+
+  uint8_t before[32], after[32];
+  EXPECT_TRUE(hacl_random_bytes(before, 32));
+  EXPECT_TRUE(EverCrypt_Random_reseed());
+  EXPECT_TRUE(hacl_random_bytes(after, 32));
+  EXPECT_NE(bytes(before, before + 32), bytes(after, after + 32));
+
+  EverCrypt_Random_thread_cleanup();
+  EverCrypt_Random_thread_cleanup();
+  EXPECT_TRUE(hacl_random_bytes(after, 32));
+}
+
+TEST(RandomBytes, Threads)
+{
+  const size_t n_threads = 8;
+  const size_t n_draws = 512;
+  vector<vector<bytes>> outputs(n_threads);
+  vector<std::thread> threads;
+
+  for (size_t t = 0; t < n_threads; t++) {
+    threads.emplace_back([&outputs, t, n_draws]() {
+      for (size_t i = 0; i < n_draws; i++) {
+        bytes out(16);
+        EXPECT_TRUE(hacl_random_bytes(out.data(), out.size()));
+        outputs[t].push_back(out);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  set<bytes> unique;
+  for (auto& per_thread : outputs) {
+    unique.insert(per_thread.begin(), per_thread.end());
+  }
+  EXPECT_EQ(unique.size(), n_threads * n_draws);
+}
+
+#if !(defined(_WIN32) || defined(_WIN64))
+TEST(RandomBytes, Fork)
+{
+  // Make sure the parent has buffered output that the child inherits.
+  uint8_t prime[1];
+  ASSERT_TRUE(hacl_random_bytes(prime, 1));
+
+  int fds[2];
+  ASSERT_EQ(pipe(fds), 0);
+  pid_t pid = fork();
+  ASSERT_GE(pid, 0);
+  if (pid == 0) {
+    uint8_t out[64];
+    bool ok = hacl_random_bytes(out, sizeof(out));
+    ssize_t written = write(fds[1], out, sizeof(out));
+    _exit(ok && written == (ssize_t)sizeof(out) ? 0 : 1);
+  }
+  close(fds[1]);
+
+  uint8_t parent[64], child[64];
+  ASSERT_TRUE(hacl_random_bytes(parent, sizeof(parent)));
+  ASSERT_EQ(read(fds[0], child, sizeof(child)), (ssize_t)sizeof(child));
+  close(fds[0]);
+  int status;
+  waitpid(pid, &status, 0);
+  EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+  EXPECT_NE(bytes(parent, parent + 64), bytes(child, child + 64));
+}
+#endif
+
 class DrbgNRSuite : public ::testing::TestWithParam<CAVPTestCase>
 {
   void SetUp() override
@@ -98,6 +98,7 @@ read_wycheproof_eddsa_verify(string path)
 #define HACL_SIGNATURE_ED25519_SECRETKEY_LEN 32
 #define HACL_SIGNATURE_ED25519_SECRETKEY_PRECOMP_LEN 96
 #define HACL_SIGNATURE_ED25519_PUBLICKEY_LEN 32
+#define HACL_SIGNATURE_ED25519_PUBLICKEY_PRECOMP_LEN 644
 #define HACL_SIGNATURE_ED25519_SIGNATURE_LEN 64
 // ANCHOR_END(DEFINE)
 
@@ -188,6 +189,44 @@ TEST(ApiTestSuite, ApiTest)
     ASSERT_EQ(result_1, true);
     ASSERT_EQ(result_2, true);
   }
+
+  {
+    // ANCHOR(example precomputed verify)
+    // In this example, we use the precomputed API to verify multiple signatures
+    // under the same public key more efficiently.
+    uint8_t sk[HACL_SIGNATURE_ED25519_SECRETKEY_LEN];
+    generate_random(sk, HACL_SIGNATURE_ED25519_SECRETKEY_LEN);
+    uint8_t pk[HACL_SIGNATURE_ED25519_PUBLICKEY_LEN];
+    Hacl_Ed25519_secret_to_public(pk, sk);
+
+    uint8_t msg_1[1337];
+    generate_random(msg_1, 1337);
+    uint8_t msg_2[42];
+    generate_random(msg_2, 42);
+
+    uint8_t signature_1[HACL_SIGNATURE_ED25519_SIGNATURE_LEN];
+    uint8_t signature_2[HACL_SIGNATURE_ED25519_SIGNATURE_LEN];
+    Hacl_Ed25519_sign(signature_1, sk, 1337, msg_1);
+    Hacl_Ed25519_sign(signature_2, sk, 42, msg_2);
+
+    // First, we precompute an intermediate key that will be used for
+    // verification. This fails if the public key is not a valid point.
+    uint64_t pk_exp[HACL_SIGNATURE_ED25519_PUBLICKEY_PRECOMP_LEN];
+    bool pk_valid = Hacl_Ed25519_expand_public_key(pk_exp, pk);
+
+    // Then, we use the precomputed key to verify (multiple) signatures.
+    bool result_1 = Hacl_Ed25519_verify_expanded(pk_exp, 1337, msg_1, signature_1);
+    bool result_2 = Hacl_Ed25519_verify_expanded(pk_exp, 42, msg_2, signature_2);
+    // ANCHOR_END(example precomputed verify)
+
+    ASSERT_EQ(pk_valid, true);
+    ASSERT_EQ(result_1, true);
+    ASSERT_EQ(result_2, true);
+
+    // A signature for another message must not verify.
+    bool result_3 = Hacl_Ed25519_verify_expanded(pk_exp, 42, msg_2, signature_1);
+    ASSERT_EQ(result_3, false);
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -219,6 +258,15 @@ TEST_P(Ed25519Suite, Wycheproof)
     test.pk.data(), test.msg.size(), test.msg.data(), test.sig.data());
 
   ASSERT_EQ(test.valid, got_valid);
+
+  // Verify the signature from the KAT with the expanded public key.
+  vector<uint64_t> pk_exp(HACL_SIGNATURE_ED25519_PUBLICKEY_PRECOMP_LEN);
+  bool got_valid_expanded =
+    Hacl_Ed25519_expand_public_key(pk_exp.data(), test.pk.data()) &&
+    Hacl_Ed25519_verify_expanded(
+      pk_exp.data(), test.msg.size(), test.msg.data(), test.sig.data());
+
+  ASSERT_EQ(test.valid, got_valid_expanded);
 }
 
 // ----- EverCrypt -------------------------------------------------------------
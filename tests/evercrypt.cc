@@ -8,6 +8,13 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <thread>
+
+#include "EverCrypt_AEAD.h"
+#include "EverCrypt_Chacha20Poly1305.h"
+#include "EverCrypt_Hash.h"
+#include "EverCrypt_Instrumentation.h"
 #include "evercrypt.h"
 #include "util.h"
 
@@ -37,6 +44,7 @@ TEST_P(EverCryptSuiteDummy, CheckDisabledFeatures)
   }
   if (config.disable_avx512) {
     ASSERT_FALSE(EverCrypt_AutoConfig2_has_avx512());
+    ASSERT_FALSE(EverCrypt_AutoConfig2_has_avx512ifma());
   }
   if (config.disable_bmi2) {
     ASSERT_FALSE(EverCrypt_AutoConfig2_has_bmi2());
@@ -63,3 +71,249 @@ INSTANTIATE_TEST_SUITE_P(
   EverCryptSuiteDummy,
   ::testing::Combine(::testing::ValuesIn(exhaustive_evercrypt_config_list()),
                      ::testing::ValuesIn({ string("") })));
+
+// ----- Instrumentation -------------------------------------------------------
+
+typedef vector<EverCrypt_Instrumentation_counters> counters;
+
+static counters
+snapshot()
+{
+  counters c(EVERCRYPT_INSTRUMENTATION_IMPLS);
+  EverCrypt_Instrumentation_snapshot(c.data());
+  return c;
+}
+
+// Calls and bytes counted between two snapshots for a set of implementations.
+static EverCrypt_Instrumentation_counters
+delta(const counters& before,
+      const counters& after,
+      vector<EverCrypt_Instrumentation_impl> impls)
+{
+  EverCrypt_Instrumentation_counters d = { 0, 0 };
+  for (auto i : impls) {
+    d.calls += after[i].calls - before[i].calls;
+    d.bytes += after[i].bytes - before[i].bytes;
+  }
+  return d;
+}
+
+static const vector<EverCrypt_Instrumentation_impl> chacha20poly1305_impls = {
+  EverCrypt_Instrumentation_Chacha20Poly1305_32,
+  EverCrypt_Instrumentation_Chacha20Poly1305_128,
+  EverCrypt_Instrumentation_Chacha20Poly1305_256
+};
+
+static const vector<EverCrypt_Instrumentation_impl> sha2_256_impls = {
+  EverCrypt_Instrumentation_SHA2_256,
+  EverCrypt_Instrumentation_SHA2_256_Vale
+};
+
+TEST(Instrumentation, ImplNames)
+{
+  for (uint8_t i = 0; i < EVERCRYPT_INSTRUMENTATION_IMPLS; i++) {
+    EXPECT_NE(EverCrypt_Instrumentation_impl_name(i), nullptr);
+  }
+  EXPECT_STREQ(
+    EverCrypt_Instrumentation_impl_name(EverCrypt_Instrumentation_SHA2_256_Vale),
+    "SHA2_256_Vale");
+  EXPECT_EQ(EverCrypt_Instrumentation_impl_name(EVERCRYPT_INSTRUMENTATION_IMPLS),
+            nullptr);
+}
+
+TEST(Instrumentation, CountsCallsAndBytes)
+{
+  EverCrypt_AutoConfig2_init();
+  vector<uint8_t> key(32), nonce(12), msg(100), cipher(100), tag(16),
+    digest(32);
+  counters before = snapshot();
+
+  EverCrypt_Chacha20Poly1305_aead_encrypt(key.data(),
+                                          nonce.data(),
+                                          0,
+                                          NULL,
+                                          (uint32_t)msg.size(),
+                                          msg.data(),
+                                          cipher.data(),
+                                          tag.data());
+  EverCrypt_Hash_Incremental_hash(
+    Spec_Hash_Definitions_SHA2_256, digest.data(), msg.data(), 64);
+  EverCrypt_Hash_Incremental_hash_state* s =
+    EverCrypt_Hash_Incremental_create_in(Spec_Hash_Definitions_SHA2_256);
+  EverCrypt_Hash_Incremental_update(s, msg.data(), 10);
+  EverCrypt_Hash_Incremental_update(s, msg.data(), 20);
+  EverCrypt_Hash_Incremental_free(s);
+
+  counters after = snapshot();
+  if (!EverCrypt_Instrumentation_enabled()) {
+    for (auto& c : after) {
+      EXPECT_EQ(c.calls, 0U);
+      EXPECT_EQ(c.bytes, 0U);
+    }
+    return;
+  }
+
+  EverCrypt_Instrumentation_counters c =
+    delta(before, after, chacha20poly1305_impls);
+  EXPECT_EQ(c.calls, 1U);
+  EXPECT_EQ(c.bytes, 100U);
+  c = delta(before, after, sha2_256_impls);
+  EXPECT_EQ(c.calls, 3U);
+  EXPECT_EQ(c.bytes, 94U);
+
+  // The counters record the implementation that was actually picked.
+  EverCrypt_AutoConfig2_disable_avx2();
+  EverCrypt_AutoConfig2_disable_avx();
+  before = snapshot();
+  EverCrypt_Chacha20Poly1305_aead_encrypt(key.data(),
+                                          nonce.data(),
+                                          0,
+                                          NULL,
+                                          (uint32_t)msg.size(),
+                                          msg.data(),
+                                          cipher.data(),
+                                          tag.data());
+  after = snapshot();
+  EverCrypt_AutoConfig2_init();
+  c = delta(before, after, { EverCrypt_Instrumentation_Chacha20Poly1305_32 });
+  EXPECT_EQ(c.calls, 1U);
+}
+
+typedef struct
+{
+  int enter;
+  int exit;
+  uint32_t len;
+  EverCrypt_Instrumentation_impl impl;
+} hook_log;
+
+static void
+log_hook(void* ctx,
+         EverCrypt_Instrumentation_event ev,
+         EverCrypt_Instrumentation_impl impl,
+         uint32_t len)
+{
+  hook_log* log = (hook_log*)ctx;
+  if (ev == EverCrypt_Instrumentation_Enter) {
+    log->enter++;
+  } else {
+    log->exit++;
+  }
+  log->impl = impl;
+  log->len = len;
+}
+
+TEST(Instrumentation, Hooks)
+{
+  EverCrypt_AutoConfig2_init();
+  hook_log log = { 0, 0, 0, 0 };
+  vector<uint8_t> msg(48), digest(64);
+  EverCrypt_Instrumentation_set_hook(log_hook, &log);
+  EverCrypt_Hash_Incremental_hash(
+    Spec_Hash_Definitions_SHA3_256, digest.data(), msg.data(), 48);
+  EverCrypt_Instrumentation_set_hook(NULL, NULL);
+  EverCrypt_Hash_Incremental_hash(
+    Spec_Hash_Definitions_SHA3_256, digest.data(), msg.data(), 48);
+
+  if (!EverCrypt_Instrumentation_enabled()) {
+    EXPECT_EQ(log.enter, 0);
+    EXPECT_EQ(log.exit, 0);
+    return;
+  }
+  EXPECT_EQ(log.enter, 1);
+  EXPECT_EQ(log.exit, 1);
+  EXPECT_EQ(log.impl, EverCrypt_Instrumentation_SHA3_256);
+  EXPECT_EQ(log.len, 48U);
+}
+
+// A hook is never called with the context of another hook, even while hooks
+// are being replaced and removed.
+static atomic<int> hook_mismatches(0);
+
+static void
+hook_a(void* ctx,
+       EverCrypt_Instrumentation_event ev,
+       EverCrypt_Instrumentation_impl impl,
+       uint32_t len)
+{
+  if (ctx == NULL || *(char*)ctx != 'a') {
+    hook_mismatches++;
+  }
+}
+
+static void
+hook_b(void* ctx,
+       EverCrypt_Instrumentation_event ev,
+       EverCrypt_Instrumentation_impl impl,
+       uint32_t len)
+{
+  if (ctx == NULL || *(char*)ctx != 'b') {
+    hook_mismatches++;
+  }
+}
+
+TEST(Instrumentation, SwapHooks)
+{
+  EverCrypt_AutoConfig2_init();
+  static char a = 'a', b = 'b';
+  atomic<bool> done(false);
+  atomic<int> calls(0);
+  vector<thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&done, &calls]() {
+      vector<uint8_t> msg(16), digest(32);
+      while (!done) {
+        EverCrypt_Hash_Incremental_hash(
+          Spec_Hash_Definitions_SHA2_256, digest.data(), msg.data(), 16);
+        calls++;
+      }
+    });
+  }
+  for (int i = 0; calls < 200000; i++) {
+    switch (i % 3) {
+      case 0:
+        EverCrypt_Instrumentation_set_hook(hook_a, &a);
+        break;
+      case 1:
+        EverCrypt_Instrumentation_set_hook(hook_b, &b);
+        break;
+      default:
+        EverCrypt_Instrumentation_set_hook(NULL, NULL);
+        break;
+    }
+  }
+  done = true;
+  for (auto& t : threads) {
+    t.join();
+  }
+  EverCrypt_Instrumentation_set_hook(NULL, NULL);
+  EXPECT_EQ(hook_mismatches, 0);
+}
+
+// Counts of exited threads are kept.
+TEST(Instrumentation, ThreadExit)
+{
+  EverCrypt_AutoConfig2_init();
+  counters before = snapshot();
+  vector<thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([]() {
+      vector<uint8_t> msg(16), digest(32);
+      for (int i = 0; i < 10; i++) {
+        EverCrypt_Hash_Incremental_hash(
+          Spec_Hash_Definitions_SHA2_256, digest.data(), msg.data(), 16);
+      }
+    });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  counters after = snapshot();
+  EverCrypt_Instrumentation_counters c = delta(before, after, sha2_256_impls);
+  if (!EverCrypt_Instrumentation_enabled()) {
+    EXPECT_EQ(c.calls, 0U);
+    return;
+  }
+  EXPECT_EQ(c.calls, 40U);
+  EXPECT_EQ(c.bytes, 640U);
+}
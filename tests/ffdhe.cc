@@ -0,0 +1,145 @@
+/*
+ *    Copyright 2022 Cryspen Sarl
+ *
+ *    Licensed under the Apache License, Version 2.0 or MIT.
+ *    - http://www.apache.org/licenses/LICENSE-2.0
+ *    - http://opensource.org/licenses/MIT
+ */
+
+#include <gtest/gtest.h>
+
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_FFDHE.h"
+#include "Hacl_Bignum64.h"
+#include "Hacl_FFDHE.h"
+#include "internal/Hacl_FFDHE.h"
+
+#include "util.h"
+
+using namespace std;
+
+typedef struct
+{
+  string name;
+  Spec_FFDHE_ffdhe_alg alg;
+} FfdheGroup;
+
+static vector<FfdheGroup> groups = {
+  { "ffdhe2048", Spec_FFDHE_FFDHE2048 }, { "ffdhe3072", Spec_FFDHE_FFDHE3072 },
+  { "ffdhe4096", Spec_FFDHE_FFDHE4096 }, { "ffdhe6144", Spec_FFDHE_FFDHE6144 },
+  { "ffdhe8192", Spec_FFDHE_FFDHE8192 },
+};
+
+class FfdheSuite : public ::testing::TestWithParam<FfdheGroup>
+{};
+
+// 2^sk mod p computed with the generic (variable-time) bignum exponentiation.
+static bytes
+reference_public(Spec_FFDHE_ffdhe_alg a, const bytes& sk)
+{
+  uint32_t len = Hacl_FFDHE_ffdhe_len(a);
+  uint32_t nLen = len / 8;
+  uint64_t* p_r2_n = Hacl_FFDHE_new_ffdhe_precomp_p(a);
+  vector<uint64_t> g(nLen, 0), b(nLen), res(nLen);
+  g[0] = 2;
+  for (uint32_t i = 0; i < nLen; i++) {
+    uint64_t l = 0;
+    for (uint32_t j = 0; j < 8; j++) {
+      l = l << 8 | sk[len - 8 * i - 8 + j];
+    }
+    b[i] = l;
+  }
+  Hacl_Bignum64_mod_exp_vartime(
+    nLen, p_r2_n, g.data(), 64 * nLen, b.data(), res.data());
+  free(p_r2_n);
+  bytes pk(len);
+  for (uint32_t i = 0; i < nLen; i++) {
+    for (uint32_t j = 0; j < 8; j++) {
+      pk[len - 8 * i - 1 - j] = (uint8_t)(res[i] >> 8 * j);
+    }
+  }
+  return pk;
+}
+
+// Key generation goes through the fixed-base comb; it must agree with a
+// generic exponentiation, including for the all-zero and all-one exponents
+// that select the extreme table entries.
+TEST_P(FfdheSuite, CombMatchesGenericExp)
+{
+  Spec_FFDHE_ffdhe_alg a = GetParam().alg;
+  uint32_t len = Hacl_FFDHE_ffdhe_len(a);
+  uint64_t* p_r2_n = Hacl_FFDHE_new_ffdhe_precomp_p(a);
+
+  vector<bytes> sks = { bytes(len, 0), bytes(len, 0xff), bytes(len) };
+  sks[0][len - 1] = 1;
+  generate_random(sks[2].data(), len);
+  for (const bytes& sk : sks) {
+    bytes expected = reference_public(a, sk);
+    bytes pk(len), pk_precomp(len);
+    Hacl_FFDHE_ffdhe_secret_to_public(a, (uint8_t*)sk.data(), pk.data());
+    Hacl_FFDHE_ffdhe_secret_to_public_precomp(
+      a, p_r2_n, (uint8_t*)sk.data(), pk_precomp.data());
+    EXPECT_EQ(pk, expected);
+    EXPECT_EQ(pk_precomp, expected);
+  }
+  free(p_r2_n);
+}
+
+TEST_P(FfdheSuite, SharedSecret)
+{
+  Spec_FFDHE_ffdhe_alg a = GetParam().alg;
+  uint32_t len = Hacl_FFDHE_ffdhe_len(a);
+  bytes sk1(len), sk2(len), pk1(len), pk2(len), ss1(len), ss2(len);
+  generate_random(sk1.data(), len);
+  generate_random(sk2.data(), len);
+  // Secret keys are smaller than p.
+  sk1[0] = 0;
+  sk2[0] = 0;
+  Hacl_FFDHE_ffdhe_secret_to_public(a, sk1.data(), pk1.data());
+  Hacl_FFDHE_ffdhe_secret_to_public(a, sk2.data(), pk2.data());
+  // A valid public key is reported with an all-ones mask.
+  ASSERT_EQ(Hacl_FFDHE_ffdhe_shared_secret(a, sk1.data(), pk2.data(), ss1.data()),
+            UINT64_MAX);
+  ASSERT_EQ(Hacl_FFDHE_ffdhe_shared_secret(a, sk2.data(), pk1.data(), ss2.data()),
+            UINT64_MAX);
+  EXPECT_EQ(ss1, ss2);
+
+  // Public keys out of [2, p - 2] are rejected.
+  bytes one(len, 0);
+  one[len - 1] = 1;
+  EXPECT_EQ(Hacl_FFDHE_ffdhe_shared_secret(a, sk1.data(), one.data(), ss1.data()),
+            0);
+}
+
+// The radix 2^52 comb table used on AVX-512 IFMA must give the same public
+// keys as the portable one, and EverCrypt must agree with both.
+TEST_P(FfdheSuite, IfmaMatchesPortable)
+{
+  EverCrypt_AutoConfig2_init();
+  if (!EverCrypt_AutoConfig2_has_avx512ifma()) {
+    GTEST_SKIP() << "AVX-512 IFMA is not available on this CPU";
+  }
+
+  Spec_FFDHE_ffdhe_alg a = GetParam().alg;
+  uint32_t len = Hacl_FFDHE_ffdhe_len(a);
+  vector<bytes> sks = { bytes(len, 0), bytes(len, 0xff), bytes(len), bytes(len) };
+  sks[0][len - 1] = 1;
+  generate_random(sks[2].data(), len);
+  generate_random(sks[3].data(), len);
+  for (bytes& sk : sks) {
+    bytes pk_portable(len), pk_ifma(len), pk_evercrypt(len);
+    Hacl_FFDHE_ffdhe_secret_to_public_impl(a, false, sk.data(), pk_portable.data());
+    Hacl_FFDHE_ffdhe_secret_to_public_impl(a, true, sk.data(), pk_ifma.data());
+    EverCrypt_FFDHE_secret_to_public(a, sk.data(), pk_evercrypt.data());
+    EXPECT_EQ(pk_ifma, pk_portable);
+    EXPECT_EQ(pk_evercrypt, pk_portable);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  Groups,
+  FfdheSuite,
+  ::testing::ValuesIn(groups),
+  [](const ::testing::TestParamInfo<FfdheGroup>& info) {
+    return info.param.name;
+  });
@@ -0,0 +1,344 @@
+/*
+ *    Copyright 2022 Cryspen Sarl
+ *
+ *    Licensed under the Apache License, Version 2.0 or MIT.
+ *    - http://www.apache.org/licenses/LICENSE-2.0
+ *    - http://opensource.org/licenses/MIT
+ */
+
+#include <fstream>
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Frodo.h"
+#include "Hacl_Frodo1344.h"
+#include "Hacl_Frodo1344_AES.h"
+#include "Hacl_Frodo640.h"
+#include "Hacl_Frodo640_AES.h"
+#include "Hacl_Frodo976.h"
+#include "Hacl_Frodo976_AES.h"
+#include "Hacl_Hash_SHA3.h"
+#include "krml/internal/target.h"
+
+#include "internal/Hacl_AES128.h"
+#include "internal/Hacl_Frodo1344_AES.h"
+#include "internal/Hacl_Frodo640_AES.h"
+#include "internal/Hacl_Frodo976_AES.h"
+#include "internal/Hacl_Frodo_KEM.h"
+
+#include "util.h"
+
+using namespace std;
+
+using json = nlohmann::json;
+
+typedef struct
+{
+  string name;
+  EverCrypt_Frodo_alg alg;
+  uint32_t (*keypair)(uint8_t*, uint8_t*);
+  uint32_t (*enc)(uint8_t*, uint8_t*, uint8_t*);
+  uint32_t (*dec)(uint8_t*, uint8_t*, uint8_t*);
+  uint32_t* pk_len;
+  uint32_t* sk_len;
+  uint32_t* ct_len;
+  uint32_t* ss_len;
+} FrodoKem;
+
+#define FRODO_KEM(V)                                                           \
+  EverCrypt_Frodo_##V, Hacl_##V##_crypto_kem_keypair,                          \
+    Hacl_##V##_crypto_kem_enc, Hacl_##V##_crypto_kem_dec,                      \
+    &Hacl_##V##_crypto_publickeybytes, &Hacl_##V##_crypto_secretkeybytes,      \
+    &Hacl_##V##_crypto_ciphertextbytes, &Hacl_##V##_crypto_bytes
+
+static vector<FrodoKem> kems = {
+  { "Frodo640", FRODO_KEM(Frodo640) },
+  { "Frodo976", FRODO_KEM(Frodo976) },
+  { "Frodo1344", FRODO_KEM(Frodo1344) },
+  { "Frodo640_AES", FRODO_KEM(Frodo640_AES) },
+  { "Frodo976_AES", FRODO_KEM(Frodo976_AES) },
+  { "Frodo1344_AES", FRODO_KEM(Frodo1344_AES) },
+};
+
+// The AES-128 implementations to test: the portable code, and AES-NI if the
+// CPU has it.
+static vector<bool>
+aes_impls()
+{
+  EverCrypt_AutoConfig2_init();
+  vector<bool> impls = { false };
+  if (EverCrypt_AutoConfig2_has_aesni() && EverCrypt_AutoConfig2_has_sse()) {
+    impls.push_back(true);
+  }
+  return impls;
+}
+
+// FIPS 197, Appendix C.1.
+TEST(Aes128, Fips197)
+{
+  bytes key = from_hex("000102030405060708090a0b0c0d0e0f");
+  bytes pt = from_hex("00112233445566778899aabbccddeeff");
+  bytes expected = from_hex("69c4e0d86a7b0430d8cdb78070b4c55a");
+
+  for (bool aesni : aes_impls()) {
+    bytes ek(176);
+    Hacl_AES128_aes128_key_expansion(aesni, key.data(), ek.data());
+
+    // Eleven blocks exercise both the 8-way and the single-block AES-NI loops.
+    bytes in(11 * 16), out(11 * 16);
+    for (size_t i = 0; i < 11; i++) {
+      copy(pt.begin(), pt.end(), in.begin() + 16 * i);
+    }
+    Hacl_AES128_aes128_encrypt_blocks(
+      aesni, 11, out.data(), in.data(), ek.data());
+    for (size_t i = 0; i < 11; i++) {
+      EXPECT_EQ(bytes(out.begin() + 16 * i, out.begin() + 16 * (i + 1)),
+                expected)
+        << "aesni " << aesni << " block " << i;
+    }
+
+    uint16_t plain[8], cipher[8];
+    for (size_t i = 0; i < 8; i++) {
+      plain[i] = (uint16_t)(pt[2 * i] | pt[2 * i + 1] << 8);
+    }
+    Hacl_AES128_aes128_encrypt_block(aesni, cipher, plain, ek.data());
+    for (size_t i = 0; i < 8; i++) {
+      EXPECT_EQ(cipher[i], (uint16_t)(expected[2 * i] | expected[2 * i + 1] << 8));
+    }
+  }
+}
+
+// Whether the CPU can run a kernel of the streaming matrix products.
+static bool
+has_matrix(Hacl_Impl_Frodo_Params_matrix matrix)
+{
+  EverCrypt_AutoConfig2_init();
+  switch (matrix) {
+    case Hacl_Impl_Frodo_Params_Vec256:
+      return EverCrypt_AutoConfig2_has_vec256();
+    case Hacl_Impl_Frodo_Params_Vec128:
+      return EverCrypt_AutoConfig2_has_vec128();
+    default:
+      return true;
+  }
+}
+
+class FrodoMatrix
+  : public ::testing::TestWithParam<std::tuple<uint32_t,
+                                               Spec_Frodo_Params_frodo_gen_a,
+                                               Hacl_Impl_Frodo_Params_matrix>>
+{};
+
+// The streaming products must agree with the full-matrix reference, which
+// generates A with the portable AES code.
+TEST_P(FrodoMatrix, StreamingMatchesFullMatrix)
+{
+  uint32_t n = std::get<0>(GetParam());
+  Spec_Frodo_Params_frodo_gen_a gen = std::get<1>(GetParam());
+  Hacl_Impl_Frodo_Params_impl impl = Hacl_Impl_Frodo_Params_portable;
+  impl.matrix = std::get<2>(GetParam());
+  impl.aesni = aes_impls().back();
+  if (!has_matrix(impl.matrix)) {
+    GTEST_SKIP() << "matrix kernel not supported on this CPU";
+  }
+
+  bytes seed(16);
+  generate_random(seed.data(), seed.size());
+  vector<uint16_t> s(8 * n), e(8 * n), expected(8 * n), got(8 * n);
+  generate_random((uint8_t*)s.data(), 16 * n);
+  generate_random((uint8_t*)e.data(), 16 * n);
+  vector<uint16_t> a(n * n);
+  Hacl_Impl_Frodo_Params_frodo_gen_matrix(
+    Hacl_Impl_Frodo_Params_portable, gen, n, seed.data(), a.data());
+
+  Hacl_Impl_Matrix_matrix_mul_s(n, n, 8, a.data(), s.data(), expected.data());
+  Hacl_Impl_Matrix_matrix_add(n, 8, expected.data(), e.data());
+  Hacl_Impl_Frodo_Params_frodo_mul_add_as_plus_e(
+    impl, gen, n, seed.data(), s.data(), e.data(), got.data());
+  EXPECT_EQ(got, expected);
+
+  Hacl_Impl_Matrix_matrix_mul(8, n, n, s.data(), a.data(), expected.data());
+  Hacl_Impl_Matrix_matrix_add(8, n, expected.data(), e.data());
+  Hacl_Impl_Frodo_Params_frodo_mul_add_sa_plus_e(
+    impl, gen, n, seed.data(), s.data(), e.data(), got.data());
+  EXPECT_EQ(got, expected);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  Streaming,
+  FrodoMatrix,
+  ::testing::Combine(::testing::Values(64, 640, 976, 1344),
+                     ::testing::Values(Spec_Frodo_Params_SHAKE128,
+                                       Spec_Frodo_Params_AES128),
+                     ::testing::Values(Hacl_Impl_Frodo_Params_Portable,
+                                       Hacl_Impl_Frodo_Params_Vec128,
+                                       Hacl_Impl_Frodo_Params_Vec256)));
+
+class FrodoKemSuite : public ::testing::TestWithParam<FrodoKem>
+{};
+
+TEST_P(FrodoKemSuite, RoundTrip)
+{
+  const FrodoKem& k = GetParam();
+  EverCrypt_AutoConfig2_init();
+  bytes pk(*k.pk_len), sk(*k.sk_len), ct(*k.ct_len), ss1(*k.ss_len),
+    ss2(*k.ss_len);
+  ASSERT_EQ(k.keypair(pk.data(), sk.data()), 0);
+  ASSERT_EQ(k.enc(ct.data(), ss1.data(), pk.data()), 0);
+  ASSERT_EQ(k.dec(ss2.data(), ct.data(), sk.data()), 0);
+  EXPECT_EQ(ss1, ss2);
+
+  // EverCrypt uses the CPU features the portable Hacl code does without, and
+  // must derive the same matrix.
+  ASSERT_EQ(EverCrypt_Frodo_crypto_kem_dec(k.alg, ss2.data(), ct.data(), sk.data()),
+            0);
+  EXPECT_EQ(ss1, ss2);
+  ASSERT_EQ(EverCrypt_Frodo_crypto_kem_keypair(k.alg, pk.data(), sk.data()), 0);
+  ASSERT_EQ(EverCrypt_Frodo_crypto_kem_enc(k.alg, ct.data(), ss1.data(), pk.data()),
+            0);
+  ASSERT_EQ(k.dec(ss2.data(), ct.data(), sk.data()), 0);
+  EXPECT_EQ(ss1, ss2);
+
+  // A modified ciphertext yields an unrelated (implicitly rejected) secret.
+  ct[0] ^= 1;
+  ASSERT_EQ(k.dec(ss2.data(), ct.data(), sk.data()), 0);
+  EXPECT_NE(ss1, ss2);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  Kems,
+  FrodoKemSuite,
+  ::testing::ValuesIn(kems),
+  [](const ::testing::TestParamInfo<FrodoKem>& info) {
+    return info.param.name;
+  });
+
+typedef struct
+{
+  FrodoKem kem;
+  uint32_t (*keypair_derand)(Hacl_Impl_Frodo_Params_impl,
+                             uint8_t*,
+                             uint8_t*,
+                             uint8_t*);
+  uint32_t (*enc_derand)(Hacl_Impl_Frodo_Params_impl,
+                         uint8_t*,
+                         uint8_t*,
+                         uint8_t*,
+                         uint8_t*);
+  uint32_t (*dec)(Hacl_Impl_Frodo_Params_impl, uint8_t*, uint8_t*, uint8_t*);
+  size_t count;
+  bytes keypair_coins;
+  bytes enc_coins;
+  bytes pk_hash;
+  bytes sk_hash;
+  bytes ct_hash;
+  bytes ss;
+} FrodoKat;
+
+std::ostream&
+operator<<(std::ostream& os, const FrodoKat& test)
+{
+  os << "{" << endl
+     << "kem: " << test.kem.name << endl
+     << "count: " << test.count << endl
+     << "}" << endl;
+  return os;
+}
+
+class FrodoKatSuite : public ::testing::TestWithParam<FrodoKat>
+{};
+
+static bytes
+sha3_256(const bytes& in)
+{
+  bytes digest(32);
+  Hacl_SHA3_sha3_256((uint32_t)in.size(), (uint8_t*)in.data(), digest.data());
+  return digest;
+}
+
+// Known-answer tests for counts 0-4 of the NIST PQC KAT generator. These are
+// self-generated, not the published PQCkemKAT values: the coins are the
+// outputs of the KAT generator's DRBG for each count (keypair draws
+// s || seedSE || z, then enc draws mu), and the expected outputs were computed
+// with a separate model of the FrodoKEM specification. Public keys, secret
+// keys and ciphertexts are compared by their SHA3-256 digests to keep the
+// vector file small.
+TEST_P(FrodoKatSuite, KAT)
+{
+  const FrodoKat& test = GetParam();
+  const FrodoKem& k = test.kem;
+  bytes keypair_coins = test.keypair_coins, enc_coins = test.enc_coins;
+
+  for (bool aesni : aes_impls()) {
+    Hacl_Impl_Frodo_Params_impl impl = Hacl_Impl_Frodo_Params_portable;
+    impl.aesni = aesni;
+    bytes pk(*k.pk_len), sk(*k.sk_len), ct(*k.ct_len), ss1(*k.ss_len),
+      ss2(*k.ss_len);
+    ASSERT_EQ(
+      test.keypair_derand(impl, keypair_coins.data(), pk.data(), sk.data()), 0);
+    EXPECT_EQ(sha3_256(pk), test.pk_hash);
+    EXPECT_EQ(sha3_256(sk), test.sk_hash);
+
+    ASSERT_EQ(
+      test.enc_derand(impl, enc_coins.data(), ct.data(), ss1.data(), pk.data()),
+      0);
+    EXPECT_EQ(sha3_256(ct), test.ct_hash);
+    EXPECT_EQ(ss1, test.ss);
+
+    ASSERT_EQ(test.dec(impl, ss2.data(), ct.data(), sk.data()), 0);
+    EXPECT_EQ(ss2, test.ss);
+  }
+}
+
+vector<FrodoKat>
+read_json_kat(string path)
+{
+  json tests_raw;
+  std::ifstream file(path);
+  file >> tests_raw;
+
+  vector<FrodoKat> tests_out;
+  for (auto& test : tests_raw.items()) {
+    auto test_case = test.value();
+    string name = test_case["kem"];
+
+    FrodoKat kat;
+    if (name == "Frodo640_AES") {
+      kat.kem = kems[3];
+      kat.keypair_derand = Hacl_Frodo640_AES_crypto_kem_keypair_derand_impl;
+      kat.enc_derand = Hacl_Frodo640_AES_crypto_kem_enc_derand_impl;
+      kat.dec = Hacl_Frodo640_AES_crypto_kem_dec_impl;
+    } else if (name == "Frodo976_AES") {
+      kat.kem = kems[4];
+      kat.keypair_derand = Hacl_Frodo976_AES_crypto_kem_keypair_derand_impl;
+      kat.enc_derand = Hacl_Frodo976_AES_crypto_kem_enc_derand_impl;
+      kat.dec = Hacl_Frodo976_AES_crypto_kem_dec_impl;
+    } else if (name == "Frodo1344_AES") {
+      kat.kem = kems[5];
+      kat.keypair_derand = Hacl_Frodo1344_AES_crypto_kem_keypair_derand_impl;
+      kat.enc_derand = Hacl_Frodo1344_AES_crypto_kem_enc_derand_impl;
+      kat.dec = Hacl_Frodo1344_AES_crypto_kem_dec_impl;
+    } else {
+      continue;
+    }
+    kat.count = test_case["count"];
+    kat.keypair_coins = from_hex(test_case["keypair_coins"]);
+    kat.enc_coins = from_hex(test_case["enc_coins"]);
+    kat.pk_hash = from_hex(test_case["pk_sha3_256"]);
+    kat.sk_hash = from_hex(test_case["sk_sha3_256"]);
+    kat.ct_hash = from_hex(test_case["ct_sha3_256"]);
+    kat.ss = from_hex(test_case["ss"]);
+    tests_out.push_back(kat);
+  }
+
+  return tests_out;
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  SelfGenerated,
+  FrodoKatSuite,
+  ::testing::ValuesIn(read_json_kat("frodo_aes_kat.json")),
+  [](const ::testing::TestParamInfo<FrodoKat>& info) {
+    return info.param.kem.name + "_" + std::to_string(info.param.count);
+  });
@@ -179,6 +179,33 @@ TEST_P(GenericFieldSuite, Toy32)
     free(expected);
   }
 
+  // multi exp (a single base) and comb exp
+  if (test.bBits > 0) {
+    uint32_t* expected = new_bn_32(test.exp);
+
+    ASSERT_TRUE(Hacl_GenericField32_multi_exp_vartime(ctx, 1, aM, test.bBits, b, rM));
+    Hacl_GenericField32_from_field(ctx, rM, r);
+    ASSERT_EQ(memcmp(r, expected, test.limbs32 * 4), 0);
+
+    ASSERT_TRUE(Hacl_GenericField32_multi_exp_consttime(ctx, 1, aM, test.bBits, b, rM));
+    Hacl_GenericField32_from_field(ctx, rM, r);
+    ASSERT_EQ(memcmp(r, expected, test.limbs32 * 4), 0);
+
+    Hacl_Bignum_MontArithmetic_bn_comb_table_u32* t =
+      Hacl_GenericField32_comb_table_init(ctx, aM, test.bBits);
+    ASSERT_NE(t, nullptr);
+    ASSERT_TRUE(Hacl_GenericField32_comb_exp_vartime(ctx, t, b, rM));
+    Hacl_GenericField32_from_field(ctx, rM, r);
+    ASSERT_EQ(memcmp(r, expected, test.limbs32 * 4), 0);
+
+    ASSERT_TRUE(Hacl_GenericField32_comb_exp_consttime(ctx, t, b, rM));
+    Hacl_GenericField32_from_field(ctx, rM, r);
+    ASSERT_EQ(memcmp(r, expected, test.limbs32 * 4), 0);
+    Hacl_GenericField32_comb_table_free(t);
+
+    free(expected);
+  }
+
   // inverse
   {
     Hacl_GenericField32_inverse(ctx, aM, rM);
@@ -322,6 +349,33 @@ TEST_P(GenericFieldSuite, Toy64)
       free(expected);
     }
 
+    // multi exp (a single base) and comb exp
+    if (test.bBits > 0) {
+      uint64_t* expected = new_bn_64(test.exp);
+
+      ASSERT_TRUE(Hacl_GenericField64_multi_exp_vartime(ctx, 1, aM, test.bBits, b, rM));
+      Hacl_GenericField64_from_field(ctx, rM, r);
+      ASSERT_EQ(memcmp(r, expected, test.limbs64 * 8), 0);
+
+      ASSERT_TRUE(Hacl_GenericField64_multi_exp_consttime(ctx, 1, aM, test.bBits, b, rM));
+      Hacl_GenericField64_from_field(ctx, rM, r);
+      ASSERT_EQ(memcmp(r, expected, test.limbs64 * 8), 0);
+
+      Hacl_Bignum_MontArithmetic_bn_comb_table_u64* t =
+        Hacl_GenericField64_comb_table_init(ctx, aM, test.bBits);
+      ASSERT_NE(t, nullptr);
+      ASSERT_TRUE(Hacl_GenericField64_comb_exp_vartime(ctx, t, b, rM));
+      Hacl_GenericField64_from_field(ctx, rM, r);
+      ASSERT_EQ(memcmp(r, expected, test.limbs64 * 8), 0);
+
+      ASSERT_TRUE(Hacl_GenericField64_comb_exp_consttime(ctx, t, b, rM));
+      Hacl_GenericField64_from_field(ctx, rM, r);
+      ASSERT_EQ(memcmp(r, expected, test.limbs64 * 8), 0);
+      Hacl_GenericField64_comb_table_free(t);
+
+      free(expected);
+    }
+
     // inverse
     {
       Hacl_GenericField64_inverse(ctx, aM, rM);
@@ -0,0 +1,966 @@
+/*
+ *    Copyright 2022 Cryspen Sarl
+ *
+ *    Licensed under the Apache License, Version 2.0 or MIT.
+ *    - http://www.apache.org/licenses/LICENSE-2.0
+ *    - http://opensource.org/licenses/MIT
+ */
+
+#include <array>
+#include <gtest/gtest.h>
+
+#include "Hacl_HPKE_Curve51_CP32_SHA256.h"
+#include "Hacl_HPKE_Curve51_CP32_SHA512.h"
+#include "Hacl_HPKE_P256_CP32_SHA256.h"
+#include "Hacl_P256.h"
+#include "config.h"
+#include "hacl-cpu-features.h"
+
+#ifdef HACL_CAN_COMPILE_VEC256
+#include "Hacl_HPKE_Curve64_CP256_SHA256.h"
+#endif
+
+#include "util.h"
+
+using namespace std;
+
+// RFC 9180, Appendix A.2.1:
+// DHKEM(X25519, HKDF-SHA256), HKDF-SHA256, ChaCha20Poly1305, Base mode.
+static bytes info = from_hex("4f6465206f6e2061204772656369616e2055726e");
+static bytes skEm = from_hex(
+  "f4ec9b33b792c372c1d2c2063507b684ef925b8c75a42dbcbf57d63ccd381600");
+static bytes pkRm = from_hex(
+  "4310ee97d88cc1f088a5576c77ab0cf5c3ac797f3d95139c6c84b5429c59662a");
+static bytes skRm = from_hex(
+  "8057991eef8f1f1af18f4a9491d16a1ce333f695d4db8e38da75975c4478e0fb");
+static bytes expected_enc = from_hex(
+  "1afa08d3dec047a643885163f1180476fa7ddb54c6a8029ea33f95796bf2ac4a");
+static bytes pt =
+  from_hex("4265617574792069732074727574682c20747275746820626561757479");
+static vector<bytes> expected_cts = {
+  from_hex("1c5250d8034ec2b784ba2cfd69dbdb8af406cfe3ff938e131f0def8c8b60b4db"
+           "21993c62ce81883d2dd1b51a28"),
+  from_hex("6b53c051e4199c518de79594e1c4ab18b96f081549d45ce015be002090bb119e"
+           "85285337cc95ba5f59992dc98c"),
+};
+static vector<pair<bytes, bytes>> expected_exports = {
+  { from_hex(""),
+    from_hex(
+      "4bbd6243b8bb54cec311fac9df81841b6fd61f56538a775e7c80a9f40160606e") },
+  { from_hex("00"),
+    from_hex(
+      "8c1df14732580e5501b00f82b10a1647b40713191b7c1240ac80e2b68808ba69") },
+  { from_hex("54657374436f6e74657874"),
+    from_hex(
+      "5acb09211139c43b3090489a9da433e8a30ee7188ba8b0a9a1ccf0c229283e53") },
+};
+
+static bytes
+aad_for(size_t seq)
+{
+  string aad = "Count-" + to_string(seq);
+  return bytes(aad.begin(), aad.end());
+}
+
+TEST(HpkeContext, Rfc9180Vectors)
+{
+  Hacl_Impl_HPKE_context_s sender =
+    Hacl_HPKE_Curve51_CP32_SHA256_context_malloc();
+  Hacl_Impl_HPKE_context_s receiver =
+    Hacl_HPKE_Curve51_CP32_SHA256_context_malloc();
+
+  bytes enc(32);
+  ASSERT_EQ(Hacl_HPKE_Curve51_CP32_SHA256_setupBaseS(enc.data(),
+                                                     sender,
+                                                     skEm.data(),
+                                                     pkRm.data(),
+                                                     info.size(),
+                                                     info.data()),
+            0);
+  EXPECT_EQ(enc, expected_enc);
+  ASSERT_EQ(Hacl_HPKE_Curve51_CP32_SHA256_setupBaseR(
+              receiver, enc.data(), skRm.data(), info.size(), info.data()),
+            0);
+
+  for (size_t seq = 0; seq < expected_cts.size(); seq++) {
+    bytes aad = aad_for(seq);
+    bytes ct(pt.size() + 16);
+    EXPECT_EQ(Hacl_HPKE_Curve51_CP32_SHA256_seal(
+                sender, aad.size(), aad.data(), pt.size(), pt.data(), ct.data()),
+              0);
+    EXPECT_EQ(ct, expected_cts[seq]);
+
+    bytes got(pt.size());
+    EXPECT_EQ(Hacl_HPKE_Curve51_CP32_SHA256_open(
+                receiver, aad.size(), aad.data(), ct.size(), ct.data(), got.data()),
+              0);
+    EXPECT_EQ(got, pt);
+  }
+
+  for (auto& [exporter_context, expected] : expected_exports) {
+    bytes s(32), r(32);
+    EXPECT_EQ(Hacl_HPKE_Curve51_CP32_SHA256_export(sender,
+                                                   exporter_context.size(),
+                                                   exporter_context.data(),
+                                                   s.size(),
+                                                   s.data()),
+              0);
+    EXPECT_EQ(Hacl_HPKE_Curve51_CP32_SHA256_export(receiver,
+                                                   exporter_context.size(),
+                                                   exporter_context.data(),
+                                                   r.size(),
+                                                   r.data()),
+              0);
+    EXPECT_EQ(s, expected);
+    EXPECT_EQ(r, expected);
+  }
+
+  // Too long for HKDF-SHA256.
+  bytes too_long(255 * 32 + 1);
+  EXPECT_EQ(Hacl_HPKE_Curve51_CP32_SHA256_export(
+              sender, 0, NULL, too_long.size(), too_long.data()),
+            1);
+
+  Hacl_HPKE_Curve51_CP32_SHA256_context_free(sender);
+  Hacl_HPKE_Curve51_CP32_SHA256_context_free(receiver);
+}
+
+TEST(HpkeContext, FirstMessageMatchesSealBase)
+{
+  bytes aad = aad_for(0);
+  bytes ct(pt.size() + 16), enc(32);
+  ASSERT_EQ(Hacl_HPKE_Curve51_CP32_SHA512_sealBase(skEm.data(),
+                                                   pkRm.data(),
+                                                   info.size(),
+                                                   info.data(),
+                                                   aad.size(),
+                                                   aad.data(),
+                                                   pt.size(),
+                                                   pt.data(),
+                                                   enc.data(),
+                                                   ct.data()),
+            0);
+
+  Hacl_Impl_HPKE_context_s receiver =
+    Hacl_HPKE_Curve51_CP32_SHA512_context_malloc();
+  ASSERT_EQ(Hacl_HPKE_Curve51_CP32_SHA512_setupBaseR(
+              receiver, enc.data(), skRm.data(), info.size(), info.data()),
+            0);
+  bytes got(pt.size());
+  EXPECT_EQ(Hacl_HPKE_Curve51_CP32_SHA512_open(
+              receiver, aad.size(), aad.data(), ct.size(), ct.data(), got.data()),
+            0);
+  EXPECT_EQ(got, pt);
+
+  // Replaying the same message fails: the receiver moved on to sequence 1.
+  EXPECT_EQ(Hacl_HPKE_Curve51_CP32_SHA512_open(
+              receiver, aad.size(), aad.data(), ct.size(), ct.data(), got.data()),
+            1);
+
+  // Exports up to 255 * 64 bytes are allowed with HKDF-SHA512.
+  bytes exported(255 * 64);
+  EXPECT_EQ(Hacl_HPKE_Curve51_CP32_SHA512_export(
+              receiver, 0, NULL, exported.size(), exported.data()),
+            0);
+
+  Hacl_HPKE_Curve51_CP32_SHA512_context_free(receiver);
+}
+
+TEST(HpkeContext, P256Stream)
+{
+  bytes skE = from_hex(
+    "4995788ef4b9d6132b249ce59a77281493eb39af373d236a1fe415cb0c2d7beb");
+  bytes skR = from_hex(
+    "f3ce7fdae57e1a310d87f1ebbde6f328be0a99cdbcadf4d6589cf29de4b8ffd2");
+  bytes pkR(64);
+  ASSERT_TRUE(Hacl_P256_dh_initiator(pkR.data(), skR.data()));
+
+  Hacl_Impl_HPKE_context_s sender = Hacl_HPKE_P256_CP32_SHA256_context_malloc();
+  Hacl_Impl_HPKE_context_s receiver =
+    Hacl_HPKE_P256_CP32_SHA256_context_malloc();
+  bytes enc(65);
+  ASSERT_EQ(Hacl_HPKE_P256_CP32_SHA256_setupBaseS(
+              enc.data(), sender, skE.data(), pkR.data(), 0, NULL),
+            0);
+  ASSERT_EQ(Hacl_HPKE_P256_CP32_SHA256_setupBaseR(
+              receiver, enc.data(), skR.data(), 0, NULL),
+            0);
+
+  for (size_t seq = 0; seq < 100; seq++) {
+    bytes aad = aad_for(seq);
+    bytes msg(seq, (uint8_t)seq);
+    bytes ct(msg.size() + 16), got(msg.size());
+    ASSERT_EQ(
+      Hacl_HPKE_P256_CP32_SHA256_seal(
+        sender, aad.size(), aad.data(), msg.size(), msg.data(), ct.data()),
+      0);
+    if (seq % 10 == 9) {
+      // A forged message is rejected without advancing the receiver.
+      ct[0] ^= 1;
+      EXPECT_EQ(
+        Hacl_HPKE_P256_CP32_SHA256_open(
+          receiver, aad.size(), aad.data(), ct.size(), ct.data(), got.data()),
+        1);
+      ct[0] ^= 1;
+    }
+    ASSERT_EQ(
+      Hacl_HPKE_P256_CP32_SHA256_open(
+        receiver, aad.size(), aad.data(), ct.size(), ct.data(), got.data()),
+      0);
+    EXPECT_EQ(got, msg);
+  }
+  EXPECT_EQ(sender.ctx_seq[0], 100);
+  EXPECT_EQ(receiver.ctx_seq[0], 100);
+
+  // The sequence number is exhausted.
+  sender.ctx_seq[0] = UINT64_MAX;
+  bytes ct(16);
+  EXPECT_EQ(Hacl_HPKE_P256_CP32_SHA256_seal(sender, 0, NULL, 0, NULL, ct.data()),
+            1);
+
+  Hacl_HPKE_P256_CP32_SHA256_context_free(sender);
+  Hacl_HPKE_P256_CP32_SHA256_context_free(receiver);
+}
+
+typedef uint32_t (*seal_base_multi)(uint32_t,
+                                     uint8_t*,
+                                     uint8_t*,
+                                     uint32_t,
+                                     uint8_t*,
+                                     uint32_t,
+                                     uint8_t*,
+                                     uint32_t,
+                                     uint8_t*,
+                                     uint8_t*,
+                                     uint8_t*,
+                                     uint8_t*,
+                                     uint8_t*);
+typedef uint32_t (*seal_base)(uint8_t*,
+                              uint8_t*,
+                              uint32_t,
+                              uint8_t*,
+                              uint32_t,
+                              uint8_t*,
+                              uint32_t,
+                              uint8_t*,
+                              uint8_t*,
+                              uint8_t*);
+typedef uint32_t (*open_base_multi)(uint8_t*,
+                                    uint8_t*,
+                                    uint32_t,
+                                    uint8_t*,
+                                    uint32_t,
+                                    uint8_t*,
+                                    uint8_t*,
+                                    uint32_t,
+                                    uint8_t*,
+                                    uint8_t*);
+
+static void
+test_curve25519_multi(seal_base_multi seal_multi,
+                      seal_base seal,
+                      open_base_multi open_multi)
+{
+  // Seven recipients: one group of four and a tail of three.
+  const uint32_t n = 7;
+  bytes skE(32 * n), skR(32 * n), pkR(32 * n);
+  for (size_t i = 0; i < skE.size(); i++) {
+    skE[i] = (uint8_t)(3 * i + 1);
+    skR[i] = (uint8_t)(5 * i + 7);
+  }
+  for (uint32_t i = 0; i < n; i++) {
+    Hacl_Curve25519_51_secret_to_public(&pkR[32 * i], &skR[32 * i]);
+  }
+  bytes dek(32, 0x42), aad = aad_for(0);
+
+  bytes enc(32 * n), wrapped(48 * n), ct(pt.size() + 16);
+  ASSERT_EQ(seal_multi(n,
+                       skE.data(),
+                       pkR.data(),
+                       info.size(),
+                       info.data(),
+                       aad.size(),
+                       aad.data(),
+                       pt.size(),
+                       pt.data(),
+                       dek.data(),
+                       enc.data(),
+                       wrapped.data(),
+                       ct.data()),
+            0);
+
+  for (uint32_t i = 0; i < n; i++) {
+    // Each wrapped key is an ordinary single-shot HPKE ciphertext.
+    bytes enc1(32), wrapped1(48);
+    ASSERT_EQ(seal(&skE[32 * i],
+                   &pkR[32 * i],
+                   info.size(),
+                   info.data(),
+                   0,
+                   NULL,
+                   dek.size(),
+                   dek.data(),
+                   enc1.data(),
+                   wrapped1.data()),
+              0);
+    EXPECT_EQ(enc1, bytes(&enc[32 * i], &enc[32 * i] + 32));
+    EXPECT_EQ(wrapped1, bytes(&wrapped[48 * i], &wrapped[48 * i] + 48));
+
+    bytes got(pt.size());
+    EXPECT_EQ(open_multi(&enc[32 * i],
+                         &skR[32 * i],
+                         info.size(),
+                         info.data(),
+                         aad.size(),
+                         aad.data(),
+                         &wrapped[48 * i],
+                         ct.size(),
+                         ct.data(),
+                         got.data()),
+              0);
+    EXPECT_EQ(got, pt);
+  }
+
+  // A key that is not addressed to this recipient does not open.
+  bytes got(pt.size());
+  EXPECT_EQ(open_multi(&enc[0],
+                       &skR[32],
+                       info.size(),
+                       info.data(),
+                       aad.size(),
+                       aad.data(),
+                       &wrapped[0],
+                       ct.size(),
+                       ct.data(),
+                       got.data()),
+            1);
+
+  // A low-order recipient key, in the group of four and in the tail, fails
+  // without affecting the others.
+  memset(&pkR[32 * 2], 0, 32);
+  memset(&pkR[32 * 5], 0, 32);
+  ASSERT_EQ(seal_multi(n,
+                       skE.data(),
+                       pkR.data(),
+                       info.size(),
+                       info.data(),
+                       aad.size(),
+                       aad.data(),
+                       pt.size(),
+                       pt.data(),
+                       dek.data(),
+                       enc.data(),
+                       wrapped.data(),
+                       ct.data()),
+            1);
+  for (uint32_t i : { 3, 6 }) {
+    EXPECT_EQ(open_multi(&enc[32 * i],
+                         &skR[32 * i],
+                         info.size(),
+                         info.data(),
+                         aad.size(),
+                         aad.data(),
+                         &wrapped[48 * i],
+                         ct.size(),
+                         ct.data(),
+                         got.data()),
+              0);
+    EXPECT_EQ(got, pt);
+  }
+}
+
+TEST(HpkeMulti, Curve25519Recipients)
+{
+  test_curve25519_multi(Hacl_HPKE_Curve51_CP32_SHA256_sealBaseMulti,
+                        Hacl_HPKE_Curve51_CP32_SHA256_sealBase,
+                        Hacl_HPKE_Curve51_CP32_SHA256_openBaseMulti);
+
+#ifdef HACL_CAN_COMPILE_VEC256
+  // The CP256 variants use the 4-way AVX2 ladder.
+  hacl_init_cpu_features();
+  if (hacl_vec256_support()) {
+    test_curve25519_multi(Hacl_HPKE_Curve64_CP256_SHA256_sealBaseMulti,
+                          Hacl_HPKE_Curve64_CP256_SHA256_sealBase,
+                          Hacl_HPKE_Curve64_CP256_SHA256_openBaseMulti);
+  } else {
+    printf(" ! Vec256 was compiled but it is not available on this CPU.\n");
+  }
+#endif
+}
+
+TEST(HpkeMulti, P256Recipients)
+{
+  const uint32_t n = 3;
+  bytes skE(32 * n, 0x11), skR(32 * n, 0x22), pkR(64 * n);
+  for (uint32_t i = 0; i < n; i++) {
+    skE[32 * i] = (uint8_t)i;
+    skR[32 * i] = (uint8_t)i;
+    ASSERT_TRUE(Hacl_P256_dh_initiator(&pkR[64 * i], &skR[32 * i]));
+  }
+  bytes dek(32, 0x42);
+  bytes enc(65 * n), wrapped(48 * n), ct(pt.size() + 16);
+  ASSERT_EQ(Hacl_HPKE_P256_CP32_SHA256_sealBaseMulti(n,
+                                                     skE.data(),
+                                                     pkR.data(),
+                                                     0,
+                                                     NULL,
+                                                     0,
+                                                     NULL,
+                                                     pt.size(),
+                                                     pt.data(),
+                                                     dek.data(),
+                                                     enc.data(),
+                                                     wrapped.data(),
+                                                     ct.data()),
+            0);
+  for (uint32_t i = 0; i < n; i++) {
+    bytes got(pt.size());
+    EXPECT_EQ(Hacl_HPKE_P256_CP32_SHA256_openBaseMulti(&enc[65 * i],
+                                                       &skR[32 * i],
+                                                       0,
+                                                       NULL,
+                                                       0,
+                                                       NULL,
+                                                       &wrapped[48 * i],
+                                                       ct.size(),
+                                                       ct.data(),
+                                                       got.data()),
+              0);
+    EXPECT_EQ(got, pt);
+  }
+}
+
+// The keys and encapsulated keys of RFC 9180, Appendix A.2.1-A.2.4 (X25519)
+// and A.3.1-A.3.4 (P-256), in Base, PSK, Auth and AuthPSK mode. The PSK modes
+// use the RFC's psk and psk_id.
+typedef struct
+{
+  bytes skE, skR, skS;
+  bytes enc;
+} ModeKeys;
+
+static bytes psk =
+  from_hex("0247fd33b913760fa1fa51e1892d9f307fbe65eb171e8132c2af18555a738b82");
+static bytes psk_id = from_hex("456e6e796e20447572696e206172616e204d6f726961");
+
+static vector<ModeKeys> x25519_mode_keys = {
+  // A.2.1
+  { from_hex(
+      "f4ec9b33b792c372c1d2c2063507b684ef925b8c75a42dbcbf57d63ccd381600"),
+    from_hex(
+      "8057991eef8f1f1af18f4a9491d16a1ce333f695d4db8e38da75975c4478e0fb"),
+    bytes(),
+    from_hex(
+      "1afa08d3dec047a643885163f1180476fa7ddb54c6a8029ea33f95796bf2ac4a") },
+  // A.2.2
+  { from_hex(
+      "77d114e0212be51cb1d76fa99dd41cfd4d0166b08caa09074430a6c59ef17879"),
+    from_hex(
+      "7b36a42822e75bf3362dfabbe474b3016236408becb83b859a6909e22803cb0c"),
+    bytes(),
+    from_hex(
+      "13640af826b722fc04feaa4de2f28fbd5ecc03623b317834e7ff4120dbe73062") },
+  // A.2.3
+  { from_hex(
+      "ff4442ef24fbc3c1ff86375b0be1e77e88a0de1e79b30896d73411c5ff4c3518"),
+    from_hex(
+      "fdea67cf831f1ca98d8e27b1f6abeb5b7745e9d35348b80fa407ff6958f9137e"),
+    from_hex(
+      "dc4a146313cce60a278a5323d321f051c5707e9c45ba21a3479fecdf76fc69dd"),
+    from_hex(
+      "23fb952571a14a25e3d678140cd0e5eb47a0961bb18afcf85896e5453c312e76") },
+  // A.2.4
+  { from_hex(
+      "14de82a5897b613616a00c39b87429df35bc2b426bcfd73febcb45e903490768"),
+    from_hex(
+      "cb29a95649dc5656c2d054c1aa0d3df0493155e9d5da6d7e344ed8b6a64a9423"),
+    from_hex(
+      "fc1c87d2f3832adb178b431fce2ac77c7ca2fd680f3406c77b5ecdf818b119f4"),
+    from_hex(
+      "820818d3c23993492cc5623ab437a48a0a7ca3e9639c140fe1e33811eb844b7c") },
+};
+
+static vector<ModeKeys> p256_mode_keys = {
+  // A.3.1
+  { from_hex(
+      "4995788ef4b9d6132b249ce59a77281493eb39af373d236a1fe415cb0c2d7beb"),
+    from_hex(
+      "f3ce7fdae57e1a310d87f1ebbde6f328be0a99cdbcadf4d6589cf29de4b8ffd2"),
+    bytes(),
+    from_hex(
+      "04a92719c6195d5085104f469a8b9814d5838ff72b60501e2c4466e5e67b325ac9"
+      "8536d7b61a1af4b78e5b7f951c0900be863c403ce65c9bfcb9382657222d18c4") },
+  // A.3.2
+  { from_hex(
+      "57427244f6cc016cddf1c19c8973b4060aa13579b4c067fd5d93a5d74e32a90f"),
+    from_hex(
+      "438d8bcef33b89e0e9ae5eb0957c353c25a94584b0dd59c991372a75b43cb661"),
+    bytes(),
+    from_hex(
+      "04305d35563527bce037773d79a13deabed0e8e7cde61eecee403496959e89e4d0"
+      "ca701726696d1485137ccb5341b3c1c7aaee90a4a02449725e744b1193b53b5f") },
+  // A.3.3
+  { from_hex(
+      "6b8de0873aed0c1b2d09b8c7ed54cbf24fdf1dfc7a47fa501f918810642d7b91"),
+    from_hex(
+      "d929ab4be2e59f6954d6bedd93e638f02d4046cef21115b00cdda2acb2a4440e"),
+    from_hex(
+      "1120ac99fb1fccc1e8230502d245719d1b217fe20505c7648795139d177f0de9"),
+    from_hex(
+      "042224f3ea800f7ec55c03f29fc9865f6ee27004f818fcbdc6dc68932c1e52e15b"
+      "79e264a98f2c535ef06745f3d308624414153b22c7332bc1e691cb4af4d53454") },
+  // A.3.4
+  { from_hex(
+      "36f771e411cf9cf72f0701ef2b991ce9743645b472e835fe234fb4d6eb2ff5a0"),
+    from_hex(
+      "bdf4e2e587afdf0930644a0c45053889ebcadeca662d7c755a353d5b4e2a8394"),
+    from_hex(
+      "b0ed8721db6185435898650f7a677affce925aba7975a582653c4cb13c72d240"),
+    from_hex(
+      "046a1de3fc26a3d43f4e4ba97dbe24f7e99181136129c48fbe872d4743e2b13135"
+      "7ed4f29a7b317dc22509c7b00991ae990bf65f8b236700c82ab7c11a84511401") },
+};
+
+typedef struct
+{
+  string name;
+  size_t npk;
+  Hacl_Impl_HPKE_context_s (*context_malloc)(void);
+  void (*context_free)(Hacl_Impl_HPKE_context_s);
+  Hacl_Impl_HPKE_receiver_key_s (*receiver_key_malloc)(void);
+  uint32_t (*receiver_key_init)(Hacl_Impl_HPKE_receiver_key_s, uint8_t*);
+  void (*receiver_key_free)(Hacl_Impl_HPKE_receiver_key_s);
+  uint8_t* (*receiver_key_public)(Hacl_Impl_HPKE_receiver_key_s);
+  uint32_t (*setupBaseS)(uint8_t*,
+                         Hacl_Impl_HPKE_context_s,
+                         uint8_t*,
+                         uint8_t*,
+                         uint32_t,
+                         uint8_t*);
+  uint32_t (*setupBaseR_key)(Hacl_Impl_HPKE_context_s,
+                             Hacl_Impl_HPKE_receiver_key_s,
+                             uint8_t*,
+                             uint32_t,
+                             uint8_t*);
+  uint32_t (*setupPSKS)(uint8_t*,
+                        Hacl_Impl_HPKE_context_s,
+                        uint8_t*,
+                        uint8_t*,
+                        uint32_t,
+                        uint8_t*,
+                        uint32_t,
+                        uint8_t*,
+                        uint32_t,
+                        uint8_t*);
+  uint32_t (*setupPSKR)(Hacl_Impl_HPKE_context_s,
+                        Hacl_Impl_HPKE_receiver_key_s,
+                        uint8_t*,
+                        uint32_t,
+                        uint8_t*,
+                        uint32_t,
+                        uint8_t*,
+                        uint32_t,
+                        uint8_t*);
+  uint32_t (*setupAuthS)(uint8_t*,
+                         Hacl_Impl_HPKE_context_s,
+                         uint8_t*,
+                         uint8_t*,
+                         uint8_t*,
+                         uint32_t,
+                         uint8_t*);
+  uint32_t (*setupAuthR)(Hacl_Impl_HPKE_context_s,
+                         Hacl_Impl_HPKE_receiver_key_s,
+                         uint8_t*,
+                         uint8_t*,
+                         uint32_t,
+                         uint8_t*);
+  uint32_t (*setupAuthPSKS)(uint8_t*,
+                            Hacl_Impl_HPKE_context_s,
+                            uint8_t*,
+                            uint8_t*,
+                            uint8_t*,
+                            uint32_t,
+                            uint8_t*,
+                            uint32_t,
+                            uint8_t*,
+                            uint32_t,
+                            uint8_t*);
+  uint32_t (*setupAuthPSKR)(Hacl_Impl_HPKE_context_s,
+                            Hacl_Impl_HPKE_receiver_key_s,
+                            uint8_t*,
+                            uint8_t*,
+                            uint32_t,
+                            uint8_t*,
+                            uint32_t,
+                            uint8_t*,
+                            uint32_t,
+                            uint8_t*);
+  uint32_t (*export_)(Hacl_Impl_HPKE_context_s,
+                      uint32_t,
+                      uint8_t*,
+                      uint32_t,
+                      uint8_t*);
+  uint32_t (*seal)(Hacl_Impl_HPKE_context_s,
+                   uint32_t,
+                   uint8_t*,
+                   uint32_t,
+                   uint8_t*,
+                   uint8_t*);
+  uint32_t (*open)(Hacl_Impl_HPKE_context_s,
+                   uint32_t,
+                   uint8_t*,
+                   uint32_t,
+                   uint8_t*,
+                   uint8_t*);
+  vector<ModeKeys> keys;
+  // Exporter output for "TestContext", and the ciphertexts of sequence numbers
+  // 0 and 1, in Base, PSK, Auth and AuthPSK mode.
+  //
+  // DHKEM(X25519, HKDF-SHA256), HKDF-SHA256, ChaCha20Poly1305 is the suite of
+  // RFC 9180, Appendix A.2, and its Base mode values are the published A.2.1
+  // values. The published A.2.2-A.2.4 outputs are not reproduced here: these,
+  // and the values of the other two suites, were computed from the RFC keys
+  // with a model of RFC 9180 that reproduces the published A.2.1 and A.3.1
+  // outputs. The RFC has no vectors for the other two suites, whose KDF or
+  // AEAD identifier differs and enters the key schedule (A.3 uses AES-128-GCM).
+  vector<bytes> expected;
+  vector<array<bytes, 2>> cts;
+} ModesSuite;
+
+#define MODES_SUITE(V)                                                         \
+  V##_context_malloc, V##_context_free, V##_receiver_key_malloc,               \
+    V##_receiver_key_init, V##_receiver_key_free, V##_receiver_key_public,     \
+    V##_setupBaseS, V##_setupBaseR_key, V##_setupPSKS, V##_setupPSKR,          \
+    V##_setupAuthS, V##_setupAuthR, V##_setupAuthPSKS, V##_setupAuthPSKR,      \
+    V##_export, V##_seal, V##_open
+
+static vector<ModesSuite> modes_suites = {
+  { "Curve51_CP32_SHA256",
+    32,
+    MODES_SUITE(Hacl_HPKE_Curve51_CP32_SHA256),
+    x25519_mode_keys,
+    { from_hex(
+        "5acb09211139c43b3090489a9da433e8a30ee7188ba8b0a9a1ccf0c229283e53"),
+      from_hex(
+        "30d92bb9e1ac2411be0bbff13a133e9f3d841b4fbfe52773e20c49987b0ef330"),
+      from_hex(
+        "bcfb3b9e3d9f1e631af23abf1695c176e8403e1175cc7391a43d18bcec7e9574"),
+      from_hex(
+        "43e804b7980d13b382b03ed0433f9ed96a7ce98e0c08758c6cc3e73a15b008c2") },
+    { { from_hex(
+          "1c5250d8034ec2b784ba2cfd69dbdb8af406cfe3ff938e131f0def8c8b60b4db"
+          "21993c62ce81883d2dd1b51a28"),
+        from_hex(
+          "6b53c051e4199c518de79594e1c4ab18b96f081549d45ce015be002090bb119e"
+          "85285337cc95ba5f59992dc98c") },
+      { from_hex(
+          "9a77fc8f3f2b44cfb2a61077040fc07baf37f851abd163dc70ab1480f17b05f1"
+          "8414dd85ee4ec7c3521eb6175a"),
+        from_hex(
+          "a4365ba1e1d6a5b98e108b587f990552a464bdd3a3cfd41fc8f3d4239906f8f9"
+          "c470c1a3fd297afcf10cfa8ec6") },
+      { from_hex(
+          "0772cf9eb2943c74c9a85f9f4d6df3eef2f2618acf9f688cbbccaa3d809ffb78"
+          "46d5a14a38437064fbab295957"),
+        from_hex(
+          "608814f4555ca96d1bacb7c95073de2f637499346a9c164eae6685850c77d9fa"
+          "4c6576180fd2795c86951761f0") },
+      { from_hex(
+          "6543f011b5d6888d0a8f1e5ba90d62c9861b83499d071738d144712ee1d721a2"
+          "c6406b8be646eab339935ea24c"),
+        from_hex(
+          "99391b4cf9ede37cd1948a2bcbb365ef72ebe016f1cfb245c262d99b10901e6a"
+          "7ba28e058f23625603197f8402") } } },
+  { "Curve51_CP32_SHA512",
+    32,
+    MODES_SUITE(Hacl_HPKE_Curve51_CP32_SHA512),
+    x25519_mode_keys,
+    { from_hex(
+        "9418c705d3e2e6b75c1a15ab06f99cd2bf2a2bbe904b8cc50a847234df2865d3"),
+      from_hex(
+        "de91315096c75a9a41a8d9d6507001ecbdca4f8778d9b76ea7b06b2e22c68e93"),
+      from_hex(
+        "37e9f35e461e67ef0bd7e4c052f4472943e908949d5044fb7ec11e70f96911ed"),
+      from_hex(
+        "7883f8ba4ad8920582e0197fabfea77bffcf6e5531502a2742a6463802df140b") },
+    { { from_hex(
+          "32384acf30f06ca600fd06e60d5d7e23e114dc91126d66bd89ddf1e5f2480762"
+          "b6865f3837a98144e8d94ab5e3"),
+        from_hex(
+          "90e8164ea2b2968d533bffb12a771c209152634d25c8d42cd6854f506a72f884"
+          "84c935aa8f2a49323ae0f48afd") },
+      { from_hex(
+          "b98ccdc70d0d0d5b4956508fb944f5489dc566ef341cba23c48d640a28d287d0"
+          "d5abfd94b743b925f1e0d60348"),
+        from_hex(
+          "3e073464b460efbe10c2358370cbd441ff3d0b072a89cc498454112a0b0f56e5"
+          "fe6ff5dc56260178bea4c9bab1") },
+      { from_hex(
+          "5919bf14e701c4dc75965e9df35182471575e6187c920567b3470e8b4cc74a66"
+          "3a218b6ef27780f2d220d73c6c"),
+        from_hex(
+          "fc26769f9200a5e6d55829c1f08271d9c9918e9cdd1c05f9f65f8359fa960b87"
+          "99474b1951aaf2ec8883acb0a9") },
+      { from_hex(
+          "366cd686c2522aa662e387c7dfb917715023c8b2ec30859c79a92058ec40eeb5"
+          "9b8fc5e87855be597b16859b3b"),
+        from_hex(
+          "dab56b9396730a13047cd5215c677330eb621d1715ef319a035cd9abaa8ec0f0"
+          "7296fa88aa5c302ad91e8addfe") } } },
+  { "P256_CP32_SHA256",
+    64,
+    MODES_SUITE(Hacl_HPKE_P256_CP32_SHA256),
+    p256_mode_keys,
+    { from_hex(
+        "e0d8710e5e5d51cfdcdffb621264c34c26b0cae1ce611f7be4f87cf55c58694b"),
+      from_hex(
+        "48196ff65628545ca53b3976a4032f4115070f493c4a65153a301ef0057065ed"),
+      from_hex(
+        "43fede2529964760b44ff07c0eb93f4902c91ddd2a58ab9d3d95b03565a4dcb0"),
+      from_hex(
+        "9e19d6abe8da96a1d57fec24a05a1f0b1d5153efbc33c2a8a339dfe50d19ae3a") },
+    { { from_hex(
+          "c3edb643d44e298e549cd164ca818e4e0bfd042cfbda13d0eb25f07e67bbcc20"
+          "4dc4e4e3b3d1321fdd4a4b11f4"),
+        from_hex(
+          "5781d5982d67f43a5b9d3fa04590ccc1527ac1f7d7652a76b576a47f078ae451"
+          "c65d942d0017a989b62d2c37c9") },
+      { from_hex(
+          "8e3ea79f40a4bfd2683ea370b4caddcbc9630474549df7a608a68b22eeb47647"
+          "96697a0f339f14c5c84477e656"),
+        from_hex(
+          "b6f6ff34368d97387befbce59ade8d620ff3703f683c4d29508c07d0b843dc08"
+          "531b374549b6cbb67fa264b395") },
+      { from_hex(
+          "a157014d8ab3c554cc59435bcb77856d5fd9f1c13425a12101b4e3b95ffacaf0"
+          "80bb0a41d6cbed92bc3eccdc4a"),
+        from_hex(
+          "c2851aa7cbea47f9e6b608442d031b1a997c09c818cb08bbab93243c67142b8c"
+          "6c91aeaff6b12495aca22f8c1a") },
+      { from_hex(
+          "2bc6c5b1c15d2e767cef6d32a2b803989b0180c6d07ba6a3dca9df5604e4ceb8"
+          "4b26e8b72f11e031172f5477f6"),
+        from_hex(
+          "4c8eeebeb459c78e0c9a10042b07f37e4cd4e98934ad696dfba23cc9580bb052"
+          "1ee1e3726c5bca35eedad3d9b4") } } },
+};
+
+class HpkeModes : public ::testing::TestWithParam<ModesSuite>
+{};
+
+TEST_P(HpkeModes, KeySchedule)
+{
+  const ModesSuite& s = GetParam();
+  bytes exp_ctx = { 'T', 'e', 's', 't', 'C', 'o', 'n', 't', 'e', 'x', 't' };
+  size_t nenc = s.npk == 32 ? 32 : 65;
+
+  Hacl_Impl_HPKE_receiver_key_s rkey = s.receiver_key_malloc();
+  Hacl_Impl_HPKE_receiver_key_s skey = s.receiver_key_malloc();
+  Hacl_Impl_HPKE_context_s sender = s.context_malloc();
+  Hacl_Impl_HPKE_context_s receiver = s.context_malloc();
+  bytes skE, skR, skS;
+  uint8_t *pkR, *pkS;
+  for (int mode = 0; mode < 4; mode++) {
+    skE = s.keys[mode].skE;
+    skR = s.keys[mode].skR;
+    ASSERT_EQ(s.receiver_key_init(rkey, skR.data()), 0);
+    // The sender-side public keys are raw: 32 bytes for X25519, x || y for
+    // P-256.
+    pkR = s.receiver_key_public(rkey) + (nenc - s.npk);
+    if (mode >= 2) {
+      skS = s.keys[mode].skS;
+      ASSERT_EQ(s.receiver_key_init(skey, skS.data()), 0);
+      pkS = s.receiver_key_public(skey) + (nenc - s.npk);
+    }
+
+    bytes enc(nenc);
+    uint32_t rs, rr;
+    switch (mode) {
+      case 0:
+        rs = s.setupBaseS(
+          enc.data(), sender, skE.data(), pkR, info.size(), info.data());
+        rr = s.setupBaseR_key(
+          receiver, rkey, enc.data(), info.size(), info.data());
+        break;
+      case 1:
+        rs = s.setupPSKS(enc.data(),
+                         sender,
+                         skE.data(),
+                         pkR,
+                         psk.size(),
+                         psk.data(),
+                         psk_id.size(),
+                         psk_id.data(),
+                         info.size(),
+                         info.data());
+        rr = s.setupPSKR(receiver,
+                         rkey,
+                         enc.data(),
+                         psk.size(),
+                         psk.data(),
+                         psk_id.size(),
+                         psk_id.data(),
+                         info.size(),
+                         info.data());
+        break;
+      case 2:
+        rs = s.setupAuthS(enc.data(),
+                          sender,
+                          skE.data(),
+                          pkR,
+                          skS.data(),
+                          info.size(),
+                          info.data());
+        rr = s.setupAuthR(
+          receiver, rkey, enc.data(), pkS, info.size(), info.data());
+        break;
+      default:
+        rs = s.setupAuthPSKS(enc.data(),
+                             sender,
+                             skE.data(),
+                             pkR,
+                             skS.data(),
+                             psk.size(),
+                             psk.data(),
+                             psk_id.size(),
+                             psk_id.data(),
+                             info.size(),
+                             info.data());
+        rr = s.setupAuthPSKR(receiver,
+                             rkey,
+                             enc.data(),
+                             pkS,
+                             psk.size(),
+                             psk.data(),
+                             psk_id.size(),
+                             psk_id.data(),
+                             info.size(),
+                             info.data());
+        break;
+    }
+    ASSERT_EQ(rs, 0) << s.name << " mode " << mode;
+    ASSERT_EQ(rr, 0) << s.name << " mode " << mode;
+    EXPECT_EQ(enc, s.keys[mode].enc) << s.name << " mode " << mode;
+
+    bytes se(32), re(32);
+    EXPECT_EQ(
+      s.export_(sender, exp_ctx.size(), exp_ctx.data(), se.size(), se.data()),
+      0);
+    EXPECT_EQ(
+      s.export_(receiver, exp_ctx.size(), exp_ctx.data(), re.size(), re.data()),
+      0);
+    EXPECT_EQ(se, s.expected[mode]) << s.name << " mode " << mode;
+    EXPECT_EQ(re, s.expected[mode]) << s.name << " mode " << mode;
+
+    for (size_t seq = 0; seq < 2; seq++) {
+      bytes aad = aad_for(seq);
+      bytes ct(pt.size() + 16), got(pt.size());
+      EXPECT_EQ(
+        s.seal(sender, aad.size(), aad.data(), pt.size(), pt.data(), ct.data()),
+        0);
+      EXPECT_EQ(ct, s.cts[mode][seq])
+        << s.name << " mode " << mode << " seq " << seq;
+      EXPECT_EQ(s.open(receiver,
+                       aad.size(),
+                       aad.data(),
+                       ct.size(),
+                       ct.data(),
+                       got.data()),
+                0);
+      EXPECT_EQ(got, pt);
+    }
+  }
+
+  // PSK modes require both a PSK and its identifier.
+  bytes enc(nenc);
+  EXPECT_EQ(s.setupPSKS(enc.data(),
+                        sender,
+                        skE.data(),
+                        pkR,
+                        psk.size(),
+                        psk.data(),
+                        0,
+                        NULL,
+                        info.size(),
+                        info.data()),
+            1);
+  EXPECT_EQ(
+    s.setupPSKR(
+      receiver, rkey, enc.data(), 0, NULL, 0, NULL, info.size(), info.data()),
+    1);
+
+  // A receiver that expects another sender derives different keys.
+  ASSERT_EQ(s.setupAuthS(enc.data(),
+                         sender,
+                         skE.data(),
+                         pkR,
+                         skS.data(),
+                         info.size(),
+                         info.data()),
+            0);
+  ASSERT_EQ(
+    s.setupAuthR(receiver, rkey, enc.data(), pkR, info.size(), info.data()), 0);
+  bytes se(32), re(32);
+  s.export_(sender, 0, NULL, se.size(), se.data());
+  s.export_(receiver, 0, NULL, re.size(), re.data());
+  EXPECT_NE(se, re);
+
+  s.context_free(sender);
+  s.context_free(receiver);
+  s.receiver_key_free(rkey);
+  s.receiver_key_free(skey);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  Suites,
+  HpkeModes,
+  ::testing::ValuesIn(modes_suites),
+  [](const ::testing::TestParamInfo<ModesSuite>& info) {
+    return info.param.name;
+  });
+
+TEST(HpkeReceiverKey, MatchesSetupBaseR)
+{
+  Hacl_Impl_HPKE_receiver_key_s key =
+    Hacl_HPKE_Curve51_CP32_SHA256_receiver_key_malloc();
+  ASSERT_EQ(Hacl_HPKE_Curve51_CP32_SHA256_receiver_key_init(key, skRm.data()),
+            0);
+  EXPECT_EQ(bytes(Hacl_HPKE_Curve51_CP32_SHA256_receiver_key_public(key),
+                  Hacl_HPKE_Curve51_CP32_SHA256_receiver_key_public(key) + 32),
+            pkRm);
+
+  Hacl_Impl_HPKE_context_s receiver =
+    Hacl_HPKE_Curve51_CP32_SHA256_context_malloc();
+  ASSERT_EQ(Hacl_HPKE_Curve51_CP32_SHA256_setupBaseR_key(
+              receiver, key, expected_enc.data(), info.size(), info.data()),
+            0);
+  bytes ct = expected_cts[0], got(pt.size()), aad = aad_for(0);
+  EXPECT_EQ(Hacl_HPKE_Curve51_CP32_SHA256_open(
+              receiver, aad.size(), aad.data(), ct.size(), ct.data(), got.data()),
+            0);
+  EXPECT_EQ(got, pt);
+  Hacl_HPKE_Curve51_CP32_SHA256_context_free(receiver);
+  Hacl_HPKE_Curve51_CP32_SHA256_receiver_key_free(key);
+
+  // P-256 encapsulated keys must be uncompressed points.
+  Hacl_Impl_HPKE_receiver_key_s pkey =
+    Hacl_HPKE_P256_CP32_SHA256_receiver_key_malloc();
+  bytes zero(32);
+  EXPECT_EQ(Hacl_HPKE_P256_CP32_SHA256_receiver_key_init(pkey, zero.data()), 1);
+  bytes skR = from_hex(
+    "f3ce7fdae57e1a310d87f1ebbde6f328be0a99cdbcadf4d6589cf29de4b8ffd2");
+  ASSERT_EQ(Hacl_HPKE_P256_CP32_SHA256_receiver_key_init(pkey, skR.data()), 0);
+  Hacl_Impl_HPKE_context_s preceiver =
+    Hacl_HPKE_P256_CP32_SHA256_context_malloc();
+  bytes enc(Hacl_HPKE_P256_CP32_SHA256_receiver_key_public(pkey),
+            Hacl_HPKE_P256_CP32_SHA256_receiver_key_public(pkey) + 65);
+  EXPECT_EQ(Hacl_HPKE_P256_CP32_SHA256_setupBaseR_key(
+              preceiver, pkey, enc.data(), 0, NULL),
+            0);
+  enc[0] = 2;
+  EXPECT_EQ(Hacl_HPKE_P256_CP32_SHA256_setupBaseR_key(
+              preceiver, pkey, enc.data(), 0, NULL),
+            1);
+  Hacl_HPKE_P256_CP32_SHA256_context_free(preceiver);
+  Hacl_HPKE_P256_CP32_SHA256_receiver_key_free(pkey);
+}
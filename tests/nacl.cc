@@ -11,9 +11,20 @@
 #include <gtest/gtest.h>
 #include <nlohmann/json.hpp>
 
+#include "EverCrypt_AutoConfig2.h"
 #include "Hacl_NaCl.h"
+#include "Hacl_Salsa20.h"
+#include "hacl-cpu-features.h"
 #include "util.h"
 
+#ifdef HACL_CAN_COMPILE_VEC128
+#include "Hacl_Salsa20_Vec128.h"
+#endif
+
+#ifdef HACL_CAN_COMPILE_VEC256
+#include "Hacl_Salsa20_Vec256.h"
+#endif
+
 // ANCHOR(example define box)
 // Note: HACL Packages will provide this (or a similar) define in a later
 // version.
@@ -413,6 +424,54 @@ TEST_P(NaClBoxSuite, EasyDetachedKAT)
   }
 }
 
+// The session implementations supported by this CPU, portable first.
+static vector<Hacl_NaCl_impl>
+session_impls()
+{
+  EverCrypt_AutoConfig2_init();
+  vector<Hacl_NaCl_impl> impls = { Hacl_NaCl_Portable };
+  if (EverCrypt_AutoConfig2_has_vec128()) {
+    impls.push_back(Hacl_NaCl_Vec128);
+  }
+  if (EverCrypt_AutoConfig2_has_vec256()) {
+    impls.push_back(Hacl_NaCl_Vec256);
+  }
+  return impls;
+}
+
+TEST_P(NaClBoxSuite, SessionKAT)
+{
+  auto test = GetParam();
+
+  for (Hacl_NaCl_impl impl : session_impls()) {
+    Hacl_NaCl_crypto_box_session_s* s = Hacl_NaCl_crypto_box_session_malloc(impl);
+    ASSERT_NE(s, nullptr);
+    ASSERT_EQ(Hacl_NaCl_crypto_box_session_init(
+                s, test.bob_pk.data(), test.alice_sk.data()),
+              0);
+
+    bytes got_ciphertext(HACL_NACL_CRYPTO_BOX_MACBYTES + test.plaintext.size());
+    ASSERT_EQ(Hacl_NaCl_crypto_box_session_easy(s,
+                                                got_ciphertext.data(),
+                                                test.plaintext.data(),
+                                                test.plaintext.size(),
+                                                test.nonce.data()),
+              0);
+    EXPECT_EQ(test.ciphertext, got_ciphertext) << "impl " << (int)impl;
+
+    bytes got_plaintext(test.plaintext.size());
+    ASSERT_EQ(Hacl_NaCl_crypto_box_session_open_easy(s,
+                                                     got_plaintext.data(),
+                                                     test.ciphertext.data(),
+                                                     test.ciphertext.size(),
+                                                     test.nonce.data()),
+              0);
+    EXPECT_EQ(test.plaintext, got_plaintext) << "impl " << (int)impl;
+
+    Hacl_NaCl_crypto_box_session_free(s);
+  }
+}
+
 TEST_P(NaClBoxSuite, SplitKAT)
 {
   auto test = GetParam();
@@ -736,6 +795,117 @@ read_json_secret_box(char* path)
   return tests;
 }
 
+// Sessions encrypt in chunks; lengths around the first block, the chunk size
+// and the vector widths must give the same result as the one-shot API.
+TEST(NaClSession, MatchesOneShot)
+{
+  bytes k(HACL_NACL_CRYPTO_BOX_BEFORENMBYTES), nonce(24);
+  generate_random(k.data(), k.size());
+  generate_random(nonce.data(), nonce.size());
+  vector<uint32_t> lens = { 0, 1, 31, 32, 33, 95, 96, 97, 255, 256, 257, 511, 512,
+                            4095, 4096, 4097, 4128, 4129, 8224, 10000 };
+
+  for (Hacl_NaCl_impl impl : session_impls()) {
+    Hacl_NaCl_crypto_box_session_s* s = Hacl_NaCl_crypto_box_session_malloc(impl);
+    ASSERT_NE(s, nullptr);
+    Hacl_NaCl_crypto_box_session_init_afternm(s, k.data());
+    for (uint32_t len : lens) {
+      bytes m(len), expected(16 + len), got(16 + len), opened(len);
+      generate_random(m.data(), len);
+      Hacl_NaCl_crypto_box_easy_afternm(
+        expected.data(), m.data(), len, nonce.data(), k.data());
+      Hacl_NaCl_crypto_box_session_easy(
+        s, got.data(), m.data(), len, nonce.data());
+      EXPECT_EQ(got, expected) << "impl " << (int)impl << " len " << len;
+      ASSERT_EQ(Hacl_NaCl_crypto_box_session_open_easy(
+                  s, opened.data(), got.data(), got.size(), nonce.data()),
+                0);
+      EXPECT_EQ(opened, m);
+
+      got[got.size() - 1] ^= 1;
+      EXPECT_NE(Hacl_NaCl_crypto_box_session_open_easy(
+                  s, opened.data(), got.data(), got.size(), nonce.data()),
+                0);
+    }
+
+    // Ciphertexts shorter than the tag are rejected.
+    bytes c(15), m(15);
+    for (uint32_t clen = 0; clen < 16; clen++) {
+      EXPECT_EQ(Hacl_NaCl_crypto_box_session_open_easy(
+                  s, m.data(), c.data(), clen, nonce.data()),
+                0xffffffff);
+    }
+    Hacl_NaCl_crypto_box_session_free(s);
+  }
+}
+
+TEST(Salsa20Vec, MatchesScalar)
+{
+  bytes key(32), nonce(8);
+  generate_random(key.data(), key.size());
+  generate_random(nonce.data(), nonce.size());
+  for (uint32_t len = 0; len <= 1100; len += 13) {
+    bytes m(len), expected(len), got(len);
+    generate_random(m.data(), len);
+    Hacl_Salsa20_salsa20_encrypt(
+      len, expected.data(), m.data(), key.data(), nonce.data(), 7);
+#ifdef HACL_CAN_COMPILE_VEC128
+    if (hacl_vec128_support()) {
+      Hacl_Salsa20_Vec128_salsa20_encrypt_128(
+        len, got.data(), m.data(), key.data(), nonce.data(), 7);
+      EXPECT_EQ(got, expected) << "vec128 len " << len;
+    }
+#endif
+#ifdef HACL_CAN_COMPILE_VEC256
+    if (hacl_vec256_support()) {
+      Hacl_Salsa20_Vec256_salsa20_encrypt_256(
+        len, got.data(), m.data(), key.data(), nonce.data(), 7);
+      EXPECT_EQ(got, expected) << "vec256 len " << len;
+    }
+#endif
+  }
+}
+
+// The block counter is the 32-bit word 8 of the state (word 9 stays zero), so
+// it wraps around to 0. Starting just below 2^32 makes the wrap happen inside a
+// vector of blocks, in a different lane for each start.
+TEST(Salsa20Vec, CounterWrap)
+{
+  bytes key(32), nonce(8);
+  generate_random(key.data(), key.size());
+  generate_random(nonce.data(), nonce.size());
+  uint32_t len = 64 * 20 + 17;
+  bytes m(len), expected(len), got(len);
+  generate_random(m.data(), len);
+  for (uint32_t back = 1; back <= 9; back++) {
+    uint32_t ctr = (uint32_t)0 - back;
+    Hacl_Salsa20_salsa20_encrypt(
+      len, expected.data(), m.data(), key.data(), nonce.data(), ctr);
+    // Block `back` is encrypted with counter 0.
+    bytes block0(64);
+    Hacl_Salsa20_salsa20_encrypt(
+      64, block0.data(), m.data() + 64 * back, key.data(), nonce.data(), 0);
+    EXPECT_EQ(bytes(expected.begin() + 64 * back,
+                    expected.begin() + 64 * back + 64),
+              block0)
+      << "ctr " << ctr;
+#ifdef HACL_CAN_COMPILE_VEC128
+    if (hacl_vec128_support()) {
+      Hacl_Salsa20_Vec128_salsa20_encrypt_128(
+        len, got.data(), m.data(), key.data(), nonce.data(), ctr);
+      EXPECT_EQ(got, expected) << "vec128 ctr " << ctr;
+    }
+#endif
+#ifdef HACL_CAN_COMPILE_VEC256
+    if (hacl_vec256_support()) {
+      Hacl_Salsa20_Vec256_salsa20_encrypt_256(
+        len, got.data(), m.data(), key.data(), nonce.data(), ctr);
+      EXPECT_EQ(got, expected) << "vec256 ctr " << ctr;
+    }
+#endif
+  }
+}
+
 INSTANTIATE_TEST_SUITE_P(
   Box,
   NaClBoxSuite,
@@ -18,6 +18,7 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 
+#include "EverCrypt_AutoConfig2.h"
 #include "Hacl_P256.h"
 #include "util.h"
 
@@ -310,6 +311,42 @@ TEST(P256Ecdsa, SignAndVerifySelfTest)
 
 //=== Failure cases ===
 
+// The ADX/BMI2 field arithmetic must produce the same keys and signatures as
+// the portable code.
+TEST(P256Ecdsa, AdxMatchesPortable)
+{
+  for (size_t i = 0; i < 16; i++) {
+    bytes sk(32), nonce(32), msg(57);
+    generate_random(sk.data(), sk.size());
+    generate_random(nonce.data(), nonce.size());
+    generate_random(msg.data(), msg.size());
+
+    bytes pk_adx(64), pk_ref(64), sig_adx(64), sig_ref(64);
+    EverCrypt_AutoConfig2_init();
+    bool ok_pk_adx = Hacl_P256_dh_initiator(pk_adx.data(), sk.data());
+    bool ok_sig_adx = Hacl_P256_ecdsa_sign_p256_sha2(
+      sig_adx.data(), msg.size(), msg.data(), sk.data(), nonce.data());
+    EverCrypt_AutoConfig2_disable_adx();
+    bool ok_pk_ref = Hacl_P256_dh_initiator(pk_ref.data(), sk.data());
+    bool ok_sig_ref = Hacl_P256_ecdsa_sign_p256_sha2(
+      sig_ref.data(), msg.size(), msg.data(), sk.data(), nonce.data());
+
+    EXPECT_EQ(ok_pk_adx, ok_pk_ref);
+    EXPECT_EQ(ok_sig_adx, ok_sig_ref);
+    EXPECT_EQ(pk_adx, pk_ref);
+    EXPECT_EQ(sig_adx, sig_ref);
+    if (ok_sig_adx) {
+      EverCrypt_AutoConfig2_init();
+      EXPECT_TRUE(Hacl_P256_ecdsa_verif_p256_sha2(msg.size(),
+                                                  msg.data(),
+                                                  pk_adx.data(),
+                                                  sig_adx.data(),
+                                                  sig_adx.data() + 32));
+    }
+  }
+  EverCrypt_AutoConfig2_init();
+}
+
 TEST(P256Ecdsa, BadKey)
 {
   // Bad secret key.
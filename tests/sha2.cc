@@ -235,6 +235,56 @@ TEST_P(Sha2KAT, TryKAT)
     EXPECT_EQ(test.md, digest) << bytes_to_hex(test.md) << endl
                                << bytes_to_hex(digest) << endl;
   }
+
+  // Streaming, with the state in caller-provided memory
+  {
+    bytes digest(test.md.size(), 0);
+    // uint64_t elements give the required alignment.
+    vector<uint64_t> mem(Hacl_Streaming_SHA2_state_size_512() / 8 + 1);
+
+    if (test.md.size() == 224 / 8 || test.md.size() == 256 / 8) {
+      bool is_224 = test.md.size() == 224 / 8;
+      Hacl_Streaming_MD_state_32* state =
+        is_224 ? Hacl_Streaming_SHA2_init_in_place_224((uint8_t*)mem.data())
+               : Hacl_Streaming_SHA2_init_in_place_256((uint8_t*)mem.data());
+      for (auto chunk : split_by_index_list(test.msg, lengths)) {
+        Hacl_Streaming_SHA2_update_256(state, chunk.data(), chunk.size());
+      }
+      if (is_224) {
+        Hacl_Streaming_SHA2_finish_224(state, digest.data());
+      } else {
+        Hacl_Streaming_SHA2_finish_256(state, digest.data());
+      }
+    } else {
+      bool is_384 = test.md.size() == 384 / 8;
+      Hacl_Streaming_MD_state_64* state =
+        is_384 ? Hacl_Streaming_SHA2_init_in_place_384((uint8_t*)mem.data())
+               : Hacl_Streaming_SHA2_init_in_place_512((uint8_t*)mem.data());
+      for (auto chunk : split_by_index_list(test.msg, lengths)) {
+        Hacl_Streaming_SHA2_update_512(state, chunk.data(), chunk.size());
+      }
+      if (is_384) {
+        Hacl_Streaming_SHA2_finish_384(state, digest.data());
+      } else {
+        Hacl_Streaming_SHA2_finish_512(state, digest.data());
+      }
+    }
+
+    EXPECT_EQ(test.md, digest) << bytes_to_hex(test.md) << endl
+                               << bytes_to_hex(digest) << endl;
+  }
+}
+
+TEST(ApiSuite, InPlaceStateSize)
+{
+  EXPECT_EQ(Hacl_Streaming_SHA2_state_size_224(),
+            Hacl_Streaming_SHA2_state_size_256());
+  EXPECT_EQ(Hacl_Streaming_SHA2_state_size_384(),
+            Hacl_Streaming_SHA2_state_size_512());
+  EXPECT_EQ(Hacl_Streaming_SHA2_state_size_256(),
+            sizeof(Hacl_Streaming_MD_state_32) + 32 + 64);
+  EXPECT_EQ(Hacl_Streaming_SHA2_state_size_512(),
+            sizeof(Hacl_Streaming_MD_state_64) + 64 + 128);
 }
 
 // ----- EverCrypt -------------------------------------------------------------
@@ -312,6 +362,109 @@ TEST_P(EverCryptSuiteTestCase, HashTest)
 
     EXPECT_EQ(test.md, got_digest);
   }
+
+  // Streaming, with the state in caller-provided memory
+  {
+    bytes got_digest(test.md.size(), 0);
+    Spec_Hash_Definitions_hash_alg alg;
+    if (test.md.size() == 224 / 8) {
+      alg = Spec_Hash_Definitions_SHA2_224;
+    } else if (test.md.size() == 256 / 8) {
+      alg = Spec_Hash_Definitions_SHA2_256;
+    } else if (test.md.size() == 384 / 8) {
+      alg = Spec_Hash_Definitions_SHA2_384;
+    } else {
+      alg = Spec_Hash_Definitions_SHA2_512;
+    }
+
+    uint32_t size = EverCrypt_Hash_Incremental_state_size(alg);
+    uint8_t* mem = (uint8_t*)KRML_ALIGNED_MALLOC(
+      EVERCRYPT_HASH_INCREMENTAL_STATE_ALIGN, size);
+    EverCrypt_Hash_Incremental_hash_state* state =
+      EverCrypt_Hash_Incremental_init_in_place(alg, mem);
+
+    for (auto chunk : split_by_index_list(test.msg, lengths)) {
+      EverCrypt_Hash_Incremental_update(state, chunk.data(), chunk.size());
+    }
+
+    EverCrypt_Hash_Incremental_finish(state, got_digest.data());
+    KRML_ALIGNED_FREE(mem);
+
+    EXPECT_EQ(test.md, got_digest);
+  }
+}
+
+// Every algorithm, including the vectorized Blake2 states, must give the same
+// digest in place as with `create_in`.
+TEST(EverCryptInPlace, MatchesCreateIn)
+{
+  vector<pair<Spec_Hash_Definitions_hash_alg, uint32_t>> algs = {
+    { Spec_Hash_Definitions_MD5, 16 },      { Spec_Hash_Definitions_SHA1, 20 },
+    { Spec_Hash_Definitions_SHA2_224, 28 }, { Spec_Hash_Definitions_SHA2_256, 32 },
+    { Spec_Hash_Definitions_SHA2_384, 48 }, { Spec_Hash_Definitions_SHA2_512, 64 },
+    { Spec_Hash_Definitions_SHA3_224, 28 }, { Spec_Hash_Definitions_SHA3_256, 32 },
+    { Spec_Hash_Definitions_SHA3_384, 48 }, { Spec_Hash_Definitions_SHA3_512, 64 },
+    { Spec_Hash_Definitions_Blake2S, 32 },  { Spec_Hash_Definitions_Blake2B, 64 },
+  };
+  bytes msg(1000);
+  generate_random(msg.data(), msg.size());
+
+  for (auto [alg, len] : algs) {
+    bytes expected(len), got(len);
+    EverCrypt_Hash_Incremental_hash_state* s =
+      EverCrypt_Hash_Incremental_create_in(alg);
+    EverCrypt_Hash_Incremental_update(s, msg.data(), 3);
+    EverCrypt_Hash_Incremental_update(s, msg.data() + 3, msg.size() - 3);
+    EverCrypt_Hash_Incremental_finish(s, expected.data());
+    EverCrypt_Hash_Incremental_free(s);
+
+    uint32_t size = EverCrypt_Hash_Incremental_state_size(alg);
+    uint8_t* mem = (uint8_t*)KRML_ALIGNED_MALLOC(
+      EVERCRYPT_HASH_INCREMENTAL_STATE_ALIGN, size);
+    // Garbage in the memory must not leak into the state.
+    memset(mem, 0xa5, size);
+    s = EverCrypt_Hash_Incremental_init_in_place(alg, mem);
+    EXPECT_EQ(EverCrypt_Hash_Incremental_alg_of_state(s), alg);
+    EverCrypt_Hash_Incremental_update(s, msg.data(), 3);
+    EverCrypt_Hash_Incremental_update(s, msg.data() + 3, msg.size() - 3);
+    EverCrypt_Hash_Incremental_finish(s, got.data());
+    EXPECT_EQ(got, expected) << "alg " << (int)alg;
+
+    // Reset and reuse the same memory.
+    EverCrypt_Hash_Incremental_init(s);
+    EverCrypt_Hash_Incremental_update(s, msg.data(), msg.size());
+    EverCrypt_Hash_Incremental_finish(s, got.data());
+    EXPECT_EQ(got, expected) << "alg " << (int)alg;
+    KRML_ALIGNED_FREE(mem);
+  }
+}
+
+// A batch gives the same digests as hashing its messages one by one.
+TEST(EverCryptBatch, HashBatch)
+{
+  vector<uint32_t> lens = { 0, 1, 64, 1000, 55, 3 };
+  uint32_t total = 0;
+  for (auto l : lens) {
+    total += l;
+  }
+  bytes input(total);
+  generate_random(input.data(), input.size());
+  bytes got(32 * lens.size()), expected(32 * lens.size());
+
+  EverCrypt_Hash_Incremental_hash_batch(Spec_Hash_Definitions_SHA2_256,
+                                        lens.size(),
+                                        got.data(),
+                                        input.data(),
+                                        lens.data());
+  uint8_t* msg = input.data();
+  for (size_t i = 0; i < lens.size(); i++) {
+    EverCrypt_Hash_Incremental_hash(Spec_Hash_Definitions_SHA2_256,
+                                    expected.data() + 32 * i,
+                                    msg,
+                                    lens[i]);
+    msg += lens[i];
+  }
+  EXPECT_EQ(got, expected);
 }
 
 // -----------------------------------------------------------------------------
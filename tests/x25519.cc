@@ -13,6 +13,7 @@
 #include "EverCrypt_AutoConfig2.h"
 #include "EverCrypt_Curve25519.h"
 #include "Hacl_Curve25519_51.h"
+#include "Hacl_Curve25519_Vec256.h"
 #include "config.h"
 #include "curve25519_vectors.h"
 #include "evercrypt.h"
@@ -61,6 +62,92 @@ TEST(x25519Test, HaclTest)
   }
 }
 
+#ifdef HACL_CAN_COMPILE_VEC256
+TEST(x25519Test, Vec256Test)
+{
+  hacl_init_cpu_features();
+
+  if (!hacl_vec256_support()) {
+    printf(" ! Vec256 was compiled but it is not available on this CPU.\n");
+    return;
+  }
+
+  // Each lane of the 4-way ladder gets a different test vector so that a
+  // lane mix-up shows up as a wrong result.
+  size_t num_vectors = sizeof(vectors) / sizeof(curve25519_test_vector);
+  uint8_t priv[4 * 32], pub[4 * 32], comp[4 * 32];
+  for (size_t i = 0; i < num_vectors; ++i) {
+    for (size_t j = 0; j < 4; ++j) {
+      const curve25519_test_vector* v = &vectors[(i + j) % num_vectors];
+      memcpy(priv + 32 * j, v->scalar, 32);
+      memcpy(pub + 32 * j, v->public_key, 32);
+    }
+
+    bool valid[4] = { false };
+    bool res = Hacl_Curve25519_Vec256_ecdh4(comp, priv, pub, valid);
+    EXPECT_TRUE(res);
+    for (size_t j = 0; j < 4; ++j) {
+      EXPECT_TRUE(valid[j]);
+      EXPECT_TRUE(compare_and_print(
+        32, comp + 32 * j, vectors[(i + j) % num_vectors].secret));
+    }
+  }
+
+  // Random keys, checked against the portable implementation.
+  for (size_t i = 0; i < 16; ++i) {
+    generate_random(priv, 4 * 32);
+    generate_random(pub, 4 * 32);
+
+    Hacl_Curve25519_Vec256_scalarmult4(comp, priv, pub);
+    for (size_t j = 0; j < 4; ++j) {
+      uint8_t expected[32];
+      Hacl_Curve25519_51_scalarmult(expected, priv + 32 * j, pub + 32 * j);
+      EXPECT_TRUE(compare_and_print(32, comp + 32 * j, expected));
+    }
+
+    Hacl_Curve25519_Vec256_secret_to_public4(comp, priv);
+    for (size_t j = 0; j < 4; ++j) {
+      uint8_t expected[32];
+      Hacl_Curve25519_51_secret_to_public(expected, priv + 32 * j);
+      EXPECT_TRUE(compare_and_print(32, comp + 32 * j, expected));
+    }
+  }
+}
+#endif // HACL_CAN_COMPILE_VEC256
+
+TEST(x25519Test, EverCryptBatchTest)
+{
+  hacl_init_cpu_features();
+  EverCrypt_AutoConfig2_init();
+
+  // Seven exchanges: one full group of four and a remainder of three.
+  const uint32_t len = 7;
+  uint8_t priv[len * 32], pub[len * 32], shared[len * 32];
+  bool valid[len];
+  generate_random(priv, len * 32);
+  generate_random(pub, len * 32);
+  // A low-order point (zero) makes an exchange fail, both in the group of
+  // four and in the remainder.
+  memset(pub + 32 * 2, 0, 32);
+  memset(pub + 32 * 5, 0, 32);
+
+  bool res = EverCrypt_Curve25519_ecdh_batch(len, shared, priv, pub, valid);
+  EXPECT_FALSE(res);
+  for (uint32_t i = 0; i < len; ++i) {
+    uint8_t expected[32];
+    bool expected_valid =
+      Hacl_Curve25519_51_ecdh(expected, priv + 32 * i, pub + 32 * i);
+    EXPECT_EQ(expected_valid, valid[i]);
+    EXPECT_TRUE(compare_and_print(32, shared + 32 * i, expected));
+  }
+  EXPECT_FALSE(valid[2]);
+  EXPECT_FALSE(valid[5]);
+
+  uint8_t shared4[4 * 32];
+  EverCrypt_Curve25519_scalarmult_4x(shared4, priv, pub);
+  EXPECT_TRUE(compare_and_print(4 * 32, shared4, shared));
+}
+
 // -----------------------------------------------------------------------------
 
 TEST(ApiSuite, ApiTest)
@@ -1,8 +1,12 @@
+import datetime
 import json
+import math
 import os
 from pathlib import Path
+import platform
 import subprocess
 import sys
+import tempfile
 from tools.utils import (
     binary_path,
     cli,
@@ -13,6 +17,29 @@ from tools.utils import (
 )
 
 
+# The size sweep runs for several minutes, so it only runs on request (`--sweep`).
+SWEEP = "sweep"
+SWEEP_JSON = "sweep_benchmark.json"
+
+# Comparison with other libraries.
+MATRIX = "matrix"
+MATRIX_JSON = "matrix_benchmark.json"
+MATRIX_REPORT = "matrix_benchmark.md"
+MATRIX_LIBRARIES = ["hacl", "openssl", "libsodium"]
+
+# Regression runs: stored baselines and the suites they skip by default.
+BASELINE_DIR = os.path.join("benchmarks", "baselines")
+REGRESSION_JSON = "regression_benchmark.json"
+REGRESSION_SKIP = [SWEEP, "threads", MATRIX]
+
+
+def benchmark_binary(file_name):
+    file_name += "_benchmark"
+    if sys.platform == "win32":
+        file_name += ".exe"
+    return file_name
+
+
 def run_benchmarks(benchmarks, bin_path):
     print("Running benchmarks ...")
     if not os.path.exists(binary_path(bin_path)):
@@ -22,12 +49,11 @@ def run_benchmarks(benchmarks, bin_path):
     os.chdir(binary_path(bin_path))
 
     for algorithm in benchmarks:
+        if algorithm == SWEEP:
+            continue
         for benchmark in benchmarks[algorithm]:
 
-            file_name = Path(benchmark).stem
-            file_name += "_benchmark"
-            if sys.platform == "win32":
-                file_name += ".exe"
+            file_name = benchmark_binary(Path(benchmark).stem)
             if not os.path.exists(file_name):
                 print("! Benchmark '%s' doesn't exist. Aborting!" % (file_name))
                 print("   Running this benchmark requires a build first.")
@@ -53,6 +79,8 @@ def compare_benchmarks(benchmarks, path_new, path_old):
     compare = "./build/benchmark-src/tools/compare.py"
 
     for algorithm in benchmarks:
+        if algorithm == SWEEP:
+            continue
         for benchmark in benchmarks[algorithm]:
 
             file_name = Path(benchmark).stem
@@ -108,12 +136,467 @@ def compare_benchmarks(benchmarks, path_new, path_old):
         exit(1)
 
 
+def run_sweep(bin_path, benchmark_filter=None):
+    """Run the size sweep and write its JSON results into the build directory."""
+    print("Running the size sweep ...")
+    return run_to_json(bin_path, SWEEP, SWEEP_JSON, benchmark_filter)
+
+
+def run_to_json(bin_path, suite, json_name, benchmark_filter=None):
+    """Run one suite and write its JSON results into the build directory."""
+    binary = os.path.join(bin_path, benchmark_binary(suite))
+    if not os.path.exists(binary):
+        print("! Benchmark '%s' doesn't exist. Aborting!" % (binary))
+        print("   See mach build --release --benchmarks")
+        exit(1)
+    out_path = os.path.join(bin_path, json_name)
+    cmd = [
+        binary,
+        "--benchmark_out=" + out_path,
+        "--benchmark_out_format=json",
+    ]
+    if benchmark_filter:
+        cmd.append("--benchmark_filter=" + benchmark_filter)
+    print(" ".join(cmd))
+    subprocess.run(cmd, check=True)
+    return out_path
+
+
+def load_sweep(path):
+    """Map `kind/primitive/implementation` to {size: cycles per byte}."""
+    with open(path) as f:
+        data = json.load(f)
+    results = {}
+    for b in data["benchmarks"]:
+        if b.get("error_occurred") or "cycles_per_byte" not in b:
+            continue
+        name, size = b["name"].rsplit("/", 1)
+        results.setdefault(name, {})[int(size)] = b["cycles_per_byte"]
+    return results
+
+
+def format_size(size):
+    for unit in ["B", "KiB", "MiB"]:
+        if size < 1024:
+            return "%d %s" % (size, unit)
+        size //= 1024
+    return "%d GiB" % size
+
+
+def report_sweep(results):
+    """For each primitive and size, list the fastest implementation."""
+    primitives = {}
+    for name, sizes in results.items():
+        primitive, implementation = name.rsplit("/", 1)
+        for size, cpb in sizes.items():
+            primitives.setdefault(primitive, {}).setdefault(size, []).append(
+                (cpb, implementation)
+            )
+    for primitive in sorted(primitives):
+        print(primitive)
+        for size in sorted(primitives[primitive]):
+            ranking = sorted(primitives[primitive][size])
+            print(
+                "  {:>8}  {:28} {:8.2f} c/B".format(
+                    format_size(size), ranking[0][1], ranking[0][0]
+                ),
+                end="",
+            )
+            if len(ranking) > 1:
+                print("  (next: {} {:.2f})".format(ranking[1][1], ranking[1][0]), end="")
+            print()
+
+
+def compare_sweep(path_new, path_old, threshold):
+    """Compare cycles per byte of two sweeps; fail above `threshold`."""
+    new = load_sweep(path_new)
+    old = load_sweep(path_old)
+    fail = False
+    for name in sorted(new):
+        if name not in old:
+            print("- {:44} (new)".format(name))
+            continue
+        for size in sorted(new[name]):
+            if size not in old[name]:
+                continue
+            change = new[name][size] / old[name][size] - 1
+            flag = ""
+            if change > threshold:
+                flag = "  !"
+                fail = True
+            print(
+                "- {:44} {:>8} {:8.2f} -> {:8.2f} c/B {:+0.2f}{}".format(
+                    name,
+                    format_size(size),
+                    old[name][size],
+                    new[name][size],
+                    change,
+                    flag,
+                )
+            )
+    if fail:
+        print("! Threshold exceeded!")
+        exit(1)
+
+
+def format_time(ns):
+    for unit, scale in [("ns", 1), ("us", 1e3), ("ms", 1e6)]:
+        if ns < 1000 * scale:
+            return "%.4g %s" % (ns / scale, unit)
+    return "%.4g s" % (ns / 1e9)
+
+
+def load_matrix(path):
+    """Map (primitive, size) to {library: time in ns or error message}."""
+    scale = {"ns": 1, "us": 1e3, "ms": 1e6, "s": 1e9}
+    with open(path) as f:
+        data = json.load(f)
+    results = {}
+    for b in data["benchmarks"]:
+        if b.get("run_type", "iteration") != "iteration":
+            continue
+        parts = b["run_name"].split("/")
+        primitive, library = parts[0], parts[1]
+        size = int(parts[2]) if len(parts) > 2 else None
+        if b.get("error_occurred"):
+            value = b.get("error_message", "error")
+        else:
+            value = b["cpu_time"] * scale[b.get("time_unit", "ns")]
+        results.setdefault((primitive, size), {})[library] = value
+    return results
+
+
+def report_matrix(results):
+    """Markdown table with one row per primitive and size and one column per
+    library. Times of other libraries are followed by their ratio to HACL,
+    i.e. above 1 HACL is faster; the fastest library is in bold."""
+    libraries = [l for l in MATRIX_LIBRARIES if any(l in r for r in results.values())]
+    libraries += sorted(
+        set(l for r in results.values() for l in r) - set(MATRIX_LIBRARIES)
+    )
+    lines = [
+        "| Primitive | Size | " + " | ".join(libraries) + " |",
+        "|---|---:|" + "---:|" * len(libraries),
+    ]
+    for primitive, size in results:
+        row = results[(primitive, size)]
+        times = {l: t for l, t in row.items() if not isinstance(t, str)}
+        fastest = min(times, key=times.get) if times else None
+        hacl = times.get("hacl")
+        cells = []
+        for library in libraries:
+            value = row.get(library)
+            if value is None:
+                cells.append("")
+                continue
+            if isinstance(value, str):
+                cells.append(value)
+                continue
+            cell = format_time(value)
+            if library != "hacl" and hacl:
+                cell += " (%.2fx)" % (value / hacl)
+            if library == fastest and len(times) > 1:
+                cell = "**%s**" % cell
+            cells.append(cell)
+        lines.append(
+            "| %s | %s | %s |"
+            % (primitive, format_size(size) if size is not None else "", " | ".join(cells))
+        )
+    return "\n".join(lines) + "\n"
+
+
+def matrix(bin_path, benchmark_filter):
+    print("Comparing with other libraries ...")
+    path = run_to_json(bin_path, MATRIX, MATRIX_JSON, benchmark_filter)
+    report = report_matrix(load_matrix(path))
+    report_path = os.path.join(bin_path, MATRIX_REPORT)
+    with open(report_path, "w") as f:
+        f.write(report)
+    for line in report.splitlines():
+        print(line)
+    print("Written to %s." % report_path)
+
+
+# Two-sided 95% quantiles of Student's t distribution, by degrees of freedom.
+T_95 = [
+    12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+    2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+    2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042,
+]
+
+
+def t_95(df):
+    if df < 1:
+        return T_95[0]
+    if df > len(T_95):
+        return 1.96
+    return T_95[int(df) - 1]
+
+
+def mean_var(samples):
+    n = len(samples)
+    mean = sum(samples) / n
+    var = sum((x - mean) ** 2 for x in samples) / (n - 1) if n > 1 else 0.0
+    return mean, var
+
+
+def relative_change(new, old):
+    """Relative change of the mean of `new` over `old` and its 95% confidence
+    interval (Welch)."""
+    m1, v1 = mean_var(new)
+    m0, v0 = mean_var(old)
+    change = m1 / m0 - 1
+    se2 = v1 / len(new) + v0 / len(old)
+    if se2 == 0:
+        return change, change, change
+    # Welch-Satterthwaite degrees of freedom.
+    terms = [
+        (v / n) ** 2 / (n - 1) for v, n in [(v1, len(new)), (v0, len(old))] if n > 1
+    ]
+    df = se2**2 / sum(terms) if sum(terms) > 0 else 1
+    half = t_95(df) * math.sqrt(se2) / m0
+    return change, change - half, change + half
+
+
+def pin_cpu(cpu):
+    """Return a preexec function that pins the child process to `cpu`."""
+    if cpu is None:
+        return None
+    if not hasattr(os, "sched_setaffinity"):
+        print("! CPU pinning is not supported on this platform, ignoring --pin.")
+        return None
+    return lambda: os.sched_setaffinity(0, {cpu})
+
+
+def run_suite(binary, repetitions, cpu, benchmark_filter=None):
+    """Run one benchmark binary and return {name: [time per repetition in ns]}.
+
+    Repetitions are interleaved at random so that slow drift of the machine
+    spreads over all benchmarks instead of biasing one of them.
+    """
+    with tempfile.TemporaryDirectory() as tmp:
+        out_path = os.path.join(tmp, "out.json")
+        cmd = [
+            binary,
+            "--benchmark_out=" + out_path,
+            "--benchmark_out_format=json",
+            "--benchmark_repetitions=%d" % repetitions,
+            "--benchmark_enable_random_interleaving=true",
+            "--benchmark_display_aggregates_only=true",
+        ]
+        if benchmark_filter:
+            cmd.append("--benchmark_filter=" + benchmark_filter)
+        print(" ".join(cmd))
+        subprocess.run(cmd, check=True, preexec_fn=pin_cpu(cpu))
+        # Nothing is written if the filter matches no benchmark.
+        if not os.path.exists(out_path) or os.path.getsize(out_path) == 0:
+            return {}, {}
+        with open(out_path) as f:
+            data = json.load(f)
+
+    scale = {"ns": 1, "us": 1e3, "ms": 1e6, "s": 1e9}
+    results = {}
+    for b in data["benchmarks"]:
+        if b.get("run_type") != "iteration" or b.get("error_occurred"):
+            continue
+        # Benchmarks that measure wall-clock time are compared on it.
+        time = b["real_time"] if "/real_time" in b["run_name"] else b["cpu_time"]
+        results.setdefault(b["run_name"], []).append(
+            time * scale[b.get("time_unit", "ns")]
+        )
+    return data.get("context", {}), results
+
+
+def run_regression(benchmarks, bin_path, repetitions, cpu, suites, benchmark_filter):
+    """Run the suites and return the results in the baseline format."""
+    if not os.path.exists(bin_path):
+        print("! Nothing is built! Please build first: `./mach build --release --benchmarks`.")
+        exit(1)
+    results = {}
+    context = {}
+    for algorithm in benchmarks:
+        if (suites and algorithm not in suites) or (
+            not suites and algorithm in REGRESSION_SKIP
+        ):
+            continue
+        for benchmark in benchmarks[algorithm]:
+            suite = Path(benchmark).stem
+            binary = os.path.join(bin_path, benchmark_binary(suite))
+            if not os.path.exists(binary):
+                print("! Benchmark '%s' doesn't exist, skipping." % binary)
+                continue
+            context, samples = run_suite(binary, repetitions, cpu, benchmark_filter)
+            for name, times in samples.items():
+                results[suite + "/" + name] = times
+    try:
+        revision = subprocess.run(
+            ["git", "rev-parse", "HEAD"], capture_output=True, text=True
+        ).stdout.strip()
+    except OSError:
+        revision = ""
+    return {
+        "context": {
+            "date": datetime.datetime.now().isoformat(timespec="seconds"),
+            "revision": revision,
+            "host": platform.node(),
+            "machine": platform.machine(),
+            "num_cpus": context.get("num_cpus"),
+            "mhz_per_cpu": context.get("mhz_per_cpu"),
+            "library_build_type": context.get("library_build_type"),
+            "repetitions": repetitions,
+            "pinned_cpu": cpu,
+        },
+        "results": results,
+    }
+
+
+def baseline_path(name):
+    return os.path.join(BASELINE_DIR, name + ".json")
+
+
+def compare_regression(new, old, threshold):
+    """Compare two result sets; return True if anything regressed.
+
+    A benchmark regresses when its mean time grew by more than `threshold`
+    and the whole 95% confidence interval of the change lies above zero, so
+    that noise alone does not fail the run.
+    """
+    for key in ["host", "machine", "mhz_per_cpu", "library_build_type"]:
+        if new["context"].get(key) != old["context"].get(key):
+            print(
+                "! Baseline %s differs: %s (baseline) vs %s."
+                % (key, old["context"].get(key), new["context"].get(key))
+            )
+    regressed = []
+    improved = 0
+    for name in sorted(new["results"]):
+        if name not in old["results"]:
+            print("- {:60} (new)".format(name))
+            continue
+        samples_new = new["results"][name]
+        samples_old = old["results"][name]
+        change, low, high = relative_change(samples_new, samples_old)
+        flag = ""
+        if change > threshold and low > 0:
+            flag = "  ! regression"
+            regressed.append(name)
+        elif change < -threshold and high < 0:
+            flag = "  improvement"
+            improved += 1
+        print(
+            "- {:60} {:+7.1%} [{:+7.1%}, {:+7.1%}]{}".format(
+                name, change, low, high, flag
+            )
+        )
+    for name in sorted(set(old["results"]) - set(new["results"])):
+        print("- {:60} (missing)".format(name))
+    print(
+        "%d benchmarks, %d regressions and %d improvements beyond %.1f%%."
+        % (len(new["results"]), len(regressed), improved, threshold * 100)
+    )
+    return len(regressed) > 0
+
+
+def regression(args, config):
+    bin_path = binary_path("Release")
+    suites = args.suites.split(",") if args.suites else None
+    path = baseline_path(args.baseline)
+    new = run_regression(
+        config["benchmarks"],
+        bin_path,
+        args.repetitions,
+        args.pin,
+        suites,
+        args.filter,
+    )
+    with open(os.path.join(bin_path, REGRESSION_JSON), "w") as f:
+        json.dump(new, f, indent=1)
+
+    if args.save_baseline:
+        os.makedirs(BASELINE_DIR, exist_ok=True)
+        with open(path, "w") as f:
+            json.dump(new, f, indent=1)
+            f.write("\n")
+        print("Stored %d results in %s." % (len(new["results"]), path))
+        return
+    if not os.path.exists(path):
+        print("! No baseline '%s'. Create one with --save-baseline. Aborting!" % path)
+        exit(1)
+    with open(path) as f:
+        old = json.load(f)
+    if compare_regression(new, old, args.threshold / 100):
+        print("! Threshold exceeded!")
+        exit(1)
+
+
 @subcommand(
     [
         argument(
             "-v", "--verbose", help="Make benchmarks verbose.", action="store_true"
         ),
         argument("--compare", help="Compare against an older revision.", type=str),
+        argument(
+            "--sweep",
+            help="Run the cycles/byte size sweep over all hash, MAC and AEAD\n"
+            "implementations and print the fastest one per size. With\n"
+            "--compare, compare against the sweep of the older revision.",
+            action="store_true",
+        ),
+        argument(
+            "--filter",
+            help="Only run sweep, matrix or regression benchmarks matching this\n"
+            "regex, e.g. 'aead/'.",
+            type=str,
+        ),
+        argument(
+            "--matrix",
+            help="Compare against OpenSSL and libsodium (see `mach build\n"
+            "--libsodium`) and write one table for all primitives.",
+            action="store_true",
+        ),
+        argument(
+            "--regression",
+            help="Run the suites several times and compare them against the\n"
+            "stored baseline in benchmarks/baselines. Exits with an error if a\n"
+            "benchmark is significantly slower by more than --threshold.",
+            action="store_true",
+        ),
+        argument(
+            "--save-baseline",
+            help="With --regression, store the results as the new baseline\n"
+            "instead of comparing.",
+            action="store_true",
+        ),
+        argument(
+            "--baseline",
+            help="Name of the baseline in benchmarks/baselines (default: the\n"
+            "machine type, e.g. 'x86_64').",
+            type=str,
+            default=platform.machine().lower(),
+        ),
+        argument(
+            "--repetitions",
+            help="Repetitions of every benchmark (default: 10).",
+            type=int,
+            default=10,
+        ),
+        argument(
+            "--threshold",
+            help="Regression threshold in percent (default: 5).",
+            type=float,
+            default=5.0,
+        ),
+        argument(
+            "--pin",
+            help="Pin the benchmarks to this CPU (Linux).",
+            type=int,
+        ),
+        argument(
+            "--suites",
+            help="Comma-separated suites to run, e.g. 'sha2,blake2'. By default\n"
+            "all suites except %s." % ", ".join(REGRESSION_SKIP),
+            type=str,
+        ),
     ]
 )
 def benchmark(args):
@@ -126,7 +609,21 @@ def benchmark(args):
     # parse file
     config = json.loads(data)
 
-    if args.compare:
+    if args.regression:
+        regression(args, config)
+    elif args.matrix:
+        matrix(binary_path("Release"), args.filter)
+    elif args.sweep:
+        bin_path = binary_path("Release")
+        if args.compare:
+            path_old = os.path.join(args.compare, bin_path, SWEEP_JSON)
+            if not os.path.exists(path_old):
+                print("! '%s' doesn't exist. Run the sweep there first. Aborting!" % path_old)
+                exit(1)
+            compare_sweep(run_sweep(bin_path, args.filter), path_old, 0.2)
+        else:
+            report_sweep(load_sweep(run_sweep(bin_path, args.filter)))
+    elif args.compare:
         compare_benchmarks(
             config["benchmarks"],
             binary_path("Release"),
@@ -202,6 +202,22 @@ class Config:
                     if file not in self.hacl_compile_feature["std"]
                 ]
 
+        # Files that are listed with a feature in the config are only compiled
+        # with that feature, even when files of another feature depend on them.
+        file_features = {}
+        for a in self.hacl_files:
+            for source_file in self.hacl_files[a]:
+                file_features[join(source_dir, source_file["file"])] = source_file[
+                    "features"
+                ].replace(",", "_")
+        for feature in self.hacl_compile_feature:
+            if feature != "std":
+                self.hacl_compile_feature[feature] = [
+                    file
+                    for file in self.hacl_compile_feature[feature]
+                    if file_features.get(file, feature) == feature
+                ]
+
         # Flatten test sources
         self.test_sources = [
             f for files in [self.tests[b] for b in self.tests] for f in files
@@ -11,6 +11,29 @@ import shutil
 from os.path import join as path_join
 from os.path import exists as path_exists
 
+# KaRaMeL only emits scalar WebAssembly. The 128-bit vectorized implementations
+# are compiled from their C code with clang into position-independent side
+# modules `simd/<module>.wasm`, which `api.js` links into the KaRaMeL memory
+# and prefers when the engine supports SIMD128.
+simd_modules = {
+    "Hacl_Chacha20Poly1305_128": {
+        "sources": [
+            "Hacl_Chacha20Poly1305_128.c",
+            "Hacl_Chacha20_Vec128.c",
+            "Hacl_Poly1305_128.c",
+            "Hacl_Chacha20.c",
+        ],
+        "exports": [
+            "Hacl_Chacha20Poly1305_128_aead_encrypt",
+            "Hacl_Chacha20Poly1305_128_aead_decrypt",
+        ],
+    },
+    "Hacl_Hash_Blake2s_128": {
+        "sources": ["Hacl_Hash_Blake2s_128.c", "Lib_Memzero0.c"],
+        "exports": ["Hacl_Blake2s_128_blake2s"],
+    },
+}
+
 
 def build_js():
     """Build the JS bindings."""
@@ -24,6 +47,50 @@ def build_js():
     shutil.copytree(src_path, dest_path)
     shutil.copytree(bindings_path, dest_path, dirs_exist_ok=True)
 
+    build_js_simd(cwd, path_join(dest_path, "simd"))
+
+
+def build_js_simd(cwd, dest_path):
+    """Build the SIMD128 side modules with the wasi-sdk in `WASI_SDK_PATH`."""
+
+    wasi_sdk = os.getenv("WASI_SDK_PATH")
+    if wasi_sdk is None:
+        print(
+            "! WASI_SDK_PATH is not set, skipping the SIMD modules. The JS bindings will only use the scalar code."
+        )
+        return
+
+    os.makedirs(dest_path, exist_ok=True)
+    include_paths = [
+        path_join(cwd, "include"),
+        path_join(cwd, "karamel", "include"),
+        path_join(cwd, "karamel", "krmllib", "dist", "minimal"),
+    ]
+    for name, module in simd_modules.items():
+        cmd = [
+            path_join(wasi_sdk, "bin", "clang"),
+            "--target=wasm32-wasi",
+            "--sysroot=" + path_join(wasi_sdk, "share", "wasi-sysroot"),
+            "-O3",
+            "-msimd128",
+            "-mbulk-memory",
+            "-DHACL_CAN_COMPILE_VEC128",
+            # There is no libc to print to or exit from, so failing checks trap.
+            "-DKRML_HOST_EPRINTF(...)=0",
+            "-DKRML_HOST_EXIT(x)=__builtin_trap()",
+            "-fPIC",
+            "-fvisibility=hidden",
+            "-nostdlib",
+            "-Wl,--no-entry",
+            "-Wl,--experimental-pic",
+            "-Wl,-shared",
+        ]
+        cmd += ["-I" + p for p in include_paths]
+        cmd += ["-Wl,--export=" + f for f in module["exports"]]
+        cmd += [path_join(cwd, "src", f) for f in module["sources"]]
+        cmd += ["-o", path_join(dest_path, name + ".wasm")]
+        subprocess.run(cmd, check=True)
+
 
 def test_js():
     """Test the JS bindings."""
@@ -42,7 +109,13 @@ def test_js():
     test1_cmd = ["node", "api_test.js"]
     test2_cmd = ["node", "test2.js"]
     test3_cmd = ["node", "test3.js"]
+    test4_cmd = ["node", "test4.js"]
 
     subprocess.run(test1_cmd, check=True)
     subprocess.run(test2_cmd, check=True)
     subprocess.run(test3_cmd, check=True)
+    subprocess.run(test4_cmd, check=True)
+
+    # Only meaningful when the SIMD side modules were built.
+    if path_exists("simd"):
+        subprocess.run(["node", "simd_test.js"], check=True)
@@ -126,6 +126,18 @@ check_avx512 proc
   ret
 check_avx512 endp
 ALIGN 16
+check_avx512ifma proc
+  mov r9, rbx
+  mov rax, 7
+  mov rcx, 0
+  cpuid
+  mov rax, rbx
+  and rax, 2097152
+  shr rax, 21
+  mov rbx, r9
+  ret
+check_avx512ifma endp
+ALIGN 16
 check_osxsave proc
   mov r9, rbx
   mov rcx, 0